@@ -0,0 +1,127 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "animationtrack.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    typedef SMath::Vector<float, 3> Vector3f;
+    typedef SMath::Quaternion<float> Quaternionf;
+
+    // A 10k-track clip: 4 seconds at 30 keys per second, played back at 60 frames per second
+    constexpr int TrackCount = 10000;
+    constexpr int KeyCount = 121;
+    constexpr int FrameCount = 240;
+    constexpr float FrameTime = 1.0f / 60.0f;
+
+    SMath::AnimationClip<float> MakeClip(SMath::TrackInterpolation interpolation)
+    {
+        std::vector<float> u(size_t(TrackCount) * KeyCount * 4);
+        SMath::Batch::FillUniform(std::span<float>(u), 61, -1.0f, 1.0f);
+
+        std::vector<float> times(KeyCount);
+        for (int k = 0; k < KeyCount; ++k)
+            times[k] = k / 30.0f;
+
+        std::vector<SMath::VectorTrack<float>> vectorTracks;
+        std::vector<SMath::RotationTrack<float>> rotationTracks;
+        for (int i = 0; i < TrackCount / 2; ++i)
+        {
+            std::vector<Vector3f> values(KeyCount);
+            std::vector<Quaternionf> rotations(KeyCount);
+            for (int k = 0; k < KeyCount; ++k)
+            {
+                const float* r = &u[(size_t(i) * KeyCount + k) * 4];
+                values[k] = Vector3f(r[0], r[1], r[2]);
+                rotations[k] = Quaternionf(r[0], r[1], r[2], r[3] + 2.0f).Normalized();
+            }
+            vectorTracks.emplace_back(times, values, interpolation == SMath::TrackInterpolation::Squad
+                                                         ? SMath::TrackInterpolation::Linear : interpolation);
+            rotationTracks.emplace_back(times, rotations, interpolation);
+        }
+        return SMath::AnimationClip<float>(std::move(vectorTracks), std::move(rotationTracks));
+    }
+}
+
+BENCHMARK(AnimationTrack)
+{
+    std::vector<SMath::TrackCursor> cursors(TrackCount);
+    std::vector<Vector3f> vectors(TrackCount / 2);
+    std::vector<Quaternionf> rotations(TrackCount / 2);
+
+    const char* labels[] = { "Clip sample, linear (tracks)", "Clip sample, cubic Hermite (tracks)", "Clip sample, squad (tracks)" };
+    for (int i = 0; i < 3; ++i)
+    {
+        SMath::AnimationClip<float> clip = MakeClip(SMath::TrackInterpolation(i));
+        double t = SMath::Bench::Measure([&]() {
+            for (int frame = 0; frame < FrameCount; ++frame)
+                clip.Sample(frame * FrameTime, cursors, vectors, rotations, 1);
+            SMath::Bench::DoNotOptimize(rotations);
+        });
+        SMath::Bench::Report(labels[i], t, size_t(TrackCount) * FrameCount);
+    }
+
+    // The same linear playback searching for the key every frame instead of using the cursors
+    SMath::AnimationClip<float> clip = MakeClip(SMath::TrackInterpolation::Linear);
+    double t = SMath::Bench::Measure([&]() {
+        for (int frame = 0; frame < FrameCount; ++frame)
+        {
+            float time = frame * FrameTime;
+            for (size_t i = 0; i < vectors.size(); ++i)
+                vectors[i] = clip.m_VectorTracks[i].Sample(time);
+            for (size_t i = 0; i < rotations.size(); ++i)
+                rotations[i] = clip.m_RotationTracks[i].Sample(time);
+        }
+        SMath::Bench::DoNotOptimize(rotations);
+    });
+    SMath::Bench::Report("Linear, binary search per sample (tracks)", t, size_t(TrackCount) * FrameCount);
+
+    // Hand-written loop over the keys with the exact slerp, for reference
+    t = SMath::Bench::Measure([&]() {
+        for (int frame = 0; frame < FrameCount; ++frame)
+        {
+            float time = frame * FrameTime;
+            for (size_t i = 0; i < rotations.size(); ++i)
+            {
+                const SMath::RotationTrack<float>& track = clip.m_RotationTracks[i];
+                size_t k = std::upper_bound(track.m_Times.begin(), track.m_Times.end(), time) - track.m_Times.begin();
+                k = std::clamp<size_t>(k, 1, track.m_Times.size() - 1) - 1;
+                float s = (time - track.m_Times[k]) / (track.m_Times[k + 1] - track.m_Times[k]);
+                rotations[i] = Quaternionf::Slerp(track.m_Values[k], track.m_Values[k + 1], s);
+            }
+        }
+        SMath::Bench::DoNotOptimize(rotations);
+    });
+    SMath::Bench::Report("Rotations, upper_bound + Slerp (tracks)", t, size_t(TrackCount / 2) * FrameCount);
+
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        t = SMath::Bench::Measure([&]() {
+            for (int frame = 0; frame < FrameCount; ++frame)
+                clip.Sample(frame * FrameTime, cursors, vectors, rotations);
+            SMath::Bench::DoNotOptimize(rotations);
+        });
+        SMath::Bench::Report("Clip sample, linear, all threads (tracks)", t, size_t(TrackCount) * FrameCount);
+    }
+}
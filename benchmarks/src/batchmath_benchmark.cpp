@@ -0,0 +1,104 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "batchmath.h"
+#include "random.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 20;
+
+    std::vector<float> RandomFloats(float lo, float hi)
+    {
+        std::vector<float> v(Count);
+        for (auto& vi : v)
+            vi = lo + (hi - lo) * float(SMath::Random::UniformFloat());
+        return v;
+    }
+
+    template <typename Exact, typename Batch>
+    void Run(const char* name, const std::vector<float>& in, Exact exact, Batch batch)
+    {
+        std::vector<float> out(Count);
+        std::printf("  %s\n", name);
+
+        double t = SMath::Bench::Measure([&]() {
+            for (int i = 0; i < Count; ++i)
+                out[i] = exact(in[i]);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("std:: loop", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            batch(std::span<const float>(in), std::span<float>(out));
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("SMath::Batch", t, Count);
+    }
+}
+
+BENCHMARK(BatchMath)
+{
+    std::printf("  dispatching to %s\n", SMath::Simd::GetLevelName(SMath::Simd::GetLevel()));
+
+    auto angles = RandomFloats(-100.0f, 100.0f);
+    auto exponents = RandomFloats(-80.0f, 80.0f);
+    auto positive = RandomFloats(1e-6f, 1e6f);
+    auto bases = RandomFloats(0.0f, 100.0f);
+    auto powers = RandomFloats(-4.0f, 4.0f);
+
+    Run("sin", angles, [](float x) { return std::sin(x); }, SMath::Batch::Sin);
+    Run("cos", angles, [](float x) { return std::cos(x); }, SMath::Batch::Cos);
+    Run("exp", exponents, [](float x) { return std::exp(x); }, SMath::Batch::Exp);
+    Run("log", positive, [](float x) { return std::log(x); }, SMath::Batch::Log);
+
+    std::vector<float> out(Count);
+    std::printf("  pow\n");
+
+    double t = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < Count; ++i)
+            out[i] = std::pow(bases[i], powers[i]);
+        SMath::Bench::DoNotOptimize(out);
+    });
+    SMath::Bench::Report("std:: loop", t, Count);
+
+    t = SMath::Bench::Measure([&]() {
+        SMath::Batch::Pow(std::span<const float>(bases), std::span<const float>(powers), std::span<float>(out));
+        SMath::Bench::DoNotOptimize(out);
+    });
+    SMath::Bench::Report("SMath::Batch", t, Count);
+
+    t = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < Count; ++i)
+            out[i] = std::pow(bases[i], 1.0f / 2.2f);
+        SMath::Bench::DoNotOptimize(out);
+    });
+    SMath::Bench::Report("std:: loop, gamma 1/2.2", t, Count);
+
+    t = SMath::Bench::Measure([&]() {
+        SMath::Batch::Pow(std::span<const float>(bases), 1.0f / 2.2f, std::span<float>(out));
+        SMath::Bench::DoNotOptimize(out);
+    });
+    SMath::Bench::Report("SMath::Batch, gamma 1/2.2", t, Count);
+}
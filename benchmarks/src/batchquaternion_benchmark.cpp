@@ -0,0 +1,112 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "batchquaternion.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Quaternion<float> Quaternionf;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    constexpr int Count = 1 << 20;
+}
+
+BENCHMARK(BatchQuaternion)
+{
+    std::vector<float> u(Count * 11);
+    SMath::Batch::FillUniform(std::span<float>(u), 97, -1.0f, 1.0f);
+
+    std::vector<Quaternionf> a(Count), b(Count), out(Count);
+    std::vector<Vector3f> v(Count), rotated(Count);
+    std::vector<float> t(Count);
+    for (int i = 0; i < Count; ++i)
+    {
+        const float* r = &u[i * 11];
+        a[i] = Quaternionf(r[0], r[1], r[2], r[3]).Normalized();
+        b[i] = Quaternionf(r[4], r[5], r[6], r[7]).Normalized();
+        v[i] = Vector3f(r[8], r[9], r[10]);
+        t[i] = r[0] * 0.5f + 0.5f;
+    }
+
+    // The per-element member functions, for reference
+    double s = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < Count; ++i)
+            out[i] = Quaternionf::Slerp(a[i], b[i], t[i]);
+        SMath::Bench::DoNotOptimize(out);
+    });
+    SMath::Bench::Report("Quaternion::Slerp loop, 1M", s, Count);
+
+    s = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < Count; ++i)
+            rotated[i] = a[i].Rotate(v[i]);
+        SMath::Bench::DoNotOptimize(rotated);
+    });
+    SMath::Bench::Report("Quaternion::Rotate loop, 1M", s, Count);
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+        {
+            std::printf("  %s: not supported on this CPU\n", SMath::Simd::GetLevelName(level));
+            continue;
+        }
+
+        SMath::Simd::SetLevel(level);
+        std::printf("  %s\n", SMath::Simd::GetLevelName(level));
+
+        double t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Normalize(a, out);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("Normalize", t0, Count);
+
+        t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Multiply(a, b, out);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("Multiply", t0, Count);
+
+        t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Rotate(a, v, rotated);
+            SMath::Bench::DoNotOptimize(rotated);
+        });
+        SMath::Bench::Report("Rotate", t0, Count);
+
+        t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Slerp(a, b, t, out);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("Slerp", t0, Count);
+
+        t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Nlerp(a, b, t, out);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("Nlerp", t0, Count);
+    }
+
+    SMath::Simd::ResetLevel();
+}
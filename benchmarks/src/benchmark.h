@@ -0,0 +1,141 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace SMath::Bench
+{
+    typedef void (*BenchmarkFunc)();
+
+    struct Registration
+    {
+        const char* m_Name;
+        BenchmarkFunc m_Func;
+    };
+
+    inline std::vector<Registration>& GetRegistry()
+    {
+        static std::vector<Registration> registry;
+        return registry;
+    }
+
+    struct Registrar
+    {
+        Registrar(const char* name, BenchmarkFunc func) { GetRegistry().push_back({ name, func }); }
+    };
+
+    // Prevents the optimizer from discarding a result that is otherwise unused
+    template <typename T>
+    inline void DoNotOptimize(const T& value)
+    {
+#if defined(_MSC_VER)
+        static volatile const void* sink;
+        sink = &value;
+        _ReadWriteBarrier();
+#else
+        asm volatile("" : : "g"(&value) : "memory");
+#endif
+    }
+
+    // Returns the best wall time (in seconds) of a few repetitions of func
+    template <typename Func>
+    inline double Measure(Func&& func, int repetitions = 5)
+    {
+        double best = 1e30;
+
+        for (int i = 0; i < repetitions; ++i)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            func();
+            auto end = std::chrono::high_resolution_clock::now();
+            double seconds = std::chrono::duration<double>(end - start).count();
+            best = seconds < best ? seconds : best;
+        }
+
+        return best;
+    }
+
+    inline void Report(const char* label, double seconds, double items)
+    {
+        std::printf("    %-48s %12.3f ms %14.2f M/s %10.2f ns/item\n",
+            label, seconds * 1e3, items / seconds * 1e-6, seconds / items * 1e9);
+    }
+
+    // User-space instructions retired by one call of func, from the Linux perf hardware
+    // counter. Returns -1 where there is none, such as on other platforms or in VMs without a PMU.
+    template <typename Func>
+    inline int64_t CountInstructions(Func&& func)
+    {
+#if defined(__linux__)
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+
+        int fd = int(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+        if (fd < 0)
+            return -1;
+
+        ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+        ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        func();
+        ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+
+        int64_t count = -1;
+        if (read(fd, &count, sizeof(count)) != sizeof(count))
+            count = -1;
+        close(fd);
+        return count;
+#else
+        (void)func;
+        return -1;
+#endif
+    }
+
+    inline void ReportInstructions(int64_t instructions, double items)
+    {
+        if (instructions < 0)
+            std::printf("    %-48s %12s\n", "", "instruction counter unavailable");
+        else
+            std::printf("    %-48s %12.1f instructions/item\n", "", double(instructions) / items);
+    }
+}
+
+#define BENCHMARK(name)                                                                 \
+    static void Benchmark_##name();                                                     \
+    static SMath::Bench::Registrar s_Registrar_##name(#name, Benchmark_##name);         \
+    static void Benchmark_##name()
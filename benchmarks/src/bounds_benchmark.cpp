@@ -0,0 +1,115 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "box.h"
+#include "boxbounds.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    // Fills the packed floats of an array of points or boxes in place, so 100M elements fit in memory
+    template <typename T>
+    void Fill(std::vector<T>& elements)
+    {
+        float* data = reinterpret_cast<float*>(elements.data());
+        SMath::Batch::FillUniform(std::span<float>(data, elements.size() * sizeof(T) / sizeof(float)), 23, -1000.0f, 1000.0f);
+    }
+
+    void ReportBandwidth(double seconds, size_t bytes)
+    {
+        std::printf("    %-48s %12.2f GB/s\n", "", double(bytes) / seconds * 1e-9);
+    }
+}
+
+BENCHMARK(BoundsReduction)
+{
+    const size_t sizes[] = { size_t(1) << 20, 10000000, 100000000 };
+
+    for (size_t count : sizes)
+    {
+        char label[64];
+        int repetitions = count > 10000000 ? 2 : 5;
+
+        {
+            std::vector<Point3f> points(count);
+            Fill(points);
+
+            double t = SMath::Bench::Measure([&]() {
+                SMath::Box<float> bounds(points[0], points[0]);
+                for (const Point3f& p : points)
+                    bounds = SMath::Box<float>::Union(bounds, SMath::Box<float>(p, p));
+                SMath::Bench::DoNotOptimize(bounds);
+            }, repetitions);
+            std::snprintf(label, sizeof(label), "Union loop, %zu points", count);
+            SMath::Bench::Report(label, t, double(count));
+
+            t = SMath::Bench::Measure([&]() {
+                auto bounds = SMath::Box<float>::FromPoints(points);
+                SMath::Bench::DoNotOptimize(bounds);
+            }, repetitions);
+            std::snprintf(label, sizeof(label), "FromPoints, %zu points", count);
+            SMath::Bench::Report(label, t, double(count));
+
+            t = SMath::Bench::Measure([&]() {
+                auto bounds = SMath::Batch::Bounds(std::span<const Point3f>(points));
+                SMath::Bench::DoNotOptimize(bounds);
+            }, repetitions);
+            std::snprintf(label, sizeof(label), "Batch::Bounds, %zu points", count);
+            SMath::Bench::Report(label, t, double(count));
+            ReportBandwidth(t, count * sizeof(Point3f));
+        }
+
+        {
+            std::vector<SMath::Box<float>> boxes(count);
+            Fill(boxes);
+            for (SMath::Box<float>& box : boxes)
+                box.m_Max = box.m_Min + SMath::Vector<float, 3>(1.0f);
+
+            double t = SMath::Bench::Measure([&]() {
+                SMath::Box<float> bounds = boxes[0];
+                for (const SMath::Box<float>& box : boxes)
+                    bounds = SMath::Box<float>::Union(bounds, box);
+                SMath::Bench::DoNotOptimize(bounds);
+            }, repetitions);
+            std::snprintf(label, sizeof(label), "Union loop, %zu boxes", count);
+            SMath::Bench::Report(label, t, double(count));
+
+            t = SMath::Bench::Measure([&]() {
+                auto bounds = SMath::Box<float>::UnionAll(boxes);
+                SMath::Bench::DoNotOptimize(bounds);
+            }, repetitions);
+            std::snprintf(label, sizeof(label), "UnionAll, %zu boxes", count);
+            SMath::Bench::Report(label, t, double(count));
+
+            t = SMath::Bench::Measure([&]() {
+                auto bounds = SMath::Batch::Bounds(std::span<const SMath::Box<float>>(boxes));
+                SMath::Bench::DoNotOptimize(bounds);
+            }, repetitions);
+            std::snprintf(label, sizeof(label), "Batch::Bounds, %zu boxes", count);
+            SMath::Bench::Report(label, t, double(count));
+            ReportBandwidth(t, count * sizeof(SMath::Box<float>));
+        }
+    }
+}
@@ -0,0 +1,138 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "box.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 20;
+    constexpr int BinCount = 16;
+
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Box<float> Boxf;
+
+    // The first two passes of a binned SAH split: centroid bounds, then binning along the
+    // longest axis of the centroid bounds. Written the way builders had to before the
+    // Box helpers existed: fresh Points and Boxes per primitive and branchy axis selection.
+    int BinWithUnion(const std::vector<Boxf>& boxes, Boxf* bins, int* counts)
+    {
+        Point3f c0((boxes[0].m_Min.x + boxes[0].m_Max.x) * 0.5f, (boxes[0].m_Min.y + boxes[0].m_Max.y) * 0.5f, (boxes[0].m_Min.z + boxes[0].m_Max.z) * 0.5f);
+        Boxf centroids(c0, c0);
+        for (const Boxf& box : boxes)
+        {
+            Point3f c((box.m_Min.x + box.m_Max.x) * 0.5f, (box.m_Min.y + box.m_Max.y) * 0.5f, (box.m_Min.z + box.m_Max.z) * 0.5f);
+            centroids = Boxf::Union(centroids, Boxf(c, c));
+        }
+
+        SMath::Vector<float, 3> size = centroids.GetSize();
+        int axis = 0;
+        if (size.y > size.x && size.y >= size.z)
+            axis = 1;
+        else if (size.z > size.x && size.z > size.y)
+            axis = 2;
+
+        for (int b = 0; b < BinCount; ++b)
+            counts[b] = 0;
+
+        for (const Boxf& box : boxes)
+        {
+            float c = (box.m_Min[axis] + box.m_Max[axis]) * 0.5f;
+            float offset = c - centroids.m_Min[axis];
+            if (size[axis] > 0.0f)
+                offset /= size[axis];
+
+            int b = std::min(BinCount - 1, int(offset * BinCount));
+            bins[b] = counts[b]++ == 0 ? box : Boxf::Union(bins[b], box);
+        }
+
+        return axis;
+    }
+
+    int BinWithHelpers(const std::vector<Boxf>& boxes, Boxf* bins, int* counts)
+    {
+        Boxf centroids = Boxf::Empty();
+        for (const Boxf& box : boxes)
+            centroids.Expand(box.GetCentroid());
+
+        int axis = centroids.GetMaximumExtent();
+
+        for (int b = 0; b < BinCount; ++b)
+        {
+            bins[b] = Boxf::Empty();
+            counts[b] = 0;
+        }
+
+        for (const Boxf& box : boxes)
+        {
+            int b = std::min(BinCount - 1, int(centroids.GetOffset(box.GetCentroid())[axis] * BinCount));
+            bins[b].Expand(box);
+            counts[b]++;
+        }
+
+        return axis;
+    }
+}
+
+BENCHMARK(BoxBuilderHelpers)
+{
+    std::vector<Boxf> boxes(Count);
+    SMath::Batch::FillUniform(std::span<float>(&boxes[0].m_Min[0], Count * 6), 31, -100.0f, 100.0f);
+    for (Boxf& box : boxes)
+        box.m_Max = box.m_Min + SMath::Vector<float, 3>(1.0f, 0.5f, 2.0f);
+
+    Boxf bins[BinCount];
+    int counts[BinCount];
+
+    double t = SMath::Bench::Measure([&]() {
+        int axis = BinWithUnion(boxes, bins, counts);
+        SMath::Bench::DoNotOptimize(axis);
+        SMath::Bench::DoNotOptimize(bins);
+    });
+    SMath::Bench::Report("Centroid bounds + binning, Union", t, Count);
+
+    t = SMath::Bench::Measure([&]() {
+        int axis = BinWithHelpers(boxes, bins, counts);
+        SMath::Bench::DoNotOptimize(axis);
+        SMath::Bench::DoNotOptimize(bins);
+    });
+    SMath::Bench::Report("Centroid bounds + binning, helpers", t, Count);
+
+    t = SMath::Bench::Measure([&]() {
+        Boxf centroids = Boxf::Empty();
+        for (const Boxf& box : boxes)
+            centroids.Expand(box.GetCentroid());
+        SMath::Bench::DoNotOptimize(centroids);
+    });
+    SMath::Bench::Report("Centroid bounds only, helpers", t, Count);
+
+
+    t = SMath::Bench::Measure([&]() {
+        Boxf query(Point3f(-20.0f), Point3f(20.0f));
+        int overlaps = 0;
+        for (const Boxf& box : boxes)
+            overlaps += query.Overlaps(box);
+        SMath::Bench::DoNotOptimize(overlaps);
+    });
+    SMath::Bench::Report("Overlaps count", t, Count);
+}
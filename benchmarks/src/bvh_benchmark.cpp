@@ -0,0 +1,107 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "widebvh.h"
+#include "quantizedbvh.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Box<float> Boxf;
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    constexpr int RayCount = 1 << 18;
+
+    std::vector<Boxf> MakeScene(int count)
+    {
+        std::vector<float> u(count * 6);
+        SMath::Batch::FillUniform(std::span<float>(u), 23, 0.0f, 1.0f);
+
+        std::vector<Boxf> boxes(count);
+        for (int i = 0; i < count; ++i)
+        {
+            const float* r = &u[i * 6];
+            Point3f center(r[0] * 200 - 100, r[1] * 200 - 100, r[2] * 200 - 100);
+            Vector3f half(r[3] * 0.8f + 0.05f, r[4] * 0.8f + 0.05f, r[5] * 0.8f + 0.05f);
+            boxes[i] = Boxf(center - half, center + half);
+        }
+        return boxes;
+    }
+
+    // Rays from inside the scene in random directions
+    std::vector<SMath::Ray<float>> MakeRays()
+    {
+        std::vector<float> u(RayCount * 6);
+        SMath::Batch::FillUniform(std::span<float>(u), 29, -1.0f, 1.0f);
+
+        std::vector<SMath::Ray<float>> rays;
+        rays.reserve(RayCount);
+        for (int i = 0; i < RayCount; ++i)
+        {
+            const float* r = &u[i * 6];
+            rays.emplace_back(Point3f(r[0] * 100, r[1] * 100, r[2] * 100), Vector3f(r[3], r[4], r[5] + 1e-3f), 0.0f, 1e30f);
+        }
+        return rays;
+    }
+
+    template <typename Bvh>
+    void BenchmarkRays(const char* label, const Bvh& bvh, const std::vector<Boxf>& boxes, const std::vector<SMath::Ray<float>>& rays)
+    {
+        size_t hits = 0;
+        double t = SMath::Bench::Measure([&]() {
+            hits = 0;
+            float tHit;
+            uint32_t primitive;
+            for (const auto& ray : rays)
+                hits += bvh.Intersect(ray, boxes, tHit, primitive);
+            SMath::Bench::DoNotOptimize(hits);
+        }, 3);
+        SMath::Bench::Report(label, t, double(rays.size()));
+    }
+}
+
+BENCHMARK(BvhTraversal)
+{
+    auto rays = MakeRays();
+    const int counts[] = { 1 << 16, 1 << 20 };
+    for (int count : counts)
+    {
+        auto boxes = MakeScene(count);
+
+        SMath::WideBvh wide;
+        double t = SMath::Bench::Measure([&]() { wide = SMath::WideBvh(boxes); }, 1);
+        std::printf("  %d boxes\n", count);
+        SMath::Bench::Report("Build WideBvh (binned SAH)", t, count);
+
+        SMath::QuantizedBvh quantized;
+        t = SMath::Bench::Measure([&]() { quantized = SMath::QuantizedBvh(wide); }, 1);
+        SMath::Bench::Report("Convert to QuantizedBvh", t, double(wide.GetNodeCount()));
+
+        std::printf("    %-48s %8zu nodes %10.2f MiB\n", "WideBvh footprint", wide.GetNodeCount(), wide.GetMemoryFootprint() / 1048576.0);
+        std::printf("    %-48s %8zu nodes %10.2f MiB\n", "QuantizedBvh footprint", quantized.GetNodeCount(), quantized.GetMemoryFootprint() / 1048576.0);
+
+        BenchmarkRays("Closest hit, WideBvh (rays)", wide, boxes, rays);
+        BenchmarkRays("Closest hit, QuantizedBvh (rays)", quantized, boxes, rays);
+    }
+}
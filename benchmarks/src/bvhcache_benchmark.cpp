@@ -0,0 +1,160 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "bvhcache.h"
+#include "batchops.h"
+
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <filesystem>
+
+#if defined(__linux__)
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace
+{
+    typedef SMath::Box<float> Boxf;
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    constexpr int BoxCount = 1 << 20;
+    constexpr int RayCount = 1 << 12;
+
+    std::vector<Boxf> MakeScene()
+    {
+        std::vector<float> u(BoxCount * 6);
+        SMath::Batch::FillUniform(std::span<float>(u), 41, 0.0f, 1.0f);
+
+        std::vector<Boxf> boxes(BoxCount);
+        for (int i = 0; i < BoxCount; ++i)
+        {
+            const float* r = &u[i * 6];
+            Point3f center(r[0] * 200 - 100, r[1] * 200 - 100, r[2] * 200 - 100);
+            Vector3f half(r[3] * 0.8f + 0.05f, r[4] * 0.8f + 0.05f, r[5] * 0.8f + 0.05f);
+            boxes[i] = Boxf(center - half, center + half);
+        }
+        return boxes;
+    }
+
+    std::vector<SMath::Ray<float>> MakeRays()
+    {
+        std::vector<float> u(RayCount * 6);
+        SMath::Batch::FillUniform(std::span<float>(u), 43, -1.0f, 1.0f);
+
+        std::vector<SMath::Ray<float>> rays;
+        for (int i = 0; i < RayCount; ++i)
+        {
+            const float* r = &u[i * 6];
+            rays.emplace_back(Point3f(r[0] * 100, r[1] * 100, r[2] * 100), Vector3f(r[3], r[4], r[5] + 1e-3f), 0.0f, 1e30f);
+        }
+        return rays;
+    }
+
+    // Drops the file from the page cache so the next open reads it from disk. Written pages
+    // have to reach the disk first, since dirty pages are not dropped.
+    bool EvictFromPageCache(const std::string& path)
+    {
+#if defined(__linux__)
+        int file = ::open(path.c_str(), O_RDONLY);
+        if (file < 0)
+            return false;
+
+        bool evicted = ::fdatasync(file) == 0 && ::posix_fadvise(file, 0, 0, POSIX_FADV_DONTNEED) == 0;
+        ::close(file);
+        return evicted;
+#else
+        (void)path;
+        return false;
+#endif
+    }
+}
+
+BENCHMARK(BvhCacheStartup)
+{
+    // Startup is "get a hierarchy, then trace a first batch of rays". Cold runs evict the
+    // cache file before every repetition, warm runs find it in the page cache.
+    auto boxes = MakeScene();
+    auto rays = MakeRays();
+    std::string path = (std::filesystem::temp_directory_path() / "smath_bvhcache_benchmark.bin").string();
+
+    size_t hits = 0;
+    double t = SMath::Bench::Measure([&]() {
+        SMath::WideBvh bvh(boxes);
+        hits = 0;
+        float tHit;
+        uint32_t primitive;
+        for (const auto& ray : rays)
+            hits += bvh.Intersect(ray, boxes, tHit, primitive);
+        SMath::Bench::DoNotOptimize(hits);
+    }, 1);
+    SMath::Bench::Report("Rebuild WideBvh + first rays (boxes)", t, BoxCount);
+
+    SMath::WideBvh wide(boxes);
+    SMath::QuantizedBvh quantized(wide);
+
+    auto benchmarkOpen = [&](const char* label, bool verify) {
+        auto openAndTrace = [&]() {
+            SMath::BvhCache cache;
+            if (cache.Open(path.c_str(), verify) != SMath::BvhCache::Status::Ok)
+                return;
+            hits = 0;
+            float tHit;
+            uint32_t primitive;
+            for (const auto& ray : rays)
+                hits += cache.Intersect(ray, tHit, primitive);
+            SMath::Bench::DoNotOptimize(hits);
+        };
+
+        char name[96];
+        std::snprintf(name, sizeof(name), "%s, warm (boxes)", label);
+        SMath::Bench::Report(name, SMath::Bench::Measure(openAndTrace), BoxCount);
+
+        // Eviction stays outside the timed region
+        double seconds = 1e30;
+        for (int i = 0; i < 5; ++i)
+        {
+            if (!EvictFromPageCache(path))
+            {
+                std::printf("    %-48s\n", "Cannot evict the page cache, no cold runs");
+                return;
+            }
+            seconds = std::min(seconds, SMath::Bench::Measure(openAndTrace, 1));
+        }
+        std::snprintf(name, sizeof(name), "%s, cold (boxes)", label);
+        SMath::Bench::Report(name, seconds, BoxCount);
+    };
+
+    t = SMath::Bench::Measure([&]() { SMath::BvhCache::Write(path.c_str(), wide, boxes); }, 1);
+    SMath::Bench::Report("Write wide cache (boxes)", t, BoxCount);
+    std::printf("    %-48s %12.2f MiB\n", "Wide cache file", std::filesystem::file_size(path) / 1048576.0);
+    benchmarkOpen("Open wide + rays", true);
+    benchmarkOpen("Open wide, no checksum + rays", false);
+
+    SMath::BvhCache::Write(path.c_str(), quantized, boxes);
+    std::printf("    %-48s %12.2f MiB\n", "Quantized cache file", std::filesystem::file_size(path) / 1048576.0);
+    benchmarkOpen("Open quantized + rays", true);
+    benchmarkOpen("Open quantized, no checksum + rays", false);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,127 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "batchcurve.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    // Hair-style workload: many short curves, each tessellated into a fixed number of points
+    constexpr size_t CurveCount = 1 << 16;
+    constexpr size_t PointsPerCurve = 32;
+    constexpr size_t ParameterCount = 1 << 20;
+
+    std::vector<SMath::CubicBezier<float>> MakeCurves(size_t count)
+    {
+        std::vector<float> u(count * 12);
+        SMath::Batch::FillUniform(std::span<float>(u), 67, -10.0f, 10.0f);
+
+        std::vector<SMath::CubicBezier<float>> curves(count);
+        for (size_t i = 0; i < count; ++i)
+            for (int j = 0; j < 4; ++j)
+                curves[i].m_Points[j] = Point3f(&u[i * 12 + j * 3]);
+        return curves;
+    }
+}
+
+BENCHMARK(Curve)
+{
+    auto curves = MakeCurves(CurveCount);
+    std::vector<float> t(ParameterCount);
+    SMath::Batch::FillUniform(std::span<float>(t), 71, 0.0f, 1.0f);
+    std::vector<Point3f> points(ParameterCount);
+
+    // Hand-written Bernstein evaluation, the baseline being replaced
+    double seconds = SMath::Bench::Measure([&]() {
+        for (size_t i = 0; i < ParameterCount; ++i)
+            points[i] = curves[0].Evaluate(t[i]);
+        SMath::Bench::DoNotOptimize(points);
+    });
+    SMath::Bench::Report("One curve, CubicBezier::Evaluate loop (points)", seconds, ParameterCount);
+
+    std::span<const float> curveT = std::span<const float>(t).first(CurveCount);
+    std::span<Point3f> curvePoints = std::span<Point3f>(points).first(CurveCount);
+    std::vector<Point3f> tessellated(CurveCount * PointsPerCurve);
+
+    seconds = SMath::Bench::Measure([&]() {
+        for (size_t c = 0; c < CurveCount; ++c)
+            for (size_t i = 0; i < PointsPerCurve; ++i)
+                tessellated[c * PointsPerCurve + i] = curves[c].Evaluate(float(i) / float(PointsPerCurve - 1));
+        SMath::Bench::DoNotOptimize(tessellated);
+    });
+    SMath::Bench::Report("Tessellate 32, Evaluate per point (points)", seconds, tessellated.size());
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+        {
+            std::printf("  %s: not supported on this CPU\n", SMath::Simd::GetLevelName(level));
+            continue;
+        }
+
+        SMath::Simd::SetLevel(level);
+        std::printf("  %s\n", SMath::Simd::GetLevelName(level));
+
+        double t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Evaluate(curves[0], t, points);
+            SMath::Bench::DoNotOptimize(points);
+        });
+        SMath::Bench::Report("One curve, many parameters (points)", t0, ParameterCount);
+
+        t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Evaluate(curves, curveT, curvePoints);
+            SMath::Bench::DoNotOptimize(points);
+        });
+        SMath::Bench::Report("Many curves, one parameter each (points)", t0, CurveCount);
+
+        t0 = SMath::Bench::Measure([&]() {
+            SMath::Batch::Tessellate(curves, PointsPerCurve, tessellated);
+            SMath::Bench::DoNotOptimize(tessellated);
+        });
+        SMath::Bench::Report("Tessellate 32, forward differencing (points)", t0, tessellated.size());
+    }
+
+    SMath::Simd::ResetLevel();
+
+    SMath::BezierPatch<float> patch;
+    for (int i = 0; i < 16; ++i)
+        patch.m_Points[i] = Point3f(float(i % 4), float(i / 4), float((i * 7) % 5));
+    std::vector<Point3f> grid(64 * 64);
+    seconds = SMath::Bench::Measure([&]() {
+        for (int r = 0; r < 256; ++r)
+            patch.Tessellate(64, 64, grid);
+        SMath::Bench::DoNotOptimize(grid);
+    });
+    SMath::Bench::Report("Patch tessellate 64x64 (points)", seconds, grid.size() * 256);
+
+    SMath::CubicSpline<float> spline(std::vector<Point3f>(&curves[0].m_Points[0], &curves[0].m_Points[0] + 4 * 256), SMath::CurveBasis::CatmullRom);
+    seconds = SMath::Bench::Measure([&]() {
+        SMath::ArcLengthTable<float> table(spline);
+        SMath::Bench::DoNotOptimize(table);
+    });
+    SMath::Bench::Report("Arc length table, 1021 segments (segments)", seconds, spline.GetSegmentCount());
+}
@@ -0,0 +1,160 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "decomposition.h"
+#include "random.h"
+
+namespace
+{
+    constexpr int MatrixCount = 1 << 16;
+
+    template <typename T, int N>
+    void MakeSystems(std::vector<SMath::Matrix<T, N>>& m, std::vector<SMath::Vector<T, N>>& b)
+    {
+        SMath::Random::Seed(1);
+        m.resize(MatrixCount);
+        b.resize(MatrixCount);
+
+        // Diagonally dominant symmetric matrices are valid for every decomposition
+        for (int n = 0; n < MatrixCount; ++n)
+        {
+            for (int i = 0; i < N; ++i)
+            {
+                for (int j = i; j < N; ++j)
+                {
+                    T v = T(SMath::Random::UniformFloat() * 2 - 1);
+                    m[n].m_Data2D[i][j] = i == j ? v + T(N) : v;
+                    m[n].m_Data2D[j][i] = m[n].m_Data2D[i][j];
+                }
+                b[n][i] = T(SMath::Random::UniformFloat());
+            }
+        }
+    }
+
+    template <typename T, int N>
+    T MaxResidual(const std::vector<SMath::Matrix<T, N>>& m, const std::vector<SMath::Vector<T, N>>& b,
+        const std::vector<SMath::Vector<T, N>>& x)
+    {
+        T worst = 0;
+        for (size_t n = 0; n < m.size(); ++n)
+        {
+            SMath::Vector<T, N> r = m[n] * x[n] - b[n];
+            for (int i = 0; i < N; ++i)
+                worst = std::max(worst, std::fabs(r[i]));
+        }
+        return worst;
+    }
+
+    template <typename T, int N>
+    void RunSolvers(const char* name)
+    {
+        std::vector<SMath::Matrix<T, N>> m;
+        std::vector<SMath::Vector<T, N>> b;
+        std::vector<SMath::Vector<T, N>> x(MatrixCount);
+        MakeSystems(m, b);
+
+        std::printf("  %s\n", name);
+
+        double t = SMath::Bench::Measure([&]() {
+            for (int n = 0; n < MatrixCount; ++n)
+                x[n] = SMath::LUDecomposition<T, N>(m[n]).Solve(b[n]);
+            SMath::Bench::DoNotOptimize(x);
+        });
+        SMath::Bench::Report("LUDecomposition::Solve", t, MatrixCount);
+        std::printf("      max residual %g\n", double(MaxResidual(m, b, x)));
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::LUSolve(std::span<const SMath::Matrix<T, N>>(m), std::span<const SMath::Vector<T, N>>(b), std::span<SMath::Vector<T, N>>(x));
+            SMath::Bench::DoNotOptimize(x);
+        });
+        SMath::Bench::Report("Batch::LUSolve", t, MatrixCount);
+        std::printf("      max residual %g\n", double(MaxResidual(m, b, x)));
+
+        t = SMath::Bench::Measure([&]() {
+            for (int n = 0; n < MatrixCount; ++n)
+                x[n] = SMath::QRDecomposition<T, N>(m[n]).Solve(b[n]);
+            SMath::Bench::DoNotOptimize(x);
+        });
+        SMath::Bench::Report("QRDecomposition::Solve", t, MatrixCount);
+        std::printf("      max residual %g\n", double(MaxResidual(m, b, x)));
+
+        t = SMath::Bench::Measure([&]() {
+            for (int n = 0; n < MatrixCount; ++n)
+                x[n] = SMath::CholeskyDecomposition<T, N>(m[n]).Solve(b[n]);
+            SMath::Bench::DoNotOptimize(x);
+        });
+        SMath::Bench::Report("CholeskyDecomposition::Solve", t, MatrixCount);
+        std::printf("      max residual %g\n", double(MaxResidual(m, b, x)));
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::CholeskySolve(std::span<const SMath::Matrix<T, N>>(m), std::span<const SMath::Vector<T, N>>(b), std::span<SMath::Vector<T, N>>(x));
+            SMath::Bench::DoNotOptimize(x);
+        });
+        SMath::Bench::Report("Batch::CholeskySolve", t, MatrixCount);
+        std::printf("      max residual %g\n", double(MaxResidual(m, b, x)));
+
+        std::vector<SMath::Vector<T, N>> values(MatrixCount);
+        std::vector<SMath::Matrix<T, N>> vectors(MatrixCount);
+
+        t = SMath::Bench::Measure([&]() {
+            for (int n = 0; n < MatrixCount; ++n)
+            {
+                SMath::SymmetricEigen<T, N> eigen(m[n]);
+                values[n] = eigen.m_Eigenvalues;
+                vectors[n] = eigen.m_Eigenvectors;
+            }
+            SMath::Bench::DoNotOptimize(values);
+        });
+        SMath::Bench::Report("SymmetricEigen", t, MatrixCount);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::SymmetricEigen(std::span<const SMath::Matrix<T, N>>(m), std::span<SMath::Vector<T, N>>(values), std::span<SMath::Matrix<T, N>>(vectors));
+            SMath::Bench::DoNotOptimize(values);
+        });
+        SMath::Bench::Report("Batch::SymmetricEigen", t, MatrixCount);
+
+        // Residual |A * v - lambda * v| of the batched eigenpairs
+        T worst = 0;
+        for (int n = 0; n < MatrixCount; ++n)
+            for (int i = 0; i < N; ++i)
+            {
+                SMath::Vector<T, N> v;
+                for (int k = 0; k < N; ++k)
+                    v[k] = vectors[n].m_Data2D[k][i];
+
+                SMath::Vector<T, N> r = m[n] * v - v * SMath::Vector<T, N>(values[n][i]);
+                worst = std::max(worst, std::sqrt(r.SquareMagnitude()));
+            }
+        std::printf("      max eigen residual %g\n", double(worst));
+    }
+}
+
+BENCHMARK(Decomposition3x3)
+{
+    RunSolvers<float, 3>("float 3x3");
+    RunSolvers<double, 3>("double 3x3");
+}
+
+BENCHMARK(Decomposition4x4)
+{
+    RunSolvers<float, 4>("float 4x4");
+    RunSolvers<double, 4>("double 4x4");
+}
@@ -0,0 +1,123 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "batchmath.h"
+#include "batchops.h"
+#include "transform.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 20;
+
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+}
+
+BENCHMARK(DispatchLevels)
+{
+    std::vector<float> uniform(Count * 6);
+    SMath::Batch::FillUniform(std::span<float>(uniform), 7, -10.0f, 10.0f);
+
+    std::vector<Point3f> points(Count), pointsOut(Count);
+    std::vector<Vector3f> vectors(Count), vectorsOut(Count);
+    std::vector<SMath::Box<float>> boxes(Count);
+    for (int i = 0; i < Count; ++i)
+    {
+        const float* u = &uniform[i * 6];
+        points[i] = Point3f(u[0], u[1], u[2]);
+        vectors[i] = Vector3f(u[3], u[4], u[5]);
+        boxes[i] = SMath::Box<float>(Point3f(std::min(u[0], u[3]), std::min(u[1], u[4]), std::min(u[2], u[5])),
+                                     Point3f(std::max(u[0], u[3]), std::max(u[1], u[4]), std::max(u[2], u[5])));
+    }
+
+    auto m = SMath::Transform<float>::GetPerspectiveMatrixLH(1.0f, 1.5f, 0.1f, 100.0f) *
+             SMath::Transform<float>::GetTranslationMatrix(Vector3f(0.0f, 0.0f, 20.0f));
+    SMath::Box<float> query(Point3f(-2.0f, -2.0f, -2.0f), Point3f(3.0f, 3.0f, 3.0f));
+    std::vector<uint64_t> mask(SMath::Batch::GetMaskSize(Count));
+    std::vector<float> scalars(Count), scalarsOut(Count);
+    SMath::Batch::FillUniform(std::span<float>(scalars), 11, -10.0f, 10.0f);
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+        {
+            std::printf("  %s: not supported on this CPU\n", SMath::Simd::GetLevelName(level));
+            continue;
+        }
+
+        SMath::Simd::SetLevel(level);
+        std::printf("  %s\n", SMath::Simd::GetLevelName(level));
+
+        double t = SMath::Bench::Measure([&]() {
+            SMath::Batch::TransformPoints(m, std::span<const Point3f>(points), std::span<Point3f>(pointsOut));
+            SMath::Bench::DoNotOptimize(pointsOut);
+        });
+        SMath::Bench::Report("TransformPoints (projective)", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::TransformVectors(m, std::span<const Vector3f>(vectors), std::span<Vector3f>(vectorsOut));
+            SMath::Bench::DoNotOptimize(vectorsOut);
+        });
+        SMath::Bench::Report("TransformVectors", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::Normalize(std::span<const Vector3f>(vectors), std::span<Vector3f>(vectorsOut));
+            SMath::Bench::DoNotOptimize(vectorsOut);
+        });
+        SMath::Bench::Report("Normalize", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::Contains(query, std::span<const Point3f>(points), std::span<uint64_t>(mask));
+            SMath::Bench::DoNotOptimize(mask);
+        });
+        SMath::Bench::Report("Box Contains", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::Overlaps(query, std::span<const SMath::Box<float>>(boxes), std::span<uint64_t>(mask));
+            SMath::Bench::DoNotOptimize(mask);
+        });
+        SMath::Bench::Report("Box Overlaps", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::FillUniform(std::span<float>(scalarsOut), 3);
+            SMath::Bench::DoNotOptimize(scalarsOut);
+        });
+        SMath::Bench::Report("FillUniform", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::Sin(std::span<const float>(scalars), std::span<float>(scalarsOut));
+            SMath::Bench::DoNotOptimize(scalarsOut);
+        });
+        SMath::Bench::Report("Sin", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::Exp(std::span<const float>(scalars), std::span<float>(scalarsOut));
+            SMath::Bench::DoNotOptimize(scalarsOut);
+        });
+        SMath::Bench::Report("Exp", t, Count);
+    }
+
+    SMath::Simd::ResetLevel();
+}
@@ -0,0 +1,166 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "fastmath.h"
+#include "linalg.h"
+#include "quaternion.h"
+#include "random.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 20;
+
+    std::vector<float> RandomFloats(float lo, float hi)
+    {
+        std::vector<float> v(Count);
+        for (auto& vi : v)
+            vi = lo + (hi - lo) * float(SMath::Random::UniformFloat());
+        return v;
+    }
+
+    template <typename Func>
+    void RunScalar(const char* label, const std::vector<float>& in, std::vector<float>& out, Func func)
+    {
+        double t = SMath::Bench::Measure([&]() {
+            for (int i = 0; i < Count; ++i)
+                out[i] = func(in[i]);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report(label, t, Count);
+    }
+
+    template <typename Func>
+    double MaxError(const std::vector<float>& in, Func func, double (*exact)(double), bool relative)
+    {
+        double maxError = 0.0;
+        for (int i = 0; i < Count; i += 7)
+        {
+            double expected = exact(double(in[i]));
+            double error = std::fabs(double(func(in[i])) - expected);
+            maxError = std::max(maxError, relative ? error / std::fabs(expected) : error);
+        }
+        return maxError;
+    }
+
+#if defined(SMATH_X86)
+    template <typename Func>
+    void RunSse(const char* label, const std::vector<float>& in, std::vector<float>& out, Func func)
+    {
+        double t = SMath::Bench::Measure([&]() {
+            for (int i = 0; i < Count; i += 4)
+                _mm_storeu_ps(&out[i], func(_mm_loadu_ps(&in[i])));
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report(label, t, Count);
+    }
+#endif
+
+    template <typename Exact, typename Fast, typename Simd>
+    void RunFunction(const char* name, float lo, float hi, bool relative, double (*reference)(double), Exact exact, Fast fast, [[maybe_unused]] Simd simd)
+    {
+        auto in = RandomFloats(lo, hi);
+        std::vector<float> out(Count);
+
+        std::printf("  %s on [%g, %g], max %s error %.3g\n", name, lo, hi,
+            relative ? "relative" : "absolute", MaxError(in, fast, reference, relative));
+
+        RunScalar("libm", in, out, exact);
+        RunScalar("FastMath scalar", in, out, fast);
+#if defined(SMATH_X86)
+        RunSse("FastMath __m128", in, out, simd);
+#endif
+    }
+}
+
+BENCHMARK(FastMath)
+{
+#if defined(SMATH_X86)
+    #define SIMD_FORM(f) [](__m128 x) { return SMath::FastMath::f(x); }
+#else
+    #define SIMD_FORM(f) 0
+#endif
+
+    RunFunction("rsqrt", 1e-3f, 1e3f, true, [](double x) { return 1.0 / std::sqrt(x); },
+        [](float x) { return 1.0f / std::sqrt(x); }, [](float x) { return SMath::FastMath::Rsqrt(x); }, SIMD_FORM(Rsqrt));
+    RunFunction("sin", -100.0f, 100.0f, false, std::sin,
+        [](float x) { return std::sin(x); }, [](float x) { return SMath::FastMath::Sin(x); }, SIMD_FORM(Sin));
+    RunFunction("cos", -100.0f, 100.0f, false, std::cos,
+        [](float x) { return std::cos(x); }, [](float x) { return SMath::FastMath::Cos(x); }, SIMD_FORM(Cos));
+    RunFunction("acos", -1.0f, 1.0f, false, std::acos,
+        [](float x) { return std::acos(x); }, [](float x) { return SMath::FastMath::Acos(x); }, SIMD_FORM(Acos));
+    RunFunction("atan", -50.0f, 50.0f, true, std::atan,
+        [](float x) { return std::atan(x); }, [](float x) { return SMath::FastMath::Atan(x); }, SIMD_FORM(Atan));
+    RunFunction("exp", -80.0f, 80.0f, true, std::exp,
+        [](float x) { return std::exp(x); }, [](float x) { return SMath::FastMath::Exp(x); }, SIMD_FORM(Exp));
+    RunFunction("log", 1e-6f, 1e6f, true, std::log,
+        [](float x) { return std::log(x); }, [](float x) { return SMath::FastMath::Log(x); }, SIMD_FORM(Log));
+
+    #undef SIMD_FORM
+}
+
+BENCHMARK(FastMathCoreTypes)
+{
+    constexpr int N = 1 << 18;
+    std::vector<SMath::Vector<float, 3>> v(N), vout(N);
+    std::vector<SMath::Quaternion<float>> a(N), b(N), qout(N);
+    std::vector<float> t(N);
+
+    for (int i = 0; i < N; ++i)
+    {
+        v[i] = SMath::Vector<float, 3>(float(SMath::Random::UniformFloat()) - 0.5f, float(SMath::Random::UniformFloat()) - 0.5f, float(SMath::Random::UniformFloat()) + 0.1f);
+        a[i] = SMath::Quaternion<float>::FromAxisAngle(v[i].Normalized(), float(SMath::Random::UniformFloat()) * 3.0f);
+        b[i] = SMath::Quaternion<float>::FromAxisAngle(v[(i * 7) % (i + 1)].Normalized(), float(SMath::Random::UniformFloat()) * 3.0f);
+        t[i] = float(SMath::Random::UniformFloat());
+    }
+
+    std::printf("  float3 / float quaternion\n");
+
+    double seconds = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < N; ++i)
+            vout[i] = v[i].Normalized();
+        SMath::Bench::DoNotOptimize(vout);
+    });
+    SMath::Bench::Report("Vector::Normalized", seconds, N);
+
+    seconds = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < N; ++i)
+            vout[i] = SMath::FastMath::Normalized(v[i]);
+        SMath::Bench::DoNotOptimize(vout);
+    });
+    SMath::Bench::Report("FastMath::Normalized, Vector3", seconds, N);
+
+    seconds = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < N; ++i)
+            qout[i] = SMath::Quaternion<float>::Slerp(a[i], b[i], t[i]);
+        SMath::Bench::DoNotOptimize(qout);
+    });
+    SMath::Bench::Report("Quaternion::Slerp", seconds, N);
+
+    seconds = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < N; ++i)
+            qout[i] = SMath::FastMath::Slerp(a[i], b[i], t[i]);
+        SMath::Bench::DoNotOptimize(qout);
+    });
+    SMath::Bench::Report("FastMath::Slerp", seconds, N);
+}
@@ -0,0 +1,85 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "frustum.h"
+#include "transform.h"
+#include "random.h"
+
+#include <bit>
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 20;
+
+    typedef SMath::Point<float, 3> Point3f;
+}
+
+BENCHMARK(FrustumCull)
+{
+    // Boxes scattered around the camera so roughly a fifth of them are visible
+    std::vector<SMath::Box<float>> boxes(Count);
+    for (auto& box : boxes)
+    {
+        Point3f center(float(SMath::Random::UniformFloat() * 400.0 - 200.0),
+                       float(SMath::Random::UniformFloat() * 400.0 - 200.0),
+                       float(SMath::Random::UniformFloat() * 400.0 - 200.0));
+        box = SMath::Box<float>(center - SMath::Vector<float, 3>(1.0f), center + SMath::Vector<float, 3>(1.0f));
+    }
+
+    auto projection = SMath::Transform<float>::GetPerspectiveMatrixLH(1.2f, 16.0f / 9.0f, 0.1f, 300.0f);
+    auto view = SMath::Transform<float>::GetTranslationMatrix(SMath::Vector<float, 3>(0.0f, 0.0f, 50.0f));
+    SMath::Frustum<float> frustum(projection * view);
+    std::vector<uint64_t> visible(SMath::Batch::GetMaskSize(Count));
+
+    double t = SMath::Bench::Measure([&]() {
+        std::fill(visible.begin(), visible.end(), 0);
+        for (int i = 0; i < Count; ++i)
+            if (frustum.Intersects(boxes[i]))
+                visible[i / 64] |= uint64_t(1) << (i % 64);
+        SMath::Bench::DoNotOptimize(visible);
+    });
+    SMath::Bench::Report("Intersects loop", t, Count);
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+            continue;
+
+        SMath::Simd::SetLevel(level);
+        t = SMath::Bench::Measure([&]() {
+            frustum.Cull(std::span<const SMath::Box<float>>(boxes), std::span<uint64_t>(visible));
+            SMath::Bench::DoNotOptimize(visible);
+        });
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "Cull (%s)", SMath::Simd::GetLevelName(level));
+        SMath::Bench::Report(label, t, Count);
+    }
+
+    SMath::Simd::ResetLevel();
+
+    size_t count = 0;
+    for (uint64_t word : visible)
+        count += std::popcount(word);
+    std::printf("    %zu of %d boxes visible\n", count, Count);
+}
@@ -0,0 +1,94 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "gpulayout.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr int InstanceCount = 100000;
+}
+
+BENCHMARK(GpuUpload)
+{
+    std::vector<float> u(InstanceCount * 16);
+    SMath::Batch::FillUniform(std::span<float>(u), 89, -10.0f, 10.0f);
+
+    std::vector<SMath::Matrix<float, 4>> floats(InstanceCount);
+    std::vector<SMath::Matrix<double, 4>> doubles(InstanceCount);
+    for (int i = 0; i < InstanceCount; ++i)
+    {
+        for (int j = 0; j < 12; ++j)
+        {
+            floats[i][j] = u[i * 16 + j];
+            doubles[i][j] = u[i * 16 + j];
+        }
+        floats[i][15] = 1.0f;
+        doubles[i][15] = 1.0;
+    }
+
+    // Stands in for the mapped upload buffer of one frame
+    std::vector<SMath::GpuMatrix4> matrices(InstanceCount);
+    std::vector<SMath::GpuMatrix3x4> affine(InstanceCount);
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+        {
+            std::printf("  %s: not supported on this CPU\n", SMath::Simd::GetLevelName(level));
+            continue;
+        }
+
+        SMath::Simd::SetLevel(level);
+        std::printf("  %s%s\n", SMath::Simd::GetLevelName(level), level == SMath::Simd::Level::Scalar ? " (element by element)" : " (streaming)");
+
+        double t = SMath::Bench::Measure([&]() {
+            SMath::Batch::WriteMatrices(floats, matrices);
+            SMath::Bench::DoNotOptimize(matrices);
+        });
+        SMath::Bench::Report("float4x4, column-major, 100k instances", t, InstanceCount);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::WriteMatrices(doubles, matrices);
+            SMath::Bench::DoNotOptimize(matrices);
+        });
+        SMath::Bench::Report("double4x4 -> float4x4, column-major", t, InstanceCount);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::WriteMatrices(floats, matrices, SMath::GpuMatrixLayout::RowMajor);
+            SMath::Bench::DoNotOptimize(matrices);
+        });
+        SMath::Bench::Report("float4x4, row-major", t, InstanceCount);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::WriteAffine(floats, affine);
+            SMath::Bench::DoNotOptimize(affine);
+        });
+        SMath::Bench::Report("float3x4 affine", t, InstanceCount);
+        std::printf("    %-48s %12.2f\n", "float3x4 affine, GB/s written", double(InstanceCount) * sizeof(SMath::GpuMatrix3x4) / t * 1e-9);
+    }
+
+    SMath::Simd::ResetLevel();
+}
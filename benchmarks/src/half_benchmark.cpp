@@ -0,0 +1,87 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "half.h"
+#include "batchops.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    constexpr int Count = 1 << 22;
+}
+
+BENCHMARK(HalfConversion)
+{
+    std::vector<float> floats(Count), out(Count);
+    SMath::Batch::FillUniform(std::span<float>(floats), 83, -1000.0f, 1000.0f);
+    std::vector<SMath::Half> halves(Count);
+    std::vector<SMath::BFloat16> bfloats(Count);
+
+    // Streaming the floats once, for the bandwidth the conversions are up against
+    double t = SMath::Bench::Measure([&]() {
+        std::copy(floats.begin(), floats.end(), out.begin());
+        SMath::Bench::DoNotOptimize(out);
+    });
+    SMath::Bench::Report("Copy float", t, Count);
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+        {
+            std::printf("  %s: not supported on this CPU\n", SMath::Simd::GetLevelName(level));
+            continue;
+        }
+
+        SMath::Simd::SetLevel(level);
+        std::printf("  %s\n", SMath::Simd::GetLevelName(level));
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::ToHalf(floats, halves);
+            SMath::Bench::DoNotOptimize(halves);
+        });
+        SMath::Bench::Report("float -> half", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::ToFloat(halves, out);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("half -> float", t, Count);
+        std::printf("    %-48s %12.2f\n", "half -> float, GB/s of floats written", double(Count) * sizeof(float) / t * 1e-9);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::ToBFloat16(floats, bfloats);
+            SMath::Bench::DoNotOptimize(bfloats);
+        });
+        SMath::Bench::Report("float -> bfloat16", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::Batch::ToFloat(bfloats, out);
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report("bfloat16 -> float", t, Count);
+    }
+
+    SMath::Simd::ResetLevel();
+}
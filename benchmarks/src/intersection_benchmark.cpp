@@ -0,0 +1,102 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "batchintersection.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    // Primitive counts as in a large BVH leaf or a small instance; every ray tests all of them
+    constexpr size_t PrimitiveCount = 256;
+    constexpr size_t RayCount = 4096;
+
+    std::vector<float> Uniform(size_t count, uint32_t seed, float lo, float hi)
+    {
+        std::vector<float> u(count);
+        SMath::Batch::FillUniform(std::span<float>(u), seed, lo, hi);
+        return u;
+    }
+
+    template<typename Primitive>
+    void Run(const char* name, const std::vector<Primitive>& primitives, const std::vector<SMath::Ray<float>>& rays)
+    {
+        const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+        std::printf("  %s\n", name);
+
+        for (SMath::Simd::Level level : levels)
+        {
+            if (level > SMath::Simd::GetSupportedLevel())
+                continue;
+
+            SMath::Simd::SetLevel(level);
+            double t = SMath::Bench::Measure([&]() {
+                uint32_t sum = 0;
+                for (const SMath::Ray<float>& ray : rays)
+                {
+                    SMath::RayHit<float> hit;
+                    uint32_t index = 0;
+                    if (SMath::Batch::Intersect(ray, std::span<const Primitive>(primitives), hit, index))
+                        sum += index;
+                }
+                SMath::Bench::DoNotOptimize(sum);
+            });
+            SMath::Bench::Report(SMath::Simd::GetLevelName(level), t, primitives.size() * rays.size());
+        }
+
+        SMath::Simd::ResetLevel();
+    }
+}
+
+BENCHMARK(Intersection)
+{
+    auto u = Uniform(PrimitiveCount * 12, 73, -8.0f, 8.0f);
+    std::vector<SMath::Sphere<float>> spheres;
+    std::vector<SMath::Plane<float>> planes;
+    std::vector<SMath::Disk<float>> disks;
+    std::vector<SMath::RibbonCurve<float>> ribbons;
+    for (size_t i = 0; i < PrimitiveCount; ++i)
+    {
+        const float* r = &u[i * 12];
+        spheres.emplace_back(Point3f(r), 0.3f);
+        planes.emplace_back(Vector3f(r[0], r[1], r[2]), r[3]);
+        disks.emplace_back(Point3f(r), Vector3f(r[3], r[4], r[5]), 0.5f);
+        ribbons.emplace_back(SMath::CubicBezier<float>(Point3f(r), Point3f(r + 3), Point3f(r + 6), Point3f(r + 9)), 0.05f, 0.02f);
+    }
+
+    auto v = Uniform(RayCount * 4, 79, -1.0f, 1.0f);
+    std::vector<SMath::Ray<float>> rays;
+    for (size_t i = 0; i < RayCount; ++i)
+    {
+        Point3f origin(v[i * 4] * 20.0f, v[i * 4 + 1] * 20.0f, -30.0f);
+        rays.emplace_back(origin, Point3f(v[i * 4 + 2] * 8.0f, v[i * 4 + 3] * 8.0f, 0.0f) - origin);
+    }
+
+    // Items are ray-primitive tests
+    Run("Spheres", spheres, rays);
+    Run("Planes", planes, rays);
+    Run("Disks", disks, rays);
+    Run("Ribbon curves", ribbons, rays);
+}
@@ -0,0 +1,120 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "kdtree.h"
+#include "batchops.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    constexpr int PointCount = 10000000;
+    constexpr int QueryCount = 1 << 16;
+    constexpr int BruteForceQueries = 16;
+    constexpr size_t K = 8;
+
+    std::vector<Point3f> MakePoints(int count, uint32_t seed)
+    {
+        std::vector<float> u(size_t(count) * 3);
+        SMath::Batch::FillUniform(std::span<float>(u), seed, -100.0f, 100.0f);
+
+        std::vector<Point3f> points(count);
+        for (int i = 0; i < count; ++i)
+            points[i] = Point3f(u[i * 3], u[i * 3 + 1], u[i * 3 + 2] * 0.05f);
+        return points;
+    }
+
+    // One pass over all points per query, keeping the k best in a sorted array
+    size_t BruteForceNearest(const std::vector<Point3f>& points, const Point3f& query, uint32_t* indices, float* distances)
+    {
+        size_t count = 0;
+        for (uint32_t i = 0; i < points.size(); ++i)
+        {
+            float dx = points[i].x - query.x, dy = points[i].y - query.y, dz = points[i].z - query.z;
+            float d = dx * dx + dy * dy + dz * dz;
+            if (count == K && d >= distances[K - 1])
+                continue;
+
+            size_t j = count < K ? count++ : K - 1;
+            for (; j > 0 && distances[j - 1] > d; --j)
+            {
+                distances[j] = distances[j - 1];
+                indices[j] = indices[j - 1];
+            }
+            distances[j] = d;
+            indices[j] = i;
+        }
+        return count;
+    }
+}
+
+BENCHMARK(KdTree)
+{
+    auto points = MakePoints(PointCount, 47);
+    auto queries = MakePoints(QueryCount, 53);
+
+    SMath::KdTree<float> tree;
+    double t = SMath::Bench::Measure([&]() { tree = SMath::KdTree<float>(points, 1); }, 1);
+    SMath::Bench::Report("Build, 10M points, 1 thread", t, PointCount);
+
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        t = SMath::Bench::Measure([&]() { tree = SMath::KdTree<float>(points); }, 1);
+        SMath::Bench::Report("Build, 10M points, all threads", t, PointCount);
+    }
+
+    std::vector<uint32_t> indices(QueryCount * K);
+    std::vector<float> distances(QueryCount * K);
+    t = SMath::Bench::Measure([&]() {
+        uint32_t sum = 0;
+        for (size_t q = 0; q < QueryCount; ++q)
+            sum += uint32_t(tree.FindNearest(queries[q], K, std::span<uint32_t>(indices).subspan(q * K, K),
+                                             std::span<float>(distances).subspan(q * K, K)));
+        SMath::Bench::DoNotOptimize(sum);
+    }, 3);
+    SMath::Bench::Report("8-NN, k-d tree (queries)", t, QueryCount);
+
+    t = SMath::Bench::Measure([&]() {
+        tree.FindNearest(queries, K, indices, distances);
+        SMath::Bench::DoNotOptimize(indices);
+    }, 3);
+    SMath::Bench::Report("8-NN, k-d tree batch (queries)", t, QueryCount);
+
+    t = SMath::Bench::Measure([&]() {
+        uint32_t sum = 0;
+        for (int q = 0; q < BruteForceQueries; ++q)
+            sum += uint32_t(BruteForceNearest(points, queries[q], &indices[q * K], &distances[q * K]));
+        SMath::Bench::DoNotOptimize(sum);
+    }, 1);
+    SMath::Bench::Report("8-NN, brute force (queries)", t, BruteForceQueries);
+
+    std::vector<uint32_t> found;
+    std::vector<size_t> offsets;
+    t = SMath::Bench::Measure([&]() {
+        tree.FindInRadius(queries, 0.5f, found, offsets);
+        SMath::Bench::DoNotOptimize(found);
+    }, 3);
+    SMath::Bench::Report("Radius 0.5, k-d tree batch (queries)", t, QueryCount);
+    std::printf("    %-48s %12.2f\n", "Mean points per radius query", double(found.size()) / QueryCount);
+}
@@ -0,0 +1,39 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+
+// Usage: Benchmarks [filter]
+// Only benchmarks whose name contains the filter substring are run.
+int main(int argc, char* argv[])
+{
+    const char* filter = argc > 1 ? argv[1] : "";
+
+    for (const SMath::Bench::Registration& reg : SMath::Bench::GetRegistry())
+    {
+        if (std::strstr(reg.m_Name, filter) == nullptr)
+            continue;
+
+        std::printf("[ RUN      ] %s\n", reg.m_Name);
+        reg.m_Func();
+    }
+
+    return 0;
+}
@@ -0,0 +1,131 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "linalg.h"
+#include "random.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 16;
+
+    template <typename T, int R, int C>
+    std::vector<SMath::Matrix<T, R, C>> RandomMatrices()
+    {
+        std::vector<SMath::Matrix<T, R, C>> m(Count);
+        for (auto& mi : m)
+            for (int i = 0; i < R * C; ++i)
+                mi[i] = T(SMath::Random::UniformFloat());
+        return m;
+    }
+
+    template <typename T, int N>
+    std::vector<SMath::Vector<T, N>> RandomVectors()
+    {
+        std::vector<SMath::Vector<T, N>> v(Count);
+        for (auto& vi : v)
+            for (int i = 0; i < N; ++i)
+                vi[i] = T(SMath::Random::UniformFloat());
+        return v;
+    }
+
+    template <typename T, int R, int C, int K>
+    void RunMultiply(const char* label)
+    {
+        auto a = RandomMatrices<T, R, C>();
+        auto b = RandomMatrices<T, C, K>();
+        std::vector<SMath::Matrix<T, R, K>> out(Count);
+
+        double t = SMath::Bench::Measure([&]() {
+            for (int i = 0; i < Count; ++i)
+                out[i] = a[i] * b[i];
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report(label, t, Count);
+    }
+
+    template <typename T, int R, int C>
+    void RunMatrixVector(const char* label)
+    {
+        auto m = RandomMatrices<T, R, C>();
+        auto v = RandomVectors<T, C>();
+        std::vector<SMath::Vector<T, R>> out(Count);
+
+        double t = SMath::Bench::Measure([&]() {
+            for (int i = 0; i < Count; ++i)
+                out[i] = m[i] * v[i];
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report(label, t, Count);
+    }
+
+    template <typename T, int R, int C>
+    void RunTranspose(const char* label)
+    {
+        auto m = RandomMatrices<T, R, C>();
+        std::vector<SMath::Matrix<T, C, R>> out(Count);
+
+        double t = SMath::Bench::Measure([&]() {
+            for (int i = 0; i < Count; ++i)
+                out[i] = m[i].Transposed();
+            SMath::Bench::DoNotOptimize(out);
+        });
+        SMath::Bench::Report(label, t, Count);
+    }
+}
+
+BENCHMARK(MatrixMultiply)
+{
+    RunMultiply<float, 2, 2, 2>("float 2x2 * 2x2");
+    RunMultiply<float, 3, 3, 3>("float 3x3 * 3x3");
+    RunMultiply<float, 3, 4, 4>("float 3x4 * 4x4");
+    RunMultiply<float, 4, 3, 4>("float 4x3 * 3x4");
+    RunMultiply<float, 4, 4, 4>("float 4x4 * 4x4");
+    RunMultiply<double, 3, 3, 3>("double 3x3 * 3x3");
+    RunMultiply<double, 4, 4, 4>("double 4x4 * 4x4");
+}
+
+BENCHMARK(MatrixVectorMultiply)
+{
+    RunMatrixVector<float, 2, 2>("float 2x2 * vec2");
+    RunMatrixVector<float, 3, 3>("float 3x3 * vec3");
+    RunMatrixVector<float, 3, 4>("float 3x4 * vec4");
+    RunMatrixVector<float, 4, 3>("float 4x3 * vec3");
+    RunMatrixVector<float, 4, 4>("float 4x4 * vec4");
+
+    auto affine = RandomMatrices<float, 3, 4>();
+    std::vector<SMath::Point<float, 3>> points(Count, SMath::Point<float, 3>(1.0f, 2.0f, 3.0f));
+
+    double t = SMath::Bench::Measure([&]() {
+        for (int i = 0; i < Count; ++i)
+            points[i] = affine[i] * points[i];
+        SMath::Bench::DoNotOptimize(points);
+    });
+    SMath::Bench::Report("float 3x4 affine * point3", t, Count);
+}
+
+BENCHMARK(MatrixTranspose)
+{
+    RunTranspose<float, 2, 2>("float 2x2");
+    RunTranspose<float, 3, 4>("float 3x4");
+    RunTranspose<float, 4, 4>("float 4x4");
+}
@@ -0,0 +1,100 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "normalencoding.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Normal<float, 3> Normal3f;
+
+    constexpr int Count = 1 << 22;
+
+    template <typename Code, typename Encode, typename Decode>
+    void Run(const char* name, const std::vector<Normal3f>& normals, Encode encode, Decode decode)
+    {
+        std::vector<Code> codes(Count);
+        std::vector<Normal3f> decoded(Count);
+        std::printf("  %s, %zu bytes per normal\n", name, sizeof(Code));
+
+        double t = SMath::Bench::Measure([&]() {
+            encode(std::span<const Normal3f>(normals), std::span<Code>(codes));
+            SMath::Bench::DoNotOptimize(codes);
+        });
+        SMath::Bench::Report("Encode", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            decode(std::span<const Code>(codes), std::span<Normal3f>(decoded));
+            SMath::Bench::DoNotOptimize(decoded);
+        });
+        SMath::Bench::Report("Decode", t, Count);
+        std::printf("    %-48s %12.2f\n", "Decode, GB/s of codes read", double(Count) * sizeof(Code) / t * 1e-9);
+    }
+}
+
+BENCHMARK(NormalEncoding)
+{
+    std::printf("  dispatching to %s\n", SMath::Simd::GetLevelName(SMath::Simd::GetLevel()));
+
+    std::vector<float> u(Count * 3);
+    SMath::Batch::FillUniform(std::span<float>(u), 71, -1.0f, 1.0f);
+    std::vector<Normal3f> normals(Count);
+    for (int i = 0; i < Count; ++i)
+        normals[i] = Normal3f(SMath::Vector<float, 3>(u[i * 3], u[i * 3 + 1], u[i * 3 + 2]).Normalized());
+
+    // Streaming the uncompressed normals, for the bandwidth the codes save
+    std::vector<Normal3f> copy(Count);
+    double t = SMath::Bench::Measure([&]() {
+        std::copy(normals.begin(), normals.end(), copy.begin());
+        SMath::Bench::DoNotOptimize(copy);
+    });
+    std::printf("  float3, %zu bytes per normal\n", sizeof(Normal3f));
+    SMath::Bench::Report("Copy", t, Count);
+
+    Run<SMath::Oct16>("Oct16", normals, SMath::Batch::EncodeOct16, SMath::Batch::DecodeOct16);
+    Run<SMath::Oct8>("Oct8", normals, SMath::Batch::EncodeOct8, SMath::Batch::DecodeOct8);
+    Run<SMath::Spheremap16>("Spheremap16", normals, SMath::Batch::EncodeSpheremap, SMath::Batch::DecodeSpheremap);
+
+    std::vector<SMath::Vector<float, 4>> tangents(Count);
+    for (int i = 0; i < Count; ++i)
+    {
+        SMath::Vector<float, 3> t = SMath::Vector<float, 3>::Cross(SMath::Vector<float, 3>(0.0f, 1.0f, 0.0f), normals[i]);
+        tangents[i] = SMath::Vector<float, 4>(t.x, t.y, t.z, (i & 1) ? 1.0f : -1.0f);
+    }
+
+    std::vector<SMath::QTangent> frames(Count);
+    std::vector<SMath::Vector<float, 4>> decodedTangents(Count);
+    std::printf("  QTangent, %zu bytes per frame vs %zu\n", sizeof(SMath::QTangent), sizeof(Normal3f) + sizeof(SMath::Vector<float, 4>));
+
+    t = SMath::Bench::Measure([&]() {
+        SMath::Batch::EncodeQTangent(normals, tangents, frames);
+        SMath::Bench::DoNotOptimize(frames);
+    });
+    SMath::Bench::Report("Encode", t, Count);
+
+    t = SMath::Bench::Measure([&]() {
+        SMath::Batch::DecodeQTangent(frames, copy, decodedTangents);
+        SMath::Bench::DoNotOptimize(copy);
+    });
+    SMath::Bench::Report("Decode", t, Count);
+}
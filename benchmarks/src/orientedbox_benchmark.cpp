@@ -0,0 +1,124 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "orientedbox.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 16;
+
+    template <typename T>
+    std::vector<SMath::OrientedBox<T>> MakeBoxes(const std::vector<float>& u)
+    {
+        std::vector<SMath::OrientedBox<T>> boxes(Count);
+        for (int i = 0; i < Count; ++i)
+        {
+            const float* r = &u[i * 8];
+            auto rotation = SMath::Quaternion<T>(T(r[0]), T(r[1]), T(r[2]), T(r[3])).Normalized();
+            boxes[i] = SMath::OrientedBox<T>(SMath::Point<T, 3>(T(r[4] * 20), T(r[5] * 20), T(r[6] * 20)), rotation,
+                                             SMath::Vector<T, 3>(T(1.5 + r[7]), T(1), T(0.5)));
+        }
+        return boxes;
+    }
+
+    template <typename T>
+    void BenchmarkPairs(const char* label, const std::vector<float>& u)
+    {
+        auto boxes = MakeBoxes<T>(u);
+
+        // Each box against the next 16, about one in seven pairs overlaps
+        size_t hits = 0;
+        double t = SMath::Bench::Measure([&]() {
+            hits = 0;
+            for (int i = 0; i < Count; ++i)
+                for (int j = 1; j <= 16; ++j)
+                    hits += boxes[i].Intersects(boxes[(i + j) % Count]);
+            SMath::Bench::DoNotOptimize(hits);
+        });
+        SMath::Bench::Report(label, t, Count * 16);
+    }
+}
+
+BENCHMARK(OrientedBoxPairs)
+{
+    std::vector<float> u(Count * 8);
+    SMath::Batch::FillUniform(std::span<float>(u), 13, -1.0f, 1.0f);
+
+    BenchmarkPairs<float>("OBB-OBB (float)", u);
+    BenchmarkPairs<double>("OBB-OBB (double)", u);
+
+    auto boxes = MakeBoxes<float>(u);
+    size_t hits = 0;
+    double t = SMath::Bench::Measure([&]() {
+        hits = 0;
+        float hit;
+        for (int i = 0; i < Count; ++i)
+        {
+            SMath::Ray<float> ray(SMath::Point<float, 3>(0.0f), SMath::Vector<float, 3>(u[i * 8 + 1], u[i * 8 + 2], u[i * 8 + 3]));
+            hits += boxes[i].Intersects(ray, hit);
+        }
+        SMath::Bench::DoNotOptimize(hits);
+    });
+    SMath::Bench::Report("OBB-Ray (float)", t, Count);
+}
+
+BENCHMARK(OrientedBoxFit)
+{
+    constexpr int PointCount = 1 << 20;
+    std::vector<float> u(PointCount * 3);
+    SMath::Batch::FillUniform(std::span<float>(u), 17, -1.0f, 1.0f);
+
+    std::vector<SMath::Point<float, 3>> points(PointCount);
+    std::vector<SMath::Point3> pointsd(PointCount);
+    for (int i = 0; i < PointCount; ++i)
+    {
+        points[i] = SMath::Point<float, 3>(u[i * 3] * 8.0f + u[i * 3 + 1], u[i * 3 + 1] * 3.0f, u[i * 3 + 2] - u[i * 3]);
+        pointsd[i] = SMath::Point3(points[i].x, points[i].y, points[i].z);
+    }
+
+    double t = SMath::Bench::Measure([&]() {
+        auto box = SMath::OrientedBox<double>::FitPca(pointsd);
+        SMath::Bench::DoNotOptimize(box);
+    });
+    SMath::Bench::Report("PCA fit (double, scalar)", t, PointCount);
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+            continue;
+
+        SMath::Simd::SetLevel(level);
+        t = SMath::Bench::Measure([&]() {
+            auto box = SMath::OrientedBox<float>::FitPca(points);
+            SMath::Bench::DoNotOptimize(box);
+        });
+
+        char label[64];
+        std::snprintf(label, sizeof(label), "PCA fit (%s)", SMath::Simd::GetLevelName(level));
+        SMath::Bench::Report(label, t, PointCount);
+    }
+
+    SMath::Simd::ResetLevel();
+}
@@ -0,0 +1,121 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "quaternionencoding.h"
+#include "batchops.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    typedef SMath::Quaternion<float> Quaternionf;
+    typedef SMath::Quaternion<double> Quaternion;
+
+    constexpr int Count = 1 << 22;
+
+    // Rotation angle between two unit quaternions in degrees, whichever sign each has
+    double AngleDegrees(const Quaternion& a, const Quaternion& b)
+    {
+        double sign = Quaternion::Dot(a, b) < 0.0 ? -1.0 : 1.0;
+        return 4.0 * std::asin(std::min((a - b * sign).Magnitude() * 0.5, 1.0)) * 180.0 / SMath::Pi;
+    }
+
+    // decode is called with both float and double quaternion outputs
+    template <typename Code, typename Encode, typename Decode>
+    void Run(const char* name, const std::vector<Quaternionf>& rotationsf, const std::vector<Quaternion>& rotations,
+             Encode encode, Decode decode)
+    {
+        std::vector<Code> codes(Count);
+        std::vector<Quaternionf> decoded(Count);
+        std::vector<Quaternion> decodedDouble(Count);
+        std::printf("  %s, %zu bytes per key\n", name, sizeof(Code));
+
+        double t = SMath::Bench::Measure([&]() {
+            encode(std::span<const Quaternionf>(rotationsf), std::span<Code>(codes));
+            SMath::Bench::DoNotOptimize(codes);
+        });
+        SMath::Bench::Report("Encode", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            decode(std::span<const Code>(codes), std::span<Quaternionf>(decoded));
+            SMath::Bench::DoNotOptimize(decoded);
+        });
+        SMath::Bench::Report("Decode to Quaternion<float>", t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            decode(std::span<const Code>(codes), std::span<Quaternion>(decodedDouble));
+            SMath::Bench::DoNotOptimize(decodedDouble);
+        });
+        SMath::Bench::Report("Decode to Quaternion<double>", t, Count);
+
+        double sum = 0.0, worst = 0.0;
+        for (int i = 0; i < Count; ++i)
+        {
+            double error = AngleDegrees(rotations[i], decodedDouble[i]);
+            sum += error;
+            worst = std::max(worst, error);
+        }
+        std::printf("    %-48s %12.5f\n", "Mean error, degrees", sum / Count);
+        std::printf("    %-48s %12.5f\n", "Max error, degrees", worst);
+    }
+}
+
+BENCHMARK(QuaternionEncoding)
+{
+    std::printf("  dispatching to %s\n", SMath::Simd::GetLevelName(SMath::Simd::GetLevel()));
+
+    // Uniform rotations: points in the 4-ball projected to the sphere. About 31% of the cube is inside.
+    std::vector<float> u(size_t(Count) * 16);
+    SMath::Batch::FillUniform(std::span<float>(u), 83, -1.0f, 1.0f);
+    std::vector<Quaternion> rotations;
+    std::vector<Quaternionf> rotationsf;
+    for (size_t i = 0; i + 4 <= u.size() && rotations.size() < Count; i += 4)
+    {
+        Quaternion q(u[i], u[i + 1], u[i + 2], u[i + 3]);
+        double length2 = q.SquareMagnitude();
+        if (length2 < 1e-4 || length2 > 1.0)
+            continue;
+
+        q = q / std::sqrt(length2);
+        rotations.push_back(q);
+        rotationsf.emplace_back(float(q.x), float(q.y), float(q.z), float(q.w));
+    }
+
+    // Streaming the uncompressed keys, for the bandwidth the codes save
+    std::vector<Quaternion> copy(Count);
+    double t = SMath::Bench::Measure([&]() {
+        std::copy(rotations.begin(), rotations.end(), copy.begin());
+        SMath::Bench::DoNotOptimize(copy);
+    });
+    std::printf("  Quaternion<double>, %zu bytes per key\n", sizeof(Quaternion));
+    SMath::Bench::Report("Copy", t, Count);
+
+    Run<SMath::SmallestThree32>("SmallestThree32", rotationsf, rotations,
+        [](auto in, auto out) { SMath::Batch::EncodeSmallestThree32(in, out); },
+        [](auto in, auto out) { SMath::Batch::DecodeSmallestThree32(in, out); });
+    Run<SMath::SmallestThree48>("SmallestThree48", rotationsf, rotations,
+        [](auto in, auto out) { SMath::Batch::EncodeSmallestThree48(in, out); },
+        [](auto in, auto out) { SMath::Batch::DecodeSmallestThree48(in, out); });
+    Run<SMath::QuaternionSnorm16>("QuaternionSnorm16", rotationsf, rotations,
+        [](auto in, auto out) { SMath::Batch::EncodeQuaternionSnorm16(in, out); },
+        [](auto in, auto out) { SMath::Batch::DecodeQuaternionSnorm16(in, out); });
+}
@@ -0,0 +1,156 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "recttree.h"
+#include "batchops.h"
+
+#include <cmath>
+#include <vector>
+#include <cstdio>
+
+namespace
+{
+    typedef SMath::Rect<float> Rectf;
+
+    constexpr int QueryCount = 1 << 16;
+    constexpr int LinearQueryCount = 256;
+
+    // Widget-sized rectangles at a fixed density, so results per query do not depend on the count
+    std::vector<Rectf> MakeRects(size_t count, uint32_t seed, float extent, float minSize, float maxSize)
+    {
+        std::vector<float> u(count * 4);
+        SMath::Batch::FillUniform(std::span<float>(u), seed, 0.0f, 1.0f);
+
+        std::vector<Rectf> rects(count);
+        for (size_t i = 0; i < count; ++i)
+            rects[i] = Rectf(u[i * 4] * extent, u[i * 4 + 1] * extent,
+                             minSize + u[i * 4 + 2] * (maxSize - minSize), minSize + u[i * 4 + 3] * (maxSize - minSize));
+        return rects;
+    }
+
+    template<typename Tree>
+    void RunQueries(const char* name, const Tree& tree, const std::vector<Rectf>& queries)
+    {
+        char label[64];
+        std::snprintf(label, sizeof(label), "%s, point (queries)", name);
+        double t = SMath::Bench::Measure([&]() {
+            uint32_t sum = 0;
+            for (const Rectf& query : queries)
+                tree.ForEachContaining(query.x, query.y, [&](uint32_t id) { sum += id; });
+            SMath::Bench::DoNotOptimize(sum);
+        });
+        SMath::Bench::Report(label, t, queries.size());
+
+        std::snprintf(label, sizeof(label), "%s, rect (queries)", name);
+        t = SMath::Bench::Measure([&]() {
+            uint32_t sum = 0;
+            for (const Rectf& query : queries)
+                tree.ForEachOverlapping(query, [&](uint32_t id) { sum += id; });
+            SMath::Bench::DoNotOptimize(sum);
+        });
+        SMath::Bench::Report(label, t, queries.size());
+    }
+
+    void Run(size_t count)
+    {
+        float extent = 40.0f * std::sqrt(float(count));
+        Rectf world(0.0f, 0.0f, extent, extent);
+        auto rects = MakeRects(count, 61, extent, 4.0f, 60.0f);
+        auto queries = MakeRects(QueryCount, 67, extent, 10.0f, 100.0f);
+        std::printf("  %zu rects\n", count);
+
+        SMath::RTree<float> rtree;
+        double t = SMath::Bench::Measure([&]() { rtree = SMath::RTree<float>(rects); }, 3);
+        SMath::Bench::Report("R-tree STR bulk load (rects)", t, count);
+
+        t = SMath::Bench::Measure([&]() {
+            SMath::RTree<float> tree;
+            for (const Rectf& rect : rects)
+                tree.Insert(rect);
+            SMath::Bench::DoNotOptimize(tree);
+        }, 1);
+        SMath::Bench::Report("R-tree inserts (rects)", t, count);
+
+        // Finest cells about the size of a typical rectangle
+        int depth = int(std::log2(extent / 32.0f));
+        SMath::LooseQuadtree<float> quadtree;
+        t = SMath::Bench::Measure([&]() {
+            quadtree = SMath::LooseQuadtree<float>(world, depth);
+            for (const Rectf& rect : rects)
+                quadtree.Insert(rect);
+        }, 3);
+        SMath::Bench::Report("Loose quadtree inserts (rects)", t, count);
+
+        // Moving items: remove and reinsert a slice, as for animated widgets
+        size_t moved = std::min<size_t>(count, 10000);
+        t = SMath::Bench::Measure([&]() {
+            for (uint32_t i = 0; i < moved; ++i)
+            {
+                rtree.Remove(i);
+                rtree.Insert(rects[i]);
+            }
+        });
+        SMath::Bench::Report("R-tree remove + insert (moves)", t, moved);
+
+        t = SMath::Bench::Measure([&]() {
+            for (uint32_t i = 0; i < moved; ++i)
+            {
+                quadtree.Remove(i);
+                quadtree.Insert(rects[i]);
+            }
+        });
+        SMath::Bench::Report("Loose quadtree remove + insert (moves)", t, moved);
+
+        RunQueries("R-tree", rtree, queries);
+        RunQueries("Loose quadtree", quadtree, queries);
+
+        t = SMath::Bench::Measure([&]() {
+            uint32_t sum = 0;
+            for (int q = 0; q < LinearQueryCount; ++q)
+                for (uint32_t i = 0; i < rects.size(); ++i)
+                    if (rects[i].Contains(queries[q].x, queries[q].y))
+                        sum += i;
+            SMath::Bench::DoNotOptimize(sum);
+        }, 1);
+        SMath::Bench::Report("Linear scan, point (queries)", t, LinearQueryCount);
+
+        t = SMath::Bench::Measure([&]() {
+            uint32_t sum = 0;
+            for (int q = 0; q < LinearQueryCount; ++q)
+                for (uint32_t i = 0; i < rects.size(); ++i)
+                    if (rects[i].Overlaps(queries[q]))
+                        sum += i;
+            SMath::Bench::DoNotOptimize(sum);
+        }, 1);
+        SMath::Bench::Report("Linear scan, rect (queries)", t, LinearQueryCount);
+
+        std::vector<uint32_t> ids;
+        for (const Rectf& query : queries)
+            rtree.FindOverlapping(query, ids);
+        std::printf("    %-48s %12.2f\n", "Mean results per rect query", double(ids.size()) / QueryCount);
+    }
+}
+
+BENCHMARK(RectTree)
+{
+    Run(10000);
+    Run(1000000);
+}
@@ -0,0 +1,87 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "spatialhashgrid.h"
+#include "kdtree.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    constexpr int ParticleCount = 1 << 20;
+
+    // 2^20 particles in a 100^3 box is 1.05 per unit volume, so a sphere of Radius holds
+    // about 30 neighbours, as in a typical SPH setup
+    constexpr float Extent = 50.0f;
+    constexpr float Radius = 1.9f;
+}
+
+BENCHMARK(SpatialHashGrid)
+{
+    std::vector<float> u(ParticleCount * 3);
+    SMath::Batch::FillUniform(std::span<float>(u), 59, -Extent, Extent);
+    std::vector<Point3f> particles(ParticleCount);
+    for (int i = 0; i < ParticleCount; ++i)
+        particles[i] = Point3f(u[i * 3], u[i * 3 + 1], u[i * 3 + 2]);
+
+    SMath::SpatialHashGrid<float> grid;
+    double t = SMath::Bench::Measure([&]() { grid = SMath::SpatialHashGrid<float>(particles, Radius, 1); });
+    SMath::Bench::Report("Build, 1M particles, 1 thread", t, ParticleCount);
+
+    if (std::thread::hardware_concurrency() > 1)
+    {
+        t = SMath::Bench::Measure([&]() { grid = SMath::SpatialHashGrid<float>(particles, Radius); });
+        SMath::Bench::Report("Build, 1M particles, all threads", t, ParticleCount);
+    }
+
+    t = SMath::Bench::Measure([&]() {
+        SMath::KdTree<float> tree(particles);
+        SMath::Bench::DoNotOptimize(tree);
+    }, 1);
+    SMath::Bench::Report("KdTree build, for reference", t, ParticleCount);
+
+    // Density-style pass: every particle visits its neighbours. Simulations usually keep
+    // particles in grid order, which keeps consecutive queries in cache.
+    auto density = [&](const std::vector<Point3f>& order) {
+        return SMath::Bench::Measure([&]() {
+            float sum = 0.0f;
+            for (const Point3f& p : order)
+                grid.ForEachInRadius(p, Radius, [&](uint32_t, float squareDistance) {
+                    sum += Radius * Radius - squareDistance;
+                });
+            SMath::Bench::DoNotOptimize(sum);
+        }, 1);
+    };
+    SMath::Bench::Report("ForEachInRadius, input order (queries)", density(particles), ParticleCount);
+    SMath::Bench::Report("ForEachInRadius, grid order (queries)", density(grid.m_Points), ParticleCount);
+
+    std::vector<uint32_t> indices;
+    std::vector<size_t> offsets;
+    t = SMath::Bench::Measure([&]() {
+        grid.FindInRadius(particles, Radius, indices, offsets);
+        SMath::Bench::DoNotOptimize(indices);
+    }, 1);
+    SMath::Bench::Report("FindInRadius batch, all particles (queries)", t, ParticleCount);
+    std::printf("    %-48s %12.2f\n", "Mean neighbours per particle", double(indices.size()) / ParticleCount);
+}
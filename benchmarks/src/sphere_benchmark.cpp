@@ -0,0 +1,83 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "sphere.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 20;
+
+    typedef SMath::Point<float, 3> Point3f;
+}
+
+BENCHMARK(SphereFit)
+{
+    std::vector<float> u(Count * 3);
+    SMath::Batch::FillUniform(std::span<float>(u), 5, -1.0f, 1.0f);
+
+    std::vector<Point3f> points(Count);
+    for (int i = 0; i < Count; ++i)
+        points[i] = Point3f(u[i * 3] * 40.0f, u[i * 3 + 1] * 10.0f, u[i * 3 + 2] * 25.0f);
+
+    std::vector<SMath::Point3> pointsd(Count);
+    for (int i = 0; i < Count; ++i)
+        pointsd[i] = SMath::Point3(points[i].x, points[i].y, points[i].z);
+
+    double radius = 0.0;
+    double t = SMath::Bench::Measure([&]() {
+        radius = SMath::Sphere<double>::FitEpos6(pointsd).m_Radius;
+        SMath::Bench::DoNotOptimize(radius);
+    });
+    SMath::Bench::Report("EPOS-6 (double, scalar)", t, Count);
+
+    const SMath::Simd::Level levels[] = { SMath::Simd::Level::Scalar, SMath::Simd::Level::Sse2, SMath::Simd::Level::Avx2, SMath::Simd::Level::Avx512 };
+    for (SMath::Simd::Level level : levels)
+    {
+        if (level > SMath::Simd::GetSupportedLevel())
+            continue;
+
+        SMath::Simd::SetLevel(level);
+        char label[64];
+
+        float ritter = 0.0f, epos = 0.0f;
+        t = SMath::Bench::Measure([&]() {
+            ritter = SMath::Sphere<float>::FitRitter(points).m_Radius;
+            SMath::Bench::DoNotOptimize(ritter);
+        });
+        std::snprintf(label, sizeof(label), "Ritter (%s)", SMath::Simd::GetLevelName(level));
+        SMath::Bench::Report(label, t, Count);
+
+        t = SMath::Bench::Measure([&]() {
+            epos = SMath::Sphere<float>::FitEpos6(points).m_Radius;
+            SMath::Bench::DoNotOptimize(epos);
+        });
+        std::snprintf(label, sizeof(label), "EPOS-6 (%s)", SMath::Simd::GetLevelName(level));
+        SMath::Bench::Report(label, t, Count);
+
+        if (level == SMath::Simd::GetSupportedLevel())
+            std::printf("    radius: Ritter %.3f, EPOS-6 %.3f\n", ritter, epos);
+    }
+
+    SMath::Simd::ResetLevel();
+}
@@ -0,0 +1,104 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "tilescheduler.h"
+
+#include <vector>
+#include <cstdio>
+
+namespace
+{
+    constexpr int Width = 1024;
+    constexpr int Height = 1024;
+    constexpr int TileSize = 32;
+    constexpr int MaxIterations = 256;
+
+    // Mandelbrot iterations, so the cost per pixel varies by two orders of magnitude across the image
+    inline uint8_t Shade(int x, int y)
+    {
+        float cr = -2.0f + 2.6f * float(x) / Width;
+        float ci = -1.3f + 2.6f * float(y) / Height;
+        float zr = 0.0f, zi = 0.0f;
+        int i = 0;
+        for (; i < MaxIterations && zr * zr + zi * zi < 4.0f; ++i)
+        {
+            float t = zr * zr - zi * zi + cr;
+            zi = 2.0f * zr * zi + ci;
+            zr = t;
+        }
+        return uint8_t(i);
+    }
+
+    void ShadeTile(std::vector<uint8_t>& image, const SMath::Rect<int>& tile)
+    {
+        for (int y = tile.y; y < tile.y + tile.h; ++y)
+            for (int x = tile.x; x < tile.x + tile.w; ++x)
+                image[size_t(y) * Width + x] = Shade(x, y);
+    }
+}
+
+BENCHMARK(TileScheduler)
+{
+    SMath::Rect area(0, 0, Width, Height);
+    std::vector<uint8_t> image(size_t(Width) * Height);
+    char label[64];
+
+    double t = SMath::Bench::Measure([&]() {
+        auto tiles = SMath::TileScheduler<int>::GenerateTiles(area, 8, 8, SMath::TileOrder::Hilbert);
+        SMath::Bench::DoNotOptimize(tiles);
+    });
+    SMath::Bench::Report("Generate 16K Hilbert tiles (tiles)", t, (Width / 8) * (Height / 8));
+
+    SMath::TileScheduler<int> scheduler(area, TileSize, TileSize);
+    for (int threads : { 1, 2, 4, 8, 16, 32, 64 })
+    {
+        std::printf("  %d threads\n", threads);
+
+        // Baseline: equal bands of rows, one per thread, as the renderer did by hand
+        t = SMath::Bench::Measure([&]() {
+            SMath::Simd::ParallelSlices(Height, threads, [&](size_t begin, size_t end, int) {
+                ShadeTile(image, SMath::Rect(0, int(begin), Width, int(end - begin)));
+            });
+            SMath::Bench::DoNotOptimize(image);
+        });
+        SMath::Bench::Report("Static row bands (pixels)", t, Width * Height);
+
+        t = SMath::Bench::Measure([&]() {
+            scheduler.Run([&](const SMath::Rect<int>& tile, int) { ShadeTile(image, tile); }, threads);
+            SMath::Bench::DoNotOptimize(image);
+        });
+        SMath::Bench::Report("Work stealing tiles (pixels)", t, Width * Height);
+    }
+
+    std::printf("  All hardware threads\n");
+    const SMath::TileOrder orders[] = { SMath::TileOrder::RowMajor, SMath::TileOrder::Spiral, SMath::TileOrder::Hilbert, SMath::TileOrder::Morton };
+    const char* names[] = { "RowMajor", "Spiral", "Hilbert", "Morton" };
+    for (int i = 0; i < 4; ++i)
+    {
+        SMath::TileScheduler<int> ordered(area, TileSize, TileSize, orders[i]);
+        t = SMath::Bench::Measure([&]() {
+            ordered.Run([&](const SMath::Rect<int>& tile, int) { ShadeTile(image, tile); });
+            SMath::Bench::DoNotOptimize(image);
+        });
+        std::snprintf(label, sizeof(label), "%s order (pixels)", names[i]);
+        SMath::Bench::Report(label, t, Width * Height);
+    }
+}
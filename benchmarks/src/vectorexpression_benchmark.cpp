@@ -0,0 +1,87 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "benchmark.h"
+#include "linalg.h"
+#include "random.h"
+#include "vectorexpression.h"
+
+#include <vector>
+
+namespace
+{
+    constexpr int Count = 1 << 18;
+
+    template <typename T>
+    std::vector<SMath::Vector<T, 3>> RandomColors()
+    {
+        std::vector<SMath::Vector<T, 3>> v(Count);
+        for (auto& vi : v)
+            vi = SMath::Vector<T, 3>(T(SMath::Random::UniformFloat()), T(SMath::Random::UniformFloat()), T(SMath::Random::UniformFloat()));
+        return v;
+    }
+
+    template <typename T>
+    void RunShading(const char* name)
+    {
+        using SMath::Expression::Lazy;
+        using SMath::Expression::Evaluate;
+
+        auto albedo = RandomColors<T>();
+        auto diffuse = RandomColors<T>();
+        auto specular = RandomColors<T>();
+        auto gloss = RandomColors<T>();
+        auto ambient = RandomColors<T>();
+        auto occlusion = RandomColors<T>();
+        auto emission = RandomColors<T>();
+        auto exposure = RandomColors<T>();
+        std::vector<SMath::Vector<T, 3>> out(Count);
+
+        std::printf("  %s\n", name);
+
+        // 7 operators: the eager form materializes 7 temporary Vectors per evaluation
+        auto eager = [&]() {
+            for (int i = 0; i < Count; ++i)
+                out[i] = (albedo[i] * diffuse[i] + specular[i] * gloss[i] - ambient[i] * occlusion[i] + emission[i]) * exposure[i];
+            SMath::Bench::DoNotOptimize(out);
+        };
+        SMath::Bench::Report("eager (7 temporaries)", SMath::Bench::Measure(eager), Count);
+        SMath::Bench::ReportInstructions(SMath::Bench::CountInstructions(eager), Count);
+
+        auto fused = [&]() {
+            for (int i = 0; i < Count; ++i)
+                out[i] = Evaluate((Lazy(albedo[i]) * diffuse[i] + Lazy(specular[i]) * gloss[i] - Lazy(ambient[i]) * occlusion[i] + emission[i]) * exposure[i]);
+            SMath::Bench::DoNotOptimize(out);
+        };
+        SMath::Bench::Report("expression (fused, 0 temporaries)", SMath::Bench::Measure(fused), Count);
+        SMath::Bench::ReportInstructions(SMath::Bench::CountInstructions(fused), Count);
+    }
+}
+
+BENCHMARK(VectorExpressionShading)
+{
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+    std::printf("  hardware FMA contraction enabled\n");
+#else
+    std::printf("  hardware FMA unavailable for this target, products and sums are separate\n");
+#endif
+    RunShading<float>("float3");
+    RunShading<double>("double3");
+}
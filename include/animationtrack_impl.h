@@ -0,0 +1,319 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T, typename V>
+KeyframeTrack<T, V>::KeyframeTrack(std::vector<T> times, std::vector<V> values, TrackInterpolation interpolation)
+    : m_Interpolation(interpolation)
+    , m_Times(std::move(times))
+    , m_Values(std::move(values))
+{
+    assert(!m_Times.empty() && m_Times.size() == m_Values.size() && m_Times.size() < 0xffffffffu);
+    assert(std::adjacent_find(m_Times.begin(), m_Times.end(), std::greater_equal<T>()) == m_Times.end());
+    assert(interpolation != TrackInterpolation::Squad || IsRotation);
+
+    MakeRotationsContinuous();
+    if (interpolation == TrackInterpolation::CubicHermite)
+        ComputeCatmullRomTangents();
+    else if (interpolation == TrackInterpolation::Squad)
+        ComputeSquadControls();
+}
+
+template<typename T, typename V>
+KeyframeTrack<T, V>::KeyframeTrack(std::vector<T> times, std::vector<V> values, std::vector<V> inTangents, std::vector<V> outTangents)
+    : m_Interpolation(TrackInterpolation::CubicHermite)
+    , m_Times(std::move(times))
+    , m_Values(std::move(values))
+    , m_InTangents(std::move(inTangents))
+    , m_OutTangents(std::move(outTangents))
+{
+    assert(!m_Times.empty() && m_Times.size() == m_Values.size() && m_Times.size() < 0xffffffffu);
+    assert(m_InTangents.size() == m_Values.size() && m_OutTangents.size() == m_Values.size());
+    assert(std::adjacent_find(m_Times.begin(), m_Times.end(), std::greater_equal<T>()) == m_Times.end());
+
+    MakeRotationsContinuous();
+}
+
+template<typename T, typename V>
+size_t KeyframeTrack<T, V>::GetKeyCount() const
+{
+    return m_Times.size();
+}
+
+template<typename T, typename V>
+T KeyframeTrack<T, V>::GetStartTime() const
+{
+    return m_Times.front();
+}
+
+template<typename T, typename V>
+T KeyframeTrack<T, V>::GetEndTime() const
+{
+    return m_Times.back();
+}
+
+template<typename T, typename V>
+V KeyframeTrack<T, V>::Sample(T time) const
+{
+    if (m_Times.size() == 1)
+        return m_Values[0];
+    return Interpolate(FindKey(time), time);
+}
+
+template<typename T, typename V>
+V KeyframeTrack<T, V>::Sample(T time, TrackCursor& cursor) const
+{
+    if (m_Times.size() == 1)
+        return m_Values[0];
+    return Interpolate(FindKey(time, cursor), time);
+}
+
+template<typename T, typename V>
+size_t KeyframeTrack<T, V>::FindKey(T time) const
+{
+    if (m_Times.size() < 2)
+        return 0;
+
+    // The last segment also takes times at and past the final key
+    size_t key = std::upper_bound(m_Times.begin() + 1, m_Times.end() - 1, time) - m_Times.begin();
+    return key - 1;
+}
+
+template<typename T, typename V>
+size_t KeyframeTrack<T, V>::FindKey(T time, TrackCursor& cursor) const
+{
+    size_t key = cursor.m_Key;
+    size_t last = m_Times.size() - 1;
+
+    // Same segment or the next one covers playback at or above the key rate
+    if (key < last && (m_Times[key] <= time || key == 0))
+    {
+        if (time < m_Times[key + 1] || key + 1 == last)
+            return key;
+        if (time < m_Times[key + 2] || key + 2 == last)
+        {
+            cursor.m_Key = uint32_t(key + 1);
+            return key + 1;
+        }
+    }
+
+    key = FindKey(time);
+    cursor.m_Key = uint32_t(key);
+    return key;
+}
+
+template<typename T, typename V>
+V KeyframeTrack<T, V>::Interpolate(size_t key, T time) const
+{
+    T dt = m_Times[key + 1] - m_Times[key];
+    T s = std::clamp((time - m_Times[key]) / dt, T(0), T(1));
+    const V& a = m_Values[key];
+    const V& b = m_Values[key + 1];
+
+    if (m_Interpolation == TrackInterpolation::CubicHermite)
+    {
+        T s2 = s * s;
+        T s3 = s2 * s;
+        V v = a * (T(2) * s3 - T(3) * s2 + T(1)) + m_OutTangents[key] * ((s3 - T(2) * s2 + s) * dt) +
+              b * (T(3) * s2 - T(2) * s3) + m_InTangents[key + 1] * ((s3 - s2) * dt);
+        if constexpr (IsRotation)
+            v.Normalize();
+        return v;
+    }
+
+    if constexpr (IsRotation)
+    {
+        // FastMath is only accurate to float, so double tracks keep the exact slerp
+        Quaternion<T> q;
+        if constexpr (std::is_same_v<T, float>)
+            q = FastMath::Slerp(a, b, s);
+        else
+            q = Quaternion<T>::Slerp(a, b, s);
+        if (m_Interpolation == TrackInterpolation::Squad)
+            q = SlerpNoInvert(q, SlerpNoInvert(m_Controls[key], m_Controls[key + 1], s), T(2) * s * (T(1) - s));
+        return q;
+    }
+    else
+    {
+        return a + (b - a) * s;
+    }
+}
+
+template<typename T, typename V>
+void KeyframeTrack<T, V>::MakeRotationsContinuous()
+{
+    if constexpr (IsRotation)
+    {
+        for (size_t k = 1; k < m_Values.size(); ++k)
+        {
+            if (Quaternion<T>::Dot(m_Values[k - 1], m_Values[k]) >= T(0))
+                continue;
+
+            m_Values[k] = -m_Values[k];
+            if (!m_InTangents.empty())
+            {
+                m_InTangents[k] = -m_InTangents[k];
+                m_OutTangents[k] = -m_OutTangents[k];
+            }
+        }
+    }
+}
+
+template<typename T, typename V>
+void KeyframeTrack<T, V>::ComputeCatmullRomTangents()
+{
+    size_t count = m_Values.size();
+    m_InTangents.resize(count);
+    for (size_t k = 0; k < count; ++k)
+    {
+        size_t prev = k > 0 ? k - 1 : k;
+        size_t next = k + 1 < count ? k + 1 : k;
+        m_InTangents[k] = prev == next ? V(T(0)) : (m_Values[next] - m_Values[prev]) * (T(1) / (m_Times[next] - m_Times[prev]));
+    }
+    m_OutTangents = m_InTangents;
+}
+
+template<typename T, typename V>
+void KeyframeTrack<T, V>::ComputeSquadControls()
+{
+    if constexpr (IsRotation)
+    {
+        // Logarithm and exponential of unit quaternions, as pure quaternions (w = 0)
+        auto log = [](const Quaternion<T>& q) {
+            T length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+            T scale = length > T(1e-12) ? std::atan2(length, q.w) / length : T(1);
+            return Quaternion<T>(q.x * scale, q.y * scale, q.z * scale, T(0));
+        };
+        auto exp = [](const Quaternion<T>& q) {
+            T angle = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z);
+            T scale = angle > T(1e-12) ? std::sin(angle) / angle : T(1);
+            return Quaternion<T>(q.x * scale, q.y * scale, q.z * scale, std::cos(angle));
+        };
+
+        // s_k = q_k * exp(-(log(q_k^-1 q_k+1) + log(q_k^-1 q_k-1)) / 4), the end keys are their own controls
+        m_Controls = m_Values;
+        for (size_t k = 1; k + 1 < m_Values.size(); ++k)
+        {
+            Quaternion<T> inverse = m_Values[k].Conjugate();
+            Quaternion<T> sum = log(inverse * m_Values[k + 1]) + log(inverse * m_Values[k - 1]);
+            m_Controls[k] = (m_Values[k] * exp(sum * T(-0.25))).Normalized();
+        }
+    }
+}
+
+template<typename T>
+AnimationClip<T>::AnimationClip(std::vector<VectorTrack<T>> vectorTracks, std::vector<RotationTrack<T>> rotationTracks)
+    : m_VectorTracks(std::move(vectorTracks))
+    , m_RotationTracks(std::move(rotationTracks))
+{
+}
+
+template<typename T>
+size_t AnimationClip<T>::GetTrackCount() const
+{
+    return m_VectorTracks.size() + m_RotationTracks.size();
+}
+
+template<typename T>
+T AnimationClip<T>::GetDuration() const
+{
+    T duration = T(0);
+    for (const VectorTrack<T>& track : m_VectorTracks)
+        duration = std::max(duration, track.GetEndTime());
+    for (const RotationTrack<T>& track : m_RotationTracks)
+        duration = std::max(duration, track.GetEndTime());
+    return duration;
+}
+
+// Squad blends along the arc between its operands even when it is the longer one (Shoemake 1987):
+// switching to the shorter arc where their dot changes sign would make the curve jump
+template<typename T, typename V>
+Quaternion<T> KeyframeTrack<T, V>::SlerpNoInvert(const Quaternion<T>& a, const Quaternion<T>& b, T t)
+{
+    T dot = Quaternion<T>::Dot(a, b);
+    if (dot > T(0.9995f))
+        return Quaternion<T>::Lerp(a, b, t);
+
+    // Nearly opposite operands would lerp through zero, and the arc between them is ill-defined.
+    // Go through a quaternion perpendicular to a instead; both halves are well-conditioned.
+    if (dot < T(-0.9995f))
+    {
+        Quaternion<T> perpendicular(-a.y, a.x, -a.w, a.z);
+        return t < T(0.5f) ? SlerpNoInvert(a, perpendicular, T(2) * t) : SlerpNoInvert(perpendicular, b, T(2) * t - T(1));
+    }
+
+    T sinT, cosT, rcpSinTheta;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        FastMath::SinCos(t * FastMath::Acos(dot), sinT, cosT);
+        rcpSinTheta = FastMath::Rsqrt(T(1) - dot * dot);
+    }
+    else
+    {
+        T angle = t * std::acos(dot);
+        sinT = std::sin(angle);
+        cosT = std::cos(angle);
+        rcpSinTheta = T(1) / std::sqrt(T(1) - dot * dot);
+    }
+    T wb = sinT * rcpSinTheta;
+    T wa = cosT - dot * wb;
+
+    return a * wa + b * wb;
+}
+
+template<typename T>
+void AnimationClip<T>::Sample(T time, std::span<TrackCursor> cursors, std::span<Vector<T, 3>> vectors, std::span<Quaternion<T>> rotations,
+                              int threadCount) const
+{
+    assert(cursors.size() == GetTrackCount());
+    assert(vectors.size() == m_VectorTracks.size() && rotations.size() == m_RotationTracks.size());
+
+    // A track sample costs roughly what bounding 32 points does, so one thread per 8192 tracks
+    constexpr size_t SampleCost = 32;
+    size_t vectorCount = m_VectorTracks.size();
+    size_t count = GetTrackCount();
+    int threads = Simd::GetThreadCount(count * SampleCost, threadCount);
+
+    // Each track is a separate allocation, so a large clip is bound by cache misses. Fetching the
+    // keys under the cursors a few tracks ahead overlaps them with the interpolation.
+    auto sampleTracks = [&](const auto& tracks, auto results, std::span<TrackCursor> trackCursors, size_t begin, size_t end) {
+        constexpr size_t Distance = 8;
+        for (size_t i = begin; i < end; ++i)
+        {
+#if defined(SMATH_X86)
+            if (i + Distance < end)
+            {
+                const auto& ahead = tracks[i + Distance];
+                uint32_t key = trackCursors[i + Distance].m_Key;
+                _mm_prefetch(reinterpret_cast<const char*>(ahead.m_Times.data() + key), _MM_HINT_T0);
+                _mm_prefetch(reinterpret_cast<const char*>(ahead.m_Values.data() + key), _MM_HINT_T0);
+            }
+#endif
+            results[i] = tracks[i].Sample(time, trackCursors[i]);
+        }
+    };
+
+    std::span<TrackCursor> rotationCursors = cursors.subspan(vectorCount);
+    Simd::ParallelSlices(count, threads, [&](size_t begin, size_t end, int) {
+        if (begin < vectorCount)
+            sampleTracks(m_VectorTracks, vectors, cursors, begin, std::min(end, vectorCount));
+        if (end > vectorCount)
+            sampleTracks(m_RotationTracks, rotations, rotationCursors, std::max(begin, vectorCount) - vectorCount, end - vectorCount);
+    });
+}
@@ -0,0 +1,130 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include "curve.h"
+#include "dispatch.h"
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(CubicBezier<float>) == 12 * sizeof(float), "Curve kernels walk CubicBezier arrays as packed floats");
+
+    struct CurveKernels
+    {
+        void (*Evaluate)(const CubicBezier<float>& curve, const float* t, Point<float, 3>* out, size_t count);
+        void (*EvaluateCurves)(const CubicBezier<float>* curves, const float* t, Point<float, 3>* out, size_t count);
+        void (*Tessellate)(const CubicBezier<float>* curves, size_t curveCount, size_t pointCount, Point<float, 3>* out);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    inline void EvaluateCurveArray(const CubicBezier<float>& curve, const float* t, Point<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = curve.Evaluate(t[i]);
+    }
+
+    inline void EvaluateCurvesArray(const CubicBezier<float>* curves, const float* t, Point<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = curves[i].Evaluate(t[i]);
+    }
+
+    inline void TessellateCurveArray(const CubicBezier<float>* curves, size_t curveCount, size_t pointCount, Point<float, 3>* out)
+    {
+        for (size_t i = 0; i < curveCount; ++i)
+            curves[i].Tessellate(std::span<Point<float, 3>>(out + i * pointCount, pointCount));
+    }
+
+    inline constexpr CurveKernels CurveTable = {
+        EvaluateCurveArray, EvaluateCurvesArray, TessellateCurveArray
+    };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "batchcurve_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "batchcurve_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "batchcurve_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const CurveKernels& GetCurveKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::CurveTable, Sse2::CurveTable, Avx2::CurveTable, Avx512::CurveTable);
+#else
+        return Scalar::CurveTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Cubic Bezier evaluation on the instruction set selected by
+     * Simd::GetLevel. Lanes run over parameters or over curves, in the
+     * power basis with fused multiply-adds, so results can differ from
+     * CubicBezier::Evaluate in the last bits. Longer curves made of
+     * several segments are CubicSpline::m_Segments.
+     */
+
+    // out[i] = curve at t[i]
+    inline void Evaluate(const CubicBezier<float>& curve, std::span<const float> t, std::span<Point<float, 3>> out)
+    {
+        assert(t.size() == out.size());
+        Simd::GetCurveKernels().Evaluate(curve, t.data(), out.data(), t.size());
+    }
+
+    // out[i] = curves[i] at t[i]
+    inline void Evaluate(std::span<const CubicBezier<float>> curves, std::span<const float> t, std::span<Point<float, 3>> out)
+    {
+        assert(curves.size() == t.size() && curves.size() == out.size());
+        Simd::GetCurveKernels().EvaluateCurves(curves.data(), t.data(), out.data(), curves.size());
+    }
+
+    // pointCount evenly spaced points per curve, as CubicBezier::Tessellate, curve i at out[i * pointCount].
+    // Lanes hold consecutive points of one curve and step Width points at a time by forward differencing.
+    inline void Tessellate(std::span<const CubicBezier<float>> curves, size_t pointCount, std::span<Point<float, 3>> out)
+    {
+        assert(out.size() == curves.size() * pointCount);
+        Simd::GetCurveKernels().Tessellate(curves.data(), curves.size(), pointCount, out.data());
+    }
+}
@@ -0,0 +1,159 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Lane versions of the batchcurve.h kernels, included once per ISA
+ * namespace the same way as batchmath_impl.h. Whole vectors run on the
+ * namespace's lanes and the remaining elements go through the Scalar loops.
+ */
+
+struct CurveLanes
+{
+    Float x, y, z;
+};
+
+// Power basis of one curve per axis, broadcast to all lanes
+struct CurveCoefficients
+{
+    Float c[3][4];
+
+    CurveCoefficients(const CubicBezier<float>& curve)
+    {
+        Vector<float, 3> coefficients[4];
+        curve.GetPowerBasis(coefficients);
+        for (int axis = 0; axis < 3; ++axis)
+            for (int k = 0; k < 4; ++k)
+                c[axis][k] = Float(coefficients[k][axis]);
+    }
+
+    CurveLanes Evaluate(Float t) const
+    {
+        CurveLanes p;
+        p.x = MulAdd(MulAdd(MulAdd(c[0][3], t, c[0][2]), t, c[0][1]), t, c[0][0]);
+        p.y = MulAdd(MulAdd(MulAdd(c[1][3], t, c[1][2]), t, c[1][1]), t, c[1][0]);
+        p.z = MulAdd(MulAdd(MulAdd(c[2][3], t, c[2][2]), t, c[2][1]), t, c[2][0]);
+        return p;
+    }
+};
+
+inline void EvaluateCurveArray(const CubicBezier<float>& curve, const float* t, Point<float, 3>* out, size_t count)
+{
+    CurveCoefficients coefficients(curve);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        CurveLanes p = coefficients.Evaluate(Load(t + i));
+        StoreInterleaved3(out[i].m_Data, p.x, p.y, p.z);
+    }
+    Scalar::EvaluateCurveArray(curve, t + i, out + i, count - i);
+}
+
+inline void EvaluateCurvesArray(const CubicBezier<float>* curves, const float* t, Point<float, 3>* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float s = Load(t + i);
+        Float r = Float(1.0f) - s;
+        Float b0 = r * r * r;
+        Float b1 = Float(3.0f) * r * r * s;
+        Float b2 = Float(3.0f) * r * s * s;
+        Float b3 = s * s * s;
+
+        // Control point j of each lane's curve is 12 floats from the next lane's
+        const float* p = curves[i].m_Points[0].m_Data;
+        Float axes[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            axes[axis] = MulAdd(b0, LoadStrided(p + axis, 12), MulAdd(b1, LoadStrided(p + 3 + axis, 12),
+                         MulAdd(b2, LoadStrided(p + 6 + axis, 12), b3 * LoadStrided(p + 9 + axis, 12))));
+        }
+        StoreInterleaved3(out[i].m_Data, axes[0], axes[1], axes[2]);
+    }
+    Scalar::EvaluateCurvesArray(curves + i, t + i, out + i, count - i);
+}
+
+inline void TessellateCurveArray(const CubicBezier<float>* curves, size_t curveCount, size_t pointCount, Point<float, 3>* out)
+{
+    // Too few points for a full vector
+    if (pointCount < Width)
+    {
+        Scalar::TessellateCurveArray(curves, curveCount, pointCount, out);
+        return;
+    }
+
+    float h = 1.0f / float(pointCount - 1);
+    float step = h * float(Width);
+    Float t = ToFloat(LaneIndex()) * Float(h);
+
+    for (size_t c = 0; c < curveCount; ++c)
+    {
+        const CubicBezier<float>& curve = curves[c];
+        Point<float, 3>* points = out + c * pointCount;
+        CurveCoefficients coefficients(curve);
+
+        // Lane j follows the cubic through t_j + k * step. Differences at step H from the power basis:
+        // d1 = c3 (3t^2 H + 3t H^2 + H^3) + c2 (2t H + H^2) + c1 H, d2 = 6 c3 H^2 (t + H) + 2 c2 H^2, d3 = 6 c3 H^3
+        Float f[3], d1[3], d2[3], d3[3];
+        CurveLanes p = coefficients.Evaluate(t);
+        f[0] = p.x;
+        f[1] = p.y;
+        f[2] = p.z;
+        Float H = Float(step);
+        Float H2 = H * H;
+        Float tH = t * H;
+        Float a1 = MulAdd(Float(3.0f), tH * (t + H), H2 * H);
+        Float b1 = MulAdd(Float(2.0f), tH, H2);
+        Float a2 = Float(6.0f) * H2 * (t + H);
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            const Float* c = coefficients.c[axis];
+            d1[axis] = MulAdd(c[3], a1, MulAdd(c[2], b1, c[1] * H));
+            d2[axis] = MulAdd(c[3], a2, Float(2.0f) * c[2] * H2);
+            d3[axis] = Float(6.0f) * c[3] * H2 * H;
+        }
+
+        size_t i = 0;
+        for (; i + Width <= pointCount; i += Width)
+        {
+            StoreInterleaved3(points[i].m_Data, f[0], f[1], f[2]);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                f[axis] = f[axis] + d1[axis];
+                d1[axis] = d1[axis] + d2[axis];
+                d2[axis] = d2[axis] + d3[axis];
+            }
+        }
+
+        // The last partial step as one overlapping full vector, evaluated directly
+        if (i < pointCount)
+        {
+            size_t last = pointCount - Width;
+            CurveLanes tail = coefficients.Evaluate(MulAdd(ToFloat(LaneIndex()), Float(h), Float(float(last) * h)));
+            StoreInterleaved3(points[last].m_Data, tail.x, tail.y, tail.z);
+        }
+        points[pointCount - 1] = curve.m_Points[3];
+    }
+}
+
+inline constexpr CurveKernels CurveTable = {
+    EvaluateCurveArray, EvaluateCurvesArray, TessellateCurveArray
+};
@@ -0,0 +1,158 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cstddef>
+#include <cstdint>
+#include "primitives.h"
+#include "sphere.h"
+#include "dispatch.h"
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(Sphere<float>) == 4 * sizeof(float), "Intersection kernels walk Sphere arrays as packed floats");
+    static_assert(sizeof(Plane<float>) == 4 * sizeof(float), "Intersection kernels walk Plane arrays as packed floats");
+    static_assert(sizeof(Disk<float>) == 7 * sizeof(float), "Intersection kernels walk Disk arrays as packed floats");
+    static_assert(sizeof(RibbonCurve<float>) == 15 * sizeof(float), "Intersection kernels walk RibbonCurve arrays as packed floats");
+
+    // Closest hit of one ray among count primitives: fills hit and index, or returns false
+    struct IntersectionKernels
+    {
+        bool (*Spheres)(const Ray<float>& ray, const Sphere<float>* spheres, size_t count, RayHit<float>& hit, uint32_t& index);
+        bool (*Planes)(const Ray<float>& ray, const Plane<float>* planes, size_t count, RayHit<float>& hit, uint32_t& index);
+        bool (*Disks)(const Ray<float>& ray, const Disk<float>* disks, size_t count, RayHit<float>& hit, uint32_t& index);
+        bool (*Ribbons)(const Ray<float>& ray, const RibbonCurve<float>* ribbons, size_t count, RayHit<float>& hit, uint32_t& index);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    // Shared by the lane versions for their remainders: hits must also be no further than hit.m_T
+    template<typename Primitive>
+    inline bool IntersectClosest(const Ray<float>& ray, const Primitive* primitives, size_t count, size_t first,
+                                 RayHit<float>& hit, uint32_t& index)
+    {
+        Ray<float> closest = ray;
+        closest.m_TMax = std::min(ray.m_TMax, hit.m_T);
+
+        bool found = false;
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (primitives[i].Intersect(closest, hit))
+            {
+                closest.m_TMax = hit.m_T;
+                index = uint32_t(first + i);
+                found = true;
+            }
+        }
+        return found;
+    }
+
+    inline bool IntersectSpheres(const Ray<float>& ray, const Sphere<float>* spheres, size_t count, RayHit<float>& hit, uint32_t& index)
+    {
+        return IntersectClosest(ray, spheres, count, 0, hit, index);
+    }
+
+    inline bool IntersectPlanes(const Ray<float>& ray, const Plane<float>* planes, size_t count, RayHit<float>& hit, uint32_t& index)
+    {
+        return IntersectClosest(ray, planes, count, 0, hit, index);
+    }
+
+    inline bool IntersectDisks(const Ray<float>& ray, const Disk<float>* disks, size_t count, RayHit<float>& hit, uint32_t& index)
+    {
+        return IntersectClosest(ray, disks, count, 0, hit, index);
+    }
+
+    inline bool IntersectRibbons(const Ray<float>& ray, const RibbonCurve<float>* ribbons, size_t count, RayHit<float>& hit, uint32_t& index)
+    {
+        return IntersectClosest(ray, ribbons, count, 0, hit, index);
+    }
+
+    inline constexpr IntersectionKernels IntersectionTable = {
+        IntersectSpheres, IntersectPlanes, IntersectDisks, IntersectRibbons
+    };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "batchintersection_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "batchintersection_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "batchintersection_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const IntersectionKernels& GetIntersectionKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::IntersectionTable, Sse2::IntersectionTable, Avx2::IntersectionTable, Avx512::IntersectionTable);
+#else
+        return Scalar::IntersectionTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Closest hit of one ray among many primitives, Width primitives at a
+     * time on the instruction set selected by Simd::GetLevel, as in a BVH
+     * leaf. The lane code follows the scalar Intersects of each primitive
+     * step for step; the full hit record is completed once, for the
+     * closest primitive. Returns false, leaving hit and index alone, when
+     * nothing is hit within [m_TMin, min(m_TMax, hit.m_T)]; passing the hit
+     * of an earlier call continues the search across primitive types.
+     */
+    inline bool Intersect(const Ray<float>& ray, std::span<const Sphere<float>> spheres, RayHit<float>& hit, uint32_t& index)
+    {
+        return Simd::GetIntersectionKernels().Spheres(ray, spheres.data(), spheres.size(), hit, index);
+    }
+
+    inline bool Intersect(const Ray<float>& ray, std::span<const Plane<float>> planes, RayHit<float>& hit, uint32_t& index)
+    {
+        return Simd::GetIntersectionKernels().Planes(ray, planes.data(), planes.size(), hit, index);
+    }
+
+    inline bool Intersect(const Ray<float>& ray, std::span<const Disk<float>> disks, RayHit<float>& hit, uint32_t& index)
+    {
+        return Simd::GetIntersectionKernels().Disks(ray, disks.data(), disks.size(), hit, index);
+    }
+
+    inline bool Intersect(const Ray<float>& ray, std::span<const RibbonCurve<float>> ribbons, RayHit<float>& hit, uint32_t& index)
+    {
+        return Simd::GetIntersectionKernels().Ribbons(ray, ribbons.data(), ribbons.size(), hit, index);
+    }
+}
@@ -0,0 +1,257 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Lane versions of the batchintersection.h kernels, included once per ISA
+ * namespace the same way as batchmath_impl.h. Each lane tests one
+ * primitive and keeps its closest hit; the lanes are reduced once at the
+ * end and the remaining primitives go through the Scalar loop.
+ */
+
+struct RayLanes
+{
+    Float ox, oy, oz;
+    Float dx, dy, dz;
+    Float tMin;
+
+    RayLanes(const Ray<float>& ray)
+        : ox(ray.m_Origin.x), oy(ray.m_Origin.y), oz(ray.m_Origin.z)
+        , dx(ray.m_Direction.x), dy(ray.m_Direction.y), dz(ray.m_Direction.z)
+        , tMin(ray.m_TMin)
+    {
+    }
+};
+
+// Closest hit per lane so far. index holds the primitive index bits, -1 for none.
+struct ClosestLanes
+{
+    Float t, u, v, index;
+
+    ClosestLanes(float tMax)
+        : t(tMax), u(0.0f), v(0.0f), index(AsFloat(Int(-1)))
+    {
+    }
+
+    void Update(Mask hit, Float hitT, size_t first, Float hitU = Float(0.0f), Float hitV = Float(0.0f))
+    {
+        t = Select(hit, hitT, t);
+        u = Select(hit, hitU, u);
+        v = Select(hit, hitV, v);
+        index = Select(hit, AsFloat(LaneIndex() + Int(int32_t(first))), index);
+    }
+
+    // Closest of the lanes into hit (m_T, m_U, m_V) and primitive
+    bool Reduce(RayHit<float>& hit, uint32_t& primitive) const
+    {
+        float ts[Width], us[Width], vs[Width];
+        int32_t indices[Width];
+        Store(ts, t);
+        Store(us, u);
+        Store(vs, v);
+        Store(indices, AsInt(index));
+
+        int best = -1;
+        for (int i = 0; i < Width; ++i)
+            if (indices[i] >= 0 && (best < 0 || ts[i] < ts[best]))
+                best = i;
+        if (best < 0)
+            return false;
+
+        hit.m_T = ts[best];
+        hit.m_U = us[best];
+        hit.m_V = vs[best];
+        primitive = uint32_t(indices[best]);
+        return true;
+    }
+};
+
+// intersectLanes(primitives + i, i, closest) tests Width primitives starting at i
+template<typename Primitive, typename IntersectLanes>
+inline bool IntersectClosest(const Ray<float>& ray, const Primitive* primitives, size_t count, RayHit<float>& hit, uint32_t& index,
+                             IntersectLanes&& intersectLanes)
+{
+    ClosestLanes closest(std::min(ray.m_TMax, hit.m_T));
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        intersectLanes(primitives + i, i, closest);
+
+    bool found = closest.Reduce(hit, index);
+    if (Scalar::IntersectClosest(ray, primitives + i, count - i, i, hit, index))
+        return true;
+
+    if (found)
+        primitives[index].CompleteHit(ray, hit);
+    return found;
+}
+
+inline bool IntersectSpheres(const Ray<float>& ray, const Sphere<float>* spheres, size_t count, RayHit<float>& hit, uint32_t& index)
+{
+    RayLanes r(ray);
+    Float a = Float(Vector<float, 3>::Dot(ray.m_Direction, ray.m_Direction));
+
+    return IntersectClosest(ray, spheres, count, hit, index, [&](const Sphere<float>* s, size_t first, ClosestLanes& closest) {
+        Float cx, cy, cz, radius;
+        LoadInterleaved4(s->m_Center.m_Data, cx, cy, cz, radius);
+
+        // As Sphere::Intersects, with the discriminant from the closest point on the line
+        Float fx = r.ox - cx, fy = r.oy - cy, fz = r.oz - cz;
+        Float b = fx * r.dx + fy * r.dy + fz * r.dz;
+        Float rr = radius * radius;
+        Float c = (fx * fx + fy * fy + fz * fz) - rr;
+        Float k = b / a;
+        Float lx = fx - r.dx * k, ly = fy - r.dy * k, lz = fz - r.dz * k;
+        Float discriminant = a * (rr - (lx * lx + ly * ly + lz * lz));
+
+        Float root = Sqrt(Max(discriminant, Float(0.0f)));
+        Float q = -(b + Select(b < Float(0.0f), -root, root));
+        Float t0 = q / a;
+        Float t1 = c / q;
+        Float tNear = Min(t0, t1);
+        Float t = Select(tNear >= r.tMin, tNear, Max(t0, t1));
+
+        closest.Update((discriminant >= Float(0.0f)) & (t >= r.tMin) & (t <= closest.t), t, first);
+    });
+}
+
+inline bool IntersectPlanes(const Ray<float>& ray, const Plane<float>* planes, size_t count, RayHit<float>& hit, uint32_t& index)
+{
+    RayLanes r(ray);
+
+    return IntersectClosest(ray, planes, count, hit, index, [&](const Plane<float>* p, size_t first, ClosestLanes& closest) {
+        Float nx, ny, nz, distance;
+        LoadInterleaved4(p->m_Normal.m_Data, nx, ny, nz, distance);
+
+        // Parallel lanes divide by zero into infinity, which passes the range test when
+        // tMax is infinite, so they are masked out as in Plane::Intersects
+        Float cosine = nx * r.dx + ny * r.dy + nz * r.dz;
+        Float t = -((nx * r.ox + ny * r.oy + nz * r.oz) - distance) / cosine;
+        closest.Update(~(cosine == Float(0.0f)) & (t >= r.tMin) & (t <= closest.t), t, first);
+    });
+}
+
+inline bool IntersectDisks(const Ray<float>& ray, const Disk<float>* disks, size_t count, RayHit<float>& hit, uint32_t& index)
+{
+    RayLanes r(ray);
+
+    return IntersectClosest(ray, disks, count, hit, index, [&](const Disk<float>* d, size_t first, ClosestLanes& closest) {
+        const float* p = d->m_Center.m_Data;
+        Float fx = r.ox - LoadStrided(p, 7), fy = r.oy - LoadStrided(p + 1, 7), fz = r.oz - LoadStrided(p + 2, 7);
+        Float nx = LoadStrided(p + 3, 7), ny = LoadStrided(p + 4, 7), nz = LoadStrided(p + 5, 7);
+        Float radius = LoadStrided(p + 6, 7);
+
+        Float cosine = nx * r.dx + ny * r.dy + nz * r.dz;
+        Float t = -(nx * fx + ny * fy + nz * fz) / cosine;
+        Float x = fx + r.dx * t, y = fy + r.dy * t, z = fz + r.dz * t;
+        Mask inside = (x * x + y * y + z * z) <= radius * radius;
+        closest.Update(inside & (t >= r.tMin) & (t <= closest.t), t, first);
+    });
+}
+
+inline bool IntersectRibbons(const Ray<float>& ray, const RibbonCurve<float>* ribbons, size_t count, RayHit<float>& hit, uint32_t& index)
+{
+    // The ray frame of RibbonCurve::Intersect, shared by all lanes
+    float length = ray.m_Direction.Magnitude();
+    Vector<float, 3> axes[3];
+    axes[2] = ray.m_Direction * (1.0f / length);
+    RibbonCurve<float>::GetBasis(axes[2], axes[0], axes[1]);
+
+    RayLanes r(ray);
+    Float tMinZ = Float(ray.m_TMin * length);
+
+    return IntersectClosest(ray, ribbons, count, hit, index, [&](const RibbonCurve<float>* c, size_t first, ClosestLanes& closest) {
+        const float* p = c->m_Curve.m_Points[0].m_Data;
+
+        Float points[4][3];
+        for (int j = 0; j < 4; ++j)
+        {
+            Float x = LoadStrided(p + 3 * j, 15) - r.ox;
+            Float y = LoadStrided(p + 3 * j + 1, 15) - r.oy;
+            Float z = LoadStrided(p + 3 * j + 2, 15) - r.oz;
+            for (int axis = 0; axis < 3; ++axis)
+                points[j][axis] = x * Float(axes[axis].x) + y * Float(axes[axis].y) + z * Float(axes[axis].z);
+        }
+
+        Float width0 = LoadStrided(p + 12, 15);
+        Float width1 = LoadStrided(p + 13, 15);
+        Float halfWidth = Max(width0, width1) * Float(0.5f);
+
+        // Control point hull against the ray, widened by half the width
+        Float lo[3], hi[3];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            lo[axis] = Min(Min(points[0][axis], points[1][axis]), Min(points[2][axis], points[3][axis]));
+            hi[axis] = Max(Max(points[0][axis], points[1][axis]), Max(points[2][axis], points[3][axis]));
+        }
+        Mask possible = (lo[0] <= halfWidth) & (hi[0] >= -halfWidth) & (lo[1] <= halfWidth) & (hi[1] >= -halfWidth) &
+                        (hi[2] >= tMinZ) & (lo[2] <= closest.t * Float(length));
+        if (!Any(possible))
+            return;
+
+        // Lanes split their curves into their own segment counts; the loop runs to the largest
+        int32_t counts[Width];
+        Store(counts, LoadStrided(reinterpret_cast<const int32_t*>(p + 14), 15));
+        int32_t maxCount = *std::max_element(counts, counts + Width);
+        Float segmentCount = ToFloat(Load(counts));
+        Float step = Float(1.0f) / segmentCount;
+
+        Float a[3] = { points[0][0], points[0][1], points[0][2] };
+        for (int32_t k = 0; k < maxCount; ++k)
+        {
+            Float next = Float(float(k + 1));
+            Float s = next * step;
+            Float w = Float(1.0f) - s;
+            Float b0 = w * w * w, b1 = Float(3.0f) * w * w * s, b2 = Float(3.0f) * w * s * s, b3 = s * s * s;
+            Mask last = next == segmentCount;
+
+            Float b[3];
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                Float value = b0 * points[0][axis] + b1 * points[1][axis] + b2 * points[2][axis] + b3 * points[3][axis];
+                b[axis] = Select(last, points[3][axis], value);
+            }
+
+            Float dx = b[0] - a[0], dy = b[1] - a[1];
+            Float squareLength = dx * dx + dy * dy;
+            Float along = Min(Max(-(a[0] * dx + a[1] * dy) / squareLength, Float(0.0f)), Float(1.0f));
+            along = Select(squareLength > Float(0.0f), along, Float(0.0f));
+            Float cx = a[0] + dx * along, cy = a[1] + dy * along;
+            Float squareDistance = cx * cx + cy * cy;
+
+            Float u = (Float(float(k)) + along) * step;
+            Float width = width0 + (width1 - width0) * u;
+            Float t = (a[2] + (b[2] - a[2]) * along) / Float(length);
+
+            Mask hitMask = possible & (next <= segmentCount) & (squareDistance <= width * width * Float(0.25f)) &
+                           (t >= r.tMin) & (t <= closest.t);
+            if (Any(hitMask))
+            {
+                Float side = Select(dx * cy - dy * cx < Float(0.0f), Float(-1.0f), Float(1.0f));
+                closest.Update(hitMask, t, first, u, Float(0.5f) + side * Sqrt(squareDistance) / width);
+            }
+
+            for (int axis = 0; axis < 3; ++axis)
+                a[axis] = b[axis];
+        }
+    });
+}
+
+inline constexpr IntersectionKernels IntersectionTable = {
+    IntersectSpheres, IntersectPlanes, IntersectDisks, IntersectRibbons
+};
@@ -0,0 +1,172 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include "dispatch.h"
+#include "fastmath.h"
+
+namespace SMath::Simd
+{
+    struct MathKernels
+    {
+        void (*Sin)(const float* in, float* out, size_t count);
+        void (*Cos)(const float* in, float* out, size_t count);
+        void (*Exp)(const float* in, float* out, size_t count);
+        void (*Log)(const float* in, float* out, size_t count);
+        void (*Pow)(const float* x, const float* y, float* out, size_t count);
+        void (*PowScalar)(const float* x, float y, float* out, size_t count);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    inline float PrecisePow(float x, float y)
+    {
+        return (y == 0.0f || x == 1.0f) ? 1.0f : float(ExpPrecise(double(y) * LogPrecise(double(x))));
+    }
+
+    inline void SinArray(const float* in, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = Sin(in[i]);
+    }
+
+    inline void CosArray(const float* in, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = Cos(in[i]);
+    }
+
+    inline void ExpArray(const float* in, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = Exp(in[i]);
+    }
+
+    inline void LogArray(const float* in, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = Log(in[i]);
+    }
+
+    inline void PowArray(const float* x, const float* y, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = PrecisePow(x[i], y[i]);
+    }
+
+    inline void PowArray(const float* x, float y, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = PrecisePow(x[i], y);
+    }
+
+    inline constexpr MathKernels MathTable = { SinArray, CosArray, ExpArray, LogArray, PowArray, PowArray };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "batchmath_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "batchmath_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "batchmath_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const MathKernels& GetMathKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::MathTable, Sse2::MathTable, Avx2::MathTable, Avx512::MathTable);
+#else
+        return Scalar::MathTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Element-wise transcendental functions over float arrays, run on the
+     * instruction set selected by Simd::GetLevel. out must be as long as the
+     * inputs and may alias them.
+     *
+     * Maximum errors against libm, in units in the last place of the result:
+     *   Sin, Cos    2.5 ulp for |x| <= 8192
+     *   Exp         1.5 ulp for x in [-87, 88], 0 below and inf above
+     *   Log         1 ulp for normal x > 0, -inf at 0 and NaN below
+     *   Pow         1 ulp for x >= 0 with a finite, normal result
+     *
+     * Pow is evaluated in double lanes with a double-accurate log and exp,
+     * so its error does not grow with |y * log(x)| the way FastMath::Pow's does.
+     */
+    inline void Sin(std::span<const float> in, std::span<float> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetMathKernels().Sin(in.data(), out.data(), in.size());
+    }
+
+    inline void Cos(std::span<const float> in, std::span<float> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetMathKernels().Cos(in.data(), out.data(), in.size());
+    }
+
+    inline void Exp(std::span<const float> in, std::span<float> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetMathKernels().Exp(in.data(), out.data(), in.size());
+    }
+
+    inline void Log(std::span<const float> in, std::span<float> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetMathKernels().Log(in.data(), out.data(), in.size());
+    }
+
+    inline void Pow(std::span<const float> x, std::span<const float> y, std::span<float> out)
+    {
+        assert(x.size() == y.size() && x.size() == out.size());
+        Simd::GetMathKernels().Pow(x.data(), y.data(), out.data(), x.size());
+    }
+
+    inline void Pow(std::span<const float> x, float y, std::span<float> out)
+    {
+        assert(x.size() == out.size());
+        Simd::GetMathKernels().PowScalar(x.data(), y, out.data(), x.size());
+    }
+}
@@ -0,0 +1,88 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Array loops over the fastmath_impl.h kernels, included once per ISA
+ * namespace the same way. Whole vectors run on the namespace's lanes and the
+ * remaining elements go through the Scalar loops.
+ */
+
+// pow with a double-accurate log and exp: the error of y * log(x) is scaled by exp,
+// so a float log, or the float polynomials run in double, are off by several ulp
+inline Float PrecisePow(Float x, Float y)
+{
+    Double xLo, xHi, yLo, yHi;
+    Widen(x, xLo, xHi);
+    Widen(y, yLo, yHi);
+    Float result = Narrow(ExpPrecise(yLo * LogPrecise(xLo)), ExpPrecise(yHi * LogPrecise(xHi)));
+
+    // pow(x, 0) and pow(1, y) are exactly 1, even for the 0 * inf cases inside exp(y * log(x))
+    return Select((y == Float(0.0f)) | (x == Float(1.0f)), Float(1.0f), result);
+}
+
+inline void SinArray(const float* in, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, Sin(Load(in + i)));
+    Scalar::SinArray(in + i, out + i, count - i);
+}
+
+inline void CosArray(const float* in, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, Cos(Load(in + i)));
+    Scalar::CosArray(in + i, out + i, count - i);
+}
+
+inline void ExpArray(const float* in, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, Exp(Load(in + i)));
+    Scalar::ExpArray(in + i, out + i, count - i);
+}
+
+inline void LogArray(const float* in, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, Log(Load(in + i)));
+    Scalar::LogArray(in + i, out + i, count - i);
+}
+
+inline void PowArray(const float* x, const float* y, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, PrecisePow(Load(x + i), Load(y + i)));
+    Scalar::PowArray(x + i, y + i, out + i, count - i);
+}
+
+inline void PowArray(const float* x, float y, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, PrecisePow(Load(x + i), Float(y)));
+    Scalar::PowArray(x + i, y, out + i, count - i);
+}
+
+inline constexpr MathKernels MathTable = { SinArray, CosArray, ExpArray, LogArray, PowArray, PowArray };
@@ -0,0 +1,258 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <algorithm>
+#include "linalg.h"
+#include "fastmath.h"
+#include "box.h"
+#include "dispatch.h"
+#include "parallel.h"
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(Point<float, 3>) == 3 * sizeof(float), "Batch kernels walk Point arrays as packed floats");
+    static_assert(sizeof(Vector<float, 3>) == 3 * sizeof(float), "Batch kernels walk Vector arrays as packed floats");
+    static_assert(sizeof(Box<float>) == 6 * sizeof(float), "Batch kernels walk Box arrays as packed floats");
+
+    struct OpsKernels
+    {
+        void (*TransformPoints)(const Matrix<float, 4>& m, const Point<float, 3>* in, Point<float, 3>* out, size_t count);
+        void (*TransformVectors)(const Matrix<float, 4>& m, const Vector<float, 3>* in, Vector<float, 3>* out, size_t count);
+        void (*Normalize)(const Vector<float, 3>* in, Vector<float, 3>* out, size_t count);
+        void (*Contains)(const Box<float>& box, const Point<float, 3>* points, uint64_t* mask, size_t count);
+        void (*Overlaps)(const Box<float>& box, const Box<float>* boxes, uint64_t* mask, size_t count);
+        void (*CullBoxes)(const Vector<float, 4>* planes, int planeCount, const Box<float>* boxes, uint64_t* mask, size_t count);
+        void (*FillUniform)(float* out, size_t count, uint32_t seed, float min, float max);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    // lowbias32 integer hash (C. Wellons), used as a counter-based generator
+    inline uint32_t Hash(uint32_t x)
+    {
+        x ^= x >> 16;
+        x *= 0x7feb352du;
+        x ^= x >> 15;
+        x *= 0x846ca68bu;
+        x ^= x >> 16;
+        return x;
+    }
+
+    // False only if the box lies entirely on the negative side of some plane (a, b, c, d),
+    // judged by the corner furthest along the plane normal
+    inline bool IsOnPositiveSide(const Vector<float, 4>* planes, int planeCount, const Box<float>& box)
+    {
+        for (int k = 0; k < planeCount; ++k)
+        {
+            const Vector<float, 4>& p = planes[k];
+            float x = p.x >= 0.0f ? box.m_Max.x : box.m_Min.x;
+            float y = p.y >= 0.0f ? box.m_Max.y : box.m_Min.y;
+            float z = p.z >= 0.0f ? box.m_Max.z : box.m_Min.z;
+
+            if (p.x * x + p.y * y + p.z * z + p.w < 0.0f)
+                return false;
+        }
+
+        return true;
+    }
+
+    inline void TransformPointsArray(const Matrix<float, 4>& m, const Point<float, 3>* in, Point<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Point<float, 3> p = in[i];
+            float w = m.m_Data2D[3][0] * p.x + m.m_Data2D[3][1] * p.y + m.m_Data2D[3][2] * p.z + m.m_Data2D[3][3];
+            float invW = 1.0f / w;
+
+            for (int r = 0; r < 3; ++r)
+                out[i][r] = (m.m_Data2D[r][0] * p.x + m.m_Data2D[r][1] * p.y + m.m_Data2D[r][2] * p.z + m.m_Data2D[r][3]) * invW;
+        }
+    }
+
+    inline void TransformVectorsArray(const Matrix<float, 4>& m, const Vector<float, 3>* in, Vector<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector<float, 3> v = in[i];
+            for (int r = 0; r < 3; ++r)
+                out[i][r] = m.m_Data2D[r][0] * v.x + m.m_Data2D[r][1] * v.y + m.m_Data2D[r][2] * v.z;
+        }
+    }
+
+    inline void NormalizeArray(const Vector<float, 3>* in, Vector<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector<float, 3> v = in[i];
+            float invLength = Rsqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+            for (int r = 0; r < 3; ++r)
+                out[i][r] = v[r] * invLength;
+        }
+    }
+
+    inline void ContainsArray(const Box<float>& box, const Point<float, 3>* points, uint64_t* mask, size_t count)
+    {
+        std::fill(mask, mask + (count + 63) / 64, 0);
+        for (size_t i = 0; i < count; ++i)
+            if (box.Contains(points[i]))
+                mask[i / 64] |= uint64_t(1) << (i % 64);
+    }
+
+    inline void OverlapsArray(const Box<float>& box, const Box<float>* boxes, uint64_t* mask, size_t count)
+    {
+        std::fill(mask, mask + (count + 63) / 64, 0);
+        for (size_t i = 0; i < count; ++i)
+            if (box.Overlaps(boxes[i]))
+                mask[i / 64] |= uint64_t(1) << (i % 64);
+    }
+
+    inline void CullBoxesArray(const Vector<float, 4>* planes, int planeCount, const Box<float>* boxes, uint64_t* mask, size_t count)
+    {
+        std::fill(mask, mask + (count + 63) / 64, 0);
+        for (size_t i = 0; i < count; ++i)
+            if (IsOnPositiveSide(planes, planeCount, boxes[i]))
+                mask[i / 64] |= uint64_t(1) << (i % 64);
+    }
+
+    // Element i is a pure function of (seed, i), so every level fills the same values.
+    // The product is kept unfused here too, since this tail is inlined into the FMA levels.
+    inline float UniformAt(size_t i, uint32_t key, float scale, float min)
+    {
+        float offset = scale * float(Hash(uint32_t(i) ^ key) >> 8);
+        Simd::NoContract(offset);
+        return min + offset;
+    }
+
+    inline void FillUniformArray(float* out, size_t count, uint32_t seed, float min, float max)
+    {
+        uint32_t key = Hash(seed);
+        float scale = (max - min) * 0x1p-24f;
+        for (size_t i = 0; i < count; ++i)
+            out[i] = UniformAt(i, key, scale, min);
+    }
+
+    inline constexpr OpsKernels OpsTable = {
+        TransformPointsArray, TransformVectorsArray, NormalizeArray, ContainsArray, OverlapsArray, CullBoxesArray,
+        FillUniformArray
+    };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "batchops_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "batchops_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "batchops_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const OpsKernels& GetOpsKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::OpsTable, Sse2::OpsTable, Avx2::OpsTable, Avx512::OpsTable);
+#else
+        return Scalar::OpsTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Dispatched kernels over float geometry arrays, run on the instruction
+     * set selected by Simd::GetLevel. Outputs must be as long as the inputs
+     * and may alias them. Box tests write one bit per element, element i to
+     * bit i % 64 of mask[i / 64], so mask needs GetMaskSize(count) words.
+     */
+    inline size_t GetMaskSize(size_t count)
+    {
+        return (count + 63) / 64;
+    }
+
+    // Full homogeneous transform, including the divide by w
+    inline void TransformPoints(const Matrix<float, 4>& m, std::span<const Point<float, 3>> in, std::span<Point<float, 3>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetOpsKernels().TransformPoints(m, in.data(), out.data(), in.size());
+    }
+
+    // Upper 3x3 only (w = 0)
+    inline void TransformVectors(const Matrix<float, 4>& m, std::span<const Vector<float, 3>> in, std::span<Vector<float, 3>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetOpsKernels().TransformVectors(m, in.data(), out.data(), in.size());
+    }
+
+    // Same accuracy as FastMath::Normalized (relative 3e-7)
+    inline void Normalize(std::span<const Vector<float, 3>> in, std::span<Vector<float, 3>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetOpsKernels().Normalize(in.data(), out.data(), in.size());
+    }
+
+    inline void Contains(const Box<float>& box, std::span<const Point<float, 3>> points, std::span<uint64_t> mask)
+    {
+        assert(mask.size() >= GetMaskSize(points.size()));
+        Simd::GetOpsKernels().Contains(box, points.data(), mask.data(), points.size());
+    }
+
+    inline void Overlaps(const Box<float>& box, std::span<const Box<float>> boxes, std::span<uint64_t> mask)
+    {
+        assert(mask.size() >= GetMaskSize(boxes.size()));
+        Simd::GetOpsKernels().Overlaps(box, boxes.data(), mask.data(), boxes.size());
+    }
+
+    // Sets the bit of every box that is not entirely behind one of the planes
+    // (a, b, c, d), i.e. a conservative visibility test for frustum culling
+    inline void CullBoxes(std::span<const Vector<float, 4>> planes, std::span<const Box<float>> boxes, std::span<uint64_t> mask)
+    {
+        assert(!planes.empty() && mask.size() >= GetMaskSize(boxes.size()));
+        Simd::GetOpsKernels().CullBoxes(planes.data(), int(planes.size()), boxes.data(), mask.data(), boxes.size());
+    }
+
+    // Uniform floats in [min, max) from a counter-based hash: the same seed gives
+    // the same values at every level. Streams repeat after 2^32 elements.
+    inline void FillUniform(std::span<float> out, uint32_t seed, float min = 0.0f, float max = 1.0f)
+    {
+        Simd::GetOpsKernels().FillUniform(out.data(), out.size(), seed, min, max);
+    }
+}
@@ -0,0 +1,211 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Geometry loops included once per ISA namespace. Arrays of 3-float
+ * structures are walked with strided loads, one structure per lane.
+ */
+
+inline Int Hash(Int x)
+{
+    x = x ^ ShiftRight(x, 16);
+    x = x * Int(0x7feb352d);
+    x = x ^ ShiftRight(x, 15);
+    x = x * Int(int32_t(0x846ca68bu));
+    return x ^ ShiftRight(x, 16);
+}
+
+inline void TransformPointsArray(const Matrix<float, 4>& m, const Point<float, 3>* in, Point<float, 3>* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    Float row[4][4];
+    for (int r = 0; r < 4; ++r)
+        for (int c = 0; c < 4; ++c)
+            row[r][c] = Float(m.m_Data2D[r][c]);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x = LoadStrided(src + 3 * i, 3);
+        Float y = LoadStrided(src + 3 * i + 1, 3);
+        Float z = LoadStrided(src + 3 * i + 2, 3);
+
+        Float invW = Float(1.0f) / MulAdd(row[3][0], x, MulAdd(row[3][1], y, MulAdd(row[3][2], z, row[3][3])));
+        for (int r = 0; r < 3; ++r)
+            StoreStrided(dst + 3 * i + r, 3, MulAdd(row[r][0], x, MulAdd(row[r][1], y, MulAdd(row[r][2], z, row[r][3]))) * invW);
+    }
+
+    Scalar::TransformPointsArray(m, in + i, out + i, count - i);
+}
+
+inline void TransformVectorsArray(const Matrix<float, 4>& m, const Vector<float, 3>* in, Vector<float, 3>* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    Float row[3][3];
+    for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c)
+            row[r][c] = Float(m.m_Data2D[r][c]);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x = LoadStrided(src + 3 * i, 3);
+        Float y = LoadStrided(src + 3 * i + 1, 3);
+        Float z = LoadStrided(src + 3 * i + 2, 3);
+
+        for (int r = 0; r < 3; ++r)
+            StoreStrided(dst + 3 * i + r, 3, MulAdd(row[r][0], x, MulAdd(row[r][1], y, row[r][2] * z)));
+    }
+
+    Scalar::TransformVectorsArray(m, in + i, out + i, count - i);
+}
+
+inline void NormalizeArray(const Vector<float, 3>* in, Vector<float, 3>* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x = LoadStrided(src + 3 * i, 3);
+        Float y = LoadStrided(src + 3 * i + 1, 3);
+        Float z = LoadStrided(src + 3 * i + 2, 3);
+
+        Float invLength = Rsqrt(MulAdd(x, x, MulAdd(y, y, z * z)));
+        StoreStrided(dst + 3 * i, 3, x * invLength);
+        StoreStrided(dst + 3 * i + 1, 3, y * invLength);
+        StoreStrided(dst + 3 * i + 2, 3, z * invLength);
+    }
+
+    Scalar::NormalizeArray(in + i, out + i, count - i);
+}
+
+inline void ContainsArray(const Box<float>& box, const Point<float, 3>* points, uint64_t* mask, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(points);
+    Float minX(box.m_Min.x), minY(box.m_Min.y), minZ(box.m_Min.z);
+    Float maxX(box.m_Max.x), maxY(box.m_Max.y), maxZ(box.m_Max.z);
+
+    std::fill(mask, mask + (count + 63) / 64, 0);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x = LoadStrided(src + 3 * i, 3);
+        Float y = LoadStrided(src + 3 * i + 1, 3);
+        Float z = LoadStrided(src + 3 * i + 2, 3);
+
+        Mask inside = (x >= minX) & (x <= maxX) & (y >= minY) & (y <= maxY) & (z >= minZ) & (z <= maxZ);
+        mask[i / 64] |= uint64_t(uint32_t(Bits(inside))) << (i % 64);
+    }
+
+    for (; i < count; ++i)
+        if (box.Contains(points[i]))
+            mask[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+inline void OverlapsArray(const Box<float>& box, const Box<float>* boxes, uint64_t* mask, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(boxes);
+    Float minX(box.m_Min.x), minY(box.m_Min.y), minZ(box.m_Min.z);
+    Float maxX(box.m_Max.x), maxY(box.m_Max.y), maxZ(box.m_Max.z);
+
+    std::fill(mask, mask + (count + 63) / 64, 0);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        const float* b = src + 6 * i;
+        Mask overlap = (LoadStrided(b, 6) <= maxX) & (minX <= LoadStrided(b + 3, 6)) &
+                       (LoadStrided(b + 1, 6) <= maxY) & (minY <= LoadStrided(b + 4, 6)) &
+                       (LoadStrided(b + 2, 6) <= maxZ) & (minZ <= LoadStrided(b + 5, 6));
+        mask[i / 64] |= uint64_t(uint32_t(Bits(overlap))) << (i % 64);
+    }
+
+    for (; i < count; ++i)
+        if (box.Overlaps(boxes[i]))
+            mask[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+inline void CullBoxesArray(const Vector<float, 4>* planes, int planeCount, const Box<float>* boxes, uint64_t* mask, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(boxes);
+
+    std::fill(mask, mask + (count + 63) / 64, 0);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        const float* b = src + 6 * i;
+        Float minX = LoadStrided(b, 6), minY = LoadStrided(b + 1, 6), minZ = LoadStrided(b + 2, 6);
+        Float maxX = LoadStrided(b + 3, 6), maxY = LoadStrided(b + 4, 6), maxZ = LoadStrided(b + 5, 6);
+
+        // The furthest corner along each plane normal only depends on the plane, so the
+        // min/max choice is made once per plane rather than per lane
+        Mask visible = Float(0.0f) == Float(0.0f);
+        for (int k = 0; k < planeCount; ++k)
+        {
+            const Vector<float, 4>& p = planes[k];
+            Float distance = MulAdd(Float(p.x), p.x >= 0.0f ? maxX : minX,
+                             MulAdd(Float(p.y), p.y >= 0.0f ? maxY : minY,
+                             MulAdd(Float(p.z), p.z >= 0.0f ? maxZ : minZ, Float(p.w))));
+            visible = visible & (distance >= Float(0.0f));
+
+            if (!Any(visible))
+                break;
+        }
+
+        mask[i / 64] |= uint64_t(uint32_t(Bits(visible))) << (i % 64);
+    }
+
+    for (; i < count; ++i)
+        if (Scalar::IsOnPositiveSide(planes, planeCount, boxes[i]))
+            mask[i / 64] |= uint64_t(1) << (i % 64);
+}
+
+inline void FillUniformArray(float* out, size_t count, uint32_t seed, float min, float max)
+{
+    uint32_t key = Scalar::Hash(seed);
+    float scale = (max - min) * 0x1p-24f;
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Int index = LaneIndex() + Int(int32_t(uint32_t(i)));
+        Float u = ToFloat(ShiftRight(Hash(index ^ Int(int32_t(key))), 8));
+        // Unfused, so every level rounds like the scalar UniformAt
+        Float offset = Float(scale) * u;
+        Simd::NoContract(offset.v);
+        Store(out + i, Float(min) + offset);
+    }
+
+    for (; i < count; ++i)
+        out[i] = Scalar::UniformAt(i, key, scale, min);
+}
+
+inline constexpr OpsKernels OpsTable = {
+    TransformPointsArray, TransformVectorsArray, NormalizeArray, ContainsArray, OverlapsArray, CullBoxesArray,
+    FillUniformArray
+};
@@ -0,0 +1,159 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include "linalg.h"
+#include "fastmath.h"
+#include "dispatch.h"
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float), "Quaternion kernels walk arrays as packed floats");
+
+    struct QuaternionKernels
+    {
+        void (*Normalize)(const Quaternion<float>* in, Quaternion<float>* out, size_t count);
+        void (*Multiply)(const Quaternion<float>* a, const Quaternion<float>* b, Quaternion<float>* out, size_t count);
+        void (*Rotate)(const Quaternion<float>* q, const Vector<float, 3>* in, Vector<float, 3>* out, size_t count);
+        void (*Slerp)(const Quaternion<float>* a, const Quaternion<float>* b, const float* t, Quaternion<float>* out, size_t count);
+        void (*Nlerp)(const Quaternion<float>* a, const Quaternion<float>* b, const float* t, Quaternion<float>* out, size_t count);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    inline void NormalizeQuaternionArray(const Quaternion<float>* in, Quaternion<float>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = in[i].Normalized();
+    }
+
+    inline void MultiplyArray(const Quaternion<float>* a, const Quaternion<float>* b, Quaternion<float>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = a[i] * b[i];
+    }
+
+    inline void RotateArray(const Quaternion<float>* q, const Vector<float, 3>* in, Vector<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = q[i].Rotate(in[i]);
+    }
+
+    inline void SlerpArray(const Quaternion<float>* a, const Quaternion<float>* b, const float* t, Quaternion<float>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = FastMath::Slerp(a[i], b[i], t[i]);
+    }
+
+    inline void NlerpArray(const Quaternion<float>* a, const Quaternion<float>* b, const float* t, Quaternion<float>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = Quaternion<float>::Nlerp(a[i], b[i], t[i]);
+    }
+
+    inline constexpr QuaternionKernels QuaternionTable = {
+        NormalizeQuaternionArray, MultiplyArray, RotateArray, SlerpArray, NlerpArray
+    };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "batchquaternion_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "batchquaternion_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "batchquaternion_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const QuaternionKernels& GetQuaternionKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::QuaternionTable, Sse2::QuaternionTable, Avx2::QuaternionTable, Avx512::QuaternionTable);
+#else
+        return Scalar::QuaternionTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Quaternion arrays, run on the instruction set selected by
+     * Simd::GetLevel. Each group of Width quaternions is transposed into
+     * x, y, z and w lanes, so the lane code has no branches: the shorter
+     * path flip and the near-parallel fallback of FastMath::Slerp are selects.
+     *
+     * Slerp follows FastMath::Slerp (FastMath::Acos and SinCos, to
+     * about 1e-6) and Normalize uses a refined reciprocal square root, so
+     * results differ from the exact scalar functions in the last few bits.
+     * out may alias an input.
+     */
+    inline void Normalize(std::span<const Quaternion<float>> in, std::span<Quaternion<float>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetQuaternionKernels().Normalize(in.data(), out.data(), in.size());
+    }
+
+    // out[i] = a[i] * b[i], applying b[i] first
+    inline void Multiply(std::span<const Quaternion<float>> a, std::span<const Quaternion<float>> b, std::span<Quaternion<float>> out)
+    {
+        assert(a.size() == b.size() && a.size() == out.size());
+        Simd::GetQuaternionKernels().Multiply(a.data(), b.data(), out.data(), a.size());
+    }
+
+    inline void Rotate(std::span<const Quaternion<float>> q, std::span<const Vector<float, 3>> in, std::span<Vector<float, 3>> out)
+    {
+        assert(q.size() == in.size() && q.size() == out.size());
+        Simd::GetQuaternionKernels().Rotate(q.data(), in.data(), out.data(), q.size());
+    }
+
+    inline void Slerp(std::span<const Quaternion<float>> a, std::span<const Quaternion<float>> b, std::span<const float> t,
+                      std::span<Quaternion<float>> out)
+    {
+        assert(a.size() == b.size() && a.size() == t.size() && a.size() == out.size());
+        Simd::GetQuaternionKernels().Slerp(a.data(), b.data(), t.data(), out.data(), a.size());
+    }
+
+    inline void Nlerp(std::span<const Quaternion<float>> a, std::span<const Quaternion<float>> b, std::span<const float> t,
+                      std::span<Quaternion<float>> out)
+    {
+        assert(a.size() == b.size() && a.size() == t.size() && a.size() == out.size());
+        Simd::GetQuaternionKernels().Nlerp(a.data(), b.data(), t.data(), out.data(), a.size());
+    }
+}
@@ -0,0 +1,159 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Lane versions of the batchquaternion.h kernels, included once per ISA
+ * namespace the same way as batchmath_impl.h. Whole vectors run on the
+ * namespace's lanes and the remaining elements go through the Scalar loops.
+ */
+
+struct QuaternionLanes
+{
+    Float x, y, z, w;
+};
+
+inline QuaternionLanes LoadQuaternions(const Quaternion<float>* q)
+{
+    QuaternionLanes l;
+    LoadInterleaved4(q->m_Data, l.x, l.y, l.z, l.w);
+    return l;
+}
+
+inline void StoreQuaternions(Quaternion<float>* q, const QuaternionLanes& l)
+{
+    StoreInterleaved4(q->m_Data, l.x, l.y, l.z, l.w);
+}
+
+inline Float Dot(const QuaternionLanes& a, const QuaternionLanes& b)
+{
+    return MulAdd(a.x, b.x, MulAdd(a.y, b.y, MulAdd(a.z, b.z, a.w * b.w)));
+}
+
+inline QuaternionLanes Scaled(const QuaternionLanes& q, Float s)
+{
+    return { q.x * s, q.y * s, q.z * s, q.w * s };
+}
+
+// a * wa + b * wb
+inline QuaternionLanes Blend(const QuaternionLanes& a, Float wa, const QuaternionLanes& b, Float wb)
+{
+    return { MulAdd(a.x, wa, b.x * wb), MulAdd(a.y, wa, b.y * wb), MulAdd(a.z, wa, b.z * wb), MulAdd(a.w, wa, b.w * wb) };
+}
+
+inline void NormalizeQuaternionArray(const Quaternion<float>* in, Quaternion<float>* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        QuaternionLanes q = LoadQuaternions(in + i);
+        StoreQuaternions(out + i, Scaled(q, Rsqrt(Dot(q, q))));
+    }
+    Scalar::NormalizeQuaternionArray(in + i, out + i, count - i);
+}
+
+inline void MultiplyArray(const Quaternion<float>* a, const Quaternion<float>* b, Quaternion<float>* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        QuaternionLanes p = LoadQuaternions(a + i);
+        QuaternionLanes q = LoadQuaternions(b + i);
+
+        QuaternionLanes r;
+        r.x = MulAdd(p.w, q.x, MulAdd(p.x, q.w, MulAdd(p.y, q.z, -(p.z * q.y))));
+        r.y = MulAdd(p.w, q.y, MulAdd(p.y, q.w, MulAdd(p.z, q.x, -(p.x * q.z))));
+        r.z = MulAdd(p.w, q.z, MulAdd(p.z, q.w, MulAdd(p.x, q.y, -(p.y * q.x))));
+        r.w = MulAdd(p.w, q.w, -MulAdd(p.x, q.x, MulAdd(p.y, q.y, p.z * q.z)));
+        StoreQuaternions(out + i, r);
+    }
+    Scalar::MultiplyArray(a + i, b + i, out + i, count - i);
+}
+
+inline void RotateArray(const Quaternion<float>* q, const Vector<float, 3>* in, Vector<float, 3>* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        QuaternionLanes r = LoadQuaternions(q + i);
+        Float x, y, z;
+        LoadInterleaved3(in[i].m_Data, x, y, z);
+
+        // v' = v + w * t + cross(q.xyz, t) with t = 2 * cross(q.xyz, v)
+        Float tx = (r.y * z - r.z * y) * Float(2.0f);
+        Float ty = (r.z * x - r.x * z) * Float(2.0f);
+        Float tz = (r.x * y - r.y * x) * Float(2.0f);
+        StoreInterleaved3(out[i].m_Data,
+                          MulAdd(r.w, tx, x) + (r.y * tz - r.z * ty),
+                          MulAdd(r.w, ty, y) + (r.z * tx - r.x * tz),
+                          MulAdd(r.w, tz, z) + (r.x * ty - r.y * tx));
+    }
+    Scalar::RotateArray(q + i, in + i, out + i, count - i);
+}
+
+inline void SlerpArray(const Quaternion<float>* a, const Quaternion<float>* b, const float* t, Quaternion<float>* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        QuaternionLanes p = LoadQuaternions(a + i);
+        QuaternionLanes q = LoadQuaternions(b + i);
+        Float s = Load(t + i);
+
+        // Shorter path: negate b where the dot is negative
+        Float dot = Dot(p, q);
+        Float sign = Select(dot < Float(0.0f), Float(-1.0f), Float(1.0f));
+        dot = Abs(dot);
+
+        // As in FastMath::Slerp: sin((1 - t) * theta) / sin(theta) = cos(t * theta) - cos(theta) * wb
+        Float sinT, cosT;
+        SinCos(s * Acos(Min(dot, Float(1.0f))), sinT, cosT);
+        Float wb = sinT * Rsqrt(Max(Float(1.0f) - dot * dot, Float(1e-30f)));
+        Float wa = cosT - dot * wb;
+
+        // Nearly parallel lanes fall back to a normalized lerp
+        Mask close = dot > Float(0.9995f);
+        wa = Select(close, Float(1.0f) - s, wa);
+        wb = Select(close, s, wb);
+
+        QuaternionLanes r = Blend(p, wa, q, wb * sign);
+        StoreQuaternions(out + i, Scaled(r, Select(close, Rsqrt(Dot(r, r)), Float(1.0f))));
+    }
+    Scalar::SlerpArray(a + i, b + i, t + i, out + i, count - i);
+}
+
+inline void NlerpArray(const Quaternion<float>* a, const Quaternion<float>* b, const float* t, Quaternion<float>* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        QuaternionLanes p = LoadQuaternions(a + i);
+        QuaternionLanes q = LoadQuaternions(b + i);
+        Float s = Load(t + i);
+
+        Float sign = Select(Dot(p, q) < Float(0.0f), Float(-1.0f), Float(1.0f));
+        QuaternionLanes r = Blend(p, Float(1.0f) - s, q, s * sign);
+        StoreQuaternions(out + i, Scaled(r, Rsqrt(Dot(r, r))));
+    }
+    Scalar::NlerpArray(a + i, b + i, t + i, out + i, count - i);
+}
+
+inline constexpr QuaternionKernels QuaternionTable = {
+    NormalizeQuaternionArray, MultiplyArray, RotateArray, SlerpArray, NlerpArray
+};
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <span>
+#include <limits>
 #include "linalg.h"
 
 namespace SMath
@@ -32,17 +34,42 @@ namespace SMath
 
     public:
         bool Contains(const Point<T, 3>& point) const;
+        bool Overlaps(const Box& box) const;
+        bool IsEmpty() const;
+
         Vector<T, 3> GetSize() const;
         T GetSurfaceArea() const;
+        Point<T, 3> GetCentroid() const;
+        // Index of the longest axis, the first one on ties
+        int GetMaximumExtent() const;
+        // Position of point relative to the box, (0, 0, 0) at m_Min and (1, 1, 1) at m_Max.
+        // Flat axes give the unscaled offset instead of dividing by zero.
+        Vector<T, 3> GetOffset(const Point<T, 3>& point) const;
+
+        void Expand(const Point<T, 3>& point);
+        void Expand(const Box& box);
 
     public:
+        // Inverted box (m_Min +inf, m_Max -inf). Expanding or taking the union with it
+        // needs no special case, and it overlaps and contains nothing.
+        static Box Empty();
+
         static Box Union(const Box& a, const Box& b);
+        // Empty (IsEmpty) when the boxes do not overlap
+        static Box Intersection(const Box& a, const Box& b);
+
+        // Bounds of whole arrays, Empty() for empty input. For large float arrays,
+        // Batch::Bounds in boxbounds.h is the SIMD and multithreaded version.
+        static Box FromPoints(std::span<const Point<T, 3>> points);
+        static Box UnionAll(std::span<const Box> boxes);
 
     public:
         Point<T, 3> m_Min;
         Point<T, 3> m_Max;
     };
+}
 
+namespace SMath
+{
     #include "box_impl.h" 
 }
-
@@ -36,6 +36,21 @@ bool Box<T>::Contains(const Point<T, 3>& point) const
     return true;
 }
 
+template<typename T>
+bool Box<T>::Overlaps(const Box& box) const
+{
+    // Non short-circuiting, so the six compares stay branch free
+    return (m_Min.x <= box.m_Max.x) & (box.m_Min.x <= m_Max.x) &
+           (m_Min.y <= box.m_Max.y) & (box.m_Min.y <= m_Max.y) &
+           (m_Min.z <= box.m_Max.z) & (box.m_Min.z <= m_Max.z);
+}
+
+template<typename T>
+bool Box<T>::IsEmpty() const
+{
+    return (m_Min.x > m_Max.x) | (m_Min.y > m_Max.y) | (m_Min.z > m_Max.z);
+}
+
 template<typename T>
 Vector<T, 3> Box<T>::GetSize() const
 {
@@ -54,6 +69,60 @@ T Box<T>::GetSurfaceArea() const
            height * depth * 2;
 }
 
+template<typename T>
+Point<T, 3> Box<T>::GetCentroid() const
+{
+    return Point<T, 3>((m_Min.x + m_Max.x) * T(0.5), (m_Min.y + m_Max.y) * T(0.5), (m_Min.z + m_Max.z) * T(0.5));
+}
+
+template<typename T>
+int Box<T>::GetMaximumExtent() const
+{
+    Vector<T, 3> size = GetSize();
+    int xy = size.y > size.x ? 1 : 0;
+    return size.z > size[xy] ? 2 : xy;
+}
+
+template<typename T>
+Vector<T, 3> Box<T>::GetOffset(const Point<T, 3>& point) const
+{
+    Vector<T, 3> offset = point - m_Min;
+    for (int i = 0; i < 3; ++i)
+    {
+        T size = m_Max[i] - m_Min[i];
+        offset[i] = size > T(0) ? offset[i] / size : offset[i];
+    }
+
+    return offset;
+}
+
+template<typename T>
+void Box<T>::Expand(const Point<T, 3>& point)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        m_Min[i] = std::min(m_Min[i], point[i]);
+        m_Max[i] = std::max(m_Max[i], point[i]);
+    }
+}
+
+template<typename T>
+void Box<T>::Expand(const Box& box)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        m_Min[i] = std::min(m_Min[i], box.m_Min[i]);
+        m_Max[i] = std::max(m_Max[i], box.m_Max[i]);
+    }
+}
+
+template<typename T>
+Box<T> Box<T>::Empty()
+{
+    static_assert(std::numeric_limits<T>::has_infinity, "Box::Empty needs a type with infinity");
+    return { Point<T, 3>(std::numeric_limits<T>::infinity()), Point<T, 3>(-std::numeric_limits<T>::infinity()) };
+}
+
 template<typename T>
 Box<T> Box<T>::Union(const Box& a, const Box& b)
 {
@@ -71,3 +140,35 @@ Box<T> Box<T>::Union(const Box& a, const Box& b)
     return { Point<T, 3>(minX, minY, minZ), Point<T, 3>(maxX, maxY, maxZ) };
 }
 
+template<typename T>
+Box<T> Box<T>::Intersection(const Box& a, const Box& b)
+{
+    Box result;
+    for (int i = 0; i < 3; ++i)
+    {
+        result.m_Min[i] = std::max(a.m_Min[i], b.m_Min[i]);
+        result.m_Max[i] = std::min(a.m_Max[i], b.m_Max[i]);
+    }
+
+    return result;
+}
+
+template<typename T>
+Box<T> Box<T>::FromPoints(std::span<const Point<T, 3>> points)
+{
+    Box bounds = Empty();
+    for (const Point<T, 3>& p : points)
+        bounds.Expand(p);
+
+    return bounds;
+}
+
+template<typename T>
+Box<T> Box<T>::UnionAll(std::span<const Box> boxes)
+{
+    Box bounds = Empty();
+    for (const Box& box : boxes)
+        bounds.Expand(box);
+
+    return bounds;
+}
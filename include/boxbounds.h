@@ -0,0 +1,145 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include "linalg.h"
+#include "box.h"
+#include "dispatch.h"
+#include "parallel.h"
+
+/**
+ * Dispatched bounds reductions over float Point and Box arrays, the SIMD
+ * and multithreaded counterparts of Box::FromPoints and Box::UnionAll.
+ * Kept out of box.h so that using Box does not pull in the intrinsics
+ * and thread headers.
+ */
+namespace SMath::Simd
+{
+    static_assert(sizeof(Point<float, 3>) == 3 * sizeof(float), "Bounds kernels walk Point arrays as packed floats");
+    static_assert(sizeof(Box<float>) == 6 * sizeof(float), "Bounds kernels walk Box arrays as packed floats");
+
+    struct BoundsKernels
+    {
+        void (*BoundsPoints)(const Point<float, 3>* points, size_t count, float* min, float* max);
+        void (*BoundsBoxes)(const Box<float>* boxes, size_t count, float* min, float* max);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    // Widens min and max (x, y, z) to cover the points. NaN coordinates are skipped.
+    inline void BoundsPointsArray(const Point<float, 3>* points, size_t count, float* min, float* max)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                min[c] = std::min(min[c], points[i][c]);
+                max[c] = std::max(max[c], points[i][c]);
+            }
+        }
+    }
+
+    inline void BoundsBoxesArray(const Box<float>* boxes, size_t count, float* min, float* max)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                min[c] = std::min(min[c], boxes[i].m_Min[c]);
+                max[c] = std::max(max[c], boxes[i].m_Max[c]);
+            }
+        }
+    }
+
+    inline constexpr BoundsKernels BoundsTable = { BoundsPointsArray, BoundsBoxesArray };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "boxbounds_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "boxbounds_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "boxbounds_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const BoundsKernels& GetBoundsKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::BoundsTable, Sse2::BoundsTable, Avx2::BoundsTable, Avx512::BoundsTable);
+#else
+        return Scalar::BoundsTable;
+#endif
+    }
+
+    template <typename Element, typename Kernel>
+    inline Box<float> ReduceBounds(std::span<const Element> elements, int threadCount, Kernel kernel)
+    {
+        int threads = GetThreadCount(elements.size(), threadCount);
+        std::vector<Box<float>> partial(threads, Box<float>::Empty());
+
+        ParallelSlices(elements.size(), threads, [&](size_t begin, size_t end, int slice) {
+            float* min = &partial[slice].m_Min[0];
+            float* max = &partial[slice].m_Max[0];
+            kernel(elements.data() + begin, end - begin, min, max);
+        });
+
+        Box<float> bounds = partial[0];
+        for (int t = 1; t < threads; ++t)
+            bounds = Box<float>::Union(bounds, partial[t]);
+        return bounds;
+    }
+}
+
+namespace SMath::Batch
+{
+    // Bounds of the points, or of the boxes. threadCount <= 0 splits inputs of more than
+    // Simd::MinParallelChunk elements across the hardware threads.
+    inline Box<float> Bounds(std::span<const Point<float, 3>> points, int threadCount = 0)
+    {
+        return Simd::ReduceBounds(points, threadCount, Simd::GetBoundsKernels().BoundsPoints);
+    }
+
+    inline Box<float> Bounds(std::span<const Box<float>> boxes, int threadCount = 0)
+    {
+        return Simd::ReduceBounds(boxes, threadCount, Simd::GetBoundsKernels().BoundsBoxes);
+    }
+}
@@ -0,0 +1,109 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Bounds loops included once per ISA namespace. The packed arrays are read
+ * with contiguous loads, each vector keeping its own accumulators.
+ */
+
+inline void BoundsPointsArray(const Point<float, 3>* points, size_t count, float* min, float* max)
+{
+    const float* src = reinterpret_cast<const float*>(points);
+
+    // 2 * Width points are six contiguous vectors, and lane j of vector k always holds
+    // component (k * Width + j) % 3. Each vector keeps its own min and max, which also
+    // gives six independent chains, and the components are sorted out once at the end.
+    // The new value goes first so Min/Max skip NaN, like the scalar loop.
+    const float inf = std::numeric_limits<float>::infinity();
+    Float lo[6], hi[6];
+    for (int k = 0; k < 6; ++k)
+    {
+        lo[k] = Float(inf);
+        hi[k] = Float(-inf);
+    }
+
+    size_t i = 0;
+    for (; i + 2 * Width <= count; i += 2 * Width)
+    {
+        for (int k = 0; k < 6; ++k)
+        {
+            Float v = Load(src + 3 * i + k * Width);
+            lo[k] = Min(v, lo[k]);
+            hi[k] = Max(v, hi[k]);
+        }
+    }
+
+    float lanes[Width];
+    for (int k = 0; k < 6; ++k)
+    {
+        Store(lanes, lo[k]);
+        for (int j = 0; j < Width; ++j)
+            min[(k * Width + j) % 3] = std::min(min[(k * Width + j) % 3], lanes[j]);
+
+        Store(lanes, hi[k]);
+        for (int j = 0; j < Width; ++j)
+            max[(k * Width + j) % 3] = std::max(max[(k * Width + j) % 3], lanes[j]);
+    }
+
+    Scalar::BoundsPointsArray(points + i, count - i, min, max);
+}
+
+inline void BoundsBoxesArray(const Box<float>* boxes, size_t count, float* min, float* max)
+{
+    const float* src = reinterpret_cast<const float*>(boxes);
+
+    // Width boxes are six contiguous vectors with lane j of vector k holding component
+    // (k * Width + j) % 6. Lanes holding a max are negated, so a single Min per vector
+    // tracks both and the max comes back as -min at the end.
+    float signs[6][Width];
+    for (int k = 0; k < 6; ++k)
+        for (int j = 0; j < Width; ++j)
+            signs[k][j] = (k * Width + j) % 6 < 3 ? 1.0f : -1.0f;
+
+    Float sign[6], lo[6];
+    for (int k = 0; k < 6; ++k)
+    {
+        sign[k] = Load(signs[k]);
+        lo[k] = Float(std::numeric_limits<float>::infinity());
+    }
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        for (int k = 0; k < 6; ++k)
+            lo[k] = Min(Load(src + 6 * i + k * Width) * sign[k], lo[k]);
+
+    float lanes[Width];
+    for (int k = 0; k < 6; ++k)
+    {
+        Store(lanes, lo[k]);
+        for (int j = 0; j < Width; ++j)
+        {
+            int c = (k * Width + j) % 6;
+            if (c < 3)
+                min[c] = std::min(min[c], lanes[j]);
+            else
+                max[c - 3] = std::max(max[c - 3], -lanes[j]);
+        }
+    }
+
+    Scalar::BoundsBoxesArray(boxes + i, count - i, min, max);
+}
+
+inline constexpr BoundsKernels BoundsTable = { BoundsPointsArray, BoundsBoxesArray };
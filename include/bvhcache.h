@@ -0,0 +1,156 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <bit>
+#include <vector>
+#include <algorithm>
+#include <utility>
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+#include "box.h"
+#include "ray.h"
+#include "widebvh.h"
+#include "quantizedbvh.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+    #define SMATH_HAS_MMAP 1
+    #include <fcntl.h>
+    #include <unistd.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+#endif
+
+namespace SMath
+{
+    /**
+     * Pointer-free file holding a WideBvh or QuantizedBvh together with its
+     * primitive index array and primitive bounds. Every section starts on a
+     * 64-byte boundary, so a mapped file is traversed in place without any
+     * deserialization. The payload carries a 64-bit checksum.
+     *
+     * The layout is native endian and tied to the node structs. Files from a
+     * machine with another byte order or node size are rejected.
+     */
+    class BvhCache
+    {
+    public:
+        static constexpr uint32_t Version = 1;
+        static constexpr size_t Alignment = 64;
+        static constexpr char Magic[8] = { 'S', 'M', 'B', 'V', 'H', '\r', '\n', '\x1a' };
+        static constexpr uint32_t ByteOrder = 0x01020304u;
+
+        enum class Format : uint32_t
+        {
+            Wide = 0,
+            Quantized = 1
+        };
+
+        enum class Status
+        {
+            Ok,
+            CannotOpen,
+            BadMagic,
+            BadVersion,
+            BadLayout,
+            Truncated,
+            BadChecksum
+        };
+
+        struct Header
+        {
+            char m_Magic[8];
+            uint32_t m_Version;
+            uint32_t m_ByteOrder;
+            uint32_t m_Format;
+            uint32_t m_NodeSize;
+            uint64_t m_NodeCount;
+            uint64_t m_NodeOffset;
+            uint64_t m_IndexCount;
+            uint64_t m_IndexOffset;
+            uint64_t m_BoxCount;
+            uint64_t m_BoxOffset;
+            uint64_t m_FileSize;
+            // Of the bytes after the header
+            uint64_t m_Checksum;
+        };
+
+    public:
+        BvhCache() = default;
+        BvhCache(BvhCache&& other) noexcept;
+        BvhCache& operator=(BvhCache&& other) noexcept;
+        BvhCache(const BvhCache&) = delete;
+        BvhCache& operator=(const BvhCache&) = delete;
+        ~BvhCache();
+
+    public:
+        // Maps the file read-only, or reads it into an aligned buffer where mmap is not
+        // available. The node and index sections are always checked so traversal stays in
+        // bounds; skipping the checksum leaves the box pages untouched until traversal.
+        Status Open(const char* path, bool verifyChecksum = true);
+        void Close();
+        bool IsOpen() const;
+
+        Format GetFormat() const;
+        const Header& GetHeader() const;
+
+        // Only the span matching GetFormat() is non-empty
+        std::span<const WideBvh::Node> GetWideNodes() const;
+        std::span<const QuantizedBvh::Node> GetQuantizedNodes() const;
+        std::span<const uint32_t> GetPrimitives() const;
+        std::span<const Box<float>> GetBoxes() const;
+
+        // Closest stored box hit, as in WideBvh::Intersect
+        bool Intersect(const Ray<float>& ray, float& t, uint32_t& primitive) const;
+
+    public:
+        // boxes must be the primitives the hierarchy was built from
+        static bool Write(const char* path, const WideBvh& bvh, std::span<const Box<float>> boxes);
+        static bool Write(const char* path, const QuantizedBvh& bvh, std::span<const Box<float>> boxes);
+
+        static uint64_t Checksum(const void* data, size_t size);
+
+    private:
+        static bool Write(const char* path, Format format, uint32_t nodeSize, std::span<const std::byte> nodes,
+                          std::span<const uint32_t> indices, std::span<const Box<float>> boxes);
+
+        static uint64_t AlignUp(uint64_t offset);
+
+        template<typename T>
+        std::span<const T> GetSection(uint64_t offset, uint64_t count) const;
+
+        // Every child is a valid leaf range or a later node, every index names a box, and the
+        // tree is shallow enough for the traversal stack
+        template<typename NodeType>
+        static bool IsValidTree(std::span<const NodeType> nodes, std::span<const uint32_t> indices, uint64_t boxCount);
+
+    private:
+        const std::byte* m_Data = nullptr;
+        size_t m_Size = 0;
+        bool m_Mapped = false;
+    };
+
+    #include "bvhcache_impl.h"
+}
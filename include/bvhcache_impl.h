@@ -0,0 +1,337 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+inline BvhCache::BvhCache(BvhCache&& other) noexcept
+    : m_Data(other.m_Data)
+    , m_Size(other.m_Size)
+    , m_Mapped(other.m_Mapped)
+{
+    other.m_Data = nullptr;
+    other.m_Size = 0;
+    other.m_Mapped = false;
+}
+
+inline BvhCache& BvhCache::operator=(BvhCache&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        std::swap(m_Data, other.m_Data);
+        std::swap(m_Size, other.m_Size);
+        std::swap(m_Mapped, other.m_Mapped);
+    }
+    return *this;
+}
+
+inline BvhCache::~BvhCache()
+{
+    Close();
+}
+
+inline BvhCache::Status BvhCache::Open(const char* path, bool verifyChecksum)
+{
+    Close();
+
+#if defined(SMATH_HAS_MMAP)
+    int file = ::open(path, O_RDONLY);
+    if (file < 0)
+        return Status::CannotOpen;
+
+    struct stat info;
+    if (::fstat(file, &info) != 0)
+    {
+        ::close(file);
+        return Status::CannotOpen;
+    }
+
+    if (info.st_size < off_t(sizeof(Header)))
+    {
+        ::close(file);
+        return Status::Truncated;
+    }
+
+    // The mapping stays valid after the descriptor is closed
+    void* data = ::mmap(nullptr, size_t(info.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    ::close(file);
+    if (data == MAP_FAILED)
+        return Status::CannotOpen;
+
+    m_Data = static_cast<const std::byte*>(data);
+    m_Size = size_t(info.st_size);
+    m_Mapped = true;
+#else
+    std::FILE* file = std::fopen(path, "rb");
+    if (file == nullptr)
+        return Status::CannotOpen;
+
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    if (size < long(sizeof(Header)))
+    {
+        std::fclose(file);
+        return size < 0 ? Status::CannotOpen : Status::Truncated;
+    }
+
+    void* data = ::operator new(size_t(size), std::align_val_t(Alignment));
+    size_t read = std::fread(data, 1, size_t(size), file);
+    std::fclose(file);
+
+    m_Data = static_cast<const std::byte*>(data);
+    m_Size = read;
+    m_Mapped = false;
+#endif
+
+    const Header& header = GetHeader();
+    Status status = Status::Ok;
+
+    uint32_t nodeSize = header.m_Format == uint32_t(Format::Wide) ? uint32_t(sizeof(WideBvh::Node)) : uint32_t(sizeof(QuantizedBvh::Node));
+    auto fits = [&](uint64_t offset, uint64_t count, uint64_t size) {
+        return offset % Alignment == 0 && offset <= m_Size && count <= (m_Size - offset) / size;
+    };
+
+    if (std::memcmp(header.m_Magic, Magic, sizeof(header.m_Magic)) != 0)
+        status = Status::BadMagic;
+    else if (header.m_Version != Version)
+        status = Status::BadVersion;
+    else if (header.m_ByteOrder != ByteOrder || header.m_Format > uint32_t(Format::Quantized) ||
+             header.m_NodeSize != nodeSize)
+        status = Status::BadLayout;
+    else if (header.m_FileSize != m_Size)
+        status = Status::Truncated;
+    else if (!fits(header.m_NodeOffset, header.m_NodeCount, nodeSize) ||
+             !fits(header.m_IndexOffset, header.m_IndexCount, sizeof(uint32_t)) ||
+             !fits(header.m_BoxOffset, header.m_BoxCount, sizeof(Box<float>)))
+        status = Status::BadLayout;
+    else if (verifyChecksum && Checksum(m_Data + sizeof(Header), m_Size - sizeof(Header)) != header.m_Checksum)
+        status = Status::BadChecksum;
+    else if (header.m_Format == uint32_t(Format::Wide) ? !IsValidTree(GetWideNodes(), GetPrimitives(), header.m_BoxCount)
+                                                       : !IsValidTree(GetQuantizedNodes(), GetPrimitives(), header.m_BoxCount))
+        status = Status::BadLayout;
+
+    if (status != Status::Ok)
+        Close();
+    return status;
+}
+
+inline void BvhCache::Close()
+{
+    if (m_Data == nullptr)
+        return;
+
+#if defined(SMATH_HAS_MMAP)
+    if (m_Mapped)
+        ::munmap(const_cast<std::byte*>(m_Data), m_Size);
+#endif
+    if (!m_Mapped)
+        ::operator delete(const_cast<std::byte*>(m_Data), std::align_val_t(Alignment));
+
+    m_Data = nullptr;
+    m_Size = 0;
+    m_Mapped = false;
+}
+
+inline bool BvhCache::IsOpen() const
+{
+    return m_Data != nullptr;
+}
+
+inline BvhCache::Format BvhCache::GetFormat() const
+{
+    assert(IsOpen());
+    return Format(GetHeader().m_Format);
+}
+
+inline const BvhCache::Header& BvhCache::GetHeader() const
+{
+    assert(IsOpen());
+    return *reinterpret_cast<const Header*>(m_Data);
+}
+
+inline std::span<const WideBvh::Node> BvhCache::GetWideNodes() const
+{
+    if (!IsOpen() || GetFormat() != Format::Wide)
+        return {};
+    return GetSection<WideBvh::Node>(GetHeader().m_NodeOffset, GetHeader().m_NodeCount);
+}
+
+inline std::span<const QuantizedBvh::Node> BvhCache::GetQuantizedNodes() const
+{
+    if (!IsOpen() || GetFormat() != Format::Quantized)
+        return {};
+    return GetSection<QuantizedBvh::Node>(GetHeader().m_NodeOffset, GetHeader().m_NodeCount);
+}
+
+inline std::span<const uint32_t> BvhCache::GetPrimitives() const
+{
+    if (!IsOpen())
+        return {};
+    return GetSection<uint32_t>(GetHeader().m_IndexOffset, GetHeader().m_IndexCount);
+}
+
+inline std::span<const Box<float>> BvhCache::GetBoxes() const
+{
+    if (!IsOpen())
+        return {};
+    return GetSection<Box<float>>(GetHeader().m_BoxOffset, GetHeader().m_BoxCount);
+}
+
+inline bool BvhCache::Intersect(const Ray<float>& ray, float& t, uint32_t& primitive) const
+{
+    if (!IsOpen())
+        return false;
+
+    if (GetFormat() == Format::Wide)
+    {
+        return WideBvh::Traverse(GetWideNodes(), GetPrimitives(), ray, GetBoxes(),
+            [](const WideBvh::Node& node, const WideBvh::RayData& data, float tMax, float (&tNear)[WideBvh::Width]) {
+                return WideBvh::IntersectChildren(node.m_Min, node.m_Max, data, tMax, tNear);
+            }, t, primitive);
+    }
+
+    return WideBvh::Traverse(GetQuantizedNodes(), GetPrimitives(), ray, GetBoxes(),
+        [](const QuantizedBvh::Node& node, const WideBvh::RayData& data, float tMax, float (&tNear)[WideBvh::Width]) {
+            return QuantizedBvh::IntersectChildren(node, data, tMax, tNear);
+        }, t, primitive);
+}
+
+inline bool BvhCache::Write(const char* path, const WideBvh& bvh, std::span<const Box<float>> boxes)
+{
+    return Write(path, Format::Wide, sizeof(WideBvh::Node), std::as_bytes(std::span<const WideBvh::Node>(bvh.m_Nodes)),
+                 bvh.GetPrimitives(), boxes);
+}
+
+inline bool BvhCache::Write(const char* path, const QuantizedBvh& bvh, std::span<const Box<float>> boxes)
+{
+    return Write(path, Format::Quantized, sizeof(QuantizedBvh::Node), std::as_bytes(std::span<const QuantizedBvh::Node>(bvh.m_Nodes)),
+                 bvh.GetPrimitives(), boxes);
+}
+
+inline uint64_t BvhCache::Checksum(const void* data, size_t size)
+{
+    // Four independent multiply-rotate lanes over 8-byte words, so the hash keeps up
+    // with reading the file. Detects corruption, not tampering.
+    constexpr uint64_t Prime1 = 0x9e3779b185ebca87ull;
+    constexpr uint64_t Prime2 = 0xc2b2ae3d27d4eb4full;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t lanes[4] = { Prime1, Prime2, ~Prime1, ~Prime2 };
+
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        for (int lane = 0; lane < 4; ++lane)
+        {
+            uint64_t word;
+            std::memcpy(&word, bytes + i + lane * 8, sizeof(word));
+            lanes[lane] = std::rotl(lanes[lane] + word * Prime2, 31) * Prime1;
+        }
+    }
+
+    uint64_t hash = uint64_t(size) * Prime1;
+    for (int lane = 0; lane < 4; ++lane)
+        hash = std::rotl(hash ^ lanes[lane], 27) * Prime1 + Prime2;
+    for (; i < size; ++i)
+        hash = (hash ^ bytes[i]) * Prime1;
+
+    hash ^= hash >> 33;
+    hash *= Prime2;
+    return hash ^ (hash >> 29);
+}
+
+inline bool BvhCache::Write(const char* path, Format format, uint32_t nodeSize, std::span<const std::byte> nodes,
+                            std::span<const uint32_t> indices, std::span<const Box<float>> boxes)
+{
+    Header header = {};
+    std::memcpy(header.m_Magic, Magic, sizeof(header.m_Magic));
+    header.m_Version = Version;
+    header.m_ByteOrder = ByteOrder;
+    header.m_Format = uint32_t(format);
+    header.m_NodeSize = nodeSize;
+    header.m_NodeCount = nodes.size() / nodeSize;
+    header.m_NodeOffset = AlignUp(sizeof(Header));
+    header.m_IndexCount = indices.size();
+    header.m_IndexOffset = AlignUp(header.m_NodeOffset + nodes.size());
+    header.m_BoxCount = boxes.size();
+    header.m_BoxOffset = AlignUp(header.m_IndexOffset + indices.size_bytes());
+    header.m_FileSize = header.m_BoxOffset + boxes.size_bytes();
+
+    assert(std::all_of(indices.begin(), indices.end(), [&](uint32_t index) { return index < boxes.size(); }));
+
+    // Assembled in memory so the checksum is computed over exactly the bytes written
+    std::vector<std::byte> file(header.m_FileSize);
+    std::memcpy(file.data() + header.m_NodeOffset, nodes.data(), nodes.size());
+    std::memcpy(file.data() + header.m_IndexOffset, indices.data(), indices.size_bytes());
+    std::memcpy(file.data() + header.m_BoxOffset, boxes.data(), boxes.size_bytes());
+    header.m_Checksum = Checksum(file.data() + sizeof(Header), file.size() - sizeof(Header));
+    std::memcpy(file.data(), &header, sizeof(Header));
+
+    std::FILE* out = std::fopen(path, "wb");
+    if (out == nullptr)
+        return false;
+
+    bool written = std::fwrite(file.data(), 1, file.size(), out) == file.size();
+    return (std::fclose(out) == 0) && written;
+}
+
+inline uint64_t BvhCache::AlignUp(uint64_t offset)
+{
+    return (offset + Alignment - 1) / Alignment * Alignment;
+}
+
+template<typename T>
+std::span<const T> BvhCache::GetSection(uint64_t offset, uint64_t count) const
+{
+    return std::span<const T>(reinterpret_cast<const T*>(m_Data + offset), size_t(count));
+}
+
+template<typename NodeType>
+bool BvhCache::IsValidTree(std::span<const NodeType> nodes, std::span<const uint32_t> indices, uint64_t boxCount)
+{
+    for (uint32_t index : indices)
+        if (index >= boxCount)
+            return false;
+
+    // The builder appends children after their parent, so depths settle in one forward
+    // pass and a child at or before its parent, which could form a cycle, is rejected.
+    // Depths stay below WideBvh::MaxLevels so the traversal stack cannot overflow.
+    std::vector<uint8_t> depth(nodes.size(), 0);
+    for (size_t node = 0; node < nodes.size(); ++node)
+    {
+        for (uint32_t child : nodes[node].m_Children)
+        {
+            if (child == WideBvh::InvalidChild)
+                continue;
+
+            if (WideBvh::IsLeaf(child))
+            {
+                if (uint64_t(WideBvh::GetLeafFirst(child)) + WideBvh::GetLeafCount(child) > indices.size())
+                    return false;
+            }
+            else
+            {
+                if (child <= node || child >= nodes.size() || depth[node] + 1u >= WideBvh::MaxLevels)
+                    return false;
+                depth[child] = std::max<uint8_t>(depth[child], uint8_t(depth[node] + 1));
+            }
+        }
+    }
+    return true;
+}
@@ -29,6 +29,8 @@ namespace SMath
     const double InvPi    = 0.31830988618379067153;    // 1/pi
     const double Inv2Pi   = 0.15915494309189533576;    // 1/2pi
     const double Inv4Pi   = 0.07957747154594766788;    // 1/4pi
+    const double Sqrt2    = 1.41421356237309504880;    // sqrt(2)
+    const double InvSqrt2 = 0.70710678118654752440;    // 1/sqrt(2)
 
     const double Epsilon  = 0.0000000001;
 }
@@ -0,0 +1,186 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cmath>
+#include <vector>
+#include <cassert>
+#include <algorithm>
+#include "linalg.h"
+#include "box.h"
+
+namespace SMath
+{
+    // How the control points of a CubicSpline are read
+    enum class CurveBasis
+    {
+        Bezier,     // 3n + 1 points, every third one on the curve
+        BSpline,    // Uniform cubic B-spline, C2 and passing through none of the points
+        CatmullRom  // Uniform Catmull-Rom, passing through all points but the first and last
+    };
+
+    /**
+     * Cubic Bezier curve over four control points, with t in [0, 1]. Every
+     * other cubic basis converts to it exactly, so it is the one segment
+     * type that evaluation, bounds and tessellation are written for.
+     */
+    template<typename T>
+    class CubicBezier
+    {
+    public:
+        CubicBezier() = default;
+        CubicBezier(const Point<T, 3>& p0, const Point<T, 3>& p1, const Point<T, 3>& p2, const Point<T, 3>& p3);
+        ~CubicBezier() = default;
+
+    public:
+        Point<T, 3> Evaluate(T t) const;
+        Vector<T, 3> Derivative(T t) const;
+        Vector<T, 3> SecondDerivative(T t) const;
+
+        // Tight bounds: the end points and the extrema where the derivative has a root in (0, 1)
+        Box<T> GetBounds() const;
+
+        // de Casteljau subdivision at t. left covers [0, t] and right [t, 1], both reparameterized to [0, 1].
+        void Split(T t, CubicBezier& left, CubicBezier& right) const;
+
+        // Fills points with the curve at evenly spaced t from 0 to 1 (inclusive) by forward differencing:
+        // three additions per point and coordinate once set up.
+        void Tessellate(std::span<Point<T, 3>> points) const;
+
+        // c[0] + c[1] t + c[2] t^2 + c[3] t^3
+        void GetPowerBasis(Vector<T, 3> coefficients[4]) const;
+
+    public:
+        // Segment of a uniform cubic B-spline over four consecutive control points
+        static CubicBezier FromBSpline(const Point<T, 3>& p0, const Point<T, 3>& p1, const Point<T, 3>& p2, const Point<T, 3>& p3);
+        // Segment of a uniform Catmull-Rom spline from p1 to p2
+        static CubicBezier FromCatmullRom(const Point<T, 3>& p0, const Point<T, 3>& p1, const Point<T, 3>& p2, const Point<T, 3>& p3);
+        // Hermite segment from p0 to p1 with end derivatives m0 and m1
+        static CubicBezier FromHermite(const Point<T, 3>& p0, const Vector<T, 3>& m0, const Point<T, 3>& p1, const Vector<T, 3>& m1);
+
+    public:
+        Point<T, 3> m_Points[4];
+    };
+
+    /**
+     * Piecewise cubic curve over control points in one of the CurveBasis
+     * layouts. The segments are converted to Bezier form on construction;
+     * the parameter u runs from 0 to GetSegmentCount(), segment i covering
+     * [i, i + 1].
+     */
+    template<typename T>
+    class CubicSpline
+    {
+    public:
+        CubicSpline() = default;
+        CubicSpline(std::vector<Point<T, 3>> points, CurveBasis basis);
+        ~CubicSpline() = default;
+
+    public:
+        size_t GetSegmentCount() const;
+        const CubicBezier<T>& GetSegment(size_t index) const;
+
+        Point<T, 3> Evaluate(T u) const;
+        Vector<T, 3> Derivative(T u) const;
+        Box<T> GetBounds() const;
+
+        // Segment of u, clamped to the spline, and the parameter within it
+        size_t FindSegment(T u, T& t) const;
+
+    public:
+        CurveBasis m_Basis = CurveBasis::Bezier;
+        std::vector<Point<T, 3>> m_Points;
+        std::vector<CubicBezier<T>> m_Segments;
+    };
+
+    /**
+     * Cumulative arc length of a curve at evenly spaced parameters, for
+     * moving along it at constant speed. Each interval is integrated with
+     * three-point Gauss-Legendre quadrature, exact for the polynomial part
+     * of the speed; lengths between samples are interpolated linearly.
+     */
+    template<typename T>
+    class ArcLengthTable
+    {
+    public:
+        ArcLengthTable() = default;
+        ArcLengthTable(const CubicBezier<T>& curve, size_t intervalCount = 32);
+        // Parameters are the spline's u, intervalCount per segment
+        ArcLengthTable(const CubicSpline<T>& spline, size_t intervalCount = 32);
+        ~ArcLengthTable() = default;
+
+    public:
+        T GetLength() const;
+        // Arc length from the start to parameter
+        T GetLength(T parameter) const;
+        // Parameter at which the arc length from the start reaches length, clamped to the curve
+        T GetParameter(T length) const;
+
+    private:
+        void Append(const CubicBezier<T>& curve, size_t intervalCount);
+
+    public:
+        // m_Lengths[i] is the length up to parameter i * m_ParameterStep
+        T m_ParameterStep = T(1);
+        std::vector<T> m_Lengths;
+    };
+
+    /**
+     * Bicubic Bezier patch over 16 control points, m_Points[v * 4 + u], with
+     * u and v in [0, 1].
+     */
+    template<typename T>
+    class BezierPatch
+    {
+    public:
+        BezierPatch() = default;
+        BezierPatch(std::span<const Point<T, 3>> points);
+        ~BezierPatch() = default;
+
+    public:
+        Point<T, 3> Evaluate(T u, T v) const;
+        Vector<T, 3> DerivativeU(T u, T v) const;
+        Vector<T, 3> DerivativeV(T u, T v) const;
+        // Unit normal, DerivativeU x DerivativeV. Zero where the patch is degenerate.
+        Vector<T, 3> GetNormal(T u, T v) const;
+
+        // Bounds of the control points, which contain the patch
+        Box<T> GetBounds() const;
+
+        // Curve along u at v
+        CubicBezier<T> GetCurveU(T v) const;
+
+        // uCount by vCount grid of points at evenly spaced (u, v), points[j * uCount + i] at
+        // (i / (uCount - 1), j / (vCount - 1)). Forward differences down the four columns, then along each row.
+        void Tessellate(size_t uCount, size_t vCount, std::span<Point<T, 3>> points) const;
+
+    private:
+        // Bernstein weights at t and their derivatives
+        static void GetWeights(T t, T weights[4], T derivatives[4]);
+        Vector<T, 3> Combine(const T wu[4], const T wv[4]) const;
+
+    public:
+        Point<T, 3> m_Points[16];
+    };
+
+    #include "curve_impl.h"
+}
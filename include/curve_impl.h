@@ -0,0 +1,438 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T>
+CubicBezier<T>::CubicBezier(const Point<T, 3>& p0, const Point<T, 3>& p1, const Point<T, 3>& p2, const Point<T, 3>& p3)
+    : m_Points{ p0, p1, p2, p3 }
+{
+}
+
+template<typename T>
+Point<T, 3> CubicBezier<T>::Evaluate(T t) const
+{
+    T s = T(1) - t;
+    T b0 = s * s * s;
+    T b1 = T(3) * s * s * t;
+    T b2 = T(3) * s * t * t;
+    T b3 = t * t * t;
+
+    Point<T, 3> p;
+    for (int i = 0; i < 3; ++i)
+        p[i] = b0 * m_Points[0][i] + b1 * m_Points[1][i] + b2 * m_Points[2][i] + b3 * m_Points[3][i];
+    return p;
+}
+
+template<typename T>
+Vector<T, 3> CubicBezier<T>::Derivative(T t) const
+{
+    T s = T(1) - t;
+    T b0 = T(3) * s * s;
+    T b1 = T(6) * s * t;
+    T b2 = T(3) * t * t;
+    return (m_Points[1] - m_Points[0]) * b0 + (m_Points[2] - m_Points[1]) * b1 + (m_Points[3] - m_Points[2]) * b2;
+}
+
+template<typename T>
+Vector<T, 3> CubicBezier<T>::SecondDerivative(T t) const
+{
+    Vector<T, 3> a = (m_Points[2] - m_Points[1]) - (m_Points[1] - m_Points[0]);
+    Vector<T, 3> b = (m_Points[3] - m_Points[2]) - (m_Points[2] - m_Points[1]);
+    return a * (T(6) * (T(1) - t)) + b * (T(6) * t);
+}
+
+template<typename T>
+Box<T> CubicBezier<T>::GetBounds() const
+{
+    Box<T> box(Point<T, 3>(std::min(m_Points[0].x, m_Points[3].x), std::min(m_Points[0].y, m_Points[3].y), std::min(m_Points[0].z, m_Points[3].z)),
+               Point<T, 3>(std::max(m_Points[0].x, m_Points[3].x), std::max(m_Points[0].y, m_Points[3].y), std::max(m_Points[0].z, m_Points[3].z)));
+
+    // Per axis, the derivative / 3 is a t^2 + b t + c
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        T p0 = m_Points[0][axis], p1 = m_Points[1][axis], p2 = m_Points[2][axis], p3 = m_Points[3][axis];
+
+        // The hull of the control points is inside the end points: no extremum on this axis
+        if (std::min(p1, p2) >= box.m_Min[axis] && std::max(p1, p2) <= box.m_Max[axis])
+            continue;
+
+        T a = p3 - p0 + T(3) * (p1 - p2);
+        T b = T(2) * (p0 - T(2) * p1 + p2);
+        T c = p1 - p0;
+
+        T roots[2];
+        int rootCount = 0;
+        if (std::abs(a) < T(1e-12) * (std::abs(b) + std::abs(c)))
+        {
+            if (b != T(0))
+                roots[rootCount++] = -c / b;
+        }
+        else
+        {
+            T discriminant = b * b - T(4) * a * c;
+            if (discriminant >= T(0))
+            {
+                // Numerically stable pair: q = -(b + sign(b) sqrt(d)) / 2, roots q / a and c / q
+                T q = T(-0.5) * (b + std::copysign(std::sqrt(discriminant), b));
+                roots[rootCount++] = q / a;
+                if (q != T(0))
+                    roots[rootCount++] = c / q;
+            }
+        }
+
+        for (int i = 0; i < rootCount; ++i)
+        {
+            if (roots[i] > T(0) && roots[i] < T(1))
+            {
+                T value = Evaluate(roots[i])[axis];
+                box.m_Min[axis] = std::min(box.m_Min[axis], value);
+                box.m_Max[axis] = std::max(box.m_Max[axis], value);
+            }
+        }
+    }
+    return box;
+}
+
+template<typename T>
+void CubicBezier<T>::Split(T t, CubicBezier& left, CubicBezier& right) const
+{
+    Point<T, 3> p01 = m_Points[0] + (m_Points[1] - m_Points[0]) * t;
+    Point<T, 3> p12 = m_Points[1] + (m_Points[2] - m_Points[1]) * t;
+    Point<T, 3> p23 = m_Points[2] + (m_Points[3] - m_Points[2]) * t;
+    Point<T, 3> p012 = p01 + (p12 - p01) * t;
+    Point<T, 3> p123 = p12 + (p23 - p12) * t;
+    Point<T, 3> mid = p012 + (p123 - p012) * t;
+
+    Point<T, 3> first = m_Points[0];
+    Point<T, 3> last = m_Points[3];
+    left = CubicBezier(first, p01, p012, mid);
+    right = CubicBezier(mid, p123, p23, last);
+}
+
+template<typename T>
+void CubicBezier<T>::Tessellate(std::span<Point<T, 3>> points) const
+{
+    if (points.empty())
+        return;
+    if (points.size() == 1)
+    {
+        points[0] = m_Points[0];
+        return;
+    }
+
+    Vector<T, 3> c[4];
+    GetPowerBasis(c);
+
+    // Differences of the cubic at step h, starting at t = 0
+    T h = T(1) / T(points.size() - 1);
+    Vector<T, 3> d3 = c[3] * (T(6) * h * h * h);
+    Vector<T, 3> d2 = c[2] * (T(2) * h * h) + d3;
+    Vector<T, 3> d1 = (c[1] + (c[2] + c[3] * h) * h) * h;
+    Vector<T, 3> f = c[0];
+
+    for (size_t i = 0; i + 1 < points.size(); ++i)
+    {
+        points[i] = Point<T, 3>(f);
+        f += d1;
+        d1 += d2;
+        d2 += d3;
+    }
+
+    // Exact end point instead of the accumulated one
+    points.back() = m_Points[3];
+}
+
+template<typename T>
+void CubicBezier<T>::GetPowerBasis(Vector<T, 3> coefficients[4]) const
+{
+    Vector<T, 3> p0(m_Points[0]), p1(m_Points[1]), p2(m_Points[2]), p3(m_Points[3]);
+    coefficients[0] = p0;
+    coefficients[1] = (p1 - p0) * T(3);
+    coefficients[2] = (p0 - p1 * T(2) + p2) * T(3);
+    coefficients[3] = p3 - p0 + (p1 - p2) * T(3);
+}
+
+template<typename T>
+CubicBezier<T> CubicBezier<T>::FromBSpline(const Point<T, 3>& p0, const Point<T, 3>& p1, const Point<T, 3>& p2, const Point<T, 3>& p3)
+{
+    Vector<T, 3> v0(p0), v1(p1), v2(p2), v3(p3);
+    return CubicBezier(Point<T, 3>((v0 + v1 * T(4) + v2) * (T(1) / T(6))),
+                       Point<T, 3>((v1 * T(2) + v2) * (T(1) / T(3))),
+                       Point<T, 3>((v1 + v2 * T(2)) * (T(1) / T(3))),
+                       Point<T, 3>((v1 + v2 * T(4) + v3) * (T(1) / T(6))));
+}
+
+template<typename T>
+CubicBezier<T> CubicBezier<T>::FromCatmullRom(const Point<T, 3>& p0, const Point<T, 3>& p1, const Point<T, 3>& p2, const Point<T, 3>& p3)
+{
+    return CubicBezier(p1, p1 + (p2 - p0) * (T(1) / T(6)), p2 - (p3 - p1) * (T(1) / T(6)), p2);
+}
+
+template<typename T>
+CubicBezier<T> CubicBezier<T>::FromHermite(const Point<T, 3>& p0, const Vector<T, 3>& m0, const Point<T, 3>& p1, const Vector<T, 3>& m1)
+{
+    return CubicBezier(p0, p0 + m0 * (T(1) / T(3)), p1 - m1 * (T(1) / T(3)), p1);
+}
+
+template<typename T>
+CubicSpline<T>::CubicSpline(std::vector<Point<T, 3>> points, CurveBasis basis)
+    : m_Basis(basis)
+    , m_Points(std::move(points))
+{
+    assert(m_Points.size() >= 4);
+
+    if (basis == CurveBasis::Bezier)
+    {
+        assert((m_Points.size() - 1) % 3 == 0);
+        for (size_t i = 0; i + 3 < m_Points.size(); i += 3)
+            m_Segments.emplace_back(m_Points[i], m_Points[i + 1], m_Points[i + 2], m_Points[i + 3]);
+        return;
+    }
+
+    for (size_t i = 0; i + 3 < m_Points.size(); ++i)
+    {
+        if (basis == CurveBasis::BSpline)
+            m_Segments.push_back(CubicBezier<T>::FromBSpline(m_Points[i], m_Points[i + 1], m_Points[i + 2], m_Points[i + 3]));
+        else
+            m_Segments.push_back(CubicBezier<T>::FromCatmullRom(m_Points[i], m_Points[i + 1], m_Points[i + 2], m_Points[i + 3]));
+    }
+}
+
+template<typename T>
+size_t CubicSpline<T>::GetSegmentCount() const
+{
+    return m_Segments.size();
+}
+
+template<typename T>
+const CubicBezier<T>& CubicSpline<T>::GetSegment(size_t index) const
+{
+    return m_Segments[index];
+}
+
+template<typename T>
+size_t CubicSpline<T>::FindSegment(T u, T& t) const
+{
+    T clamped = std::clamp(u, T(0), T(m_Segments.size()));
+    size_t index = std::min(size_t(clamped), m_Segments.size() - 1);
+    t = clamped - T(index);
+    return index;
+}
+
+template<typename T>
+Point<T, 3> CubicSpline<T>::Evaluate(T u) const
+{
+    T t;
+    size_t index = FindSegment(u, t);
+    return m_Segments[index].Evaluate(t);
+}
+
+template<typename T>
+Vector<T, 3> CubicSpline<T>::Derivative(T u) const
+{
+    T t;
+    size_t index = FindSegment(u, t);
+    return m_Segments[index].Derivative(t);
+}
+
+template<typename T>
+Box<T> CubicSpline<T>::GetBounds() const
+{
+    Box<T> box = Box<T>::Empty();
+    for (const CubicBezier<T>& segment : m_Segments)
+        box.Expand(segment.GetBounds());
+    return box;
+}
+
+template<typename T>
+ArcLengthTable<T>::ArcLengthTable(const CubicBezier<T>& curve, size_t intervalCount)
+    : m_ParameterStep(T(1) / T(intervalCount))
+    , m_Lengths(1, T(0))
+{
+    assert(intervalCount > 0);
+    Append(curve, intervalCount);
+}
+
+template<typename T>
+ArcLengthTable<T>::ArcLengthTable(const CubicSpline<T>& spline, size_t intervalCount)
+    : m_ParameterStep(T(1) / T(intervalCount))
+    , m_Lengths(1, T(0))
+{
+    assert(intervalCount > 0);
+    for (const CubicBezier<T>& segment : spline.m_Segments)
+        Append(segment, intervalCount);
+}
+
+template<typename T>
+void ArcLengthTable<T>::Append(const CubicBezier<T>& curve, size_t intervalCount)
+{
+    // Gauss-Legendre nodes and weights on [-1, 1]
+    const T node = std::sqrt(T(0.6));
+    const T weights[3] = { T(5) / T(9), T(8) / T(9), T(5) / T(9) };
+    const T nodes[3] = { -node, T(0), node };
+
+    T h = T(1) / T(intervalCount);
+    for (size_t i = 0; i < intervalCount; ++i)
+    {
+        T mid = (T(i) + T(0.5)) * h;
+        T length = T(0);
+        for (int k = 0; k < 3; ++k)
+            length += weights[k] * curve.Derivative(mid + nodes[k] * T(0.5) * h).Magnitude();
+        m_Lengths.push_back(m_Lengths.back() + length * T(0.5) * h);
+    }
+}
+
+template<typename T>
+T ArcLengthTable<T>::GetLength() const
+{
+    return m_Lengths.back();
+}
+
+template<typename T>
+T ArcLengthTable<T>::GetLength(T parameter) const
+{
+    T x = std::clamp(parameter / m_ParameterStep, T(0), T(m_Lengths.size() - 1));
+    size_t i = std::min(size_t(x), m_Lengths.size() - 2);
+    return m_Lengths[i] + (m_Lengths[i + 1] - m_Lengths[i]) * (x - T(i));
+}
+
+template<typename T>
+T ArcLengthTable<T>::GetParameter(T length) const
+{
+    if (length <= T(0))
+        return T(0);
+    if (length >= m_Lengths.back())
+        return T(m_Lengths.size() - 1) * m_ParameterStep;
+
+    size_t i = std::upper_bound(m_Lengths.begin(), m_Lengths.end(), length) - m_Lengths.begin() - 1;
+    T interval = m_Lengths[i + 1] - m_Lengths[i];
+    T fraction = interval > T(0) ? (length - m_Lengths[i]) / interval : T(0);
+    return (T(i) + fraction) * m_ParameterStep;
+}
+
+template<typename T>
+BezierPatch<T>::BezierPatch(std::span<const Point<T, 3>> points)
+{
+    assert(points.size() == 16);
+    std::copy(points.begin(), points.end(), m_Points);
+}
+
+template<typename T>
+void BezierPatch<T>::GetWeights(T t, T weights[4], T derivatives[4])
+{
+    T s = T(1) - t;
+    weights[0] = s * s * s;
+    weights[1] = T(3) * s * s * t;
+    weights[2] = T(3) * s * t * t;
+    weights[3] = t * t * t;
+
+    derivatives[0] = T(-3) * s * s;
+    derivatives[1] = T(3) * s * (s - T(2) * t);
+    derivatives[2] = T(3) * t * (T(2) * s - t);
+    derivatives[3] = T(3) * t * t;
+}
+
+template<typename T>
+Vector<T, 3> BezierPatch<T>::Combine(const T wu[4], const T wv[4]) const
+{
+    Vector<T, 3> sum(T(0));
+    for (int j = 0; j < 4; ++j)
+    {
+        Vector<T, 3> row(T(0));
+        for (int i = 0; i < 4; ++i)
+            row += Vector<T, 3>(m_Points[j * 4 + i]) * wu[i];
+        sum += row * wv[j];
+    }
+    return sum;
+}
+
+template<typename T>
+Point<T, 3> BezierPatch<T>::Evaluate(T u, T v) const
+{
+    T wu[4], du[4], wv[4], dv[4];
+    GetWeights(u, wu, du);
+    GetWeights(v, wv, dv);
+    return Point<T, 3>(Combine(wu, wv));
+}
+
+template<typename T>
+Vector<T, 3> BezierPatch<T>::DerivativeU(T u, T v) const
+{
+    T wu[4], du[4], wv[4], dv[4];
+    GetWeights(u, wu, du);
+    GetWeights(v, wv, dv);
+    return Combine(du, wv);
+}
+
+template<typename T>
+Vector<T, 3> BezierPatch<T>::DerivativeV(T u, T v) const
+{
+    T wu[4], du[4], wv[4], dv[4];
+    GetWeights(u, wu, du);
+    GetWeights(v, wv, dv);
+    return Combine(wu, dv);
+}
+
+template<typename T>
+Vector<T, 3> BezierPatch<T>::GetNormal(T u, T v) const
+{
+    Vector<T, 3> normal = Vector<T, 3>::Cross(DerivativeU(u, v), DerivativeV(u, v));
+    T length = normal.Magnitude();
+    return length > T(0) ? normal * (T(1) / length) : Vector<T, 3>(T(0));
+}
+
+template<typename T>
+Box<T> BezierPatch<T>::GetBounds() const
+{
+    Box<T> box = Box<T>::Empty();
+    for (const Point<T, 3>& point : m_Points)
+        box.Expand(point);
+    return box;
+}
+
+template<typename T>
+CubicBezier<T> BezierPatch<T>::GetCurveU(T v) const
+{
+    // Each control point of the u curve is a column curve evaluated at v
+    CubicBezier<T> curve;
+    for (int i = 0; i < 4; ++i)
+        curve.m_Points[i] = CubicBezier<T>(m_Points[i], m_Points[4 + i], m_Points[8 + i], m_Points[12 + i]).Evaluate(v);
+    return curve;
+}
+
+template<typename T>
+void BezierPatch<T>::Tessellate(size_t uCount, size_t vCount, std::span<Point<T, 3>> points) const
+{
+    assert(points.size() == uCount * vCount);
+    if (points.empty())
+        return;
+
+    std::vector<Point<T, 3>> columns(vCount * 4);
+    for (int i = 0; i < 4; ++i)
+    {
+        CubicBezier<T>(m_Points[i], m_Points[4 + i], m_Points[8 + i], m_Points[12 + i])
+            .Tessellate(std::span<Point<T, 3>>(columns).subspan(i * vCount, vCount));
+    }
+
+    for (size_t j = 0; j < vCount; ++j)
+    {
+        CubicBezier<T>(columns[j], columns[vCount + j], columns[2 * vCount + j], columns[3 * vCount + j])
+            .Tessellate(points.subspan(j * uCount, uCount));
+    }
+}
@@ -0,0 +1,139 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <limits>
+#include "linalg.h"
+
+namespace SMath
+{
+    /**
+     * Decompositions of small fixed-size square matrices. Loop bounds are
+     * compile-time constants so the compiler fully unrolls them, and no
+     * decomposition allocates.
+     */
+    template <typename T, int N>
+    class LUDecomposition
+    {
+        static_assert(std::is_floating_point_v<T>, "LUDecomposition only works with floating types");
+
+    public:
+        LUDecomposition(const Matrix<T, N>& m);
+
+    public:
+        bool IsSingular() const;
+        T Determinant() const;
+        Vector<T, N> Solve(const Vector<T, N>& b) const;
+        Matrix<T, N> Inversed() const;
+
+    public:
+        // Unit lower triangle (L) and upper triangle (U) packed into one matrix
+        Matrix<T, N> m_LU;
+        int m_Pivot[N];
+        int m_Sign;
+        bool m_IsSingular;
+    };
+
+    template <typename T, int N>
+    class QRDecomposition
+    {
+        static_assert(std::is_floating_point_v<T>, "QRDecomposition only works with floating types");
+
+    public:
+        QRDecomposition(const Matrix<T, N>& m);
+
+    public:
+        bool IsSingular() const;
+        Vector<T, N> Solve(const Vector<T, N>& b) const;
+
+    public:
+        // Q is orthogonal, R is upper triangular with a non-negative diagonal
+        Matrix<T, N> m_Q;
+        Matrix<T, N> m_R;
+    };
+
+    template <typename T, int N>
+    class CholeskyDecomposition
+    {
+        static_assert(std::is_floating_point_v<T>, "CholeskyDecomposition only works with floating types");
+
+    public:
+        CholeskyDecomposition(const Matrix<T, N>& m);
+
+    public:
+        bool IsPositiveDefinite() const;
+        Vector<T, N> Solve(const Vector<T, N>& b) const;
+
+    public:
+        // Lower triangular L such that L * L^T = m
+        Matrix<T, N> m_L;
+        bool m_IsPositiveDefinite;
+    };
+
+    template <typename T, int N>
+    class SymmetricEigen
+    {
+        static_assert(std::is_floating_point_v<T>, "SymmetricEigen only works with floating types");
+
+    public:
+        // Cyclic Jacobi. Only the upper triangle of m is read.
+        SymmetricEigen(const Matrix<T, N>& m, int maxSweeps = 32);
+
+    public:
+        // Sorts eigenvalues in descending order, keeping eigenvector columns paired
+        static void Sort(Vector<T, N>& eigenvalues, Matrix<T, N>& eigenvectors);
+
+    public:
+        Vector<T, N> m_Eigenvalues;
+        // Column i is the unit eigenvector of m_Eigenvalues[i]
+        Matrix<T, N> m_Eigenvectors;
+    };
+
+    /**
+     * Batched versions that process DecompositionLanes matrices at a time in a
+     * structure-of-arrays block, so that every arithmetic loop runs across
+     * lanes and vectorizes. Pivoting and rotations are branch-free selects.
+     * Lanes holding singular (or non positive-definite) matrices produce
+     * non-finite results instead of being reported. All spans must have the
+     * same length.
+     */
+    namespace Batch
+    {
+        static constexpr int DecompositionLanes = 8;
+
+        template <typename T, int N>
+        void LUSolve(std::span<const Matrix<T, N>> m, std::span<const Vector<T, N>> b, std::span<Vector<T, N>> x);
+
+        template <typename T, int N>
+        void CholeskySolve(std::span<const Matrix<T, N>> m, std::span<const Vector<T, N>> b, std::span<Vector<T, N>> x);
+
+        template <typename T, int N>
+        void QRDecompose(std::span<const Matrix<T, N>> m, std::span<Matrix<T, N>> q, std::span<Matrix<T, N>> r);
+
+        template <typename T, int N>
+        void SymmetricEigen(std::span<const Matrix<T, N>> m, std::span<Vector<T, N>> eigenvalues,
+            std::span<Matrix<T, N>> eigenvectors, int maxSweeps = 32);
+    }
+
+    #include "decomposition_impl.h"
+}
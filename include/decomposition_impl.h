@@ -0,0 +1,750 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template <typename T, int N>
+LUDecomposition<T, N>::LUDecomposition(const Matrix<T, N>& m)
+    : m_LU(m)
+    , m_Sign(1)
+    , m_IsSingular(false)
+{
+    T scale = 0;
+    for (int i = 0; i < N * N; ++i)
+        scale = std::max(scale, std::fabs(m.m_Data[i]));
+
+    const T tolerance = scale * std::numeric_limits<T>::epsilon();
+
+    for (int i = 0; i < N; ++i)
+        m_Pivot[i] = i;
+
+    for (int k = 0; k < N; ++k)
+    {
+        // Partial pivoting: bring the largest remaining entry of column k onto the diagonal
+        int p = k;
+        for (int i = k + 1; i < N; ++i)
+            if (std::fabs(m_LU.m_Data2D[i][k]) > std::fabs(m_LU.m_Data2D[p][k]))
+                p = i;
+
+        if (p != k)
+        {
+            for (int j = 0; j < N; ++j)
+                std::swap(m_LU.m_Data2D[k][j], m_LU.m_Data2D[p][j]);
+
+            std::swap(m_Pivot[k], m_Pivot[p]);
+            m_Sign = -m_Sign;
+        }
+
+        T pivot = m_LU.m_Data2D[k][k];
+        if (std::fabs(pivot) <= tolerance)
+        {
+            m_IsSingular = true;
+            continue;
+        }
+
+        for (int i = k + 1; i < N; ++i)
+        {
+            T l = m_LU.m_Data2D[i][k] / pivot;
+            m_LU.m_Data2D[i][k] = l;
+
+            for (int j = k + 1; j < N; ++j)
+                m_LU.m_Data2D[i][j] -= l * m_LU.m_Data2D[k][j];
+        }
+    }
+}
+
+template <typename T, int N>
+bool LUDecomposition<T, N>::IsSingular() const
+{
+    return m_IsSingular;
+}
+
+template <typename T, int N>
+T LUDecomposition<T, N>::Determinant() const
+{
+    T det = T(m_Sign);
+    for (int i = 0; i < N; ++i)
+        det *= m_LU.m_Data2D[i][i];
+    return det;
+}
+
+template <typename T, int N>
+Vector<T, N> LUDecomposition<T, N>::Solve(const Vector<T, N>& b) const
+{
+    Vector<T, N> x;
+
+    // Forward substitution with the unit lower triangle: L * y = P * b
+    for (int i = 0; i < N; ++i)
+    {
+        T sum = b[m_Pivot[i]];
+        for (int j = 0; j < i; ++j)
+            sum -= m_LU.m_Data2D[i][j] * x[j];
+        x[i] = sum;
+    }
+
+    // Back substitution with the upper triangle: U * x = y
+    for (int i = N - 1; i >= 0; --i)
+    {
+        T sum = x[i];
+        for (int j = i + 1; j < N; ++j)
+            sum -= m_LU.m_Data2D[i][j] * x[j];
+        x[i] = sum / m_LU.m_Data2D[i][i];
+    }
+
+    return x;
+}
+
+template <typename T, int N>
+Matrix<T, N> LUDecomposition<T, N>::Inversed() const
+{
+    Matrix<T, N> inverse;
+
+    for (int j = 0; j < N; ++j)
+    {
+        Vector<T, N> e;
+        e[j] = 1;
+
+        Vector<T, N> column = Solve(e);
+        for (int i = 0; i < N; ++i)
+            inverse.m_Data2D[i][j] = column[i];
+    }
+
+    return inverse;
+}
+
+template <typename T, int N>
+QRDecomposition<T, N>::QRDecomposition(const Matrix<T, N>& m)
+    : m_Q(Matrix<T, N>::Identity())
+    , m_R(m)
+{
+    // Householder reflections H_k = I - 2 * v * v^T / (v^T * v), accumulated into Q
+    for (int k = 0; k < N - 1; ++k)
+    {
+        T v[N] = {};
+        T norm = 0;
+
+        for (int i = k; i < N; ++i)
+        {
+            v[i] = m_R.m_Data2D[i][k];
+            norm += v[i] * v[i];
+        }
+
+        norm = std::sqrt(norm);
+        T alpha = v[k] > 0 ? -norm : norm;
+        v[k] -= alpha;
+
+        T vv = 0;
+        for (int i = k; i < N; ++i)
+            vv += v[i] * v[i];
+
+        if (vv <= std::numeric_limits<T>::min())
+            continue;
+
+        T scale = T(2) / vv;
+
+        for (int j = 0; j < N; ++j)
+        {
+            T dot = 0;
+            for (int i = k; i < N; ++i)
+                dot += v[i] * m_R.m_Data2D[i][j];
+
+            dot *= scale;
+            for (int i = k; i < N; ++i)
+                m_R.m_Data2D[i][j] -= dot * v[i];
+        }
+
+        for (int i = 0; i < N; ++i)
+        {
+            T dot = 0;
+            for (int j = k; j < N; ++j)
+                dot += m_Q.m_Data2D[i][j] * v[j];
+
+            dot *= scale;
+            for (int j = k; j < N; ++j)
+                m_Q.m_Data2D[i][j] -= dot * v[j];
+        }
+    }
+
+    // Make the decomposition unique by flipping rows of R (and columns of Q) to a non-negative diagonal
+    for (int k = 0; k < N; ++k)
+    {
+        if (m_R.m_Data2D[k][k] >= 0)
+            continue;
+
+        for (int j = 0; j < N; ++j)
+        {
+            m_R.m_Data2D[k][j] = -m_R.m_Data2D[k][j];
+            m_Q.m_Data2D[j][k] = -m_Q.m_Data2D[j][k];
+        }
+    }
+
+    // Entries below the diagonal are round-off by construction
+    for (int i = 1; i < N; ++i)
+        for (int j = 0; j < i; ++j)
+            m_R.m_Data2D[i][j] = 0;
+}
+
+template <typename T, int N>
+bool QRDecomposition<T, N>::IsSingular() const
+{
+    T scale = 0;
+    for (int i = 0; i < N; ++i)
+        scale = std::max(scale, m_R.m_Data2D[i][i]);
+
+    for (int i = 0; i < N; ++i)
+        if (m_R.m_Data2D[i][i] <= scale * std::numeric_limits<T>::epsilon())
+            return true;
+
+    return false;
+}
+
+template <typename T, int N>
+Vector<T, N> QRDecomposition<T, N>::Solve(const Vector<T, N>& b) const
+{
+    // R * x = Q^T * b
+    Vector<T, N> x;
+
+    for (int i = 0; i < N; ++i)
+    {
+        T sum = 0;
+        for (int j = 0; j < N; ++j)
+            sum += m_Q.m_Data2D[j][i] * b[j];
+        x[i] = sum;
+    }
+
+    for (int i = N - 1; i >= 0; --i)
+    {
+        T sum = x[i];
+        for (int j = i + 1; j < N; ++j)
+            sum -= m_R.m_Data2D[i][j] * x[j];
+        x[i] = sum / m_R.m_Data2D[i][i];
+    }
+
+    return x;
+}
+
+template <typename T, int N>
+CholeskyDecomposition<T, N>::CholeskyDecomposition(const Matrix<T, N>& m)
+    : m_L(T(0))
+    , m_IsPositiveDefinite(true)
+{
+    for (int j = 0; j < N; ++j)
+    {
+        T diagonal = m.m_Data2D[j][j];
+        for (int k = 0; k < j; ++k)
+            diagonal -= m_L.m_Data2D[j][k] * m_L.m_Data2D[j][k];
+
+        if (!(diagonal > 0))
+        {
+            m_IsPositiveDefinite = false;
+            return;
+        }
+
+        T ljj = std::sqrt(diagonal);
+        T invLjj = T(1) / ljj;
+        m_L.m_Data2D[j][j] = ljj;
+
+        for (int i = j + 1; i < N; ++i)
+        {
+            T sum = m.m_Data2D[i][j];
+            for (int k = 0; k < j; ++k)
+                sum -= m_L.m_Data2D[i][k] * m_L.m_Data2D[j][k];
+            m_L.m_Data2D[i][j] = sum * invLjj;
+        }
+    }
+}
+
+template <typename T, int N>
+bool CholeskyDecomposition<T, N>::IsPositiveDefinite() const
+{
+    return m_IsPositiveDefinite;
+}
+
+template <typename T, int N>
+Vector<T, N> CholeskyDecomposition<T, N>::Solve(const Vector<T, N>& b) const
+{
+    // L * y = b, then L^T * x = y
+    Vector<T, N> x;
+
+    for (int i = 0; i < N; ++i)
+    {
+        T sum = b[i];
+        for (int k = 0; k < i; ++k)
+            sum -= m_L.m_Data2D[i][k] * x[k];
+        x[i] = sum / m_L.m_Data2D[i][i];
+    }
+
+    for (int i = N - 1; i >= 0; --i)
+    {
+        T sum = x[i];
+        for (int k = i + 1; k < N; ++k)
+            sum -= m_L.m_Data2D[k][i] * x[k];
+        x[i] = sum / m_L.m_Data2D[i][i];
+    }
+
+    return x;
+}
+
+template <typename T, int N>
+SymmetricEigen<T, N>::SymmetricEigen(const Matrix<T, N>& m, int maxSweeps)
+    : m_Eigenvectors(Matrix<T, N>::Identity())
+{
+    T a[N][N];
+    T norm = 0;
+
+    for (int i = 0; i < N; ++i)
+        for (int j = 0; j < N; ++j)
+        {
+            a[i][j] = i <= j ? m.m_Data2D[i][j] : m.m_Data2D[j][i];
+            norm += a[i][j] * a[i][j];
+        }
+
+    const T tolerance = norm * std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon();
+
+    for (int sweep = 0; sweep < maxSweeps; ++sweep)
+    {
+        T off = 0;
+        for (int p = 0; p < N; ++p)
+            for (int q = p + 1; q < N; ++q)
+                off += a[p][q] * a[p][q];
+
+        if (off <= tolerance)
+            break;
+
+        for (int p = 0; p < N; ++p)
+        {
+            for (int q = p + 1; q < N; ++q)
+            {
+                if (std::fabs(a[p][q]) <= std::numeric_limits<T>::min())
+                    continue;
+
+                // Rotation angle that annihilates a[p][q] (Numerical Recipes, 11.1)
+                T theta = (a[q][q] - a[p][p]) / (T(2) * a[p][q]);
+                T t = T(1) / (std::fabs(theta) + std::sqrt(theta * theta + T(1)));
+                t = theta < 0 ? -t : t;
+                T c = T(1) / std::sqrt(t * t + T(1));
+                T s = t * c;
+
+                for (int k = 0; k < N; ++k)
+                {
+                    T akp = a[k][p];
+                    T akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+
+                for (int k = 0; k < N; ++k)
+                {
+                    T apk = a[p][k];
+                    T aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+
+                for (int k = 0; k < N; ++k)
+                {
+                    T vkp = m_Eigenvectors.m_Data2D[k][p];
+                    T vkq = m_Eigenvectors.m_Data2D[k][q];
+                    m_Eigenvectors.m_Data2D[k][p] = c * vkp - s * vkq;
+                    m_Eigenvectors.m_Data2D[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+
+    for (int i = 0; i < N; ++i)
+        m_Eigenvalues[i] = a[i][i];
+
+    Sort(m_Eigenvalues, m_Eigenvectors);
+}
+
+template <typename T, int N>
+void SymmetricEigen<T, N>::Sort(Vector<T, N>& eigenvalues, Matrix<T, N>& eigenvectors)
+{
+    // Selection sort, N is tiny
+    for (int i = 0; i < N - 1; ++i)
+    {
+        int largest = i;
+        for (int j = i + 1; j < N; ++j)
+            if (eigenvalues[j] > eigenvalues[largest])
+                largest = j;
+
+        if (largest == i)
+            continue;
+
+        std::swap(eigenvalues[i], eigenvalues[largest]);
+        for (int k = 0; k < N; ++k)
+            std::swap(eigenvectors.m_Data2D[k][i], eigenvectors.m_Data2D[k][largest]);
+    }
+}
+
+template <typename T, int N>
+void Batch::LUSolve(std::span<const Matrix<T, N>> m, std::span<const Vector<T, N>> b, std::span<Vector<T, N>> x)
+{
+    constexpr int W = DecompositionLanes;
+    assert(m.size() == b.size() && b.size() == x.size());
+    const size_t count = m.size();
+
+    for (size_t base = 0; base < count; base += W)
+    {
+        const int lanes = int(std::min<size_t>(W, count - base));
+
+        T a[N][N][W];
+        T y[N][W];
+
+        // Unused lanes solve I * x = 0
+        for (int w = 0; w < W; ++w)
+            for (int i = 0; i < N; ++i)
+            {
+                for (int j = 0; j < N; ++j)
+                    a[i][j][w] = w < lanes ? m[base + w].m_Data2D[i][j] : T(i == j ? 1 : 0);
+                y[i][w] = w < lanes ? b[base + w][i] : T(0);
+            }
+
+        for (int k = 0; k < N; ++k)
+        {
+            int pivot[W];
+            T best[W];
+
+            for (int w = 0; w < W; ++w)
+            {
+                pivot[w] = k;
+                best[w] = std::fabs(a[k][k][w]);
+            }
+
+            for (int r = k + 1; r < N; ++r)
+                for (int w = 0; w < W; ++w)
+                {
+                    T v = std::fabs(a[r][k][w]);
+                    bool larger = v > best[w];
+                    best[w] = larger ? v : best[w];
+                    pivot[w] = larger ? r : pivot[w];
+                }
+
+            // Masked row swaps keep every lane on the same instruction stream
+            for (int r = k + 1; r < N; ++r)
+            {
+                for (int j = k; j < N; ++j)
+                    for (int w = 0; w < W; ++w)
+                    {
+                        bool swap = pivot[w] == r;
+                        T top = a[k][j][w];
+                        T bottom = a[r][j][w];
+                        a[k][j][w] = swap ? bottom : top;
+                        a[r][j][w] = swap ? top : bottom;
+                    }
+
+                for (int w = 0; w < W; ++w)
+                {
+                    bool swap = pivot[w] == r;
+                    T top = y[k][w];
+                    T bottom = y[r][w];
+                    y[k][w] = swap ? bottom : top;
+                    y[r][w] = swap ? top : bottom;
+                }
+            }
+
+            T inv[W];
+            for (int w = 0; w < W; ++w)
+                inv[w] = T(1) / a[k][k][w];
+
+            for (int i = k + 1; i < N; ++i)
+            {
+                T l[W];
+                for (int w = 0; w < W; ++w)
+                    l[w] = a[i][k][w] * inv[w];
+
+                for (int j = k + 1; j < N; ++j)
+                    for (int w = 0; w < W; ++w)
+                        a[i][j][w] -= l[w] * a[k][j][w];
+
+                for (int w = 0; w < W; ++w)
+                    y[i][w] -= l[w] * y[k][w];
+            }
+        }
+
+        for (int i = N - 1; i >= 0; --i)
+        {
+            for (int j = i + 1; j < N; ++j)
+                for (int w = 0; w < W; ++w)
+                    y[i][w] -= a[i][j][w] * y[j][w];
+
+            for (int w = 0; w < W; ++w)
+                y[i][w] /= a[i][i][w];
+        }
+
+        for (int w = 0; w < lanes; ++w)
+            for (int i = 0; i < N; ++i)
+                x[base + w][i] = y[i][w];
+    }
+}
+
+template <typename T, int N>
+void Batch::CholeskySolve(std::span<const Matrix<T, N>> m, std::span<const Vector<T, N>> b, std::span<Vector<T, N>> x)
+{
+    constexpr int W = DecompositionLanes;
+    assert(m.size() == b.size() && b.size() == x.size());
+    const size_t count = m.size();
+
+    for (size_t base = 0; base < count; base += W)
+    {
+        const int lanes = int(std::min<size_t>(W, count - base));
+
+        T l[N][N][W];
+        T inv[N][W];
+        T y[N][W];
+
+        for (int w = 0; w < W; ++w)
+            for (int i = 0; i < N; ++i)
+            {
+                for (int j = 0; j <= i; ++j)
+                    l[i][j][w] = w < lanes ? m[base + w].m_Data2D[i][j] : T(i == j ? 1 : 0);
+                y[i][w] = w < lanes ? b[base + w][i] : T(0);
+            }
+
+        for (int j = 0; j < N; ++j)
+        {
+            for (int k = 0; k < j; ++k)
+                for (int w = 0; w < W; ++w)
+                    l[j][j][w] -= l[j][k][w] * l[j][k][w];
+
+            for (int w = 0; w < W; ++w)
+            {
+                l[j][j][w] = std::sqrt(l[j][j][w]);
+                inv[j][w] = T(1) / l[j][j][w];
+            }
+
+            for (int i = j + 1; i < N; ++i)
+            {
+                for (int k = 0; k < j; ++k)
+                    for (int w = 0; w < W; ++w)
+                        l[i][j][w] -= l[i][k][w] * l[j][k][w];
+
+                for (int w = 0; w < W; ++w)
+                    l[i][j][w] *= inv[j][w];
+            }
+        }
+
+        for (int i = 0; i < N; ++i)
+        {
+            for (int k = 0; k < i; ++k)
+                for (int w = 0; w < W; ++w)
+                    y[i][w] -= l[i][k][w] * y[k][w];
+
+            for (int w = 0; w < W; ++w)
+                y[i][w] *= inv[i][w];
+        }
+
+        for (int i = N - 1; i >= 0; --i)
+        {
+            for (int k = i + 1; k < N; ++k)
+                for (int w = 0; w < W; ++w)
+                    y[i][w] -= l[k][i][w] * y[k][w];
+
+            for (int w = 0; w < W; ++w)
+                y[i][w] *= inv[i][w];
+        }
+
+        for (int w = 0; w < lanes; ++w)
+            for (int i = 0; i < N; ++i)
+                x[base + w][i] = y[i][w];
+    }
+}
+
+template <typename T, int N>
+void Batch::QRDecompose(std::span<const Matrix<T, N>> m, std::span<Matrix<T, N>> q, std::span<Matrix<T, N>> r)
+{
+    constexpr int W = DecompositionLanes;
+    assert(m.size() == q.size() && q.size() == r.size());
+    const size_t count = m.size();
+
+    for (size_t base = 0; base < count; base += W)
+    {
+        const int lanes = int(std::min<size_t>(W, count - base));
+
+        // Modified Gram-Schmidt on the columns of m. For full rank input this
+        // yields the same unique factorization (positive diagonal R) as QRDecomposition.
+        T qs[N][N][W];
+        T rs[N][N][W] = {};
+
+        for (int w = 0; w < W; ++w)
+            for (int i = 0; i < N; ++i)
+                for (int j = 0; j < N; ++j)
+                    qs[i][j][w] = w < lanes ? m[base + w].m_Data2D[i][j] : T(i == j ? 1 : 0);
+
+        for (int k = 0; k < N; ++k)
+        {
+            T norm[W] = {};
+            for (int i = 0; i < N; ++i)
+                for (int w = 0; w < W; ++w)
+                    norm[w] += qs[i][k][w] * qs[i][k][w];
+
+            T inv[W];
+            for (int w = 0; w < W; ++w)
+            {
+                rs[k][k][w] = std::sqrt(norm[w]);
+                inv[w] = T(1) / rs[k][k][w];
+            }
+
+            for (int i = 0; i < N; ++i)
+                for (int w = 0; w < W; ++w)
+                    qs[i][k][w] *= inv[w];
+
+            for (int j = k + 1; j < N; ++j)
+            {
+                T dot[W] = {};
+                for (int i = 0; i < N; ++i)
+                    for (int w = 0; w < W; ++w)
+                        dot[w] += qs[i][k][w] * qs[i][j][w];
+
+                for (int w = 0; w < W; ++w)
+                    rs[k][j][w] = dot[w];
+
+                for (int i = 0; i < N; ++i)
+                    for (int w = 0; w < W; ++w)
+                        qs[i][j][w] -= dot[w] * qs[i][k][w];
+            }
+        }
+
+        for (int w = 0; w < lanes; ++w)
+            for (int i = 0; i < N; ++i)
+                for (int j = 0; j < N; ++j)
+                {
+                    q[base + w].m_Data2D[i][j] = qs[i][j][w];
+                    r[base + w].m_Data2D[i][j] = rs[i][j][w];
+                }
+    }
+}
+
+template <typename T, int N>
+void Batch::SymmetricEigen(std::span<const Matrix<T, N>> m, std::span<Vector<T, N>> eigenvalues,
+    std::span<Matrix<T, N>> eigenvectors, int maxSweeps)
+{
+    constexpr int W = DecompositionLanes;
+    assert(m.size() == eigenvalues.size() && eigenvalues.size() == eigenvectors.size());
+    const size_t count = m.size();
+
+    for (size_t base = 0; base < count; base += W)
+    {
+        const int lanes = int(std::min<size_t>(W, count - base));
+
+        T a[N][N][W];
+        T v[N][N][W];
+
+        for (int w = 0; w < W; ++w)
+            for (int i = 0; i < N; ++i)
+                for (int j = 0; j < N; ++j)
+                {
+                    const int r = std::min(i, j);
+                    const int c = std::max(i, j);
+                    a[i][j][w] = w < lanes ? m[base + w].m_Data2D[r][c] : T(i == j ? 1 : 0);
+                    v[i][j][w] = T(i == j ? 1 : 0);
+                }
+
+        T tolerance[W];
+        for (int w = 0; w < W; ++w)
+        {
+            T norm = 0;
+            for (int i = 0; i < N; ++i)
+                for (int j = 0; j < N; ++j)
+                    norm += a[i][j][w] * a[i][j][w];
+            tolerance[w] = norm * std::numeric_limits<T>::epsilon() * std::numeric_limits<T>::epsilon();
+        }
+
+        // The whole block stops once every lane has converged. Lanes that
+        // converge early see a[p][q] == 0 and rotate by the identity.
+        for (int sweep = 0; sweep < maxSweeps; ++sweep)
+        {
+            bool converged = true;
+            for (int w = 0; w < W; ++w)
+            {
+                T off = 0;
+                for (int p = 0; p < N; ++p)
+                    for (int q = p + 1; q < N; ++q)
+                        off += a[p][q][w] * a[p][q][w];
+                converged &= off <= tolerance[w];
+            }
+
+            if (converged)
+                break;
+
+            for (int p = 0; p < N; ++p)
+            {
+                for (int q = p + 1; q < N; ++q)
+                {
+                    T c[W];
+                    T s[W];
+
+                    for (int w = 0; w < W; ++w)
+                    {
+                        T apq = a[p][q][w];
+                        bool skip = std::fabs(apq) <= std::numeric_limits<T>::min();
+                        T theta = (a[q][q][w] - a[p][p][w]) / (T(2) * (skip ? T(1) : apq));
+                        T t = T(1) / (std::fabs(theta) + std::sqrt(theta * theta + T(1)));
+                        t = theta < 0 ? -t : t;
+                        t = skip ? T(0) : t;
+                        c[w] = T(1) / std::sqrt(t * t + T(1));
+                        s[w] = t * c[w];
+                    }
+
+                    for (int k = 0; k < N; ++k)
+                        for (int w = 0; w < W; ++w)
+                        {
+                            T akp = a[k][p][w];
+                            T akq = a[k][q][w];
+                            a[k][p][w] = c[w] * akp - s[w] * akq;
+                            a[k][q][w] = s[w] * akp + c[w] * akq;
+                        }
+
+                    for (int k = 0; k < N; ++k)
+                        for (int w = 0; w < W; ++w)
+                        {
+                            T apk = a[p][k][w];
+                            T aqk = a[q][k][w];
+                            a[p][k][w] = c[w] * apk - s[w] * aqk;
+                            a[q][k][w] = s[w] * apk + c[w] * aqk;
+                        }
+
+                    for (int k = 0; k < N; ++k)
+                        for (int w = 0; w < W; ++w)
+                        {
+                            T vkp = v[k][p][w];
+                            T vkq = v[k][q][w];
+                            v[k][p][w] = c[w] * vkp - s[w] * vkq;
+                            v[k][q][w] = s[w] * vkp + c[w] * vkq;
+                        }
+                }
+            }
+        }
+
+        for (int w = 0; w < lanes; ++w)
+        {
+            Vector<T, N>& values = eigenvalues[base + w];
+            Matrix<T, N>& vectors = eigenvectors[base + w];
+
+            for (int i = 0; i < N; ++i)
+            {
+                values[i] = a[i][i][w];
+                for (int j = 0; j < N; ++j)
+                    vectors.m_Data2D[i][j] = v[i][j][w];
+            }
+
+            SMath::SymmetricEigen<T, N>::Sort(values, vectors);
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <algorithm>
+#include "simd.h"
+
+#if defined(SMATH_X86)
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#endif
+
+namespace SMath::Simd
+{
+    // Instruction set levels, ordered so that a higher level implies the lower ones
+    enum class Level
+    {
+        Scalar,
+        Sse2,
+        Avx2,
+        Avx512
+    };
+
+    inline const char* GetLevelName(Level level)
+    {
+        switch (level)
+        {
+        case Level::Sse2: return "SSE2";
+        case Level::Avx2: return "AVX2";
+        case Level::Avx512: return "AVX-512";
+        default: return "Scalar";
+        }
+    }
+
+    // Queries cpuid and the OS-enabled register state for the best supported level
+    inline Level DetectLevel()
+    {
+#if defined(SMATH_X86)
+        unsigned int regs[4] = {};
+        auto cpuid = [&regs](unsigned int leaf, unsigned int subleaf) {
+#if defined(_MSC_VER)
+            __cpuidex(reinterpret_cast<int*>(regs), int(leaf), int(subleaf));
+#else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        };
+
+        cpuid(0, 0);
+        unsigned int maxLeaf = regs[0];
+
+        cpuid(1, 0);
+        bool osxsave = (regs[2] & (1u << 27)) != 0;
+        bool avx = (regs[2] & (1u << 28)) != 0;
+        bool fma = (regs[2] & (1u << 12)) != 0;
+        bool f16c = (regs[2] & (1u << 29)) != 0;
+
+        if (!osxsave || !avx || !fma || !f16c || maxLeaf < 7)
+            return Level::Sse2;
+
+        // XCR0 must have the SSE/AVX state (and for AVX-512, opmask/ZMM state) enabled by the OS
+#if defined(_MSC_VER)
+        unsigned long long xcr0 = _xgetbv(0);
+#else
+        unsigned int xcr0Lo, xcr0Hi;
+        __asm__ volatile("xgetbv" : "=a"(xcr0Lo), "=d"(xcr0Hi) : "c"(0));
+        unsigned long long xcr0 = (static_cast<unsigned long long>(xcr0Hi) << 32) | xcr0Lo;
+#endif
+
+        cpuid(7, 0);
+        bool avx2 = (regs[1] & (1u << 5)) != 0;
+        bool avx512f = (regs[1] & (1u << 16)) != 0;
+
+        if (avx512f && avx2 && (xcr0 & 0xe6) == 0xe6)
+            return Level::Avx512;
+        if (avx2 && (xcr0 & 0x6) == 0x6)
+            return Level::Avx2;
+        return Level::Sse2;
+#else
+        return Level::Scalar;
+#endif
+    }
+
+    // The best level this CPU supports, detected once on first use
+    inline Level GetSupportedLevel()
+    {
+        static const Level level = DetectLevel();
+        return level;
+    }
+
+    inline std::atomic<Level>& GetActiveLevel()
+    {
+        static std::atomic<Level> level(GetSupportedLevel());
+        return level;
+    }
+
+    // The level batch kernels currently run at
+    inline Level GetLevel()
+    {
+        return GetActiveLevel().load(std::memory_order_relaxed);
+    }
+
+    // Forces batch kernels down to a lower level, e.g. to test or benchmark every
+    // code path on one machine. Levels above the supported one are clamped, and
+    // the level actually set is returned.
+    inline Level SetLevel(Level level)
+    {
+        Level clamped = std::min(level, GetSupportedLevel());
+        GetActiveLevel().store(clamped, std::memory_order_relaxed);
+        return clamped;
+    }
+
+    inline void ResetLevel()
+    {
+        SetLevel(GetSupportedLevel());
+    }
+
+    /**
+     * Picks the kernel table for the active level. Each batch header declares a
+     * table struct of function pointers and defines one instance per ISA
+     * namespace, so a call costs one indirect jump instead of a feature check.
+     */
+    template <typename Table>
+    inline const Table& Dispatch(const Table& scalar, [[maybe_unused]] const Table& sse2,
+        [[maybe_unused]] const Table& avx2, [[maybe_unused]] const Table& avx512)
+    {
+        switch (GetLevel())
+        {
+        case Level::Avx512: return avx512;
+        case Level::Avx2: return avx2;
+        case Level::Sse2: return sse2;
+        default: return scalar;
+        }
+    }
+}
@@ -0,0 +1,164 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "simd.h"
+#include "linalg.h"
+
+namespace SMath::Simd::Scalar
+{
+    #include "fastmath_impl.h"
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "fastmath_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "fastmath_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "fastmath_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+/**
+ * Fast approximations of libm functions, trading accuracy for speed.
+ *
+ * Maximum errors, measured against libm in float over the given domain:
+ *   Rsqrt, Rcp    relative 3e-7
+ *   Sin, Cos      absolute 1e-7 for |x| <= 8192, also for SinCos
+ *   Acos          absolute 5e-7 on [-1, 1]
+ *   Atan          relative 2e-7
+ *   Atan2         absolute 3e-7, with signed zeros handled as std::atan2
+ *   Exp           relative 2e-7 for x in [-87, 88], 0 below and inf above
+ *   Log           relative 1e-7, absolute 5e-8 on [0.5, 2], for normal x > 0
+ *   Pow           as Exp, with the error scaled by |y * log(x)|
+ *
+ * Double arguments are computed in double with the same polynomials, so
+ * they get the single-precision bounds above. The __m128 overloads are the
+ * 4-lane SIMD forms; the Simd::Avx2 and Simd::Avx512 namespaces provide
+ * wider ones for code that has checked CPU support.
+ */
+namespace SMath::FastMath
+{
+    template <typename T> inline T Rsqrt(T x) { return Simd::Scalar::Rsqrt(x); }
+    template <typename T> inline T Rcp(T x) { return Simd::Scalar::Rcp(x); }
+    template <typename T> inline T Sin(T x) { return Simd::Scalar::Sin(x); }
+    template <typename T> inline T Cos(T x) { return Simd::Scalar::Cos(x); }
+    template <typename T> inline void SinCos(T x, T& s, T& c) { Simd::Scalar::SinCos(x, s, c); }
+    template <typename T> inline T Acos(T x) { return Simd::Scalar::Acos(x); }
+    template <typename T> inline T Atan(T x) { return Simd::Scalar::Atan(x); }
+    template <typename T> inline T Atan2(T y, T x) { return Simd::Scalar::Atan2(y, x); }
+    template <typename T> inline T Exp(T x) { return Simd::Scalar::Exp(x); }
+    template <typename T> inline T Log(T x) { return Simd::Scalar::Log(x); }
+    template <typename T> inline T Pow(T x, T y) { return Simd::Scalar::Pow(x, y); }
+
+#if defined(SMATH_X86)
+    // The trigonometric kernels select on data-dependent quadrants and ranges, which
+    // mispredict as scalar branches, so single floats go through one branchless SSE lane
+    inline float Sin(float x) { return _mm_cvtss_f32(Simd::Sse2::Sin(Simd::Sse2::Float(_mm_set_ss(x))).v); }
+    inline float Cos(float x) { return _mm_cvtss_f32(Simd::Sse2::Cos(Simd::Sse2::Float(_mm_set_ss(x))).v); }
+    inline void SinCos(float x, float& s, float& c)
+    {
+        Simd::Sse2::Float vs, vc;
+        Simd::Sse2::SinCos(Simd::Sse2::Float(_mm_set_ss(x)), vs, vc);
+        s = _mm_cvtss_f32(vs.v);
+        c = _mm_cvtss_f32(vc.v);
+    }
+    inline float Acos(float x) { return _mm_cvtss_f32(Simd::Sse2::Acos(Simd::Sse2::Float(_mm_set_ss(x))).v); }
+    inline float Atan(float x) { return _mm_cvtss_f32(Simd::Sse2::Atan(Simd::Sse2::Float(_mm_set_ss(x))).v); }
+    inline float Atan2(float y, float x) { return _mm_cvtss_f32(Simd::Sse2::Atan2(Simd::Sse2::Float(_mm_set_ss(y)), Simd::Sse2::Float(_mm_set_ss(x))).v); }
+
+    inline __m128 Rsqrt(__m128 x) { return Simd::Sse2::Rsqrt(x).v; }
+    inline __m128 Rcp(__m128 x) { return Simd::Sse2::Rcp(x).v; }
+    inline __m128 Sin(__m128 x) { return Simd::Sse2::Sin(Simd::Sse2::Float(x)).v; }
+    inline __m128 Cos(__m128 x) { return Simd::Sse2::Cos(Simd::Sse2::Float(x)).v; }
+    inline __m128 Acos(__m128 x) { return Simd::Sse2::Acos(Simd::Sse2::Float(x)).v; }
+    inline __m128 Atan(__m128 x) { return Simd::Sse2::Atan(Simd::Sse2::Float(x)).v; }
+    inline __m128 Atan2(__m128 y, __m128 x) { return Simd::Sse2::Atan2(Simd::Sse2::Float(y), Simd::Sse2::Float(x)).v; }
+    inline __m128 Exp(__m128 x) { return Simd::Sse2::Exp(Simd::Sse2::Float(x)).v; }
+    inline __m128 Log(__m128 x) { return Simd::Sse2::Log(Simd::Sse2::Float(x)).v; }
+    inline __m128 Pow(__m128 x, __m128 y) { return Simd::Sse2::Pow(Simd::Sse2::Float(x), Simd::Sse2::Float(y)).v; }
+#endif
+}
+
+// Vector and Quaternion helpers on the approximations above. They are free functions rather
+// than members so linalg.h does not pull in the SIMD headers
+namespace SMath::FastMath
+{
+    template<typename T, int N>
+    inline Vector<T, N> Normalized(const Vector<T, N>& v)
+    {
+        Vector<T, N> data(v);
+        T invMagnitude = Rsqrt(v.SquareMagnitude());
+        for (int i = 0; i < N; ++i)
+            data[i] *= invMagnitude;
+        return data;
+    }
+
+    template<typename T, int N>
+    inline T Angle(const Vector<T, N>& a, const Vector<T, N>& b)
+    {
+        T cosAngle = Vector<T, N>::Dot(a, b) * Rsqrt(a.SquareMagnitude() * b.SquareMagnitude());
+        return Acos(std::clamp(cosAngle, T(-1), T(1)));
+    }
+
+    template<typename T>
+    inline Quaternion<T> Normalized(const Quaternion<T>& q)
+    {
+        return q * Rsqrt(q.SquareMagnitude());
+    }
+
+    template<typename T>
+    inline Quaternion<T> Slerp(const Quaternion<T>& a, const Quaternion<T>& b, T t)
+    {
+        T dot = Quaternion<T>::Dot(a, b);
+
+        Quaternion<T> end = b;
+        if (dot < T(0))
+        {
+            end = -b;
+            dot = -dot;
+        }
+
+        if (dot > T(0.9995f))
+            return Normalized(a * (T(1) - t) + end * t);
+
+        // sin((1 - t) * theta) = sin(theta) * cos(t * theta) - cos(theta) * sin(t * theta),
+        // with cos(theta) = dot, so one SinCos replaces the two sines
+        T sinT, cosT;
+        SinCos(t * Acos(dot), sinT, cosT);
+        T wb = sinT * Rsqrt(T(1) - dot * dot);
+        T wa = cosT - dot * wb;
+
+        return a * wa + end * wb;
+    }
+}
@@ -0,0 +1,270 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Lane-generic kernels, included once per ISA namespace in simd.h's
+ * vocabulary. V is float or double in Scalar, and the lane Float type
+ * elsewhere. Polynomials are the single-precision Cephes minimax fits, so
+ * double inputs get single-precision accuracy, except for LogPrecise and
+ * ExpPrecise, which are meant for double only.
+ */
+
+// sin(x + quadrant * pi/2) and cos(x + quadrant * pi/2) from one range reduction
+template <typename V>
+inline void SinCosQuadrant(V x, int quadrant, V& sine, V& cosine)
+{
+    // Reduce to r in [-pi/4, pi/4] with x = q * pi/2 + r. pi/2 is split into
+    // 11-bit parts (Cody-Waite) so q * part is exact for |q| < 2^13 even without
+    // FMA, and r keeps its relative accuracy next to the zeros of sin and cos.
+    auto q = RoundToInt(x * V(0.636619772367581343f));
+    typedef decltype(q) I;
+
+    V fq = ToFloat(q);
+    V r = MulAdd(fq, V(-1.5703125f), x);
+    r = MulAdd(fq, V(-4.837512969970703125e-4f), r);
+    r = MulAdd(fq, V(-7.54953362047672271728515625e-8f), r);
+    r = MulAdd(fq, V(-2.5632829192545614e-12f), r);
+
+    V r2 = r * r;
+    V s = MulAdd(MulAdd(MulAdd(V(-1.9515295891e-4f), r2, V(8.3321608736e-3f)), r2, V(-1.6666654611e-1f)), r2 * r, r);
+    V c = MulAdd(MulAdd(MulAdd(MulAdd(V(2.443315711809948e-5f), r2, V(-1.388731625493765e-3f)), r2, V(4.166664568298827e-2f)), r2, V(-0.5f)), r2, V(1.0f));
+
+    // sin(r + q * pi/2) cycles through s, c, -s, -c; cosine is one step ahead
+    q = q + I(quadrant);
+    auto swap = (q & I(1)) == I(1);
+    V sr = Select(swap, c, s);
+    V cr = Select(swap, s, c);
+    sine = Select((q & I(2)) == I(2), -sr, sr);
+    cosine = Select(((q + I(1)) & I(2)) == I(2), -cr, cr);
+}
+
+template <typename V>
+inline V Sin(V x)
+{
+    V s, c;
+    SinCosQuadrant(x, 0, s, c);
+    return s;
+}
+
+template <typename V>
+inline V Cos(V x)
+{
+    V s, c;
+    SinCosQuadrant(x, 1, s, c);
+    return s;
+}
+
+template <typename V>
+inline void SinCos(V x, V& s, V& c)
+{
+    SinCosQuadrant(x, 0, s, c);
+}
+
+template <typename V>
+inline V Exp(V x)
+{
+    V limit = ExpLimit(x);
+    // Min/Max return their second operand for NaN lanes, so NaN passes through the clamp
+    V xc = Min(limit, Max(-(limit - V(1.0f)), x));
+
+    // x = n * ln2 + r, r in [-ln2/2, ln2/2]
+    auto n = RoundToInt(xc * V(1.44269504088896341f));
+    V fn = ToFloat(n);
+    V r = MulAdd(fn, V(-0.693359375f), xc);
+    r = MulAdd(fn, V(2.12194440e-4f), r);
+
+    V p = MulAdd(V(1.9875691500e-4f), r, V(1.3981999507e-3f));
+    p = MulAdd(p, r, V(8.3334519073e-3f));
+    p = MulAdd(p, r, V(4.1665795894e-2f));
+    p = MulAdd(p, r, V(1.6666665459e-1f));
+    p = MulAdd(p, r, V(5.0000001201e-1f));
+    p = MulAdd(p * r, r, r + V(1.0f));
+
+    V result = p * Pow2(n);
+    result = Select(x < -(limit - V(1.0f)), V(0.0f), result);
+    return Select(x > limit, V(std::numeric_limits<float>::infinity()), result);
+}
+
+template <typename V>
+inline V Log(V x)
+{
+    decltype(RoundToInt(x)) e;
+    V m = SplitExponent(x, e);
+
+    // Keep the mantissa in [sqrt(1/2), sqrt(2)) so the polynomial argument is centred on 0
+    auto small = m < V(0.707106781186547524f);
+    V fe = ToFloat(e) - Select(small, V(1.0f), V(0.0f));
+    m = Select(small, m + m, m) - V(1.0f);
+
+    V z = m * m;
+    V p = MulAdd(V(7.0376836292e-2f), m, V(-1.1514610310e-1f));
+    p = MulAdd(p, m, V(1.1676998740e-1f));
+    p = MulAdd(p, m, V(-1.2420140846e-1f));
+    p = MulAdd(p, m, V(1.4249322787e-1f));
+    p = MulAdd(p, m, V(-1.6668057665e-1f));
+    p = MulAdd(p, m, V(2.0000714765e-1f));
+    p = MulAdd(p, m, V(-2.4999993993e-1f));
+    p = MulAdd(p, m, V(3.3333331174e-1f));
+
+    V y = p * m * z;
+    y = MulAdd(fe, V(-2.12194440e-4f), y);
+    y = MulAdd(z, V(-0.5f), y);
+    V result = MulAdd(fe, V(0.693359375f), m + y);
+
+    const V inf = V(std::numeric_limits<float>::infinity());
+    result = Select(x == inf, inf, result);
+    result = Select(x == V(0.0f), -inf, result);
+    return Select(x < V(0.0f), V(std::numeric_limits<float>::quiet_NaN()), result);
+}
+
+template <typename V>
+inline V Pow(V x, V y)
+{
+    // Defined for x > 0; the error grows with |y * log(x)|
+    return Exp(y * Log(x));
+}
+
+// log and exp to double precision, for V = double or Double lanes only. The precise
+// float paths run in double so that y * log(x) keeps its bits before exp scales the error.
+template <typename V>
+inline V LogPrecise(V x)
+{
+    decltype(RoundToInt(x)) e;
+    V m = SplitExponent(x, e);
+
+    auto small = m < V(0.70710678118654752440);
+    V fe = ToFloat(e) - Select(small, V(1.0), V(0.0));
+    m = Select(small, m + m, m);
+
+    // log(m) = 2 atanh(s) with s = (m - 1) / (m + 1). |s| < 0.172, so the odd series
+    // is below double rounding after s^21.
+    V s = (m - V(1.0)) / (m + V(1.0));
+    V s2 = s * s;
+    V p = V(1.0 / 21.0);
+    p = MulAdd(p, s2, V(1.0 / 19.0));
+    p = MulAdd(p, s2, V(1.0 / 17.0));
+    p = MulAdd(p, s2, V(1.0 / 15.0));
+    p = MulAdd(p, s2, V(1.0 / 13.0));
+    p = MulAdd(p, s2, V(1.0 / 11.0));
+    p = MulAdd(p, s2, V(1.0 / 9.0));
+    p = MulAdd(p, s2, V(1.0 / 7.0));
+    p = MulAdd(p, s2, V(1.0 / 5.0));
+    p = MulAdd(p, s2, V(1.0 / 3.0));
+    V logm = MulAdd(p * s2, s + s, s + s);
+
+    // ln2 split so fe * hi is exact for any double exponent
+    V result = MulAdd(fe, V(6.93147180369123816490e-01), MulAdd(fe, V(1.90821492927058770002e-10), logm));
+
+    const V inf = V(std::numeric_limits<double>::infinity());
+    result = Select(x == inf, inf, result);
+    result = Select(x == V(0.0), -inf, result);
+    return Select(x < V(0.0), V(std::numeric_limits<double>::quiet_NaN()), result);
+}
+
+template <typename V>
+inline V ExpPrecise(V x)
+{
+    // Min/Max return their second operand for NaN lanes, so NaN passes through the clamp
+    V xc = Min(V(709.0), Max(V(-708.0), x));
+
+    // x = n * ln2 + r with |r| <= ln2/2, ln2 split as in LogPrecise
+    auto n = RoundToInt(xc * V(1.44269504088896340736));
+    V fn = ToFloat(n);
+    V r = MulAdd(fn, V(-6.93147180369123816490e-01), xc);
+    r = MulAdd(fn, V(-1.90821492927058770002e-10), r);
+
+    // Taylor series, the r^14 term is below double rounding
+    V p = V(1.0 / 6227020800.0);
+    p = MulAdd(p, r, V(1.0 / 479001600.0));
+    p = MulAdd(p, r, V(1.0 / 39916800.0));
+    p = MulAdd(p, r, V(1.0 / 3628800.0));
+    p = MulAdd(p, r, V(1.0 / 362880.0));
+    p = MulAdd(p, r, V(1.0 / 40320.0));
+    p = MulAdd(p, r, V(1.0 / 5040.0));
+    p = MulAdd(p, r, V(1.0 / 720.0));
+    p = MulAdd(p, r, V(1.0 / 120.0));
+    p = MulAdd(p, r, V(1.0 / 24.0));
+    p = MulAdd(p, r, V(1.0 / 6.0));
+    p = MulAdd(p, r, V(0.5));
+    p = MulAdd(p, r, V(1.0));
+    p = MulAdd(p, r, V(1.0));
+
+    V result = p * Pow2(n);
+    result = Select(x < V(-708.0), V(0.0), result);
+    return Select(x > V(709.0), V(std::numeric_limits<double>::infinity()), result);
+}
+
+template <typename V>
+inline V Acos(V x)
+{
+    // Abramowitz & Stegun 4.4.46: acos(a) = sqrt(1 - a) * p(a) on [0, 1]
+    V a = Abs(x);
+    V p = MulAdd(V(-0.0012624911f), a, V(0.0066700901f));
+    p = MulAdd(p, a, V(-0.0170881256f));
+    p = MulAdd(p, a, V(0.0308918810f));
+    p = MulAdd(p, a, V(-0.0501743046f));
+    p = MulAdd(p, a, V(0.0889789874f));
+    p = MulAdd(p, a, V(-0.2145988016f));
+    p = MulAdd(p, a, V(1.5707963050f));
+
+    V r = Sqrt(Max(V(1.0f) - a, V(0.0f))) * p;
+    return Select(x < V(0.0f), V(3.14159265358979323846f) - r, r);
+}
+
+template <typename V>
+inline V Atan(V x)
+{
+    // Reduce |x| to [0, tan(pi/8)] using atan(a) = pi/2 + atan(-1/a) and pi/4 + atan((a-1)/(a+1))
+    V a = Abs(x);
+    auto big = a > V(2.414213562373095f);
+    auto mid = a > V(0.4142135623730950f);
+
+    V reduced = Select(big, V(-1.0f) / a, Select(mid, (a - V(1.0f)) / (a + V(1.0f)), a));
+    V offset = Select(big, V(1.57079632679489661923f), Select(mid, V(0.78539816339744830961f), V(0.0f)));
+
+    V z = reduced * reduced;
+    V p = MulAdd(V(8.05374449538e-2f), z, V(-1.38776856032e-1f));
+    p = MulAdd(p, z, V(1.99777106478e-1f));
+    p = MulAdd(p, z, V(-3.33329491539e-1f));
+
+    V r = offset + MulAdd(p * z, reduced, reduced);
+    return Select(x < V(0.0f), -r, r);
+}
+
+template <typename V>
+inline V Atan2(V y, V x)
+{
+    V r = Atan(y / x);
+
+    // y / -0 has the wrong sign, so x = +-0 takes pi/2 by the sign of y alone
+    r = Select(x == V(0.0f), Select(y < V(0.0f), V(-1.57079632679489661923f), V(1.57079632679489661923f)), r);
+
+    // Quadrant correction for x < 0
+    V pi = Select(y < V(0.0f), V(-3.14159265358979323846f), V(3.14159265358979323846f));
+    r = Select(x < V(0.0f), r + pi, r);
+
+    // y = +-0 is decided by the signs of the zeros, which only show in their reciprocals. As
+    // std::atan2: +-pi when x is negative or -0, +-0 otherwise, signed like y; NaN x stays NaN.
+    auto negativeY = V(1.0f) / y < V(0.0f);
+    auto negativeX = (x < V(0.0f)) | (V(1.0f) / x < V(0.0f));
+    V onAxis = Select(negativeX, Select(negativeY, V(-3.14159265358979323846f), V(3.14159265358979323846f)),
+                      Select(negativeY, V(-0.0f), V(0.0f)));
+    return Select((y == V(0.0f)) & (x == x), onAxis, r);
+}
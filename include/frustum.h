@@ -0,0 +1,63 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <type_traits>
+#include "linalg.h"
+#include "box.h"
+#include "batchops.h"
+
+namespace SMath
+{
+    /**
+     * Six inward-facing planes (a, b, c, d), with a * x + b * y + c * z + d >= 0
+     * inside, extracted from a view-projection matrix (Gribb-Hartmann). Clip
+     * space follows Transform::GetPerspectiveMatrix*: column vectors and depth
+     * in [0, w]. Plane normals are normalized, so d is a signed distance.
+     */
+    template<typename T>
+    class Frustum
+    {
+    public:
+        enum Plane { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+
+    public:
+        Frustum() = default;
+        Frustum(const Matrix<T, 4>& viewProjection);
+        ~Frustum() = default;
+
+    public:
+        bool Contains(const Point<T, 3>& point) const;
+        bool Intersects(const Box<T>& box) const;
+
+        // Sets bit i % 64 of visible[i / 64] for every box that Intersects the frustum.
+        // Float frustums test several boxes per instruction on the dispatched level; boxes
+        // touching a plane to within rounding may be classified differently per level.
+        void Cull(std::span<const Box<T>> boxes, std::span<uint64_t> visible) const;
+
+    public:
+        Vector<T, 4> m_Planes[PlaneCount];
+    };
+
+    #include "frustum_impl.h"
+}
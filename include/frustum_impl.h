@@ -0,0 +1,88 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T>
+Frustum<T>::Frustum(const Matrix<T, 4>& viewProjection)
+{
+    Vector<T, 4> rows[4];
+    for (int r = 0; r < 4; ++r)
+        rows[r] = Vector<T, 4>(viewProjection.m_Data2D[r][0], viewProjection.m_Data2D[r][1],
+                               viewProjection.m_Data2D[r][2], viewProjection.m_Data2D[r][3]);
+
+    // -w <= x <= w, -w <= y <= w and 0 <= z <= w in clip space
+    m_Planes[Left] = rows[3] + rows[0];
+    m_Planes[Right] = rows[3] - rows[0];
+    m_Planes[Bottom] = rows[3] + rows[1];
+    m_Planes[Top] = rows[3] - rows[1];
+    m_Planes[Near] = rows[2];
+    m_Planes[Far] = rows[3] - rows[2];
+
+    for (Vector<T, 4>& plane : m_Planes)
+    {
+        T length = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        plane = plane / Vector<T, 4>(length);
+    }
+}
+
+template<typename T>
+bool Frustum<T>::Contains(const Point<T, 3>& point) const
+{
+    for (const Vector<T, 4>& plane : m_Planes)
+        if (plane.x * point.x + plane.y * point.y + plane.z * point.z + plane.w < T(0))
+            return false;
+
+    return true;
+}
+
+template<typename T>
+bool Frustum<T>::Intersects(const Box<T>& box) const
+{
+    // Conservative: only rejects boxes entirely behind one plane, judged by the
+    // corner furthest along its normal
+    for (const Vector<T, 4>& plane : m_Planes)
+    {
+        T x = plane.x >= T(0) ? box.m_Max.x : box.m_Min.x;
+        T y = plane.y >= T(0) ? box.m_Max.y : box.m_Min.y;
+        T z = plane.z >= T(0) ? box.m_Max.z : box.m_Min.z;
+
+        if (plane.x * x + plane.y * y + plane.z * z + plane.w < T(0))
+            return false;
+    }
+
+    return true;
+}
+
+template<typename T>
+void Frustum<T>::Cull(std::span<const Box<T>> boxes, std::span<uint64_t> visible) const
+{
+    assert(visible.size() >= Batch::GetMaskSize(boxes.size()));
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        Batch::CullBoxes(std::span<const Vector<float, 4>>(m_Planes), boxes, visible);
+    }
+    else
+    {
+        std::fill(visible.begin(), visible.begin() + Batch::GetMaskSize(boxes.size()), 0);
+        for (size_t i = 0; i < boxes.size(); ++i)
+            if (Intersects(boxes[i]))
+                visible[i / 64] |= uint64_t(1) << (i % 64);
+    }
+}
@@ -0,0 +1,255 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include "linalg.h"
+#include "dispatch.h"
+
+namespace SMath
+{
+    /**
+     * Float layouts for GPU constant and storage buffers. Each type has the
+     * size and 16-byte alignment that std140, std430 and HLSL cbuffer
+     * packing give it, so arrays of them can be written straight into a
+     * mapped buffer (see GpuView).
+     *
+     * SMath matrices are row-major and multiply column vectors, with the
+     * translation in the last column. GpuMatrixLayout picks how that matrix
+     * is laid out in the buffer:
+     *   ColumnMajor   the default for GLSL mat4 and HLSL float4x4; the shader
+     *                 sees the same matrix and uses m * v / mul(m, v)
+     *   RowMajor      the SMath element order; matches HLSL row_major and
+     *                 GLSL layout(row_major), or the transpose when read as
+     *                 column-major (v * m in the shader)
+     */
+    enum class GpuMatrixLayout
+    {
+        ColumnMajor,
+        RowMajor
+    };
+
+    // vec3 / float3 padded to a full 16-byte slot, the array stride std140 and std430 use
+    struct alignas(16) GpuVector3
+    {
+        float x, y, z, m_Pad;
+    };
+
+    // mat4 / float4x4
+    struct alignas(16) GpuMatrix4
+    {
+        float m_Data[16];
+    };
+
+    /**
+     * Three 16-byte registers. Holds either:
+     *   - a 3x3 matrix with each row or column padded to 16 bytes, which is
+     *     the std140/std430 mat3 layout and HLSL float3x3 (where a following
+     *     float may also use the last slot)
+     *   - the top three rows of an affine 4x4 (PackAffine), which is HLSL
+     *     row_major float3x4 and, read as a GLSL mat3x4, used as vec4(p, 1) * m
+     */
+    struct alignas(16) GpuMatrix3x4
+    {
+        float m_Data[12];
+    };
+
+    template <typename T>
+    inline GpuVector3 PackVector(const Vector<T, 3>& v)
+    {
+        return { float(v.x), float(v.y), float(v.z), 0.0f };
+    }
+
+    template <typename T>
+    inline GpuVector3 PackVector(const Point<T, 3>& p)
+    {
+        return { float(p.x), float(p.y), float(p.z), 0.0f };
+    }
+
+    template <typename T>
+    inline GpuMatrix4 PackMatrix(const Matrix<T, 4>& m, GpuMatrixLayout layout = GpuMatrixLayout::ColumnMajor)
+    {
+        GpuMatrix4 packed;
+        for (int r = 0; r < 4; ++r)
+            for (int c = 0; c < 4; ++c)
+                packed.m_Data[layout == GpuMatrixLayout::RowMajor ? r * 4 + c : c * 4 + r] = float(m.m_Data2D[r][c]);
+        return packed;
+    }
+
+    template <typename T>
+    inline GpuMatrix3x4 PackMatrix(const Matrix<T, 3>& m, GpuMatrixLayout layout = GpuMatrixLayout::ColumnMajor)
+    {
+        GpuMatrix3x4 packed = {};
+        for (int r = 0; r < 3; ++r)
+            for (int c = 0; c < 3; ++c)
+                packed.m_Data[layout == GpuMatrixLayout::RowMajor ? r * 4 + c : c * 4 + r] = float(m.m_Data2D[r][c]);
+        return packed;
+    }
+
+    // Drops the last row, which must be (0, 0, 0, 1)
+    template <typename T>
+    inline GpuMatrix3x4 PackAffine(const Matrix<T, 4>& m)
+    {
+        GpuMatrix3x4 packed;
+        for (int i = 0; i < 12; ++i)
+            packed.m_Data[i] = float(m.m_Data[i]);
+        return packed;
+    }
+
+    /**
+     * Typed view of count elements of a mapped buffer, for the Batch writers
+     * below. No copy is made; data must be aligned to 16 bytes, which every
+     * graphics API guarantees for mapped buffer ranges.
+     */
+    template <typename T>
+    inline std::span<T> GpuView(void* data, size_t count)
+    {
+        assert(reinterpret_cast<uintptr_t>(data) % alignof(T) == 0);
+        return std::span<T>(static_cast<T*>(data), count);
+    }
+}
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(GpuVector3) == 16 && sizeof(GpuMatrix4) == 64 && sizeof(GpuMatrix3x4) == 48, "GPU layouts have fixed sizes");
+    static_assert(sizeof(Matrix<float, 4>) == 64 && sizeof(Vector<double, 3>) == 24, "Packing kernels walk matrices and vectors as packed scalars");
+
+    struct GpuLayoutKernels
+    {
+        void (*WriteMatrices)(const Matrix<float, 4>* in, GpuMatrix4* out, size_t count, GpuMatrixLayout layout);
+        void (*WriteMatricesDouble)(const Matrix<double, 4>* in, GpuMatrix4* out, size_t count, GpuMatrixLayout layout);
+        void (*WriteAffine)(const Matrix<float, 4>* in, GpuMatrix3x4* out, size_t count);
+        void (*WriteAffineDouble)(const Matrix<double, 4>* in, GpuMatrix3x4* out, size_t count);
+        void (*WriteVectors)(const Vector<float, 3>* in, GpuVector3* out, size_t count);
+        void (*WriteVectorsDouble)(const Vector<double, 3>* in, GpuVector3* out, size_t count);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    template <typename T>
+    inline void WriteMatricesArray(const Matrix<T, 4>* in, GpuMatrix4* out, size_t count, GpuMatrixLayout layout)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = PackMatrix(in[i], layout);
+    }
+
+    template <typename T>
+    inline void WriteAffineArray(const Matrix<T, 4>* in, GpuMatrix3x4* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = PackAffine(in[i]);
+    }
+
+    template <typename T>
+    inline void WriteVectorsArray(const Vector<T, 3>* in, GpuVector3* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = PackVector(in[i]);
+    }
+
+    inline constexpr GpuLayoutKernels GpuLayoutTable = {
+        WriteMatricesArray<float>, WriteMatricesArray<double>, WriteAffineArray<float>, WriteAffineArray<double>,
+        WriteVectorsArray<float>, WriteVectorsArray<double>
+    };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "gpulayout_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "gpulayout_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "gpulayout_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const GpuLayoutKernels& GetGpuLayoutKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::GpuLayoutTable, Sse2::GpuLayoutTable, Avx2::GpuLayoutTable, Avx512::GpuLayoutTable);
+#else
+        return Scalar::GpuLayoutTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Converts to float and writes GPU layouts, typically into a GpuView of
+     * a mapped upload buffer. Above the scalar level the writes are
+     * non-temporal: they bypass the cache, which suits write-combined upload
+     * memory and large arrays, and are fenced before returning. Don't read
+     * the output back on the CPU straight after.
+     */
+    inline void WriteMatrices(std::span<const Matrix<float, 4>> in, std::span<GpuMatrix4> out, GpuMatrixLayout layout = GpuMatrixLayout::ColumnMajor)
+    {
+        assert(in.size() == out.size());
+        Simd::GetGpuLayoutKernels().WriteMatrices(in.data(), out.data(), in.size(), layout);
+    }
+
+    inline void WriteMatrices(std::span<const Matrix<double, 4>> in, std::span<GpuMatrix4> out, GpuMatrixLayout layout = GpuMatrixLayout::ColumnMajor)
+    {
+        assert(in.size() == out.size());
+        Simd::GetGpuLayoutKernels().WriteMatricesDouble(in.data(), out.data(), in.size(), layout);
+    }
+
+    inline void WriteAffine(std::span<const Matrix<float, 4>> in, std::span<GpuMatrix3x4> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetGpuLayoutKernels().WriteAffine(in.data(), out.data(), in.size());
+    }
+
+    inline void WriteAffine(std::span<const Matrix<double, 4>> in, std::span<GpuMatrix3x4> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetGpuLayoutKernels().WriteAffineDouble(in.data(), out.data(), in.size());
+    }
+
+    inline void WriteVectors(std::span<const Vector<float, 3>> in, std::span<GpuVector3> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetGpuLayoutKernels().WriteVectors(in.data(), out.data(), in.size());
+    }
+
+    inline void WriteVectors(std::span<const Vector<double, 3>> in, std::span<GpuVector3> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetGpuLayoutKernels().WriteVectorsDouble(in.data(), out.data(), in.size());
+    }
+}
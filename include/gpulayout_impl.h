@@ -0,0 +1,94 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Packing kernels for gpulayout.h, included once per ISA namespace. Every
+ * GPU layout is made of 16-byte registers, so these work on 128-bit rows
+ * at every level. The AVX2 and AVX-512 copies are VEX encoded, so callers
+ * running wider code do not pay an SSE/AVX transition. Stores are
+ * non-temporal, which the 16-byte alignment of the GPU types allows.
+ */
+
+inline __m128 LoadRow(const float* p)
+{
+    return _mm_loadu_ps(p);
+}
+
+inline __m128 LoadRow(const double* p)
+{
+    return _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(p)), _mm_cvtpd_ps(_mm_loadu_pd(p + 2)));
+}
+
+// Three components and a zero, without reading past the vector
+inline __m128 LoadRow3(const float* p)
+{
+    return _mm_movelh_ps(_mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(p))), _mm_load_ss(p + 2));
+}
+
+inline __m128 LoadRow3(const double* p)
+{
+    return _mm_movelh_ps(_mm_cvtpd_ps(_mm_loadu_pd(p)), _mm_cvtpd_ps(_mm_load_sd(p + 2)));
+}
+
+template <typename T>
+inline void WriteMatricesArray(const Matrix<T, 4>* in, GpuMatrix4* out, size_t count, GpuMatrixLayout layout)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const T* m = in[i].m_Data;
+        __m128 r0 = LoadRow(m), r1 = LoadRow(m + 4), r2 = LoadRow(m + 8), r3 = LoadRow(m + 12);
+        if (layout == GpuMatrixLayout::ColumnMajor)
+            _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+        float* o = out[i].m_Data;
+        _mm_stream_ps(o, r0);
+        _mm_stream_ps(o + 4, r1);
+        _mm_stream_ps(o + 8, r2);
+        _mm_stream_ps(o + 12, r3);
+    }
+    _mm_sfence();
+}
+
+template <typename T>
+inline void WriteAffineArray(const Matrix<T, 4>* in, GpuMatrix3x4* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+    {
+        const T* m = in[i].m_Data;
+        float* o = out[i].m_Data;
+        _mm_stream_ps(o, LoadRow(m));
+        _mm_stream_ps(o + 4, LoadRow(m + 4));
+        _mm_stream_ps(o + 8, LoadRow(m + 8));
+    }
+    _mm_sfence();
+}
+
+template <typename T>
+inline void WriteVectorsArray(const Vector<T, 3>* in, GpuVector3* out, size_t count)
+{
+    for (size_t i = 0; i < count; ++i)
+        _mm_stream_ps(&out[i].x, LoadRow3(in[i].m_Data));
+    _mm_sfence();
+}
+
+inline constexpr GpuLayoutKernels GpuLayoutTable = {
+    WriteMatricesArray<float>, WriteMatricesArray<double>, WriteAffineArray<float>, WriteAffineArray<double>,
+    WriteVectorsArray<float>, WriteVectorsArray<double>
+};
@@ -0,0 +1,339 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include "linalg.h"
+#include "dispatch.h"
+
+namespace SMath
+{
+    /**
+     * IEEE binary16 (1 sign, 5 exponent, 10 mantissa bits) and bfloat16
+     * (1, 8, 7: the top half of a float) storage types. Both convert
+     * implicitly to and from float and all arithmetic is done in float, so
+     * Vector<Half, 3> is a compact vertex or cache format rather than a
+     * type to compute in.
+     *
+     * Conversions from float round to nearest even. Half keeps subnormals
+     * and saturates to infinity above 65504 (after rounding); NaN stays NaN
+     * but its payload is not preserved.
+     *
+     * The conversions go through Simd::BitCast and so are not constexpr;
+     * only FromBits can build a value at compile time.
+     */
+    inline uint16_t FloatToHalfBits(float v)
+    {
+        uint32_t bits = Simd::BitCast<uint32_t>(v);
+        uint32_t sign = (bits >> 16) & 0x8000u;
+        bits &= 0x7fffffffu;
+
+        uint32_t half;
+        if (bits > 0x7f800000u)
+            half = 0x7e00u;
+        else if (bits >= 0x47800000u)
+            half = 0x7c00u;
+        else if (bits < 0x38800000u)
+        {
+            // Below 2^-14 the result is subnormal. Adding 0.5 lines the 10 mantissa bits up
+            // with the bottom of the float, and the float addition rounds them to nearest even.
+            half = Simd::BitCast<uint32_t>(Simd::BitCast<float>(bits) + 0.5f) - 0x3f000000u;
+        }
+        else
+        {
+            // Rebias the exponent and round the 13 dropped bits to nearest even
+            half = (bits + 0xc8000fffu + ((bits >> 13) & 1u)) >> 13;
+        }
+
+        return uint16_t(half | sign);
+    }
+
+    inline float HalfBitsToFloat(uint16_t h)
+    {
+        uint32_t bits = uint32_t(h & 0x7fffu) << 13;
+        uint32_t exponent = bits & 0x0f800000u;
+        bits += 0x38000000u;
+
+        float v;
+        if (exponent == 0x0f800000u)
+            v = Simd::BitCast<float>(bits + 0x38000000u);
+        else if (exponent == 0)
+            v = Simd::BitCast<float>(bits + 0x00800000u) - 6.103515625e-05f;
+        else
+            v = Simd::BitCast<float>(bits);
+
+        return Simd::BitCast<float>(Simd::BitCast<uint32_t>(v) | (uint32_t(h & 0x8000u) << 16));
+    }
+
+    inline uint16_t FloatToBFloat16Bits(float v)
+    {
+        uint32_t bits = Simd::BitCast<uint32_t>(v);
+        if ((bits & 0x7fffffffu) > 0x7f800000u)
+            return uint16_t((bits >> 16) | 0x40u);
+
+        return uint16_t((bits + 0x7fffu + ((bits >> 16) & 1u)) >> 16);
+    }
+
+    inline float BFloat16BitsToFloat(uint16_t b)
+    {
+        return Simd::BitCast<float>(uint32_t(b) << 16);
+    }
+
+    class Half
+    {
+    public:
+        Half() = default;
+        Half(float v) : m_Bits(FloatToHalfBits(v)) {}
+        operator float() const { return HalfBitsToFloat(m_Bits); }
+
+        static constexpr Half FromBits(uint16_t bits)
+        {
+            Half h;
+            h.m_Bits = bits;
+            return h;
+        }
+
+        Half& operator+=(float b) { return *this = float(*this) + b; }
+        Half& operator-=(float b) { return *this = float(*this) - b; }
+        Half& operator*=(float b) { return *this = float(*this) * b; }
+        Half& operator/=(float b) { return *this = float(*this) / b; }
+
+    public:
+        uint16_t m_Bits;
+    };
+
+    class BFloat16
+    {
+    public:
+        BFloat16() = default;
+        BFloat16(float v) : m_Bits(FloatToBFloat16Bits(v)) {}
+        operator float() const { return BFloat16BitsToFloat(m_Bits); }
+
+        static constexpr BFloat16 FromBits(uint16_t bits)
+        {
+            BFloat16 b;
+            b.m_Bits = bits;
+            return b;
+        }
+
+        BFloat16& operator+=(float b) { return *this = float(*this) + b; }
+        BFloat16& operator-=(float b) { return *this = float(*this) - b; }
+        BFloat16& operator*=(float b) { return *this = float(*this) * b; }
+        BFloat16& operator/=(float b) { return *this = float(*this) / b; }
+
+    public:
+        uint16_t m_Bits;
+    };
+
+    template <>
+    struct ScalarTraits<Half>
+    {
+        static constexpr bool IsScalar = true;
+        typedef float ComputeType;
+    };
+
+    template <>
+    struct ScalarTraits<BFloat16>
+    {
+        static constexpr bool IsScalar = true;
+        typedef float ComputeType;
+    };
+}
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(Half) == 2 && sizeof(BFloat16) == 2, "Conversion kernels walk 16-bit floats as packed integers");
+    static_assert(sizeof(Vector<Half, 4>) == 8, "Vectors of 16-bit floats are packed");
+
+    struct HalfKernels
+    {
+        void (*FloatToHalf)(const float* in, Half* out, size_t count);
+        void (*HalfToFloat)(const Half* in, float* out, size_t count);
+        void (*FloatToBFloat16)(const float* in, BFloat16* out, size_t count);
+        void (*BFloat16ToFloat)(const BFloat16* in, float* out, size_t count);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    inline void FloatToHalfArray(const float* in, Half* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = Half(in[i]);
+    }
+
+    inline void HalfToFloatArray(const Half* in, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = float(in[i]);
+    }
+
+    inline void FloatToBFloat16Array(const float* in, BFloat16* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = BFloat16(in[i]);
+    }
+
+    inline void BFloat16ToFloatArray(const BFloat16* in, float* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = float(in[i]);
+    }
+
+    inline constexpr HalfKernels HalfTable = { FloatToHalfArray, HalfToFloatArray, FloatToBFloat16Array, BFloat16ToFloatArray };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "half_impl.h"
+
+    inline constexpr HalfKernels HalfTable = { FloatToHalfArray, HalfToFloatArray, FloatToBFloat16Array, BFloat16ToFloatArray };
+}
+
+// Every CPU at the AVX2 level has F16C (DetectLevel checks), so half conversions use it
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "half_impl.h"
+
+    inline void FloatToHalfF16cArray(const float* in, Half* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm256_cvtps_ph(_mm256_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+        Scalar::FloatToHalfArray(in + i, out + i, count - i);
+    }
+
+    inline void HalfToFloatF16cArray(const Half* in, float* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+            _mm256_storeu_ps(out + i, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))));
+        Scalar::HalfToFloatArray(in + i, out + i, count - i);
+    }
+
+    inline constexpr HalfKernels HalfTable = { FloatToHalfF16cArray, HalfToFloatF16cArray, FloatToBFloat16Array, BFloat16ToFloatArray };
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "half_impl.h"
+
+    inline void FloatToHalfF16cArray(const float* in, Half* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm512_cvtps_ph(_mm512_loadu_ps(in + i), _MM_FROUND_TO_NEAREST_INT));
+        Scalar::FloatToHalfArray(in + i, out + i, count - i);
+    }
+
+    inline void HalfToFloatF16cArray(const Half* in, float* out, size_t count)
+    {
+        size_t i = 0;
+        for (; i + Width <= count; i += Width)
+            _mm512_storeu_ps(out + i, _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i))));
+        Scalar::HalfToFloatArray(in + i, out + i, count - i);
+    }
+
+    inline constexpr HalfKernels HalfTable = { FloatToHalfF16cArray, HalfToFloatF16cArray, FloatToBFloat16Array, BFloat16ToFloatArray };
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const HalfKernels& GetHalfKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::HalfTable, Sse2::HalfTable, Avx2::HalfTable, Avx512::HalfTable);
+#else
+        return Scalar::HalfTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Bulk conversions between float and the 16-bit formats, run on the
+     * instruction set selected by Simd::GetLevel. The AVX2 and AVX-512
+     * levels convert halves in hardware (vcvtps2ph / vcvtph2ps); the other
+     * levels give bit-identical results in software, apart from NaN payloads.
+     */
+    inline void ToHalf(std::span<const float> in, std::span<Half> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().FloatToHalf(in.data(), out.data(), in.size());
+    }
+
+    inline void ToFloat(std::span<const Half> in, std::span<float> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().HalfToFloat(in.data(), out.data(), in.size());
+    }
+
+    inline void ToBFloat16(std::span<const float> in, std::span<BFloat16> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().FloatToBFloat16(in.data(), out.data(), in.size());
+    }
+
+    inline void ToFloat(std::span<const BFloat16> in, std::span<float> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().BFloat16ToFloat(in.data(), out.data(), in.size());
+    }
+
+    // Vector arrays, converted as packed components
+    template <int N>
+    inline void ToHalf(std::span<const Vector<float, N>> in, std::span<Vector<Half, N>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().FloatToHalf(&in.data()->x, &out.data()->x, in.size() * N);
+    }
+
+    template <int N>
+    inline void ToFloat(std::span<const Vector<Half, N>> in, std::span<Vector<float, N>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().HalfToFloat(&in.data()->x, &out.data()->x, in.size() * N);
+    }
+
+    template <int N>
+    inline void ToBFloat16(std::span<const Vector<float, N>> in, std::span<Vector<BFloat16, N>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().FloatToBFloat16(&in.data()->x, &out.data()->x, in.size() * N);
+    }
+
+    template <int N>
+    inline void ToFloat(std::span<const Vector<BFloat16, N>> in, std::span<Vector<float, N>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetHalfKernels().BFloat16ToFloat(&in.data()->x, &out.data()->x, in.size() * N);
+    }
+}
@@ -0,0 +1,98 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Lane versions of the half.h conversions, included once per ISA namespace
+ * the same way as batchmath_impl.h. These are the software paths; the AVX2
+ * and AVX-512 tables swap in the hardware half conversions.
+ */
+
+inline Int SelectBits(Mask m, Int a, Int b)
+{
+    return AsInt(Select(m, AsFloat(a), AsFloat(b)));
+}
+
+inline Int FloatToHalfBits(Float v)
+{
+    Float a = Abs(v);
+    Int bits = AsInt(a);
+    Int sign = ShiftRight(AsInt(v), 16) & Int(0x8000);
+
+    Int subnormal = AsInt(a + Float(0.5f)) - Int(0x3f000000);
+    Int normal = ShiftRight(bits + Int(int32_t(0xc8000fff)) + (ShiftRight(bits, 13) & Int(1)), 13);
+
+    Int half = SelectBits(a < Float(6.103515625e-05f), subnormal, normal);
+    half = SelectBits(a >= Float(65536.0f), Int(0x7c00), half);
+    half = SelectBits(v == v, half, Int(0x7e00));
+    return half | sign;
+}
+
+inline Float HalfBitsToFloat(Int h)
+{
+    Int bits = ShiftLeft(h & Int(0x7fff), 13);
+    Int exponent = bits & Int(0x0f800000);
+    bits = bits + Int(0x38000000);
+
+    Float normal = AsFloat(bits);
+    Float special = AsFloat(bits + Int(0x38000000));
+    Float subnormal = AsFloat(bits + Int(0x00800000)) - Float(6.103515625e-05f);
+
+    Float v = Select(exponent == Int(0x0f800000), special, Select(exponent == Int(0), subnormal, normal));
+    return AsFloat(AsInt(v) | ShiftLeft(h & Int(0x8000), 16));
+}
+
+inline Int FloatToBFloat16Bits(Float v)
+{
+    Int bits = AsInt(v);
+    Int rounded = ShiftRight(bits + Int(0x7fff) + (ShiftRight(bits, 16) & Int(1)), 16);
+    return SelectBits(v == v, rounded, ShiftRight(bits, 16) | Int(0x40));
+}
+
+inline void FloatToHalfArray(const float* in, Half* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        StoreNarrow(reinterpret_cast<uint16_t*>(out + i), FloatToHalfBits(Load(in + i)));
+    Scalar::FloatToHalfArray(in + i, out + i, count - i);
+}
+
+inline void HalfToFloatArray(const Half* in, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, HalfBitsToFloat(LoadWiden(reinterpret_cast<const uint16_t*>(in + i))));
+    Scalar::HalfToFloatArray(in + i, out + i, count - i);
+}
+
+inline void FloatToBFloat16Array(const float* in, BFloat16* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        StoreNarrow(reinterpret_cast<uint16_t*>(out + i), FloatToBFloat16Bits(Load(in + i)));
+    Scalar::FloatToBFloat16Array(in + i, out + i, count - i);
+}
+
+inline void BFloat16ToFloatArray(const BFloat16* in, float* out, size_t count)
+{
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+        Store(out + i, AsFloat(ShiftLeft(LoadWiden(reinterpret_cast<const uint16_t*>(in + i)), 16)));
+    Scalar::BFloat16ToFloatArray(in + i, out + i, count - i);
+}
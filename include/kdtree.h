@@ -0,0 +1,106 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <bit>
+#include <cassert>
+#include <vector>
+#include <limits>
+#include <thread>
+#include <cstdint>
+#include <algorithm>
+#include "linalg.h"
+#include "spatialquery.h"
+
+namespace SMath
+{
+    /**
+     * Implicit, left-balanced k-d tree over points. The tree is a complete
+     * binary tree in heap order (children of node i at 2i + 1 and 2i + 2), so
+     * it needs no child pointers and the top levels share cache lines. Each
+     * node splits at its median along the axis of largest spread.
+     *
+     * Indices returned by queries refer to the array the tree was built from.
+     */
+    template<typename T, int N = 3>
+    class KdTree
+    {
+        static_assert(N >= 1 && N <= 4, "KdTree stores the split axis in two bits");
+
+    public:
+        static constexpr uint32_t InvalidIndex = 0xffffffffu;
+        static constexpr size_t MaxSize = size_t(1) << 30;
+
+        // Split point, source index and split axis in one 16-byte record for float points
+        struct Node
+        {
+            Point<T, N> m_Point;
+            uint32_t m_Index : 30;
+            uint32_t m_Axis : 2;
+        };
+
+    public:
+        KdTree() = default;
+        // Subtrees above Simd::MinParallelChunk points are built on separate threads,
+        // threadCount <= 0 picks the count from the hardware
+        KdTree(std::span<const Point<T, N>> points, int threadCount = 0);
+        ~KdTree() = default;
+
+    public:
+        size_t GetSize() const;
+
+        // Up to k nearest points within maxDistance, closest first. Returns how many were found.
+        size_t FindNearest(const Point<T, N>& point, size_t k, std::span<uint32_t> indices, std::span<T> squareDistances,
+                           T maxDistance = std::numeric_limits<T>::infinity()) const;
+
+        // Appends the points within radius (inclusive) in no particular order. Returns how many were appended.
+        size_t FindInRadius(const Point<T, N>& point, T radius, std::vector<uint32_t>& indices) const;
+
+    public:
+        // Batch queries, split across threads. Query q writes k entries from q * k; slots past
+        // the found count hold InvalidIndex and infinity.
+        void FindNearest(std::span<const Point<T, N>> points, size_t k, std::span<uint32_t> indices, std::span<T> squareDistances,
+                         T maxDistance = std::numeric_limits<T>::infinity(), int threadCount = 0) const;
+
+        // The result of query q is indices[offsets[q]] to indices[offsets[q + 1]]
+        void FindInRadius(std::span<const Point<T, N>> points, T radius, std::vector<uint32_t>& indices,
+                          std::vector<size_t>& offsets, int threadCount = 0) const;
+
+    private:
+        struct Entry
+        {
+            Point<T, N> m_Point;
+            uint32_t m_Index;
+        };
+
+        void Build(std::span<Entry> entries, size_t node, Point<T, N> min, Point<T, N> max, int threadCount);
+
+        static size_t GetLeftSize(size_t count);
+        static T SquareDistance(const Point<T, N>& a, const Point<T, N>& b);
+
+    public:
+        // Heap order, children of m_Nodes[i] at 2i + 1 and 2i + 2
+        std::vector<Node> m_Nodes;
+    };
+
+    #include "kdtree_impl.h"
+}
@@ -0,0 +1,279 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T, int N>
+KdTree<T, N>::KdTree(std::span<const Point<T, N>> points, int threadCount)
+{
+    assert(points.size() <= MaxSize);
+
+    size_t count = points.size();
+    if (count == 0)
+        return;
+
+    std::vector<Entry> entries(count);
+    Point<T, N> min = points[0];
+    Point<T, N> max = points[0];
+    for (size_t i = 0; i < count; ++i)
+    {
+        entries[i] = { points[i], uint32_t(i) };
+        for (int axis = 0; axis < N; ++axis)
+        {
+            min[axis] = std::min(min[axis], points[i][axis]);
+            max[axis] = std::max(max[axis], points[i][axis]);
+        }
+    }
+
+    m_Nodes.resize(count);
+    Build(entries, 0, min, max, Simd::GetThreadCount(count, threadCount));
+}
+
+template<typename T, int N>
+size_t KdTree<T, N>::GetSize() const
+{
+    return m_Nodes.size();
+}
+
+template<typename T, int N>
+size_t KdTree<T, N>::FindNearest(const Point<T, N>& point, size_t k, std::span<uint32_t> indices, std::span<T> squareDistances,
+                                 T maxDistance) const
+{
+    assert(indices.size() >= k && squareDistances.size() >= k);
+    if (k == 0 || m_Nodes.empty())
+        return 0;
+
+    // Bounded max-heap of the best candidates, kept in the output arrays. Until it is full
+    // the bound is the search radius, afterwards the worst candidate.
+    size_t count = 0;
+    T bound = maxDistance * maxDistance;
+
+    auto siftDown = [&](size_t i, size_t heapSize) {
+        while (true)
+        {
+            size_t largest = i;
+            size_t left = 2 * i + 1;
+            size_t right = left + 1;
+            if (left < heapSize && squareDistances[left] > squareDistances[largest])
+                largest = left;
+            if (right < heapSize && squareDistances[right] > squareDistances[largest])
+                largest = right;
+            if (largest == i)
+                return;
+            std::swap(squareDistances[i], squareDistances[largest]);
+            std::swap(indices[i], indices[largest]);
+            i = largest;
+        }
+    };
+
+    auto insert = [&](T distance, uint32_t index) {
+        if (count < k)
+        {
+            // Sift up
+            size_t i = count++;
+            for (; i > 0 && squareDistances[(i - 1) / 2] < distance; i = (i - 1) / 2)
+            {
+                squareDistances[i] = squareDistances[(i - 1) / 2];
+                indices[i] = indices[(i - 1) / 2];
+            }
+            squareDistances[i] = distance;
+            indices[i] = index;
+            if (count == k)
+                bound = squareDistances[0];
+            return;
+        }
+
+        squareDistances[0] = distance;
+        indices[0] = index;
+        siftDown(0, count);
+        bound = squareDistances[0];
+    };
+
+    struct Pending
+    {
+        size_t m_Node;
+        T m_PlaneDistance;
+    };
+
+    // At most one far child is pending per level
+    Pending stack[64];
+    int top = 0;
+    size_t size = m_Nodes.size();
+    size_t node = 0;
+
+    while (true)
+    {
+        while (node < size)
+        {
+            const Node& current = m_Nodes[node];
+            T distance = SquareDistance(point, current.m_Point);
+            if (count < k ? distance <= bound : distance < bound)
+                insert(distance, current.m_Index);
+
+            int axis = current.m_Axis;
+            T offset = point[axis] - current.m_Point[axis];
+            size_t near = 2 * node + (offset < T(0) ? 1 : 2);
+            size_t far = 4 * node + 3 - near;
+            if (far < size && offset * offset <= bound)
+                stack[top++] = { far, offset * offset };
+            node = near;
+        }
+
+        do
+        {
+            if (top == 0)
+            {
+                // Heap sort in place, closest first
+                for (size_t end = count; end > 1; --end)
+                {
+                    std::swap(squareDistances[0], squareDistances[end - 1]);
+                    std::swap(indices[0], indices[end - 1]);
+                    siftDown(0, end - 1);
+                }
+                return count;
+            }
+            node = stack[--top].m_Node;
+        } while (stack[top].m_PlaneDistance > bound);
+    }
+}
+
+template<typename T, int N>
+size_t KdTree<T, N>::FindInRadius(const Point<T, N>& point, T radius, std::vector<uint32_t>& indices) const
+{
+    size_t first = indices.size();
+    size_t size = m_Nodes.size();
+    T bound = radius * radius;
+
+    size_t stack[64];
+    int top = 0;
+    size_t node = 0;
+
+    while (true)
+    {
+        while (node < size)
+        {
+            const Node& current = m_Nodes[node];
+            if (SquareDistance(point, current.m_Point) <= bound)
+                indices.push_back(current.m_Index);
+
+            int axis = current.m_Axis;
+            T offset = point[axis] - current.m_Point[axis];
+            size_t near = 2 * node + (offset < T(0) ? 1 : 2);
+            size_t far = 4 * node + 3 - near;
+            if (far < size && offset * offset <= bound)
+                stack[top++] = far;
+            node = near;
+        }
+
+        if (top == 0)
+            return indices.size() - first;
+        node = stack[--top];
+    }
+}
+
+template<typename T, int N>
+void KdTree<T, N>::FindNearest(std::span<const Point<T, N>> points, size_t k, std::span<uint32_t> indices, std::span<T> squareDistances,
+                               T maxDistance, int threadCount) const
+{
+    assert(indices.size() >= points.size() * k && squareDistances.size() >= points.size() * k);
+
+    Simd::ParallelSlices(points.size(), Simd::GetQueryThreadCount(points.size(), threadCount), [&](size_t begin, size_t end, int) {
+        for (size_t q = begin; q < end; ++q)
+        {
+            std::span<uint32_t> queryIndices = indices.subspan(q * k, k);
+            std::span<T> queryDistances = squareDistances.subspan(q * k, k);
+            size_t found = FindNearest(points[q], k, queryIndices, queryDistances, maxDistance);
+            std::fill(queryIndices.begin() + found, queryIndices.end(), InvalidIndex);
+            std::fill(queryDistances.begin() + found, queryDistances.end(), std::numeric_limits<T>::infinity());
+        }
+    });
+}
+
+template<typename T, int N>
+void KdTree<T, N>::FindInRadius(std::span<const Point<T, N>> points, T radius, std::vector<uint32_t>& indices,
+                                std::vector<size_t>& offsets, int threadCount) const
+{
+    int threads = Simd::GetQueryThreadCount(points.size(), threadCount);
+    Simd::GatherQueries(points.size(), threads, indices, offsets, [&](size_t q, std::vector<uint32_t>& out) {
+        return FindInRadius(points[q], radius, out);
+    });
+}
+
+template<typename T, int N>
+void KdTree<T, N>::Build(std::span<Entry> entries, size_t node, Point<T, N> min, Point<T, N> max, int threadCount)
+{
+    if (entries.empty())
+        return;
+
+    int axis = 0;
+    for (int i = 1; i < N; ++i)
+        if (max[i] - min[i] > max[axis] - min[axis])
+            axis = i;
+
+    size_t left = GetLeftSize(entries.size());
+    std::nth_element(entries.begin(), entries.begin() + left, entries.end(),
+                     [axis](const Entry& a, const Entry& b) { return a.m_Point[axis] < b.m_Point[axis]; });
+
+    const Entry& median = entries[left];
+    m_Nodes[node].m_Point = median.m_Point;
+    m_Nodes[node].m_Index = median.m_Index;
+    m_Nodes[node].m_Axis = uint32_t(axis);
+
+    // Child bounds are the parent's cut at the median, which saves a pass over the points
+    Point<T, N> leftMax = max;
+    Point<T, N> rightMin = min;
+    leftMax[axis] = median.m_Point[axis];
+    rightMin[axis] = median.m_Point[axis];
+
+    std::span<Entry> leftEntries = entries.first(left);
+    std::span<Entry> rightEntries = entries.subspan(left + 1);
+
+    // The subtrees write disjoint heap positions, so they can be built concurrently
+    if (threadCount > 1 && entries.size() > Simd::MinParallelChunk)
+    {
+        std::thread worker([&]() { Build(leftEntries, 2 * node + 1, min, leftMax, threadCount / 2); });
+        Build(rightEntries, 2 * node + 2, rightMin, max, threadCount - threadCount / 2);
+        worker.join();
+        return;
+    }
+
+    Build(leftEntries, 2 * node + 1, min, leftMax, 1);
+    Build(rightEntries, 2 * node + 2, rightMin, max, 1);
+}
+
+template<typename T, int N>
+size_t KdTree<T, N>::GetLeftSize(size_t count)
+{
+    if (count <= 1)
+        return 0;
+
+    // Levels above the last are full; the last level fills the left subtree first
+    int height = std::bit_width(count) - 1;
+    size_t half = size_t(1) << (height - 1);
+    size_t lastLevel = count - ((size_t(1) << height) - 1);
+    return (half - 1) + std::min(lastLevel, half);
+}
+
+template<typename T, int N>
+T KdTree<T, N>::SquareDistance(const Point<T, N>& a, const Point<T, N>& b)
+{
+    T sum = T(0);
+    for (int i = 0; i < N; ++i)
+        sum += (a[i] - b[i]) * (a[i] - b[i]);
+    return sum;
+}
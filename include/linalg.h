@@ -46,43 +46,87 @@ namespace SMath
 
     typedef Normal<double, 3> Normal3;
 
+    typedef Matrix<double, 2> Matrix2x2;
     typedef Matrix<double, 3> Matrix3x3;
     typedef Matrix<double, 4> Matrix4x4;
+    typedef Matrix<double, 3, 4> Matrix3x4;
+    typedef Matrix<double, 4, 3> Matrix4x3;
     typedef Matrix<int, 3> Matrix3x3i;
     typedef Matrix<int, 4> Matrix4x4i;
 
     /**
      * Matrix-Vector Operations
      */
-    template<typename T, int N>
-    inline VectorData<T, N> operator*(const Matrix<T, N>& m, const VectorData<T, N>& v)
+    template<typename T, int R, int C>
+    inline VectorData<T, R> operator*(const Matrix<T, R, C>& m, const VectorData<T, C>& v)
     {
-        VectorData<T, N> result;
+        VectorData<T, R> result;
 
-        for (int i = 0; i < N; ++i)
+        for (int i = 0; i < R; ++i)
         {
-            result.m_Data[i] = 0;
+            result.m_Data[i] = m.m_Data2D[i][0] * v.m_Data[0];
 
-            for (int j = 0; j < N; ++j)
+            for (int j = 1; j < C; ++j)
                 result.m_Data[i] += m.m_Data2D[i][j] * v.m_Data[j];
         }
 
         return result;
     }
 
-    template<typename T, int N>
-    inline Vector<T, N> operator*(const Matrix<T, N>& m, const Vector<T, N>& v)
+    template<typename T, int R, int C>
+    inline Vector<T, R> operator*(const Matrix<T, R, C>& m, const Vector<T, C>& v)
     {
-        return m * static_cast<VectorData<T, N>>(v);
+        return m * static_cast<VectorData<T, C>>(v);
+    }
+
+    // Row vector times matrix, i.e. (m^T * v)^T, without forming the transpose
+    template<typename T, int R, int C>
+    inline Vector<T, C> operator*(const Vector<T, R>& v, const Matrix<T, R, C>& m)
+    {
+        Vector<T, C> result;
+
+        for (int j = 0; j < C; ++j)
+            result[j] = v[0] * m.m_Data2D[0][j];
+
+        for (int i = 1; i < R; ++i)
+            for (int j = 0; j < C; ++j)
+                result[j] += v[i] * m.m_Data2D[i][j];
+
+        return result;
     }
 
     /**
      * Matrix-Point Operations
      */
-    template<typename T, int N>
-    inline Point<T, N> operator*(const Matrix<T, N>& m, const Point<T, N>& p)
+    template<typename T, int R, int C>
+    inline Point<T, R> operator*(const Matrix<T, R, C>& m, const Point<T, C>& p)
     {
-        return m * static_cast<VectorData<T, N>>(p);
+        return m * static_cast<VectorData<T, C>>(p);
+    }
+
+    /**
+     * Affine (3x4) Operations. Points carry an implicit w = 1, vectors w = 0.
+     */
+    template<typename T>
+    inline Point<T, 3> operator*(const Matrix<T, 3, 4>& m, const Point<T, 3>& p)
+    {
+        Point<T, 3> res;
+
+        for (int i = 0; i < 3; ++i)
+            res[i] = m.m_Data2D[i][0] * p[0] + m.m_Data2D[i][1] * p[1] + m.m_Data2D[i][2] * p[2] + m.m_Data2D[i][3];
+
+        return res;
+    }
+
+    template<typename T>
+    inline Vector<T, 3> operator*(const Matrix<T, 3, 4>& m, const Vector<T, 3>& v)
+    {
+        Vector<T, 3> res;
+
+        for (int i = 0; i < 3; ++i)
+            res[i] = m.m_Data2D[i][0] * v[0] + m.m_Data2D[i][1] * v[1] + m.m_Data2D[i][2] * v[2];
+
+        return res;
     }
 
     /**
@@ -22,14 +22,37 @@
 
 namespace SMath
 {
-    template <typename T, int N>
+    template <typename T, int R, int C>
     class MatrixData
     {
-        static_assert(N >= 3 && N <= 4, "Only 3-4 dimensions are supported");
+        static_assert(R >= 1 && C >= 1, "Matrix dimensions must be positive");
+
+    public:
+        union
+        {
+            struct { T m_Data[R * C]; };
+            struct { T m_Data2D[R][C]; };
+        };
+    };
+
+    template <typename T>
+    class MatrixData<T, 2, 2>
+    {
+    public:
+        union
+        {
+            struct { T m_Data[2 * 2]; };
+            struct { T m_Data2D[2][2]; };
+            struct
+            {
+                T m_11, m_12;
+                T m_21, m_22;
+            };
+        };
     };
 
     template <typename T>
-    class MatrixData<T, 3>
+    class MatrixData<T, 3, 3>
     {
     public:
         union
@@ -46,7 +69,7 @@ namespace SMath
     };
 
     template <typename T>
-    class MatrixData<T, 4>
+    class MatrixData<T, 4, 4>
     {
     public:
         union
@@ -63,16 +86,22 @@ namespace SMath
         };
     };
 
-    template<typename T, int N>
-    class Matrix : public MatrixData<T, N>
+    // Row-major R x C matrix. Square matrices can be written as Matrix<T, N>.
+    template<typename T, int R, int C = R>
+    class Matrix : public MatrixData<T, R, C>
     {
     public:
         Matrix();
         Matrix(T v);
         Matrix(const T* data);
+        Matrix(T _11, T _12,
+            T _21, T _22);
         Matrix(T _11, T _12, T _13,
             T _21, T _22, T _23,
             T _31, T _32, T _33);
+        Matrix(T _11, T _12, T _13, T _14,
+            T _21, T _22, T _23, T _24,
+            T _31, T _32, T _33, T _34);
         Matrix(T _11, T _12, T _13, T _14,
             T _21, T _22, T _23, T _24,
             T _31, T _32, T _33, T _34,
@@ -82,17 +111,19 @@ namespace SMath
         inline T operator[](int i) const { return this->m_Data[i]; }
         inline T& operator[](int i) { return this->m_Data[i]; }
         bool operator==(const Matrix& m2) const;
-        Matrix operator*(const Matrix& m2) const;
+
+        template <int K>
+        Matrix<T, R, K> operator*(const Matrix<T, C, K>& m2) const;
 
     public:
         bool IsIdentity() const;
         bool IsZero() const;
-        Matrix Transposed() const;
+        Matrix<T, C, R> Transposed() const;
         Matrix<T, 4> Inversed() const;
         Matrix<T, 3> Upper3x3() const;
         
     public:
-        static Matrix<T, N> Identity();
+        static Matrix Identity();
         static Matrix<T, 4> From3x3(Matrix<T, 3> mat);
 
     private:
@@ -101,4 +132,3 @@ namespace SMath
 
     #include "matrix_impl.h"
 }
-
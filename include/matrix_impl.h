@@ -17,36 +17,47 @@
     You should have received a copy of the GNU General Public License
     along with this program. If not, see <http://www.gnu.org/licenses/>.
 */
-
-template<typename T, int N>
-inline Matrix<T, N>::Matrix()
+template<typename T, int R, int C>
+inline Matrix<T, R, C>::Matrix()
 {
-    for (int i = 0; i < N; ++i)
-        for (int j = 0; j < N; ++j)
+    for (int i = 0; i < R; ++i)
+        for (int j = 0; j < C; ++j)
             this->m_Data2D[i][j] = i == j ? 1 : 0;
 }
 
-template<typename T, int N>
-Matrix<T, N>::Matrix(T v)
+template<typename T, int R, int C>
+Matrix<T, R, C>::Matrix(T v)
 {
-    for (int i = 0; i < N * N; ++i)
+    for (int i = 0; i < R * C; ++i)
         this->m_Data[i] = v;
 }
 
-template<typename T, int N>
-Matrix<T, N>::Matrix(const T* data)
+template<typename T, int R, int C>
+Matrix<T, R, C>::Matrix(const T* data)
 {
-    for (int i = 0; i < N * N; ++i)
+    for (int i = 0; i < R * C; ++i)
         this->m_Data[i] = data[i];
 }
 
-template<typename T, int N>
-Matrix<T, N>::Matrix(
+template<typename T, int R, int C>
+Matrix<T, R, C>::Matrix(
+    T _11, T _12,
+    T _21, T _22)
+{
+    static_assert(R == 2 && C == 2, "4 component constructor only available for 2x2 matrices");
+    this->m_11 = _11;
+    this->m_12 = _12;
+    this->m_21 = _21;
+    this->m_22 = _22;
+}
+
+template<typename T, int R, int C>
+Matrix<T, R, C>::Matrix(
     T _11, T _12, T _13,
     T _21, T _22, T _23,
     T _31, T _32, T _33)
 {
-    static_assert(N == 3, "9 component constructor only available for N = 3");
+    static_assert(R == 3 && C == 3, "9 component constructor only available for 3x3 matrices");
     this->m_11 = _11;
     this->m_12 = _12;
     this->m_13 = _13;
@@ -58,14 +69,27 @@ Matrix<T, N>::Matrix(
     this->m_33 = _33;
 }
 
-template<typename T, int N>
-Matrix<T, N>::Matrix(
+template<typename T, int R, int C>
+Matrix<T, R, C>::Matrix(
+    T _11, T _12, T _13, T _14,
+    T _21, T _22, T _23, T _24,
+    T _31, T _32, T _33, T _34)
+{
+    // Components are taken in row-major order, so this serves both 3x4 and 4x3
+    static_assert(R * C == 12, "12 component constructor only available for 3x4 and 4x3 matrices");
+    const T data[12] = { _11, _12, _13, _14, _21, _22, _23, _24, _31, _32, _33, _34 };
+    for (int i = 0; i < 12; ++i)
+        this->m_Data[i] = data[i];
+}
+
+template<typename T, int R, int C>
+Matrix<T, R, C>::Matrix(
     T _11, T _12, T _13, T _14,
     T _21, T _22, T _23, T _24,
     T _31, T _32, T _33, T _34,
     T _41, T _42, T _43, T _44)
 {
-    static_assert(N == 4, "16 component constructor only available for N = 4");
+    static_assert(R == 4 && C == 4, "16 component constructor only available for 4x4 matrices");
     this->m_11 = _11;
     this->m_12 = _12;
     this->m_13 = _13;
@@ -84,39 +108,42 @@ Matrix<T, N>::Matrix(
     this->m_44 = _44;
 }
 
-template<typename T, int N>
-bool Matrix<T, N>::operator==(const Matrix& m2) const
+template<typename T, int R, int C>
+bool Matrix<T, R, C>::operator==(const Matrix& m2) const
 {
-    for (int i = 0; i < N * N; ++i)
+    for (int i = 0; i < R * C; ++i)
         if (std::fabs(this->m_Data[i] - m2.m_Data[i]) > SMath::Epsilon)
             return false;
 
     return true;
 }
 
-template<typename T, int N>
-Matrix<T, N> Matrix<T, N>::operator*(const Matrix& m2) const
+template<typename T, int R, int C>
+template<int K>
+Matrix<T, R, K> Matrix<T, R, C>::operator*(const Matrix<T, C, K>& m2) const
 {
-    T data[N][N];
+    T data[R][K];
 
-    for (int i = 0; i < N; ++i)
+    // i-k-j order broadcasts one element of this against a contiguous row of
+    // m2, so the fixed-size inner loop maps directly onto vector lanes
+    for (int i = 0; i < R; ++i)
     {
-        for (int j = 0; j < N; ++j)
-        {
-            data[i][j] = 0;
-            for (int k = 0; k < N; ++k)
+        for (int j = 0; j < K; ++j)
+            data[i][j] = this->m_Data2D[i][0] * m2.m_Data2D[0][j];
+
+        for (int k = 1; k < C; ++k)
+            for (int j = 0; j < K; ++j)
                 data[i][j] += this->m_Data2D[i][k] * m2.m_Data2D[k][j];
-        }
     }
 
     return &(data[0][0]);
 }
 
-template<typename T, int N>
-bool Matrix<T, N>::IsIdentity() const
+template<typename T, int R, int C>
+bool Matrix<T, R, C>::IsIdentity() const
 {
-    for (int i = 0; i < N; ++i)
-        for (int j = 0; j < N; ++j)
+    for (int i = 0; i < R; ++i)
+        for (int j = 0; j < C; ++j)
         {
             if (i == j && std::fabs(this->m_Data2D[i][j] - 1) > SMath::Epsilon)
                 return false;
@@ -128,32 +155,33 @@ bool Matrix<T, N>::IsIdentity() const
     return true;
 }
 
-template<typename T, int N>
-bool Matrix<T, N>::IsZero() const
+template<typename T, int R, int C>
+bool Matrix<T, R, C>::IsZero() const
 {
-    for (int i = 0; i < N; ++i)
-        for (int j = 0; j < N; ++j)
-            if (this->m_Data2D[i][j] != 0)
-                return false;
+    for (int i = 0; i < R * C; ++i)
+        if (this->m_Data[i] != 0)
+            return false;
 
     return true;
 }
 
-template<typename T, int N>
-Matrix<T, N> Matrix<T, N>::Transposed() const
+template<typename T, int R, int C>
+Matrix<T, C, R> Matrix<T, R, C>::Transposed() const
 {
-    Matrix<T, N> transposed;
+    T data[C][R];
 
-    for (int i = 0; i < N; ++i)
-        for (int j = 0; j < N; ++j)
-            transposed.m_Data2D[i][j] = this->m_Data2D[j][i];
+    for (int i = 0; i < C; ++i)
+        for (int j = 0; j < R; ++j)
+            data[i][j] = this->m_Data2D[j][i];
 
-    return transposed;
+    return &(data[0][0]);
 }
 
-template<typename T, int N>
-Matrix<T, 4> Matrix<T, N>::Inversed() const
+template<typename T, int R, int C>
+Matrix<T, 4> Matrix<T, R, C>::Inversed() const
 {
+    static_assert(R == 4 && C == 4, "Inverse only available for 4x4 matrices");
+
     double d = Determinant();
     if (std::fabs(d) < 0.001)
         return Matrix<T, 4>();
@@ -181,8 +209,8 @@ Matrix<T, 4> Matrix<T, N>::Inversed() const
     return out;
 }
 
-template<typename T, int N>
-double Matrix<T, N>::Determinant() const
+template<typename T, int R, int C>
+double Matrix<T, R, C>::Determinant() const
 {
     return
         (this->m_Data[0] * this->m_Data[5] - this->m_Data[1] * this->m_Data[4]) * (this->m_Data[10] * this->m_Data[15] - this->m_Data[11] * this->m_Data[14]) -
@@ -193,20 +221,14 @@ double Matrix<T, N>::Determinant() const
         (this->m_Data[2] * this->m_Data[7] - this->m_Data[3] * this->m_Data[6]) * (this->m_Data[8] * this->m_Data[13] - this->m_Data[9] * this->m_Data[12]);
 }
 
-template<typename T, int N>
-Matrix<T, N> Matrix<T, N>::Identity()
+template<typename T, int R, int C>
+Matrix<T, R, C> Matrix<T, R, C>::Identity()
 {
-    Matrix<T, N> identity;
-
-    for (int i = 0; i < N; ++i)
-        for (int j = 0; j < N; ++j)
-            identity.m_Data2D[i][j] = i == j ? 1 : 0;
-
-    return identity;
+    return Matrix<T, R, C>();
 }
 
-template<typename T, int N>
-Matrix<T, 4> Matrix<T, N>::From3x3(Matrix<T, 3> mat)
+template<typename T, int R, int C>
+Matrix<T, 4> Matrix<T, R, C>::From3x3(Matrix<T, 3> mat)
 {
     return {
         mat.m_11, mat.m_12, mat.m_13, 0,
@@ -216,13 +238,14 @@ Matrix<T, 4> Matrix<T, N>::From3x3(Matrix<T, 3> mat)
     };
 }
 
-template<typename T, int N>
-Matrix<T, 3> Matrix<T, N>::Upper3x3() const
+template<typename T, int R, int C>
+Matrix<T, 3> Matrix<T, R, C>::Upper3x3() const
 {
+    static_assert(R >= 3 && C >= 3, "Upper3x3 only available for matrices of at least 3x3");
+
     return {
-        this->m_11, this->m_12, this->m_13,
-        this->m_21, this->m_22, this->m_23,
-        this->m_31, this->m_32, this->m_33
+        this->m_Data2D[0][0], this->m_Data2D[0][1], this->m_Data2D[0][2],
+        this->m_Data2D[1][0], this->m_Data2D[1][1], this->m_Data2D[1][2],
+        this->m_Data2D[2][0], this->m_Data2D[2][1], this->m_Data2D[2][2]
     };
 }
-
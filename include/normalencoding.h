@@ -0,0 +1,485 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cmath>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <algorithm>
+#include "linalg.h"
+#include "dispatch.h"
+
+namespace SMath
+{
+    /**
+     * Compact encodings for unit normals and tangent frames. Components are
+     * snorm integers: q / (2^(bits - 1) - 1), so 0 and +-1 are exact.
+     *
+     * Worst-case angle between a unit normal and its decoded value, measured
+     * over a dense sweep of the sphere:
+     *   Oct16          4 bytes   0.0037 deg, 0.0025 deg with EncodeOct16Precise
+     *   Oct8           2 bytes   0.94 deg, 0.64 deg with EncodeOct8Precise
+     *   Spheremap16    4 bytes   0.0035 deg for z >= 0, 0.011 deg for z >= -0.9
+     *   QTangent       8 bytes   0.0035 deg on both the normal and the tangent
+     *
+     * Spheremap16 is the Lambert equal-area map. Its error grows towards -z
+     * (0.033 deg at z = -0.99), so it suits view-space normals; the
+     * octahedral maps are close to uniform over the whole sphere.
+     */
+    struct Oct16
+    {
+        int16_t m_U, m_V;
+        bool operator==(const Oct16&) const = default;
+    };
+
+    struct Oct8
+    {
+        int8_t m_U, m_V;
+        bool operator==(const Oct8&) const = default;
+    };
+
+    struct Spheremap16
+    {
+        int16_t m_U, m_V;
+        bool operator==(const Spheremap16&) const = default;
+    };
+
+    // Rotation taking (x, y, z) to (tangent, bitangent, normal). w is kept at least one step
+    // away from zero and carries the sign of the bitangent: bitangent = sign * Cross(normal, tangent).
+    struct QTangent
+    {
+        int16_t m_X, m_Y, m_Z, m_W;
+        bool operator==(const QTangent&) const = default;
+    };
+}
+
+// Snorm and octahedral helpers shared by the normal and quaternion encodings,
+// kept out of SMath so their generic names cannot clash with user code
+namespace SMath::Encoding
+{
+    template<int Bits, typename T>
+    inline int32_t ToSnorm(T a)
+    {
+        constexpr T scale = T((1 << (Bits - 1)) - 1);
+        return int32_t(Simd::Scalar::RoundToInt(std::clamp(a, T(-1), T(1)) * scale));
+    }
+
+    template<int Bits, typename T>
+    inline T FromSnorm(int32_t q)
+    {
+        constexpr T invScale = T(1) / T((1 << (Bits - 1)) - 1);
+        return std::max(T(q) * invScale, T(-1));
+    }
+
+    template<typename T>
+    inline T SignNotZero(T a)
+    {
+        return a >= T(0) ? T(1) : T(-1);
+    }
+
+    // Projects n onto the octahedron |u| + |v| + |z| = 1 and unfolds the lower half over the corners
+    template<typename T>
+    inline void ToOctahedron(const Vector<T, 3>& n, T& u, T& v)
+    {
+        T invL1 = T(1) / (std::abs(n.x) + std::abs(n.y) + std::abs(n.z));
+        u = n.x * invL1;
+        v = n.y * invL1;
+        if (n.z < T(0))
+        {
+            T foldedU = (T(1) - std::abs(v)) * SignNotZero(u);
+            v = (T(1) - std::abs(u)) * SignNotZero(v);
+            u = foldedU;
+        }
+    }
+
+    template<typename T>
+    inline Normal<T, 3> FromOctahedron(T u, T v)
+    {
+        T z = T(1) - std::abs(u) - std::abs(v);
+        T t = std::max(-z, T(0));
+        u -= t * SignNotZero(u);
+        v -= t * SignNotZero(v);
+        T invLength = T(1) / std::sqrt(u * u + v * v + z * z);
+        return Normal<T, 3>(u * invLength, v * invLength, z * invLength);
+    }
+
+    // Tries the four neighbouring grid points and keeps the one that decodes closest to n
+    template<int Bits, typename T>
+    inline void ToOctahedronPrecise(const Normal<T, 3>& n, int32_t& qu, int32_t& qv)
+    {
+        constexpr T scale = T((1 << (Bits - 1)) - 1);
+        T u, v;
+        ToOctahedron<T>(n, u, v);
+        int32_t baseU = int32_t(std::floor(u * scale));
+        int32_t baseV = int32_t(std::floor(v * scale));
+
+        // A NaN or zero normal never beats best, so fall back to the base point
+        qu = baseU;
+        qv = baseV;
+        T best = -std::numeric_limits<T>::infinity();
+        for (int32_t cu = baseU; cu <= std::min(baseU + 1, int32_t(scale)); ++cu)
+        {
+            for (int32_t cv = baseV; cv <= std::min(baseV + 1, int32_t(scale)); ++cv)
+            {
+                T cosine = Vector<T, 3>::Dot(FromOctahedron(FromSnorm<Bits, T>(cu), FromSnorm<Bits, T>(cv)), n);
+                if (cosine > best)
+                {
+                    best = cosine;
+                    qu = cu;
+                    qv = cv;
+                }
+            }
+        }
+    }
+}
+
+namespace SMath
+{
+    // The octahedral encodings accept normals of any non-zero length
+    template<typename T>
+    inline Oct16 EncodeOct16(const Normal<T, 3>& n)
+    {
+        T u, v;
+        Encoding::ToOctahedron<T>(n, u, v);
+        return { int16_t(Encoding::ToSnorm<16>(u)), int16_t(Encoding::ToSnorm<16>(v)) };
+    }
+
+    template<typename T>
+    inline Oct16 EncodeOct16Precise(const Normal<T, 3>& n)
+    {
+        int32_t u, v;
+        Encoding::ToOctahedronPrecise<16>(n, u, v);
+        return { int16_t(u), int16_t(v) };
+    }
+
+    template<typename T = double>
+    inline Normal<T, 3> DecodeOct16(Oct16 e)
+    {
+        return Encoding::FromOctahedron(Encoding::FromSnorm<16, T>(e.m_U), Encoding::FromSnorm<16, T>(e.m_V));
+    }
+
+    template<typename T>
+    inline Oct8 EncodeOct8(const Normal<T, 3>& n)
+    {
+        T u, v;
+        Encoding::ToOctahedron<T>(n, u, v);
+        return { int8_t(Encoding::ToSnorm<8>(u)), int8_t(Encoding::ToSnorm<8>(v)) };
+    }
+
+    template<typename T>
+    inline Oct8 EncodeOct8Precise(const Normal<T, 3>& n)
+    {
+        int32_t u, v;
+        Encoding::ToOctahedronPrecise<8>(n, u, v);
+        return { int8_t(u), int8_t(v) };
+    }
+
+    template<typename T = double>
+    inline Normal<T, 3> DecodeOct8(Oct8 e)
+    {
+        return Encoding::FromOctahedron(Encoding::FromSnorm<8, T>(e.m_U), Encoding::FromSnorm<8, T>(e.m_V));
+    }
+
+    // Expects a unit normal. (0, 0, -1) maps to the rim of the disk.
+    template<typename T>
+    inline Spheremap16 EncodeSpheremap(const Normal<T, 3>& n)
+    {
+        T d = T(1) + n.z;
+        if (!(d > T(0)))
+            return { int16_t(Encoding::ToSnorm<16>(T(1))), 0 };
+
+        T scale = T(1) / std::sqrt(d + d);
+        return { int16_t(Encoding::ToSnorm<16>(n.x * scale)), int16_t(Encoding::ToSnorm<16>(n.y * scale)) };
+    }
+
+    template<typename T = double>
+    inline Normal<T, 3> DecodeSpheremap(Spheremap16 e)
+    {
+        T u = Encoding::FromSnorm<16, T>(e.m_U);
+        T v = Encoding::FromSnorm<16, T>(e.m_V);
+        T r2 = std::min(u * u + v * v, T(1));
+        T g = T(2) * std::sqrt(T(1) - r2);
+        return Normal<T, 3>(u * g, v * g, T(1) - T(2) * r2);
+    }
+
+    /**
+     * Expects a unit normal. The tangent is made orthogonal to the normal
+     * first; a tangent parallel to the normal is replaced by an arbitrary
+     * perpendicular one. sign < 0 flips the bitangent.
+     */
+    template<typename T>
+    inline QTangent EncodeQTangent(const Normal<T, 3>& normal, const Vector<T, 3>& tangent, T sign)
+    {
+        T nt = Vector<T, 3>::Dot(normal, tangent);
+        T tx = tangent.x - normal.x * nt, ty = tangent.y - normal.y * nt, tz = tangent.z - normal.z * nt;
+        T length2 = tx * tx + ty * ty + tz * tz;
+        if (!(length2 > T(1e-8)))
+        {
+            bool useX = std::abs(normal.x) < T(0.9);
+            tx = useX ? T(0) : -normal.z;
+            ty = useX ? normal.z : T(0);
+            tz = useX ? -normal.y : normal.x;
+            length2 = tx * tx + ty * ty + tz * tz;
+        }
+
+        T invLength = T(1) / std::sqrt(length2);
+        tx *= invLength;
+        ty *= invLength;
+        tz *= invLength;
+
+        // Columns of the rotation are (tangent, bitangent, normal)
+        T bx = normal.y * tz - normal.z * ty;
+        T by = normal.z * tx - normal.x * tz;
+        T bz = normal.x * ty - normal.y * tx;
+        T m00 = tx, m10 = ty, m20 = tz;
+        T m01 = bx, m11 = by, m21 = bz;
+        T m02 = normal.x, m12 = normal.y, m22 = normal.z;
+
+        T x, y, z, w;
+        T trace = m00 + m11 + m22;
+        if (trace > T(0))
+        {
+            T s = std::sqrt(T(1) + trace) * T(2);
+            w = T(0.25) * s;
+            x = (m21 - m12) / s;
+            y = (m02 - m20) / s;
+            z = (m10 - m01) / s;
+        }
+        else if (m00 >= m11 && m00 >= m22)
+        {
+            T s = std::sqrt(T(1) + m00 - m11 - m22) * T(2);
+            w = (m21 - m12) / s;
+            x = T(0.25) * s;
+            y = (m01 + m10) / s;
+            z = (m02 + m20) / s;
+        }
+        else if (m11 >= m22)
+        {
+            T s = std::sqrt(T(1) + m11 - m00 - m22) * T(2);
+            w = (m02 - m20) / s;
+            x = (m01 + m10) / s;
+            y = T(0.25) * s;
+            z = (m12 + m21) / s;
+        }
+        else
+        {
+            T s = std::sqrt(T(1) + m22 - m00 - m11) * T(2);
+            w = (m10 - m01) / s;
+            x = (m02 + m20) / s;
+            y = (m12 + m21) / s;
+            z = T(0.25) * s;
+        }
+
+        // q and -q are the same rotation: pick w > 0, then let the bitangent sign choose
+        T flip = Encoding::SignNotZero(w) * Encoding::SignNotZero(sign);
+        w = std::max(std::abs(w), Encoding::FromSnorm<16, T>(1)) * Encoding::SignNotZero(sign);
+        return { int16_t(Encoding::ToSnorm<16>(x * flip)), int16_t(Encoding::ToSnorm<16>(y * flip)),
+                 int16_t(Encoding::ToSnorm<16>(z * flip)), int16_t(Encoding::ToSnorm<16>(w)) };
+    }
+
+    // Returns the bitangent sign
+    template<typename T = double>
+    inline T DecodeQTangent(QTangent e, Normal<T, 3>& normal, Vector<T, 3>& tangent)
+    {
+        T x = Encoding::FromSnorm<16, T>(e.m_X), y = Encoding::FromSnorm<16, T>(e.m_Y), z = Encoding::FromSnorm<16, T>(e.m_Z), w = Encoding::FromSnorm<16, T>(e.m_W);
+        T sign = Encoding::SignNotZero(w);
+        T invLength = T(1) / std::sqrt(x * x + y * y + z * z + w * w);
+        x *= invLength;
+        y *= invLength;
+        z *= invLength;
+        w *= invLength;
+
+        tangent = Vector<T, 3>(T(1) - T(2) * (y * y + z * z), T(2) * (x * y + w * z), T(2) * (x * z - w * y));
+        normal = Normal<T, 3>(T(2) * (x * z + w * y), T(2) * (y * z - w * x), T(1) - T(2) * (x * x + y * y));
+        return sign;
+    }
+}
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(Normal<float, 3>) == 3 * sizeof(float), "Encoding kernels walk Normal arrays as packed floats");
+    static_assert(sizeof(Oct16) == 4 && sizeof(Spheremap16) == 4 && sizeof(QTangent) == 8, "Encoding kernels walk codes as packed integers");
+
+    struct EncodingKernels
+    {
+        void (*EncodeOct16)(const Normal<float, 3>* in, Oct16* out, size_t count);
+        void (*DecodeOct16)(const Oct16* in, Normal<float, 3>* out, size_t count);
+        void (*EncodeOct8)(const Normal<float, 3>* in, Oct8* out, size_t count);
+        void (*DecodeOct8)(const Oct8* in, Normal<float, 3>* out, size_t count);
+        void (*EncodeSpheremap)(const Normal<float, 3>* in, Spheremap16* out, size_t count);
+        void (*DecodeSpheremap)(const Spheremap16* in, Normal<float, 3>* out, size_t count);
+        void (*EncodeQTangent)(const Normal<float, 3>* normals, const Vector<float, 4>* tangents, QTangent* out, size_t count);
+        void (*DecodeQTangent)(const QTangent* in, Normal<float, 3>* normals, Vector<float, 4>* tangents, size_t count);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    inline void EncodeOct16Array(const Normal<float, 3>* in, Oct16* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = EncodeOct16(in[i]);
+    }
+
+    inline void DecodeOct16Array(const Oct16* in, Normal<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = DecodeOct16<float>(in[i]);
+    }
+
+    inline void EncodeOct8Array(const Normal<float, 3>* in, Oct8* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = EncodeOct8(in[i]);
+    }
+
+    inline void DecodeOct8Array(const Oct8* in, Normal<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = DecodeOct8<float>(in[i]);
+    }
+
+    inline void EncodeSpheremapArray(const Normal<float, 3>* in, Spheremap16* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = EncodeSpheremap(in[i]);
+    }
+
+    inline void DecodeSpheremapArray(const Spheremap16* in, Normal<float, 3>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = DecodeSpheremap<float>(in[i]);
+    }
+
+    inline void EncodeQTangentArray(const Normal<float, 3>* normals, const Vector<float, 4>* tangents, QTangent* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = EncodeQTangent(normals[i], Vector<float, 3>(tangents[i].x, tangents[i].y, tangents[i].z), tangents[i].w);
+    }
+
+    inline void DecodeQTangentArray(const QTangent* in, Normal<float, 3>* normals, Vector<float, 4>* tangents, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector<float, 3> tangent;
+            float sign = DecodeQTangent<float>(in[i], normals[i], tangent);
+            tangents[i] = Vector<float, 4>(tangent.x, tangent.y, tangent.z, sign);
+        }
+    }
+
+    inline constexpr EncodingKernels EncodingTable = {
+        EncodeOct16Array, DecodeOct16Array, EncodeOct8Array, DecodeOct8Array,
+        EncodeSpheremapArray, DecodeSpheremapArray, EncodeQTangentArray, DecodeQTangentArray
+    };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "normalencoding_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "normalencoding_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "normalencoding_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const EncodingKernels& GetEncodingKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::EncodingTable, Sse2::EncodingTable, Avx2::EncodingTable, Avx512::EncodingTable);
+#else
+        return Scalar::EncodingTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Array versions of the encodings above, run on the instruction set
+     * selected by Simd::GetLevel. Results can differ from the scalar
+     * functions by one step where an exact tie rounds differently after
+     * fused multiply-adds. Tangents are (x, y, z, sign), as in glTF.
+     */
+    inline void EncodeOct16(std::span<const Normal<float, 3>> in, std::span<Oct16> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetEncodingKernels().EncodeOct16(in.data(), out.data(), in.size());
+    }
+
+    inline void DecodeOct16(std::span<const Oct16> in, std::span<Normal<float, 3>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetEncodingKernels().DecodeOct16(in.data(), out.data(), in.size());
+    }
+
+    inline void EncodeOct8(std::span<const Normal<float, 3>> in, std::span<Oct8> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetEncodingKernels().EncodeOct8(in.data(), out.data(), in.size());
+    }
+
+    inline void DecodeOct8(std::span<const Oct8> in, std::span<Normal<float, 3>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetEncodingKernels().DecodeOct8(in.data(), out.data(), in.size());
+    }
+
+    inline void EncodeSpheremap(std::span<const Normal<float, 3>> in, std::span<Spheremap16> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetEncodingKernels().EncodeSpheremap(in.data(), out.data(), in.size());
+    }
+
+    inline void DecodeSpheremap(std::span<const Spheremap16> in, std::span<Normal<float, 3>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetEncodingKernels().DecodeSpheremap(in.data(), out.data(), in.size());
+    }
+
+    inline void EncodeQTangent(std::span<const Normal<float, 3>> normals, std::span<const Vector<float, 4>> tangents, std::span<QTangent> out)
+    {
+        assert(normals.size() == tangents.size() && normals.size() == out.size());
+        Simd::GetEncodingKernels().EncodeQTangent(normals.data(), tangents.data(), out.data(), normals.size());
+    }
+
+    inline void DecodeQTangent(std::span<const QTangent> in, std::span<Normal<float, 3>> normals, std::span<Vector<float, 4>> tangents)
+    {
+        assert(in.size() == normals.size() && in.size() == tangents.size());
+        Simd::GetEncodingKernels().DecodeQTangent(in.data(), normals.data(), tangents.data(), in.size());
+    }
+}
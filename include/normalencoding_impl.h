@@ -0,0 +1,283 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Lane versions of the normalencoding.h encodings, included once per ISA
+ * namespace the same way as batchmath_impl.h. Whole vectors run on the
+ * namespace's lanes and the remaining elements go through the Scalar loops.
+ */
+
+inline Float SignNotZero(Float a)
+{
+    return Select(a >= Float(0.0f), Float(1.0f), Float(-1.0f));
+}
+
+inline Int ToSnorm(Float a, float scale)
+{
+    return RoundToInt(Min(Max(a, Float(-1.0f)), Float(1.0f)) * Float(scale));
+}
+
+inline Float FromSnorm(Int q, float scale)
+{
+    return Max(ToFloat(q) * Float(1.0f / scale), Float(-1.0f));
+}
+
+// Two snorm16 values per 32-bit lane, u in the low half
+inline Int PackSnorm16(Float u, Float v)
+{
+    return (ToSnorm(u, 32767.0f) & Int(0xffff)) | ShiftLeft(ToSnorm(v, 32767.0f), 16);
+}
+
+inline void UnpackSnorm16(Int packed, Float& u, Float& v)
+{
+    u = FromSnorm(ShiftRightSigned(ShiftLeft(packed, 16), 16), 32767.0f);
+    v = FromSnorm(ShiftRightSigned(packed, 16), 32767.0f);
+}
+
+inline void ToOctahedron(Float x, Float y, Float z, Float& u, Float& v)
+{
+    Float invL1 = Float(1.0f) / (Abs(x) + Abs(y) + Abs(z));
+    u = x * invL1;
+    v = y * invL1;
+
+    Mask lower = z < Float(0.0f);
+    Float foldedU = (Float(1.0f) - Abs(v)) * SignNotZero(u);
+    Float foldedV = (Float(1.0f) - Abs(u)) * SignNotZero(v);
+    u = Select(lower, foldedU, u);
+    v = Select(lower, foldedV, v);
+}
+
+inline void FromOctahedron(Float u, Float v, float* out)
+{
+    Float z = Float(1.0f) - Abs(u) - Abs(v);
+    Float t = Max(-z, Float(0.0f));
+    u = u - t * SignNotZero(u);
+    v = v - t * SignNotZero(v);
+
+    Float invLength = Float(1.0f) / Sqrt(u * u + v * v + z * z);
+    StoreInterleaved3(out, u * invLength, v * invLength, z * invLength);
+}
+
+inline void EncodeOct16Array(const Normal<float, 3>* in, Oct16* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    int32_t* dst = reinterpret_cast<int32_t*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float u, v;
+        ToOctahedron(LoadStrided(src + 3 * i, 3), LoadStrided(src + 3 * i + 1, 3), LoadStrided(src + 3 * i + 2, 3), u, v);
+        Store(dst + i, PackSnorm16(u, v));
+    }
+
+    Scalar::EncodeOct16Array(in + i, out + i, count - i);
+}
+
+inline void DecodeOct16Array(const Oct16* in, Normal<float, 3>* out, size_t count)
+{
+    const int32_t* src = reinterpret_cast<const int32_t*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float u, v;
+        UnpackSnorm16(Load(src + i), u, v);
+        FromOctahedron(u, v, dst + 3 * i);
+    }
+
+    Scalar::DecodeOct16Array(in + i, out + i, count - i);
+}
+
+inline void EncodeOct8Array(const Normal<float, 3>* in, Oct8* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    uint16_t* dst = reinterpret_cast<uint16_t*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float u, v;
+        ToOctahedron(LoadStrided(src + 3 * i, 3), LoadStrided(src + 3 * i + 1, 3), LoadStrided(src + 3 * i + 2, 3), u, v);
+        StoreNarrow(dst + i, (ToSnorm(u, 127.0f) & Int(0xff)) | ShiftLeft(ToSnorm(v, 127.0f) & Int(0xff), 8));
+    }
+
+    Scalar::EncodeOct8Array(in + i, out + i, count - i);
+}
+
+inline void DecodeOct8Array(const Oct8* in, Normal<float, 3>* out, size_t count)
+{
+    const uint16_t* src = reinterpret_cast<const uint16_t*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Int packed = LoadWiden(src + i);
+        Float u = FromSnorm(ShiftRightSigned(ShiftLeft(packed, 24), 24), 127.0f);
+        Float v = FromSnorm(ShiftRightSigned(ShiftLeft(packed, 16), 24), 127.0f);
+        FromOctahedron(u, v, dst + 3 * i);
+    }
+
+    Scalar::DecodeOct8Array(in + i, out + i, count - i);
+}
+
+inline void EncodeSpheremapArray(const Normal<float, 3>* in, Spheremap16* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    int32_t* dst = reinterpret_cast<int32_t*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x = LoadStrided(src + 3 * i, 3);
+        Float y = LoadStrided(src + 3 * i + 1, 3);
+        Float d = Float(1.0f) + LoadStrided(src + 3 * i + 2, 3);
+
+        // The -z pole goes to (1, 0); the division there only produces lanes that are replaced
+        Mask pole = ~(d > Float(0.0f));
+        Float scale = Float(1.0f) / Sqrt(d + d);
+        Store(dst + i, PackSnorm16(Select(pole, Float(1.0f), x * scale), Select(pole, Float(0.0f), y * scale)));
+    }
+
+    Scalar::EncodeSpheremapArray(in + i, out + i, count - i);
+}
+
+inline void DecodeSpheremapArray(const Spheremap16* in, Normal<float, 3>* out, size_t count)
+{
+    const int32_t* src = reinterpret_cast<const int32_t*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float u, v;
+        UnpackSnorm16(Load(src + i), u, v);
+        Float r2 = Min(u * u + v * v, Float(1.0f));
+        Float g = Float(2.0f) * Sqrt(Float(1.0f) - r2);
+        StoreInterleaved3(dst + 3 * i, u * g, v * g, Float(1.0f) - Float(2.0f) * r2);
+    }
+
+    Scalar::DecodeSpheremapArray(in + i, out + i, count - i);
+}
+
+inline void EncodeQTangentArray(const Normal<float, 3>* normals, const Vector<float, 4>* tangents, QTangent* out, size_t count)
+{
+    const float* n = reinterpret_cast<const float*>(normals);
+    const float* t = reinterpret_cast<const float*>(tangents);
+    int32_t* dst = reinterpret_cast<int32_t*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float nx = LoadStrided(n + 3 * i, 3), ny = LoadStrided(n + 3 * i + 1, 3), nz = LoadStrided(n + 3 * i + 2, 3);
+        Float tx = LoadStrided(t + 4 * i, 4), ty = LoadStrided(t + 4 * i + 1, 4), tz = LoadStrided(t + 4 * i + 2, 4);
+        Float sign = SignNotZero(LoadStrided(t + 4 * i + 3, 4));
+
+        // Gram-Schmidt, with a perpendicular fallback where the tangent is parallel to the normal
+        Float nt = MulAdd(nx, tx, MulAdd(ny, ty, nz * tz));
+        tx = tx - nx * nt;
+        ty = ty - ny * nt;
+        tz = tz - nz * nt;
+        Float length2 = MulAdd(tx, tx, MulAdd(ty, ty, tz * tz));
+        Mask parallel = ~(length2 > Float(1e-8f));
+        if (Any(parallel))
+        {
+            Mask useX = Abs(nx) < Float(0.9f);
+            tx = Select(parallel, Select(useX, Float(0.0f), -nz), tx);
+            ty = Select(parallel, Select(useX, nz, Float(0.0f)), ty);
+            tz = Select(parallel, Select(useX, -ny, nx), tz);
+            length2 = MulAdd(tx, tx, MulAdd(ty, ty, tz * tz));
+        }
+
+        Float invLength = Float(1.0f) / Sqrt(length2);
+        tx = tx * invLength;
+        ty = ty * invLength;
+        tz = tz * invLength;
+
+        Float bx = ny * tz - nz * ty;
+        Float by = nz * tx - nx * tz;
+        Float bz = nx * ty - ny * tx;
+
+        // All four branches of the scalar matrix-to-quaternion conversion, selected per lane
+        Float trace = tx + by + nz;
+        Mask caseW = trace > Float(0.0f);
+        Mask caseX = ~caseW & (tx >= by) & (tx >= nz);
+        Mask caseY = ~caseW & ~caseX & (by >= nz);
+
+        Float diagonal = Select(caseW, trace, Select(caseX, tx - by - nz, Select(caseY, by - tx - nz, nz - tx - by)));
+        Float s = Sqrt(Float(1.0f) + diagonal) * Float(2.0f);
+        Float invS = Float(1.0f) / s;
+        Float quarter = Float(0.25f) * s;
+
+        Float a = (bz - ny) * invS;   // m21 - m12
+        Float b = (nx - tz) * invS;   // m02 - m20
+        Float c = (ty - bx) * invS;   // m10 - m01
+        Float xy = (bx + ty) * invS;  // m01 + m10
+        Float xz = (nx + tz) * invS;  // m02 + m20
+        Float yz = (ny + bz) * invS;  // m12 + m21
+
+        Float w = Select(caseW, quarter, Select(caseX, a, Select(caseY, b, c)));
+        Float x = Select(caseW, a, Select(caseX, quarter, Select(caseY, xy, xz)));
+        Float y = Select(caseW, b, Select(caseX, xy, Select(caseY, quarter, yz)));
+        Float z = Select(caseW, c, Select(caseX, xz, Select(caseY, yz, quarter)));
+
+        Float flip = SignNotZero(w) * sign;
+        w = Max(Abs(w), Float(1.0f / 32767.0f)) * sign;
+        StoreStrided(dst + 2 * i, 2, PackSnorm16(x * flip, y * flip));
+        StoreStrided(dst + 2 * i + 1, 2, PackSnorm16(z * flip, w));
+    }
+
+    Scalar::EncodeQTangentArray(normals + i, tangents + i, out + i, count - i);
+}
+
+inline void DecodeQTangentArray(const QTangent* in, Normal<float, 3>* normals, Vector<float, 4>* tangents, size_t count)
+{
+    const int32_t* src = reinterpret_cast<const int32_t*>(in);
+    float* n = reinterpret_cast<float*>(normals);
+    float* t = reinterpret_cast<float*>(tangents);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x, y, z, w;
+        UnpackSnorm16(LoadStrided(src + 2 * i, 2), x, y);
+        UnpackSnorm16(LoadStrided(src + 2 * i + 1, 2), z, w);
+        Float sign = SignNotZero(w);
+
+        Float invLength = Float(1.0f) / Sqrt(x * x + y * y + z * z + w * w);
+        x = x * invLength;
+        y = y * invLength;
+        z = z * invLength;
+        w = w * invLength;
+
+        StoreInterleaved4(t + 4 * i, Float(1.0f) - Float(2.0f) * (y * y + z * z), Float(2.0f) * (x * y + w * z),
+                          Float(2.0f) * (x * z - w * y), sign);
+        StoreInterleaved3(n + 3 * i, Float(2.0f) * (x * z + w * y), Float(2.0f) * (y * z - w * x), Float(1.0f) - Float(2.0f) * (x * x + y * y));
+    }
+
+    Scalar::DecodeQTangentArray(in + i, normals + i, tangents + i, count - i);
+}
+
+inline constexpr EncodingKernels EncodingTable = {
+    EncodeOct16Array, DecodeOct16Array, EncodeOct8Array, DecodeOct8Array,
+    EncodeSpheremapArray, DecodeSpheremapArray, EncodeQTangentArray, DecodeQTangentArray
+};
@@ -0,0 +1,236 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T>
+OrientedBox<T>::OrientedBox()
+    : m_Center(T(0))
+    , m_Axes{ Vector<T, 3>(1, 0, 0), Vector<T, 3>(0, 1, 0), Vector<T, 3>(0, 0, 1) }
+    , m_Extents(T(0))
+{
+}
+
+template<typename T>
+OrientedBox<T>::OrientedBox(const Point<T, 3>& center, const Quaternion<T>& rotation, const Vector<T, 3>& extents)
+    : m_Center(center)
+    , m_Axes{ rotation.Rotate(Vector<T, 3>(1, 0, 0)), rotation.Rotate(Vector<T, 3>(0, 1, 0)), rotation.Rotate(Vector<T, 3>(0, 0, 1)) }
+    , m_Extents(extents)
+{
+}
+
+template<typename T>
+OrientedBox<T>::OrientedBox(const Point<T, 3>& center, const Matrix<T, 3>& basis, const Vector<T, 3>& extents)
+    : m_Center(center)
+    , m_Extents(extents)
+{
+    for (int i = 0; i < 3; ++i)
+        m_Axes[i] = Vector<T, 3>(basis.m_Data2D[0][i], basis.m_Data2D[1][i], basis.m_Data2D[2][i]);
+}
+
+template<typename T>
+OrientedBox<T>::OrientedBox(const Box<T>& box)
+    : m_Center(box.m_Min + box.GetSize() * T(0.5))
+    , m_Axes{ Vector<T, 3>(1, 0, 0), Vector<T, 3>(0, 1, 0), Vector<T, 3>(0, 0, 1) }
+    , m_Extents(box.GetSize() * T(0.5))
+{
+}
+
+template<typename T>
+bool OrientedBox<T>::Contains(const Point<T, 3>& point) const
+{
+    Vector<T, 3> offset = point - m_Center;
+    for (int i = 0; i < 3; ++i)
+        if (std::abs(Vector<T, 3>::Dot(offset, m_Axes[i])) > m_Extents[i])
+            return false;
+
+    return true;
+}
+
+template<typename T>
+bool OrientedBox<T>::Intersects(const OrientedBox& box) const
+{
+    // Rotation and translation of box expressed in this box's frame. The epsilon keeps
+    // the edge-edge axes from reporting false separation when edges are near parallel.
+    const T epsilon = T(64) * std::numeric_limits<T>::epsilon();
+    T r[3][3], absR[3][3];
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+        {
+            r[i][j] = Vector<T, 3>::Dot(m_Axes[i], box.m_Axes[j]);
+            absR[i][j] = std::abs(r[i][j]) + epsilon;
+        }
+
+    Vector<T, 3> offset = box.m_Center - m_Center;
+    T t[3] = { Vector<T, 3>::Dot(offset, m_Axes[0]), Vector<T, 3>::Dot(offset, m_Axes[1]), Vector<T, 3>::Dot(offset, m_Axes[2]) };
+    const Vector<T, 3>& a = m_Extents;
+    const Vector<T, 3>& b = box.m_Extents;
+
+    // Face axes of this box
+    for (int i = 0; i < 3; ++i)
+        if (std::abs(t[i]) > a[i] + b[0] * absR[i][0] + b[1] * absR[i][1] + b[2] * absR[i][2])
+            return false;
+
+    // Face axes of the other box
+    for (int j = 0; j < 3; ++j)
+        if (std::abs(t[0] * r[0][j] + t[1] * r[1][j] + t[2] * r[2][j]) > a[0] * absR[0][j] + a[1] * absR[1][j] + a[2] * absR[2][j] + b[j])
+            return false;
+
+    // Cross products of one axis from each box
+    for (int i = 0; i < 3; ++i)
+    {
+        int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+        for (int j = 0; j < 3; ++j)
+        {
+            int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+            T ra = a[i1] * absR[i2][j] + a[i2] * absR[i1][j];
+            T rb = b[j1] * absR[i][j2] + b[j2] * absR[i][j1];
+            if (std::abs(t[i2] * r[i1][j] - t[i1] * r[i2][j]) > ra + rb)
+                return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename T>
+bool OrientedBox<T>::Intersects(const Ray<T>& ray, T& t) const
+{
+    // Slab test in the box's frame
+    Vector<T, 3> offset = ray.m_Origin - m_Center;
+    T tNear = -std::numeric_limits<T>::infinity();
+    T tFar = std::numeric_limits<T>::infinity();
+
+    for (int i = 0; i < 3; ++i)
+    {
+        T origin = Vector<T, 3>::Dot(offset, m_Axes[i]);
+        T direction = Vector<T, 3>::Dot(ray.m_Direction, m_Axes[i]);
+
+        if (direction == T(0))
+        {
+            if (std::abs(origin) > m_Extents[i])
+                return false;
+            continue;
+        }
+
+        T t0 = (-m_Extents[i] - origin) / direction;
+        T t1 = (m_Extents[i] - origin) / direction;
+        if (t0 > t1)
+            std::swap(t0, t1);
+
+        tNear = std::max(tNear, t0);
+        tFar = std::min(tFar, t1);
+        if (tNear > tFar)
+            return false;
+    }
+
+    if (tNear >= ray.m_TMin && tNear <= ray.m_TMax)
+        t = tNear;
+    else if (tFar >= ray.m_TMin && tFar <= ray.m_TMax)
+        t = tFar;
+    else
+        return false;
+
+    return true;
+}
+
+template<typename T>
+Box<T> OrientedBox<T>::GetBounds() const
+{
+    Vector<T, 3> reach;
+    for (int i = 0; i < 3; ++i)
+        reach[i] = std::abs(m_Axes[0][i]) * m_Extents[0] + std::abs(m_Axes[1][i]) * m_Extents[1] + std::abs(m_Axes[2][i]) * m_Extents[2];
+
+    return Box<T>(m_Center - reach, m_Center + reach);
+}
+
+template<typename T>
+OrientedBox<T> OrientedBox<T>::FitPca(std::span<const Point<T, 3>> points)
+{
+    assert(!points.empty());
+
+    // Moments relative to the first point, which keeps them small for far-off point sets
+    const Point<T, 3> origin = points[0];
+    double sums[9] = {};
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        std::array<double, 9> moments = Batch::Moments(points, origin);
+        std::copy(moments.begin(), moments.end(), sums);
+    }
+    else
+    {
+        for (const Point<T, 3>& p : points)
+        {
+            double d[3] = { double(p.x - origin.x), double(p.y - origin.y), double(p.z - origin.z) };
+            for (int i = 0, k = 3; i < 3; ++i)
+            {
+                sums[i] += d[i];
+                for (int j = i; j < 3; ++j)
+                    sums[k++] += d[i] * d[j];
+            }
+        }
+    }
+
+    double n = double(points.size());
+    double mean[3] = { sums[0] / n, sums[1] / n, sums[2] / n };
+    Matrix<double, 3> covariance;
+    for (int i = 0, k = 3; i < 3; ++i)
+        for (int j = i; j < 3; ++j, ++k)
+        {
+            covariance.m_Data2D[i][j] = sums[k] / n - mean[i] * mean[j];
+            covariance.m_Data2D[j][i] = covariance.m_Data2D[i][j];
+        }
+
+    SymmetricEigen<double, 3> eigen(covariance);
+
+    OrientedBox box;
+    for (int i = 0; i < 2; ++i)
+        box.m_Axes[i] = Vector<T, 3>(T(eigen.m_Eigenvectors.m_Data2D[0][i]), T(eigen.m_Eigenvectors.m_Data2D[1][i]), T(eigen.m_Eigenvectors.m_Data2D[2][i]));
+    box.m_Axes[2] = Vector<T, 3>::Cross(box.m_Axes[0], box.m_Axes[1]);
+
+    Vector<T, 3> min, max;
+    if constexpr (std::is_same_v<T, float>)
+    {
+        Batch::ProjectRange(points, origin, box.m_Axes, min, max);
+    }
+    else
+    {
+        min = Vector<T, 3>(std::numeric_limits<T>::infinity());
+        max = Vector<T, 3>(-std::numeric_limits<T>::infinity());
+        for (const Point<T, 3>& p : points)
+        {
+            Vector<T, 3> offset = p - origin;
+            for (int i = 0; i < 3; ++i)
+            {
+                T projection = Vector<T, 3>::Dot(offset, box.m_Axes[i]);
+                min[i] = std::min(min[i], projection);
+                max[i] = std::max(max[i], projection);
+            }
+        }
+    }
+
+    box.m_Center = origin;
+    for (int i = 0; i < 3; ++i)
+    {
+        box.m_Center = box.m_Center + box.m_Axes[i] * ((min[i] + max[i]) * T(0.5));
+        box.m_Extents[i] = (max[i] - min[i]) * T(0.5);
+    }
+
+    return box;
+}
@@ -0,0 +1,144 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <algorithm>
+#include "linalg.h"
+#include "dispatch.h"
+
+/**
+ * Dispatched passes over float Point arrays for fitting oriented boxes:
+ * the moments behind the PCA axes and the extents along those axes.
+ * orientedbox.h includes this; the kernels are kept out of batchops.h so
+ * that only users of OrientedBox compile them.
+ */
+namespace SMath::Simd
+{
+    static_assert(sizeof(Point<float, 3>) == 3 * sizeof(float), "Oriented box kernels walk Point arrays as packed floats");
+
+    struct OrientedBoxFitKernels
+    {
+        void (*Moments)(const Point<float, 3>* points, size_t count, const Point<float, 3>& origin, double* sums);
+        void (*ProjectRange)(const Point<float, 3>* points, size_t count, const Point<float, 3>& origin, const Vector<float, 3>* axes, float* min, float* max);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    // Adds the sums of d = p - origin and of its products: x, y, z, xx, xy, xz, yy, yz, zz
+    inline void MomentsArray(const Point<float, 3>* points, size_t count, const Point<float, 3>& origin, double* sums)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            double d[3] = { double(points[i].x - origin.x), double(points[i].y - origin.y), double(points[i].z - origin.z) };
+            sums[0] += d[0];
+            sums[1] += d[1];
+            sums[2] += d[2];
+            sums[3] += d[0] * d[0];
+            sums[4] += d[0] * d[1];
+            sums[5] += d[0] * d[2];
+            sums[6] += d[1] * d[1];
+            sums[7] += d[1] * d[2];
+            sums[8] += d[2] * d[2];
+        }
+    }
+
+    // Widens min[k] and max[k] to cover dot(p - origin, axes[k]) for k = 0, 1, 2
+    inline void ProjectRangeArray(const Point<float, 3>* points, size_t count, const Point<float, 3>& origin, const Vector<float, 3>* axes, float* min, float* max)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            float dx = points[i].x - origin.x;
+            float dy = points[i].y - origin.y;
+            float dz = points[i].z - origin.z;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                float projection = axes[k].x * dx + axes[k].y * dy + axes[k].z * dz;
+                min[k] = std::min(min[k], projection);
+                max[k] = std::max(max[k], projection);
+            }
+        }
+    }
+
+    inline constexpr OrientedBoxFitKernels OrientedBoxFitTable = { MomentsArray, ProjectRangeArray };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "orientedboxfit_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "orientedboxfit_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "orientedboxfit_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const OrientedBoxFitKernels& GetOrientedBoxFitKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::OrientedBoxFitTable, Sse2::OrientedBoxFitTable, Avx2::OrientedBoxFitTable, Avx512::OrientedBoxFitTable);
+#else
+        return Scalar::OrientedBoxFitTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    // Sums of d = p - origin and of its products (x, y, z, xx, xy, xz, yy, yz, zz), for
+    // means and covariances. Choosing origin near the points keeps the float terms accurate.
+    inline std::array<double, 9> Moments(std::span<const Point<float, 3>> points, const Point<float, 3>& origin)
+    {
+        std::array<double, 9> sums = {};
+        Simd::GetOrientedBoxFitKernels().Moments(points.data(), points.size(), origin, sums.data());
+        return sums;
+    }
+
+    // Range of dot(p - origin, axes[k]) over the points, for each of the three axes
+    inline void ProjectRange(std::span<const Point<float, 3>> points, const Point<float, 3>& origin, const Vector<float, 3>* axes,
+                             Vector<float, 3>& min, Vector<float, 3>& max)
+    {
+        const float inf = std::numeric_limits<float>::infinity();
+        float lo[3] = { inf, inf, inf };
+        float hi[3] = { -inf, -inf, -inf };
+        Simd::GetOrientedBoxFitKernels().ProjectRange(points.data(), points.size(), origin, axes, lo, hi);
+        min = Vector<float, 3>(lo[0], lo[1], lo[2]);
+        max = Vector<float, 3>(hi[0], hi[1], hi[2]);
+    }
+}
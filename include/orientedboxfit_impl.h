@@ -0,0 +1,116 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Oriented box fitting loops included once per ISA namespace. Points are
+ * read with strided loads, one point per lane.
+ */
+
+inline void MomentsArray(const Point<float, 3>* points, size_t count, const Point<float, 3>& origin, double* sums)
+{
+    const float* src = reinterpret_cast<const float*>(points);
+    Float ox(origin.x), oy(origin.y), oz(origin.z);
+
+    // Float lane sums are flushed to double every BlockSize points per lane, so
+    // their rounding error stays bounded however many points there are
+    constexpr size_t BlockSize = 256;
+
+    size_t i = 0;
+    while (i + Width <= count)
+    {
+        Float acc[9];
+        for (int k = 0; k < 9; ++k)
+            acc[k] = Float(0.0f);
+
+        size_t end = std::min(count - count % Width, i + BlockSize * Width);
+        for (; i < end; i += Width)
+        {
+            Float x = LoadStrided(src + 3 * i, 3) - ox;
+            Float y = LoadStrided(src + 3 * i + 1, 3) - oy;
+            Float z = LoadStrided(src + 3 * i + 2, 3) - oz;
+
+            acc[0] = acc[0] + x;
+            acc[1] = acc[1] + y;
+            acc[2] = acc[2] + z;
+            acc[3] = MulAdd(x, x, acc[3]);
+            acc[4] = MulAdd(x, y, acc[4]);
+            acc[5] = MulAdd(x, z, acc[5]);
+            acc[6] = MulAdd(y, y, acc[6]);
+            acc[7] = MulAdd(y, z, acc[7]);
+            acc[8] = MulAdd(z, z, acc[8]);
+        }
+
+        float lanes[Width];
+        for (int k = 0; k < 9; ++k)
+        {
+            Store(lanes, acc[k]);
+            for (int lane = 0; lane < Width; ++lane)
+                sums[k] += double(lanes[lane]);
+        }
+    }
+
+    Scalar::MomentsArray(points + i, count - i, origin, sums);
+}
+
+inline void ProjectRangeArray(const Point<float, 3>* points, size_t count, const Point<float, 3>& origin, const Vector<float, 3>* axes, float* min, float* max)
+{
+    const float* src = reinterpret_cast<const float*>(points);
+    Float ox(origin.x), oy(origin.y), oz(origin.z);
+
+    Float axis[3][3], lo[3], hi[3];
+    for (int k = 0; k < 3; ++k)
+    {
+        for (int c = 0; c < 3; ++c)
+            axis[k][c] = Float(axes[k][c]);
+        lo[k] = Float(min[k]);
+        hi[k] = Float(max[k]);
+    }
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x = LoadStrided(src + 3 * i, 3) - ox;
+        Float y = LoadStrided(src + 3 * i + 1, 3) - oy;
+        Float z = LoadStrided(src + 3 * i + 2, 3) - oz;
+
+        for (int k = 0; k < 3; ++k)
+        {
+            Float projection = MulAdd(axis[k][0], x, MulAdd(axis[k][1], y, axis[k][2] * z));
+            lo[k] = Min(lo[k], projection);
+            hi[k] = Max(hi[k], projection);
+        }
+    }
+
+    float lanes[Width];
+    for (int k = 0; k < 3; ++k)
+    {
+        Store(lanes, lo[k]);
+        for (int lane = 0; lane < Width; ++lane)
+            min[k] = std::min(min[k], lanes[lane]);
+
+        Store(lanes, hi[k]);
+        for (int lane = 0; lane < Width; ++lane)
+            max[k] = std::max(max[k], lanes[lane]);
+    }
+
+    Scalar::ProjectRangeArray(points + i, count - i, origin, axes, min, max);
+}
+
+inline constexpr OrientedBoxFitKernels OrientedBoxFitTable = { MomentsArray, ProjectRangeArray };
@@ -0,0 +1,61 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+namespace SMath::Simd
+{
+    // Arrays shorter than this per thread are not worth a thread start-up
+    inline constexpr size_t MinParallelChunk = size_t(1) << 18;
+
+    // threadCount <= 0 picks one thread per MinParallelChunk elements, up to the hardware concurrency
+    inline int GetThreadCount(size_t count, int threadCount)
+    {
+        if (threadCount > 0)
+            return int(std::clamp<size_t>(count, 1, size_t(threadCount)));
+
+        size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        return int(std::clamp<size_t>(count / MinParallelChunk, 1, hardware));
+    }
+
+    // Calls func(begin, end, slice) on threadCount contiguous slices of [0, count),
+    // slice 0 on the calling thread
+    template <typename Func>
+    inline void ParallelSlices(size_t count, int threadCount, Func func)
+    {
+        size_t slice = (count + threadCount - 1) / threadCount;
+
+        std::vector<std::thread> threads;
+        for (int t = 1; t < threadCount; ++t)
+        {
+            size_t begin = std::min(count, t * slice);
+            threads.emplace_back(func, begin, std::min(count, begin + slice), t);
+        }
+
+        func(size_t(0), std::min(count, slice), 0);
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+}
@@ -27,7 +27,7 @@ namespace SMath
     template<typename T, int N>
     class Point : public VectorData<T, N>
     {
-        static_assert(std::is_arithmetic_v<T>, "Point only works with arithmetic types");
+        static_assert(ScalarTraits<T>::IsScalar, "Point only works with arithmetic types, Half and BFloat16");
 
     public:
         Point(T v = 0.0);
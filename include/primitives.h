@@ -0,0 +1,122 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include "linalg.h"
+#include "ray.h"
+#include "curve.h"
+
+namespace SMath
+{
+    /**
+     * Analytic primitives for ray tracing besides triangles and spheres
+     * (Sphere). Every primitive has the same three ray routines:
+     * Intersects for the distance only, Intersect for a full RayHit, and
+     * CompleteHit to fill the rest of a hit once m_T is known, which the
+     * batch kernels in batchintersection.h use for the closest one.
+     * Hits are accepted within [m_TMin, m_TMax].
+     */
+
+    // Points p with Dot(m_Normal, p) = m_Distance
+    template<typename T>
+    class Plane
+    {
+    public:
+        Plane() = default;
+        // normal need not be unit length
+        Plane(const Vector<T, 3>& normal, T distance);
+        Plane(const Vector<T, 3>& normal, const Point<T, 3>& point);
+        ~Plane() = default;
+
+    public:
+        T GetSignedDistance(const Point<T, 3>& point) const;
+
+        bool Intersects(const Ray<T>& ray, T& t) const;
+        // (u, v) are zero
+        bool Intersect(const Ray<T>& ray, RayHit<T>& hit) const;
+        void CompleteHit(const Ray<T>& ray, RayHit<T>& hit) const;
+
+    public:
+        Vector<T, 3> m_Normal = Vector<T, 3>(T(0), T(0), T(1));
+        T m_Distance = T(0);
+    };
+
+    template<typename T>
+    class Disk
+    {
+    public:
+        Disk() = default;
+        Disk(const Point<T, 3>& center, const Vector<T, 3>& normal, T radius);
+        ~Disk() = default;
+
+    public:
+        bool Intersects(const Ray<T>& ray, T& t) const;
+        // u is the distance from the center over the radius, v is zero
+        bool Intersect(const Ray<T>& ray, RayHit<T>& hit) const;
+        void CompleteHit(const Ray<T>& ray, RayHit<T>& hit) const;
+
+    public:
+        Point<T, 3> m_Center;
+        Vector<T, 3> m_Normal = Vector<T, 3>(T(0), T(0), T(1));
+        T m_Radius = T(0);
+    };
+
+    /**
+     * Flat ribbon along a cubic Bezier that always faces the ray, with the
+     * width interpolated linearly from m_Width[0] to m_Width[1], as used
+     * for hair and fur. The curve is projected into a frame looking down
+     * the ray and split into m_SegmentCount line segments, enough for the
+     * chords to stay within 5% of the width of the curve (pbrt's
+     * flatness bound); a hit is a segment passing within half the width.
+     */
+    template<typename T>
+    class RibbonCurve
+    {
+    public:
+        static constexpr int MaxDepth = 5;
+
+    public:
+        RibbonCurve() = default;
+        RibbonCurve(const CubicBezier<T>& curve, T width0, T width1);
+        ~RibbonCurve() = default;
+
+    public:
+        bool Intersects(const Ray<T>& ray, T& t) const;
+        // u is the curve parameter, v runs from 0 to 1 across the width
+        bool Intersect(const Ray<T>& ray, RayHit<T>& hit) const;
+        // The normal faces the ray; m_U and m_V are set by the intersection
+        void CompleteHit(const Ray<T>& ray, RayHit<T>& hit) const;
+
+    public:
+        // Orthonormal x and y completing the unit z (Duff et al. 2017)
+        static void GetBasis(const Vector<T, 3>& z, Vector<T, 3>& x, Vector<T, 3>& y);
+
+    public:
+        CubicBezier<T> m_Curve;
+        T m_Width[2] = { T(0), T(0) };
+        uint32_t m_SegmentCount = 1;
+    };
+
+    #include "primitives_impl.h"
+}
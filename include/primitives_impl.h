@@ -0,0 +1,235 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T>
+Plane<T>::Plane(const Vector<T, 3>& normal, T distance)
+{
+    T length = normal.Magnitude();
+    m_Normal = normal * (T(1) / length);
+    m_Distance = distance / length;
+}
+
+template<typename T>
+Plane<T>::Plane(const Vector<T, 3>& normal, const Point<T, 3>& point)
+    : m_Normal(normal.Normalized())
+    , m_Distance(Vector<T, 3>::Dot(m_Normal, Vector<T, 3>(point)))
+{
+}
+
+template<typename T>
+T Plane<T>::GetSignedDistance(const Point<T, 3>& point) const
+{
+    return Vector<T, 3>::Dot(m_Normal, Vector<T, 3>(point)) - m_Distance;
+}
+
+template<typename T>
+bool Plane<T>::Intersects(const Ray<T>& ray, T& t) const
+{
+    T cosine = Vector<T, 3>::Dot(m_Normal, ray.m_Direction);
+    if (cosine == T(0))
+        return false;
+
+    T distance = -GetSignedDistance(ray.m_Origin) / cosine;
+    if (!(distance >= ray.m_TMin && distance <= ray.m_TMax))
+        return false;
+
+    t = distance;
+    return true;
+}
+
+template<typename T>
+bool Plane<T>::Intersect(const Ray<T>& ray, RayHit<T>& hit) const
+{
+    T t;
+    if (!Intersects(ray, t))
+        return false;
+
+    hit.m_T = t;
+    CompleteHit(ray, hit);
+    return true;
+}
+
+template<typename T>
+void Plane<T>::CompleteHit(const Ray<T>&, RayHit<T>& hit) const
+{
+    hit.m_Normal = m_Normal;
+    hit.m_U = T(0);
+    hit.m_V = T(0);
+}
+
+template<typename T>
+Disk<T>::Disk(const Point<T, 3>& center, const Vector<T, 3>& normal, T radius)
+    : m_Center(center)
+    , m_Normal(normal.Normalized())
+    , m_Radius(radius)
+{
+}
+
+template<typename T>
+bool Disk<T>::Intersects(const Ray<T>& ray, T& t) const
+{
+    T cosine = Vector<T, 3>::Dot(m_Normal, ray.m_Direction);
+    if (cosine == T(0))
+        return false;
+
+    Vector<T, 3> oc = ray.m_Origin - m_Center;
+    T distance = -Vector<T, 3>::Dot(m_Normal, oc) / cosine;
+    if (!(distance >= ray.m_TMin && distance <= ray.m_TMax))
+        return false;
+
+    Vector<T, 3> offset = oc + ray.m_Direction * distance;
+    if (Vector<T, 3>::Dot(offset, offset) > m_Radius * m_Radius)
+        return false;
+
+    t = distance;
+    return true;
+}
+
+template<typename T>
+bool Disk<T>::Intersect(const Ray<T>& ray, RayHit<T>& hit) const
+{
+    T t;
+    if (!Intersects(ray, t))
+        return false;
+
+    hit.m_T = t;
+    CompleteHit(ray, hit);
+    return true;
+}
+
+template<typename T>
+void Disk<T>::CompleteHit(const Ray<T>& ray, RayHit<T>& hit) const
+{
+    Vector<T, 3> offset = (ray.m_Origin - m_Center) + ray.m_Direction * hit.m_T;
+    hit.m_Normal = m_Normal;
+    hit.m_U = m_Radius > T(0) ? std::min(offset.Magnitude() / m_Radius, T(1)) : T(0);
+    hit.m_V = T(0);
+}
+
+template<typename T>
+RibbonCurve<T>::RibbonCurve(const CubicBezier<T>& curve, T width0, T width1)
+    : m_Curve(curve)
+    , m_Width{ width0, width1 }
+{
+    // Chords of 2^depth segments stay within eps of a cubic whose second differences are at most l0.
+    // The 3D differences bound those of any projection.
+    T l0 = T(0);
+    for (int i = 0; i < 2; ++i)
+        l0 = std::max(l0, ((curve.m_Points[i + 2] - curve.m_Points[i + 1]) - (curve.m_Points[i + 1] - curve.m_Points[i])).Magnitude());
+
+    T eps = std::max(width0, width1) * T(0.05);
+    int depth = 0;
+    if (l0 > T(0) && eps > T(0))
+        depth = std::clamp(int(std::ceil(std::log2(T(Sqrt2) * T(6) * l0 / (T(8) * eps)) * T(0.5))), 0, MaxDepth);
+    m_SegmentCount = 1u << depth;
+}
+
+template<typename T>
+void RibbonCurve<T>::GetBasis(const Vector<T, 3>& z, Vector<T, 3>& x, Vector<T, 3>& y)
+{
+    T sign = std::copysign(T(1), z.z);
+    T a = T(-1) / (sign + z.z);
+    T b = z.x * z.y * a;
+    x = Vector<T, 3>(T(1) + sign * z.x * z.x * a, sign * b, -sign * z.x);
+    y = Vector<T, 3>(b, sign + z.y * z.y * a, -z.y);
+}
+
+template<typename T>
+bool RibbonCurve<T>::Intersect(const Ray<T>& ray, RayHit<T>& hit) const
+{
+    // Ray frame: the ray starts at the origin and runs down z, so the distance to the curve is in xy
+    T length = ray.m_Direction.Magnitude();
+    Vector<T, 3> z = ray.m_Direction * (T(1) / length);
+    Vector<T, 3> x, y;
+    GetBasis(z, x, y);
+
+    CubicBezier<T> curve;
+    for (int i = 0; i < 4; ++i)
+    {
+        Vector<T, 3> offset = m_Curve.m_Points[i] - ray.m_Origin;
+        curve.m_Points[i] = Point<T, 3>(Vector<T, 3>::Dot(offset, x), Vector<T, 3>::Dot(offset, y), Vector<T, 3>::Dot(offset, z));
+    }
+
+    // The curve lies in the hull of its control points; widen that by half the width
+    T halfWidth = std::max(m_Width[0], m_Width[1]) * T(0.5);
+    Box<T> bounds = Box<T>::Empty();
+    for (const Point<T, 3>& point : curve.m_Points)
+        bounds.Expand(point);
+    if (bounds.m_Min.x > halfWidth || bounds.m_Max.x < -halfWidth || bounds.m_Min.y > halfWidth || bounds.m_Max.y < -halfWidth ||
+        bounds.m_Max.z < ray.m_TMin * length || bounds.m_Min.z > ray.m_TMax * length)
+        return false;
+
+    T bestT = ray.m_TMax;
+    T bestU = T(0), bestV = T(0);
+    bool found = false;
+    T step = T(1) / T(m_SegmentCount);
+    Point<T, 3> a = curve.m_Points[0];
+    for (uint32_t k = 0; k < m_SegmentCount; ++k)
+    {
+        Point<T, 3> b = k + 1 == m_SegmentCount ? curve.m_Points[3] : curve.Evaluate(T(k + 1) * step);
+
+        // Closest point of the segment to the ray in xy
+        T dx = b.x - a.x, dy = b.y - a.y;
+        T squareLength = dx * dx + dy * dy;
+        T s = squareLength > T(0) ? std::clamp(-(a.x * dx + a.y * dy) / squareLength, T(0), T(1)) : T(0);
+        T cx = a.x + dx * s, cy = a.y + dy * s;
+        T squareDistance = cx * cx + cy * cy;
+
+        T u = (T(k) + s) * step;
+        T width = m_Width[0] + (m_Width[1] - m_Width[0]) * u;
+        T t = (a.z + (b.z - a.z) * s) / length;
+        if (squareDistance <= width * width * T(0.25) && t >= ray.m_TMin && t <= bestT)
+        {
+            // Which side of the segment the ray passes on, as the sign of the 2D cross product
+            T side = dx * cy - dy * cx < T(0) ? T(-1) : T(1);
+            bestT = t;
+            bestU = u;
+            bestV = T(0.5) + side * std::sqrt(squareDistance) / width;
+            found = true;
+        }
+        a = b;
+    }
+
+    if (!found)
+        return false;
+
+    hit.m_T = bestT;
+    hit.m_U = bestU;
+    hit.m_V = bestV;
+    CompleteHit(ray, hit);
+    return true;
+}
+
+template<typename T>
+bool RibbonCurve<T>::Intersects(const Ray<T>& ray, T& t) const
+{
+    RayHit<T> hit;
+    if (!Intersect(ray, hit))
+        return false;
+
+    t = hit.m_T;
+    return true;
+}
+
+template<typename T>
+void RibbonCurve<T>::CompleteHit(const Ray<T>& ray, RayHit<T>& hit) const
+{
+    hit.m_Normal = -ray.m_Direction.Normalized();
+}
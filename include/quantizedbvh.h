@@ -0,0 +1,104 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <concepts>
+#include "linalg.h"
+#include "box.h"
+#include "ray.h"
+#include "widebvh.h"
+
+namespace SMath
+{
+    // Four-wide hierarchy that can be read node by node, such as WideBvh. Children are
+    // node indices, WideBvh leaf handles or WideBvh::InvalidChild.
+    template<typename H>
+    concept WideHierarchy = requires(const H& h, size_t node, int slot)
+    {
+        { h.GetNodeCount() } -> std::convertible_to<size_t>;
+        { h.GetChild(node, slot) } -> std::convertible_to<uint32_t>;
+        { h.GetChildBounds(node, slot) } -> std::convertible_to<Box<float>>;
+        { h.GetPrimitives() } -> std::convertible_to<std::span<const uint32_t>>;
+    };
+
+    /**
+     * Four-wide BVH with child bounds stored as 8-bit offsets from the union of
+     * the children. The step on each axis is a power of two, so q * step is
+     * exact; adding the origin rounds, and the stored bounds are rounded
+     * outwards so that origin + q * step still encloses the source bounds.
+     * Nodes are half the size of WideBvh's; traversal visits a few more boxes
+     * and gives the same hits.
+     */
+    class QuantizedBvh
+    {
+    public:
+        static constexpr int Width = WideBvh::Width;
+
+        struct Node
+        {
+            float m_Origin[3];
+            // Step on each axis is 2^m_Exponent
+            int8_t m_Exponent[3];
+            uint8_t m_Padding;
+            uint8_t m_Min[3][Width];
+            uint8_t m_Max[3][Width];
+            uint32_t m_Children[Width];
+        };
+
+    public:
+        QuantizedBvh() = default;
+        // Keeps the node indices and leaf ranges of hierarchy
+        template<typename H> requires WideHierarchy<H>
+        QuantizedBvh(const H& hierarchy);
+        ~QuantizedBvh() = default;
+
+    public:
+        // Same contract as WideBvh::Intersect
+        bool Intersect(const Ray<float>& ray, std::span<const Box<float>> primitives, float& t, uint32_t& primitive) const;
+
+        size_t GetNodeCount() const;
+        uint32_t GetChild(size_t node, int slot) const;
+        // Dequantized, conservative bounds
+        Box<float> GetChildBounds(size_t node, int slot) const;
+        std::span<const uint32_t> GetPrimitives() const;
+        size_t GetMemoryFootprint() const;
+
+    public:
+        static Node Quantize(const Box<float> (&children)[Width], const uint32_t (&handles)[Width]);
+
+        static void Dequantize(const Node& node, float (&min)[3][Width], float (&max)[3][Width]);
+
+        // WideBvh::IntersectChildren on the dequantized bounds, which stay in registers on x86
+        static int IntersectChildren(const Node& node, const WideBvh::RayData& ray, float tMax, float (&tNear)[Width]);
+
+    public:
+        std::vector<Node> m_Nodes;
+        std::vector<uint32_t> m_Primitives;
+    };
+
+    #include "quantizedbvh_impl.h"
+}
@@ -0,0 +1,189 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename H> requires WideHierarchy<H>
+QuantizedBvh::QuantizedBvh(const H& hierarchy)
+{
+    m_Nodes.resize(hierarchy.GetNodeCount());
+    for (size_t node = 0; node < m_Nodes.size(); ++node)
+    {
+        Box<float> children[Width];
+        uint32_t handles[Width];
+        for (int slot = 0; slot < Width; ++slot)
+        {
+            handles[slot] = hierarchy.GetChild(node, slot);
+            children[slot] = hierarchy.GetChildBounds(node, slot);
+        }
+        m_Nodes[node] = Quantize(children, handles);
+    }
+
+    std::span<const uint32_t> primitives = hierarchy.GetPrimitives();
+    m_Primitives.assign(primitives.begin(), primitives.end());
+}
+
+inline bool QuantizedBvh::Intersect(const Ray<float>& ray, std::span<const Box<float>> primitives, float& t, uint32_t& primitive) const
+{
+    return WideBvh::Traverse(std::span<const Node>(m_Nodes), std::span<const uint32_t>(m_Primitives), ray, primitives,
+        [](const Node& node, const WideBvh::RayData& data, float tMax, float (&tNear)[Width]) {
+            return IntersectChildren(node, data, tMax, tNear);
+        }, t, primitive);
+}
+
+inline size_t QuantizedBvh::GetNodeCount() const
+{
+    return m_Nodes.size();
+}
+
+inline uint32_t QuantizedBvh::GetChild(size_t node, int slot) const
+{
+    return m_Nodes[node].m_Children[slot];
+}
+
+inline Box<float> QuantizedBvh::GetChildBounds(size_t node, int slot) const
+{
+    float min[3][Width], max[3][Width];
+    Dequantize(m_Nodes[node], min, max);
+    return Box<float>(Point<float, 3>(min[0][slot], min[1][slot], min[2][slot]),
+                      Point<float, 3>(max[0][slot], max[1][slot], max[2][slot]));
+}
+
+inline std::span<const uint32_t> QuantizedBvh::GetPrimitives() const
+{
+    return m_Primitives;
+}
+
+inline size_t QuantizedBvh::GetMemoryFootprint() const
+{
+    return m_Nodes.size() * sizeof(Node) + m_Primitives.size() * sizeof(uint32_t);
+}
+
+inline QuantizedBvh::Node QuantizedBvh::Quantize(const Box<float> (&children)[Width], const uint32_t (&handles)[Width])
+{
+    Box<float> parent = Box<float>::Empty();
+    for (int slot = 0; slot < Width; ++slot)
+        if (handles[slot] != WideBvh::InvalidChild)
+            parent.Expand(children[slot]);
+
+    Node node = {};
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float origin = parent.IsEmpty() ? 0.0f : parent.m_Min[axis];
+        float extent = parent.IsEmpty() ? 0.0f : parent.m_Max[axis] - origin;
+
+        // Smallest power of two step with 255 steps covering the parent, checked with the
+        // rounded sum. Any step is exact for a flat axis, and tiny extents use the smallest
+        // normal step.
+        int exponent = 0;
+        if (extent > 0.0f)
+        {
+            std::frexp(extent / 255.0f, &exponent);
+            exponent = std::clamp(exponent, -126, 127);
+            while (exponent < 127 && origin + 255.0f * std::ldexp(1.0f, exponent) < parent.m_Max[axis])
+                ++exponent;
+        }
+        float step = std::ldexp(1.0f, exponent);
+
+        node.m_Origin[axis] = origin;
+        node.m_Exponent[axis] = int8_t(exponent);
+
+        for (int slot = 0; slot < Width; ++slot)
+        {
+            if (handles[slot] == WideBvh::InvalidChild)
+            {
+                // Traversal skips the slot by its handle
+                node.m_Min[axis][slot] = 0;
+                node.m_Max[axis][slot] = 0;
+                continue;
+            }
+
+            // Round outwards, then correct with the expression used to dequantize. q = 0 gives
+            // origin itself and q = 255 at least the parent's max, so the result is conservative.
+            float lo = children[slot].m_Min[axis];
+            float hi = children[slot].m_Max[axis];
+            int qMin = int(std::clamp(std::floor((lo - origin) / step), 0.0f, 255.0f));
+            int qMax = int(std::clamp(std::ceil((hi - origin) / step), 0.0f, 255.0f));
+            while (qMin > 0 && origin + float(qMin) * step > lo)
+                --qMin;
+            while (qMax < 255 && origin + float(qMax) * step < hi)
+                ++qMax;
+
+            node.m_Min[axis][slot] = uint8_t(qMin);
+            node.m_Max[axis][slot] = uint8_t(qMax);
+        }
+    }
+
+    for (int slot = 0; slot < Width; ++slot)
+        node.m_Children[slot] = handles[slot];
+    return node;
+}
+
+inline void QuantizedBvh::Dequantize(const Node& node, float (&min)[3][Width], float (&max)[3][Width])
+{
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float step = Simd::Scalar::Pow2(int32_t(node.m_Exponent[axis]));
+        for (int slot = 0; slot < Width; ++slot)
+        {
+            min[axis][slot] = node.m_Origin[axis] + float(node.m_Min[axis][slot]) * step;
+            max[axis][slot] = node.m_Origin[axis] + float(node.m_Max[axis][slot]) * step;
+        }
+    }
+}
+
+inline int QuantizedBvh::IntersectChildren(const Node& node, const WideBvh::RayData& ray, float tMax, float (&tNear)[Width])
+{
+#if defined(SMATH_X86)
+    using namespace Simd::Sse2;
+
+    // Widens the four bytes of one axis to float lanes
+    auto widen = [](const uint8_t (&bytes)[Width]) {
+        int32_t packed;
+        std::memcpy(&packed, bytes, sizeof(packed));
+        __m128i zero = _mm_setzero_si128();
+        __m128i lanes = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(packed), zero), zero);
+        return ToFloat(Int(lanes));
+    };
+
+    Float tEnter = ray.m_TMin;
+    Float tExit = tMax;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        // q * step is exact, so these match Dequantize bit for bit
+        Float step = Simd::Scalar::Pow2(int32_t(node.m_Exponent[axis]));
+        Float origin = node.m_Origin[axis];
+        Float min = widen(node.m_Min[axis]) * step + origin;
+        Float max = widen(node.m_Max[axis]) * step + origin;
+
+        Float rayOrigin = ray.m_Origin[axis];
+        Float invDirection = ray.m_InvDirection[axis];
+        Float t0 = (min - rayOrigin) * invDirection;
+        Float t1 = (max - rayOrigin) * invDirection;
+        tEnter = Max(Min(t0, t1), tEnter);
+        tExit = Min(Max(t0, t1), tExit);
+    }
+
+    Store(tNear, tEnter);
+    return Bits(tEnter <= tExit);
+#else
+    float min[3][Width], max[3][Width];
+    Dequantize(node, min, max);
+    return WideBvh::IntersectChildren(min, max, ray, tMax, tNear);
+#endif
+}
@@ -82,6 +82,7 @@ namespace SMath
         static T Dot(const Quaternion& a, const Quaternion& b);
         static Quaternion Slerp(const Quaternion& a, const Quaternion& b, T t);
         static Quaternion Lerp(const Quaternion& a, const Quaternion& b, T t);
+        static Quaternion Nlerp(const Quaternion& a, const Quaternion& b, T t);
     };
 
     #include "quaternion_impl.h" 
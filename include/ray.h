@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <limits>
 #include "linalg.h"
 
 namespace SMath
@@ -49,5 +50,17 @@ namespace SMath
         T m_TMax;
     };
 
+    // Closest-hit record filled by the primitive intersection routines
+    template <typename T>
+    struct RayHit
+    {
+        T m_T = std::numeric_limits<T>::max();
+        // Unit geometric normal, not flipped toward the ray
+        Vector<T, 3> m_Normal;
+        // Surface parameters, as documented by each primitive
+        T m_U = T(0);
+        T m_V = T(0);
+    };
+
     #include "ray_impl.h"
 }
@@ -18,17 +18,41 @@
 
 #pragma once
 
+#include <algorithm>
+
 namespace SMath
 {
+    /**
+     * Axis-aligned rectangle covering [x, x + w) by [y, y + h). A rectangle
+     * with zero or negative width or height is empty.
+     */
     template<typename T>
     class Rect
     {
     public:
+        Rect();
         Rect(T x, T y, T w, T h);
         ~Rect() = default;
 
     public:
         bool Contains(T x, T y) const;
+        bool Contains(const Rect& rect) const;
+        bool Overlaps(const Rect& rect) const;
+        bool IsEmpty() const;
+        T GetArea() const;
+
+        // Cuts at x = position (axis 0) or y = position (axis 1), clamped to the rectangle.
+        // first gets the part below position, second the rest; either may be empty.
+        void Split(int axis, T position, Rect& first, Rect& second) const;
+
+        bool operator==(const Rect& rect) const;
+        bool operator!=(const Rect& rect) const;
+
+    public:
+        // Smallest rectangle containing both, ignoring empty ones
+        static Rect Union(const Rect& a, const Rect& b);
+        // Empty, with zero size, when they do not overlap
+        static Rect Intersection(const Rect& a, const Rect& b);
 
     public:
         T x, y;
@@ -16,6 +16,12 @@
     along with this program. If not, see <http://www.gnu.org/licenses/>.
 */
 
+template<typename T>
+Rect<T>::Rect()
+    : x(0), y(0), w(0), h(0)
+{
+}
+
 template<typename T>
 Rect<T>::Rect(T x, T y, T w, T h)
 {
@@ -31,3 +37,87 @@ bool Rect<T>::Contains(T x, T y) const
     return x >= this->x && x < (this->x + this->w) &&
         y >= this->y && y < (this->y + this->h);
 }
+
+template<typename T>
+bool Rect<T>::Contains(const Rect& rect) const
+{
+    return rect.IsEmpty() || (rect.x >= x && rect.y >= y && rect.x + rect.w <= x + w && rect.y + rect.h <= y + h);
+}
+
+template<typename T>
+bool Rect<T>::Overlaps(const Rect& rect) const
+{
+    return !IsEmpty() && !rect.IsEmpty() &&
+        rect.x < x + w && x < rect.x + rect.w &&
+        rect.y < y + h && y < rect.y + rect.h;
+}
+
+template<typename T>
+bool Rect<T>::IsEmpty() const
+{
+    return !(w > T(0) && h > T(0));
+}
+
+template<typename T>
+T Rect<T>::GetArea() const
+{
+    return IsEmpty() ? T(0) : w * h;
+}
+
+template<typename T>
+void Rect<T>::Split(int axis, T position, Rect& first, Rect& second) const
+{
+    first = *this;
+    second = *this;
+    if (axis == 0)
+    {
+        T cut = std::clamp(position, x, std::max(x, x + w));
+        first.w = cut - x;
+        second.x = cut;
+        second.w = x + w - cut;
+    }
+    else
+    {
+        T cut = std::clamp(position, y, std::max(y, y + h));
+        first.h = cut - y;
+        second.y = cut;
+        second.h = y + h - cut;
+    }
+}
+
+template<typename T>
+bool Rect<T>::operator==(const Rect& rect) const
+{
+    return x == rect.x && y == rect.y && w == rect.w && h == rect.h;
+}
+
+template<typename T>
+bool Rect<T>::operator!=(const Rect& rect) const
+{
+    return !(*this == rect);
+}
+
+template<typename T>
+Rect<T> Rect<T>::Union(const Rect& a, const Rect& b)
+{
+    if (a.IsEmpty())
+        return b;
+    if (b.IsEmpty())
+        return a;
+
+    T x0 = std::min(a.x, b.x);
+    T y0 = std::min(a.y, b.y);
+    return Rect(x0, y0, std::max(a.x + a.w, b.x + b.w) - x0, std::max(a.y + a.h, b.y + b.h) - y0);
+}
+
+template<typename T>
+Rect<T> Rect<T>::Intersection(const Rect& a, const Rect& b)
+{
+    T x0 = std::max(a.x, b.x);
+    T y0 = std::max(a.y, b.y);
+    T x1 = std::min(a.x + a.w, b.x + b.w);
+    T y1 = std::min(a.y + a.h, b.y + b.h);
+    if (!(x1 > x0 && y1 > y0))
+        return Rect(x0, y0, T(0), T(0));
+    return Rect(x0, y0, x1 - x0, y1 - y0);
+}
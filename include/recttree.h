@@ -0,0 +1,238 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <bit>
+#include <span>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+#include "rect.h"
+#include "simd.h"
+
+namespace SMath
+{
+    /**
+     * Bounds of Width rectangles in structure-of-arrays form, half-open like
+     * Rect, so one query is tested against all of them at once. Cleared
+     * slots hold inverted bounds that no query overlaps or contains, which
+     * is also how empty rectangles are stored.
+     */
+    template<typename T, int Width>
+    struct RectLanes
+    {
+        static_assert(Width % 4 == 0, "RectLanes are tested four at a time");
+
+        void Clear();
+        void Clear(int slot);
+        void Set(int slot, const Rect<T>& rect);
+        // Empty for cleared slots
+        Rect<T> Get(int slot) const;
+
+        // Copy slot from of lanes, or the union of its first count slots. Unlike a round trip
+        // through Rect these are exact, since x + w can round away from the stored maximum.
+        template<int OtherWidth>
+        void Set(int slot, const RectLanes<T, OtherWidth>& lanes, int from);
+        template<int OtherWidth>
+        void SetUnion(int slot, const RectLanes<T, OtherWidth>& lanes, int count);
+
+        // A bit per slot overlapping rect, or containing (x, y)
+        int Overlapping(const Rect<T>& rect) const;
+        int Containing(T x, T y) const;
+
+        T m_MinX[Width];
+        T m_MinY[Width];
+        T m_MaxX[Width];
+        T m_MaxY[Width];
+    };
+
+    /**
+     * Two-dimensional R-tree over rectangles. Nodes live in one array and
+     * hold the bounds of their Width children as RectLanes. Items are
+     * identified by the id Insert returns, or by their index when bulk
+     * loaded; ids of removed items are reused.
+     *
+     * The bulk load is Sort-Tile-Recursive (Leutenegger et al. 1997), which
+     * packs every node full. Insert follows Guttman, descending by least
+     * enlargement and splitting overflowing nodes with the R* axis and
+     * distribution choice. Remove drops nodes once they are empty instead
+     * of reinserting the entries of underfull ones.
+     */
+    template<typename T>
+    class RTree
+    {
+    public:
+        static constexpr int Width = 8;
+        static constexpr int MinFill = 3;
+        static constexpr uint32_t InvalidIndex = 0xffffffffu;
+
+        struct Node
+        {
+            RectLanes<T, Width> m_Bounds;
+            // Item ids in leaves, node indices otherwise. Slots from m_Count on are cleared.
+            uint32_t m_Children[Width];
+            uint32_t m_Parent;
+            uint16_t m_Count;
+            // Zero for leaves
+            uint16_t m_Level;
+        };
+
+    public:
+        RTree();
+        RTree(std::span<const Rect<T>> rects);
+        ~RTree() = default;
+
+    public:
+        size_t GetSize() const;
+        size_t GetHeight() const;
+        Rect<T> GetBounds() const;
+        const Rect<T>& GetRect(uint32_t id) const;
+
+        uint32_t Insert(const Rect<T>& rect);
+        // False if id is not in the tree
+        bool Remove(uint32_t id);
+
+        // Calls func(id) for every item containing (x, y), or overlapping rect, in no particular order
+        template<typename Func>
+        void ForEachContaining(T x, T y, Func&& func) const;
+        template<typename Func>
+        void ForEachOverlapping(const Rect<T>& rect, Func&& func) const;
+
+        // Append the matching ids and return how many were appended
+        size_t FindContaining(T x, T y, std::vector<uint32_t>& ids) const;
+        size_t FindOverlapping(const Rect<T>& rect, std::vector<uint32_t>& ids) const;
+
+    private:
+        uint32_t AllocateNode(uint32_t parent, uint16_t level);
+        void FreeNode(uint32_t node);
+        Rect<T> GetNodeBounds(uint32_t node) const;
+        int FindSlot(uint32_t node, uint32_t child) const;
+        // Links entry into slot of node, leaving the bounds to the caller
+        void SetEntry(uint32_t node, int slot, uint32_t entry);
+        void RemoveEntry(uint32_t node, int slot);
+        // Adds entry with the bounds in slot 0 of bounds, splitting node if it is full
+        void InsertEntry(uint32_t node, uint32_t entry, const RectLanes<T, 4>& bounds);
+        // Updates the bounds stored for node in its ancestors, stopping once nothing changes
+        void Refit(uint32_t node);
+
+        template<typename Test, typename Func>
+        void Traverse(Test&& test, Func&& func) const;
+
+        // Permutation of bounds grouping them into tiles of Width, sorted by centre x into
+        // vertical slices and by centre y within each slice
+        static std::vector<uint32_t> SortTiles(const std::vector<Rect<T>>& bounds);
+
+    public:
+        std::vector<Node> m_Nodes;
+        uint32_t m_Root = 0;
+        std::vector<uint32_t> m_FreeNodes;
+
+        std::vector<Rect<T>> m_Rects;
+        // Leaf holding each id, InvalidIndex for removed ids
+        std::vector<uint32_t> m_Leaves;
+        std::vector<uint32_t> m_FreeIds;
+        size_t m_Size = 0;
+    };
+
+    /**
+     * Loose quadtree over a fixed world rectangle (Ulrich 2000). A cell's
+     * loose bounds extend half a cell past it on every side, so an item
+     * goes in the deepest cell at least as large as itself that holds its
+     * centre, with no splitting or reinsertion. Items are linked into their
+     * node through m_Next and m_Previous, so Insert and Remove are O(depth).
+     *
+     * Nodes are created along the path of an insert and freed when their
+     * subtree empties. Items not inside any loose cell, such as those
+     * outside the world, stay in the root, which every query visits.
+     */
+    template<typename T>
+    class LooseQuadtree
+    {
+    public:
+        static constexpr int MaxDepthLimit = 16;
+        static constexpr uint32_t InvalidIndex = 0xffffffffu;
+
+        struct Node
+        {
+            // Loose bounds of the four children, slot x + 2 * y. Absent children are cleared.
+            RectLanes<T, 4> m_Bounds;
+            uint32_t m_Children[4];
+            uint32_t m_FirstItem;
+            uint32_t m_Parent;
+            // Items in the whole subtree
+            uint32_t m_Count;
+        };
+
+    public:
+        LooseQuadtree();
+        LooseQuadtree(const Rect<T>& world, int maxDepth = 8);
+        ~LooseQuadtree() = default;
+
+    public:
+        size_t GetSize() const;
+        const Rect<T>& GetRect(uint32_t id) const;
+        // Cell (cellX, cellY) of the 2^depth by 2^depth grid over the world, widened by half a cell
+        Rect<T> GetLooseBounds(int depth, uint32_t cellX, uint32_t cellY) const;
+
+        uint32_t Insert(const Rect<T>& rect);
+        // False if id is not in the tree
+        bool Remove(uint32_t id);
+
+        // Calls func(id) for every item containing (x, y), or overlapping rect, in no particular order
+        template<typename Func>
+        void ForEachContaining(T x, T y, Func&& func) const;
+        template<typename Func>
+        void ForEachOverlapping(const Rect<T>& rect, Func&& func) const;
+
+        // Append the matching ids and return how many were appended
+        size_t FindContaining(T x, T y, std::vector<uint32_t>& ids) const;
+        size_t FindOverlapping(const Rect<T>& rect, std::vector<uint32_t>& ids) const;
+
+    private:
+        uint32_t AllocateNode(uint32_t parent);
+
+        template<typename ChildTest, typename ItemTest, typename Func>
+        void Traverse(ChildTest&& childTest, ItemTest&& itemTest, Func&& func) const;
+
+    public:
+        Rect<T> m_World;
+        int m_MaxDepth = 8;
+
+        // The root is node 0 and is never freed
+        std::vector<Node> m_Nodes;
+        std::vector<uint32_t> m_FreeNodes;
+
+        std::vector<Rect<T>> m_Rects;
+        // Node holding each id, InvalidIndex for removed ids
+        std::vector<uint32_t> m_ItemNodes;
+        std::vector<uint32_t> m_Next;
+        std::vector<uint32_t> m_Previous;
+        std::vector<uint32_t> m_FreeIds;
+        size_t m_Size = 0;
+    };
+
+    #include "recttree_impl.h"
+}
@@ -0,0 +1,813 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T, int Width>
+void RectLanes<T, Width>::Clear()
+{
+    for (int slot = 0; slot < Width; ++slot)
+        Clear(slot);
+}
+
+template<typename T, int Width>
+void RectLanes<T, Width>::Clear(int slot)
+{
+    m_MinX[slot] = m_MinY[slot] = std::numeric_limits<T>::max();
+    m_MaxX[slot] = m_MaxY[slot] = std::numeric_limits<T>::lowest();
+}
+
+template<typename T, int Width>
+void RectLanes<T, Width>::Set(int slot, const Rect<T>& rect)
+{
+    if (rect.IsEmpty())
+    {
+        Clear(slot);
+        return;
+    }
+
+    m_MinX[slot] = rect.x;
+    m_MinY[slot] = rect.y;
+    m_MaxX[slot] = rect.x + rect.w;
+    m_MaxY[slot] = rect.y + rect.h;
+}
+
+template<typename T, int Width>
+Rect<T> RectLanes<T, Width>::Get(int slot) const
+{
+    if (!(m_MinX[slot] < m_MaxX[slot]))
+        return Rect<T>();
+    return Rect<T>(m_MinX[slot], m_MinY[slot], m_MaxX[slot] - m_MinX[slot], m_MaxY[slot] - m_MinY[slot]);
+}
+
+template<typename T, int Width>
+template<int OtherWidth>
+void RectLanes<T, Width>::Set(int slot, const RectLanes<T, OtherWidth>& lanes, int from)
+{
+    m_MinX[slot] = lanes.m_MinX[from];
+    m_MinY[slot] = lanes.m_MinY[from];
+    m_MaxX[slot] = lanes.m_MaxX[from];
+    m_MaxY[slot] = lanes.m_MaxY[from];
+}
+
+template<typename T, int Width>
+template<int OtherWidth>
+void RectLanes<T, Width>::SetUnion(int slot, const RectLanes<T, OtherWidth>& lanes, int count)
+{
+    // Cleared slots are inverted, so they drop out and an all-cleared union stays cleared
+    Clear(slot);
+    for (int i = 0; i < count; ++i)
+    {
+        m_MinX[slot] = std::min(m_MinX[slot], lanes.m_MinX[i]);
+        m_MinY[slot] = std::min(m_MinY[slot], lanes.m_MinY[i]);
+        m_MaxX[slot] = std::max(m_MaxX[slot], lanes.m_MaxX[i]);
+        m_MaxY[slot] = std::max(m_MaxY[slot], lanes.m_MaxY[i]);
+    }
+}
+
+template<typename T, int Width>
+int RectLanes<T, Width>::Overlapping(const Rect<T>& rect) const
+{
+    if (rect.IsEmpty())
+        return 0;
+
+    T x0 = rect.x, y0 = rect.y;
+    T x1 = rect.x + rect.w, y1 = rect.y + rect.h;
+    int mask = 0;
+#if defined(SMATH_X86)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        using namespace Simd::Sse2;
+        for (int i = 0; i < Width; i += 4)
+        {
+            Mask hit = (Load(m_MinX + i) < Float(x1)) & (Float(x0) < Load(m_MaxX + i)) &
+                       (Load(m_MinY + i) < Float(y1)) & (Float(y0) < Load(m_MaxY + i));
+            mask |= Bits(hit) << i;
+        }
+        return mask;
+    }
+#endif
+    for (int i = 0; i < Width; ++i)
+        mask |= int(m_MinX[i] < x1 && x0 < m_MaxX[i] && m_MinY[i] < y1 && y0 < m_MaxY[i]) << i;
+    return mask;
+}
+
+template<typename T, int Width>
+int RectLanes<T, Width>::Containing(T x, T y) const
+{
+    int mask = 0;
+#if defined(SMATH_X86)
+    if constexpr (std::is_same_v<T, float>)
+    {
+        using namespace Simd::Sse2;
+        for (int i = 0; i < Width; i += 4)
+        {
+            Mask hit = (Load(m_MinX + i) <= Float(x)) & (Float(x) < Load(m_MaxX + i)) &
+                       (Load(m_MinY + i) <= Float(y)) & (Float(y) < Load(m_MaxY + i));
+            mask |= Bits(hit) << i;
+        }
+        return mask;
+    }
+#endif
+    for (int i = 0; i < Width; ++i)
+        mask |= int(m_MinX[i] <= x && x < m_MaxX[i] && m_MinY[i] <= y && y < m_MaxY[i]) << i;
+    return mask;
+}
+
+template<typename T>
+RTree<T>::RTree()
+    : RTree(std::span<const Rect<T>>())
+{
+}
+
+template<typename T>
+RTree<T>::RTree(std::span<const Rect<T>> rects)
+    : m_Rects(rects.begin(), rects.end())
+    , m_Leaves(rects.size(), InvalidIndex)
+    , m_Size(rects.size())
+{
+    assert(rects.size() < InvalidIndex);
+
+    std::vector<uint32_t> entries(rects.size());
+    std::iota(entries.begin(), entries.end(), 0u);
+    std::vector<Rect<T>> bounds(m_Rects);
+
+    // Pack each level into full nodes, which become the entries of the next, until one is left
+    for (uint16_t level = 0;; ++level)
+    {
+        std::vector<uint32_t> order = SortTiles(bounds);
+        size_t count = std::max<size_t>((entries.size() + Width - 1) / Width, 1);
+        std::vector<uint32_t> nodes(count);
+        std::vector<Rect<T>> nodeBounds(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            uint32_t node = AllocateNode(InvalidIndex, level);
+            size_t begin = i * Width;
+            size_t end = std::min(entries.size(), begin + Width);
+            Node& n = m_Nodes[node];
+            for (size_t j = begin; j < end; ++j)
+            {
+                int slot = int(j - begin);
+                SetEntry(node, slot, entries[order[j]]);
+                if (level == 0)
+                    n.m_Bounds.Set(slot, bounds[order[j]]);
+                else
+                    n.m_Bounds.SetUnion(slot, m_Nodes[entries[order[j]]].m_Bounds, Width);
+            }
+
+            n.m_Count = uint16_t(end - begin);
+            nodes[i] = node;
+            nodeBounds[i] = GetNodeBounds(node);
+        }
+
+        if (count == 1)
+        {
+            m_Root = nodes[0];
+            break;
+        }
+
+        entries = std::move(nodes);
+        bounds = std::move(nodeBounds);
+    }
+}
+
+template<typename T>
+size_t RTree<T>::GetSize() const
+{
+    return m_Size;
+}
+
+template<typename T>
+size_t RTree<T>::GetHeight() const
+{
+    return size_t(m_Nodes[m_Root].m_Level) + 1;
+}
+
+template<typename T>
+Rect<T> RTree<T>::GetBounds() const
+{
+    return GetNodeBounds(m_Root);
+}
+
+template<typename T>
+const Rect<T>& RTree<T>::GetRect(uint32_t id) const
+{
+    return m_Rects[id];
+}
+
+template<typename T>
+uint32_t RTree<T>::Insert(const Rect<T>& rect)
+{
+    uint32_t id;
+    if (!m_FreeIds.empty())
+    {
+        id = m_FreeIds.back();
+        m_FreeIds.pop_back();
+        m_Rects[id] = rect;
+    }
+    else
+    {
+        assert(m_Rects.size() < InvalidIndex);
+        id = uint32_t(m_Rects.size());
+        m_Rects.push_back(rect);
+        m_Leaves.push_back(InvalidIndex);
+    }
+
+    auto area = [](const Rect<T>& r) { return r.IsEmpty() ? 0.0 : double(r.w) * double(r.h); };
+
+    // Descend into the child needing the least enlargement, then the smallest one
+    uint32_t node = m_Root;
+    while (m_Nodes[node].m_Level > 0)
+    {
+        const Node& current = m_Nodes[node];
+        int best = 0;
+        double bestEnlargement = std::numeric_limits<double>::max();
+        double bestArea = std::numeric_limits<double>::max();
+        for (int slot = 0; slot < current.m_Count; ++slot)
+        {
+            Rect<T> bounds = current.m_Bounds.Get(slot);
+            double size = area(bounds);
+            double enlargement = area(Rect<T>::Union(bounds, rect)) - size;
+            if (enlargement < bestEnlargement || (enlargement == bestEnlargement && size < bestArea))
+            {
+                best = slot;
+                bestEnlargement = enlargement;
+                bestArea = size;
+            }
+        }
+        node = current.m_Children[best];
+    }
+
+    RectLanes<T, 4> bounds;
+    bounds.Set(0, rect);
+    InsertEntry(node, id, bounds);
+    ++m_Size;
+    return id;
+}
+
+template<typename T>
+bool RTree<T>::Remove(uint32_t id)
+{
+    if (id >= m_Leaves.size() || m_Leaves[id] == InvalidIndex)
+        return false;
+
+    uint32_t node = m_Leaves[id];
+    RemoveEntry(node, FindSlot(node, id));
+    m_Leaves[id] = InvalidIndex;
+    m_Rects[id] = Rect<T>();
+    m_FreeIds.push_back(id);
+    --m_Size;
+
+    // Unlink emptied nodes up to the root, then shrink the bounds above
+    while (node != m_Root && m_Nodes[node].m_Count == 0)
+    {
+        uint32_t parent = m_Nodes[node].m_Parent;
+        RemoveEntry(parent, FindSlot(parent, node));
+        FreeNode(node);
+        node = parent;
+    }
+    Refit(node);
+
+    // A root with a single child only adds a level
+    while (m_Nodes[m_Root].m_Level > 0 && m_Nodes[m_Root].m_Count <= 1)
+    {
+        uint32_t root = m_Root;
+        if (m_Nodes[root].m_Count == 0)
+        {
+            m_Nodes[root].m_Level = 0;
+            break;
+        }
+
+        m_Root = m_Nodes[root].m_Children[0];
+        m_Nodes[m_Root].m_Parent = InvalidIndex;
+        FreeNode(root);
+    }
+    return true;
+}
+
+template<typename T>
+template<typename Func>
+void RTree<T>::ForEachContaining(T x, T y, Func&& func) const
+{
+    Traverse([&](const RectLanes<T, Width>& bounds) { return bounds.Containing(x, y); }, func);
+}
+
+template<typename T>
+template<typename Func>
+void RTree<T>::ForEachOverlapping(const Rect<T>& rect, Func&& func) const
+{
+    Traverse([&](const RectLanes<T, Width>& bounds) { return bounds.Overlapping(rect); }, func);
+}
+
+template<typename T>
+size_t RTree<T>::FindContaining(T x, T y, std::vector<uint32_t>& ids) const
+{
+    size_t first = ids.size();
+    ForEachContaining(x, y, [&](uint32_t id) { ids.push_back(id); });
+    return ids.size() - first;
+}
+
+template<typename T>
+size_t RTree<T>::FindOverlapping(const Rect<T>& rect, std::vector<uint32_t>& ids) const
+{
+    size_t first = ids.size();
+    ForEachOverlapping(rect, [&](uint32_t id) { ids.push_back(id); });
+    return ids.size() - first;
+}
+
+template<typename T>
+uint32_t RTree<T>::AllocateNode(uint32_t parent, uint16_t level)
+{
+    uint32_t node;
+    if (!m_FreeNodes.empty())
+    {
+        node = m_FreeNodes.back();
+        m_FreeNodes.pop_back();
+    }
+    else
+    {
+        node = uint32_t(m_Nodes.size());
+        m_Nodes.emplace_back();
+    }
+
+    Node& n = m_Nodes[node];
+    n.m_Bounds.Clear();
+    std::fill(std::begin(n.m_Children), std::end(n.m_Children), InvalidIndex);
+    n.m_Parent = parent;
+    n.m_Count = 0;
+    n.m_Level = level;
+    return node;
+}
+
+template<typename T>
+void RTree<T>::FreeNode(uint32_t node)
+{
+    m_FreeNodes.push_back(node);
+}
+
+template<typename T>
+Rect<T> RTree<T>::GetNodeBounds(uint32_t node) const
+{
+    const Node& n = m_Nodes[node];
+    Rect<T> bounds;
+    for (int slot = 0; slot < n.m_Count; ++slot)
+        bounds = Rect<T>::Union(bounds, n.m_Bounds.Get(slot));
+    return bounds;
+}
+
+template<typename T>
+int RTree<T>::FindSlot(uint32_t node, uint32_t child) const
+{
+    const Node& n = m_Nodes[node];
+    for (int slot = 0; slot < n.m_Count; ++slot)
+        if (n.m_Children[slot] == child)
+            return slot;
+
+    assert(false);
+    return -1;
+}
+
+template<typename T>
+void RTree<T>::SetEntry(uint32_t node, int slot, uint32_t entry)
+{
+    Node& n = m_Nodes[node];
+    n.m_Children[slot] = entry;
+    if (n.m_Level == 0)
+        m_Leaves[entry] = node;
+    else
+        m_Nodes[entry].m_Parent = node;
+}
+
+template<typename T>
+void RTree<T>::RemoveEntry(uint32_t node, int slot)
+{
+    // Moves the last entry into the hole, keeping the slots packed
+    Node& n = m_Nodes[node];
+    int last = --n.m_Count;
+    if (slot != last)
+    {
+        SetEntry(node, slot, n.m_Children[last]);
+        n.m_Bounds.Set(slot, n.m_Bounds, last);
+    }
+
+    n.m_Children[last] = InvalidIndex;
+    n.m_Bounds.Clear(last);
+}
+
+template<typename T>
+void RTree<T>::InsertEntry(uint32_t node, uint32_t entry, const RectLanes<T, 4>& bounds)
+{
+    if (m_Nodes[node].m_Count < Width)
+    {
+        int slot = m_Nodes[node].m_Count++;
+        SetEntry(node, slot, entry);
+        m_Nodes[node].m_Bounds.Set(slot, bounds, 0);
+        Refit(node);
+        return;
+    }
+
+    uint32_t entries[Width + 1];
+    RectLanes<T, 2 * Width> lanes;
+    Rect<T> boxes[Width + 1];
+    for (int slot = 0; slot < Width; ++slot)
+    {
+        entries[slot] = m_Nodes[node].m_Children[slot];
+        lanes.Set(slot, m_Nodes[node].m_Bounds, slot);
+    }
+    entries[Width] = entry;
+    lanes.Set(Width, bounds, 0);
+    for (int i = 0; i <= Width; ++i)
+        boxes[i] = lanes.Get(i);
+
+    // R* split: for each axis sort by centre and score every distribution leaving both sides
+    // at least MinFill entries by overlap, then total area
+    auto area = [](const Rect<T>& r) { return r.IsEmpty() ? 0.0 : double(r.w) * double(r.h); };
+    int bestOrder[Width + 1];
+    int bestSplit = MinFill;
+    double bestOverlap = std::numeric_limits<double>::max();
+    double bestArea = std::numeric_limits<double>::max();
+    for (int axis = 0; axis < 2; ++axis)
+    {
+        int order[Width + 1];
+        std::iota(order, order + Width + 1, 0);
+        std::sort(order, order + Width + 1, [&](int a, int b) {
+            return axis == 0 ? double(boxes[a].x) * 2 + double(boxes[a].w) < double(boxes[b].x) * 2 + double(boxes[b].w)
+                             : double(boxes[a].y) * 2 + double(boxes[a].h) < double(boxes[b].y) * 2 + double(boxes[b].h);
+        });
+
+        Rect<T> prefix[Width + 1], suffix[Width + 2];
+        for (int i = 0; i <= Width; ++i)
+            prefix[i] = Rect<T>::Union(i > 0 ? prefix[i - 1] : Rect<T>(), boxes[order[i]]);
+        for (int i = Width; i >= 0; --i)
+            suffix[i] = Rect<T>::Union(suffix[i + 1], boxes[order[i]]);
+
+        for (int split = MinFill; split <= Width + 1 - MinFill; ++split)
+        {
+            double overlap = area(Rect<T>::Intersection(prefix[split - 1], suffix[split]));
+            double total = area(prefix[split - 1]) + area(suffix[split]);
+            if (overlap < bestOverlap || (overlap == bestOverlap && total < bestArea))
+            {
+                std::copy(order, order + Width + 1, bestOrder);
+                bestSplit = split;
+                bestOverlap = overlap;
+                bestArea = total;
+            }
+        }
+    }
+
+    uint16_t level = m_Nodes[node].m_Level;
+    uint32_t sibling = AllocateNode(m_Nodes[node].m_Parent, level);
+    m_Nodes[node].m_Bounds.Clear();
+    std::fill(std::begin(m_Nodes[node].m_Children), std::end(m_Nodes[node].m_Children), InvalidIndex);
+    m_Nodes[node].m_Count = uint16_t(bestSplit);
+    m_Nodes[sibling].m_Count = uint16_t(Width + 1 - bestSplit);
+    for (int i = 0; i <= Width; ++i)
+    {
+        uint32_t target = i < bestSplit ? node : sibling;
+        int slot = i < bestSplit ? i : i - bestSplit;
+        SetEntry(target, slot, entries[bestOrder[i]]);
+        m_Nodes[target].m_Bounds.Set(slot, lanes, bestOrder[i]);
+    }
+
+    RectLanes<T, 4> siblingBounds;
+    siblingBounds.SetUnion(0, m_Nodes[sibling].m_Bounds, Width);
+    if (node == m_Root)
+    {
+        m_Root = AllocateNode(InvalidIndex, uint16_t(level + 1));
+        Node& root = m_Nodes[m_Root];
+        root.m_Count = 2;
+        SetEntry(m_Root, 0, node);
+        SetEntry(m_Root, 1, sibling);
+        root.m_Bounds.SetUnion(0, m_Nodes[node].m_Bounds, Width);
+        root.m_Bounds.Set(1, siblingBounds, 0);
+        return;
+    }
+
+    uint32_t parent = m_Nodes[node].m_Parent;
+    m_Nodes[parent].m_Bounds.SetUnion(FindSlot(parent, node), m_Nodes[node].m_Bounds, Width);
+    InsertEntry(parent, sibling, siblingBounds);
+}
+
+template<typename T>
+void RTree<T>::Refit(uint32_t node)
+{
+    for (uint32_t parent = m_Nodes[node].m_Parent; parent != InvalidIndex; parent = m_Nodes[node].m_Parent)
+    {
+        int slot = FindSlot(parent, node);
+        RectLanes<T, 4> bounds;
+        bounds.SetUnion(0, m_Nodes[node].m_Bounds, Width);
+
+        RectLanes<T, Width>& stored = m_Nodes[parent].m_Bounds;
+        if (bounds.m_MinX[0] == stored.m_MinX[slot] && bounds.m_MinY[0] == stored.m_MinY[slot] &&
+            bounds.m_MaxX[0] == stored.m_MaxX[slot] && bounds.m_MaxY[0] == stored.m_MaxY[slot])
+            return;
+
+        stored.Set(slot, bounds, 0);
+        node = parent;
+    }
+}
+
+template<typename T>
+template<typename Test, typename Func>
+void RTree<T>::Traverse(Test&& test, Func&& func) const
+{
+    // Each inner node popped pushes at most Width children, so the stack never holds more than
+    // (Width - 1) * levels + 1 entries. The item count does not bound the height: it only grows
+    // on a root split, and Remove leaves underfull nodes behind. Trees too tall for the local
+    // array (36 levels) get a heap stack.
+    constexpr size_t LocalSize = 256;
+    size_t capacity = size_t(Width - 1) * m_Nodes[m_Root].m_Level + 1;
+    uint32_t local[LocalSize];
+    std::vector<uint32_t> heap;
+    uint32_t* stack = local;
+    if (capacity > LocalSize)
+    {
+        heap.resize(capacity);
+        stack = heap.data();
+    }
+
+    size_t top = 0;
+    stack[top++] = m_Root;
+
+    while (top > 0)
+    {
+        const Node& node = m_Nodes[stack[--top]];
+        for (int mask = test(node.m_Bounds); mask != 0; mask &= mask - 1)
+        {
+            uint32_t child = node.m_Children[std::countr_zero(unsigned(mask))];
+            if (node.m_Level == 0)
+                func(child);
+            else
+            {
+                assert(top < capacity);
+                stack[top++] = child;
+            }
+        }
+    }
+}
+
+template<typename T>
+std::vector<uint32_t> RTree<T>::SortTiles(const std::vector<Rect<T>>& bounds)
+{
+    size_t count = bounds.size();
+    std::vector<uint32_t> order(count);
+    std::iota(order.begin(), order.end(), 0u);
+
+    // Twice the centre, which orders the same without a division
+    auto centreX = [&](uint32_t i) { return double(bounds[i].x) * 2 + double(bounds[i].w); };
+    auto centreY = [&](uint32_t i) { return double(bounds[i].y) * 2 + double(bounds[i].h); };
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return centreX(a) < centreX(b); });
+
+    size_t nodes = (count + Width - 1) / Width;
+    size_t sliceSize = size_t(std::ceil(std::sqrt(double(nodes)))) * Width;
+    for (size_t begin = 0; begin < count; begin += sliceSize)
+    {
+        auto end = order.begin() + std::min(count, begin + sliceSize);
+        std::sort(order.begin() + begin, end, [&](uint32_t a, uint32_t b) { return centreY(a) < centreY(b); });
+    }
+    return order;
+}
+
+template<typename T>
+LooseQuadtree<T>::LooseQuadtree()
+    : LooseQuadtree(Rect<T>(T(0), T(0), T(1), T(1)))
+{
+}
+
+template<typename T>
+LooseQuadtree<T>::LooseQuadtree(const Rect<T>& world, int maxDepth)
+    : m_World(world)
+    , m_MaxDepth(maxDepth)
+{
+    assert(maxDepth >= 0 && maxDepth <= MaxDepthLimit);
+    AllocateNode(InvalidIndex);
+}
+
+template<typename T>
+size_t LooseQuadtree<T>::GetSize() const
+{
+    return m_Size;
+}
+
+template<typename T>
+const Rect<T>& LooseQuadtree<T>::GetRect(uint32_t id) const
+{
+    return m_Rects[id];
+}
+
+template<typename T>
+Rect<T> LooseQuadtree<T>::GetLooseBounds(int depth, uint32_t cellX, uint32_t cellY) const
+{
+    // Same expression for both edges, so neighbouring cells share them exactly
+    double cells = double(1u << depth);
+    T x0 = T(double(m_World.x) + double(m_World.w) * cellX / cells);
+    T x1 = T(double(m_World.x) + double(m_World.w) * (cellX + 1) / cells);
+    T y0 = T(double(m_World.y) + double(m_World.h) * cellY / cells);
+    T y1 = T(double(m_World.y) + double(m_World.h) * (cellY + 1) / cells);
+
+    T marginX = (x1 - x0) / T(2);
+    T marginY = (y1 - y0) / T(2);
+    return Rect<T>(x0 - marginX, y0 - marginY, x1 - x0 + marginX * T(2), y1 - y0 + marginY * T(2));
+}
+
+template<typename T>
+uint32_t LooseQuadtree<T>::Insert(const Rect<T>& rect)
+{
+    uint32_t id;
+    if (!m_FreeIds.empty())
+    {
+        id = m_FreeIds.back();
+        m_FreeIds.pop_back();
+        m_Rects[id] = rect;
+    }
+    else
+    {
+        assert(m_Rects.size() < InvalidIndex);
+        id = uint32_t(m_Rects.size());
+        m_Rects.push_back(rect);
+        m_ItemNodes.push_back(InvalidIndex);
+        m_Next.push_back(InvalidIndex);
+        m_Previous.push_back(InvalidIndex);
+    }
+
+    // Deepest level whose cells are at least as large as the item
+    int depth = 0;
+    if (!rect.IsEmpty())
+    {
+        depth = m_MaxDepth;
+        while (depth > 0 && (double(rect.w) * (1u << depth) > double(m_World.w) ||
+                             double(rect.h) * (1u << depth) > double(m_World.h)))
+            --depth;
+    }
+
+    uint32_t cells = 1u << depth;
+    double cellX = (double(rect.x) + double(rect.w) * 0.5 - double(m_World.x)) * cells / double(m_World.w);
+    double cellY = (double(rect.y) + double(rect.h) * 0.5 - double(m_World.y)) * cells / double(m_World.h);
+    uint32_t x = uint32_t(std::clamp(cellX, 0.0, double(cells - 1)));
+    uint32_t y = uint32_t(std::clamp(cellY, 0.0, double(cells - 1)));
+
+    // Walk down to the cell holding the centre, stopping early where a loose cell does not
+    // contain the item. Checking every level keeps queries exact under rounding.
+    uint32_t node = 0;
+    ++m_Nodes[0].m_Count;
+    for (int level = 1; level <= depth; ++level)
+    {
+        uint32_t childX = x >> (depth - level);
+        uint32_t childY = y >> (depth - level);
+        Rect<T> bounds = GetLooseBounds(level, childX, childY);
+        if (!bounds.Contains(rect))
+            break;
+
+        int slot = int(childX & 1) + 2 * int(childY & 1);
+        uint32_t child = m_Nodes[node].m_Children[slot];
+        if (child == InvalidIndex)
+        {
+            child = AllocateNode(node);
+            m_Nodes[node].m_Children[slot] = child;
+            m_Nodes[node].m_Bounds.Set(slot, bounds);
+        }
+
+        node = child;
+        ++m_Nodes[node].m_Count;
+    }
+
+    uint32_t first = m_Nodes[node].m_FirstItem;
+    m_Next[id] = first;
+    m_Previous[id] = InvalidIndex;
+    if (first != InvalidIndex)
+        m_Previous[first] = id;
+    m_Nodes[node].m_FirstItem = id;
+    m_ItemNodes[id] = node;
+
+    ++m_Size;
+    return id;
+}
+
+template<typename T>
+bool LooseQuadtree<T>::Remove(uint32_t id)
+{
+    if (id >= m_ItemNodes.size() || m_ItemNodes[id] == InvalidIndex)
+        return false;
+
+    uint32_t node = m_ItemNodes[id];
+    if (m_Previous[id] != InvalidIndex)
+        m_Next[m_Previous[id]] = m_Next[id];
+    else
+        m_Nodes[node].m_FirstItem = m_Next[id];
+    if (m_Next[id] != InvalidIndex)
+        m_Previous[m_Next[id]] = m_Previous[id];
+
+    m_ItemNodes[id] = InvalidIndex;
+    m_Rects[id] = Rect<T>();
+    m_FreeIds.push_back(id);
+    --m_Size;
+
+    // Children empty before their parents, so a node reaching zero has no children left
+    while (node != InvalidIndex)
+    {
+        uint32_t parent = m_Nodes[node].m_Parent;
+        if (--m_Nodes[node].m_Count == 0 && parent != InvalidIndex)
+        {
+            Node& p = m_Nodes[parent];
+            int slot = int(std::find(std::begin(p.m_Children), std::end(p.m_Children), node) - std::begin(p.m_Children));
+            p.m_Children[slot] = InvalidIndex;
+            p.m_Bounds.Clear(slot);
+            m_FreeNodes.push_back(node);
+        }
+        node = parent;
+    }
+    return true;
+}
+
+template<typename T>
+template<typename Func>
+void LooseQuadtree<T>::ForEachContaining(T x, T y, Func&& func) const
+{
+    Traverse([&](const RectLanes<T, 4>& bounds) { return bounds.Containing(x, y); },
+             [&](const Rect<T>& rect) { return rect.Contains(x, y); }, func);
+}
+
+template<typename T>
+template<typename Func>
+void LooseQuadtree<T>::ForEachOverlapping(const Rect<T>& rect, Func&& func) const
+{
+    Traverse([&](const RectLanes<T, 4>& bounds) { return bounds.Overlapping(rect); },
+             [&](const Rect<T>& item) { return item.Overlaps(rect); }, func);
+}
+
+template<typename T>
+size_t LooseQuadtree<T>::FindContaining(T x, T y, std::vector<uint32_t>& ids) const
+{
+    size_t first = ids.size();
+    ForEachContaining(x, y, [&](uint32_t id) { ids.push_back(id); });
+    return ids.size() - first;
+}
+
+template<typename T>
+size_t LooseQuadtree<T>::FindOverlapping(const Rect<T>& rect, std::vector<uint32_t>& ids) const
+{
+    size_t first = ids.size();
+    ForEachOverlapping(rect, [&](uint32_t id) { ids.push_back(id); });
+    return ids.size() - first;
+}
+
+template<typename T>
+uint32_t LooseQuadtree<T>::AllocateNode(uint32_t parent)
+{
+    uint32_t node;
+    if (!m_FreeNodes.empty())
+    {
+        node = m_FreeNodes.back();
+        m_FreeNodes.pop_back();
+    }
+    else
+    {
+        node = uint32_t(m_Nodes.size());
+        m_Nodes.emplace_back();
+    }
+
+    Node& n = m_Nodes[node];
+    n.m_Bounds.Clear();
+    std::fill(std::begin(n.m_Children), std::end(n.m_Children), InvalidIndex);
+    n.m_FirstItem = InvalidIndex;
+    n.m_Parent = parent;
+    n.m_Count = 0;
+    return node;
+}
+
+template<typename T>
+template<typename ChildTest, typename ItemTest, typename Func>
+void LooseQuadtree<T>::Traverse(ChildTest&& childTest, ItemTest&& itemTest, Func&& func) const
+{
+    // At most three siblings wait on the stack per level
+    uint32_t stack[3 * MaxDepthLimit + 2];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0)
+    {
+        const Node& node = m_Nodes[stack[--top]];
+        for (uint32_t id = node.m_FirstItem; id != InvalidIndex; id = m_Next[id])
+            if (itemTest(m_Rects[id]))
+                func(id);
+
+        for (int mask = childTest(node.m_Bounds); mask != 0; mask &= mask - 1)
+            stack[top++] = node.m_Children[std::countr_zero(unsigned(mask))];
+    }
+}
@@ -0,0 +1,916 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <algorithm>
+
+/**
+ * Thin lane wrappers used to write a kernel once and compile it for several
+ * instruction sets. Every ISA namespace exposes the same vocabulary (Float,
+ * Int, Mask, Width and a set of free functions) so a kernel written against
+ * unqualified names can be included into each namespace in turn, the same
+ * way _impl.h files are included into SMath.
+ *
+ * Scalar overloads cover float and double. The x86 namespaces operate on
+ * float lanes. AVX2 and AVX-512 code is compiled with per-function target
+ * attributes, so it is only safe to call after checking the CPU supports it.
+ */
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(_M_AMD64)
+    #define SMATH_X86 1
+    #include <immintrin.h>
+#endif
+
+#if defined(__clang__)
+    #define SMATH_BEGIN_TARGET_AVX2 _Pragma("clang attribute push(__attribute__((target(\"avx2,fma,f16c\"))), apply_to = function)")
+    #define SMATH_BEGIN_TARGET_AVX512 _Pragma("clang attribute push(__attribute__((target(\"avx512f,avx2,fma,f16c\"))), apply_to = function)")
+    #define SMATH_END_TARGET _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+    #define SMATH_BEGIN_TARGET_AVX2 _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,fma,f16c\")")
+    #define SMATH_BEGIN_TARGET_AVX512 _Pragma("GCC push_options") _Pragma("GCC target(\"avx512f,avx2,fma,f16c\")")
+    #define SMATH_END_TARGET _Pragma("GCC pop_options")
+#else
+    #define SMATH_BEGIN_TARGET_AVX2
+    #define SMATH_BEGIN_TARGET_AVX512
+    #define SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    // Reinterprets the bits of one trivially copyable type as another. std::bit_cast would do,
+    // but libstdc++ only has it from GCC 11 and GCC 10 is still supported.
+    template <typename To, typename From>
+    inline To BitCast(const From& from)
+    {
+        static_assert(sizeof(To) == sizeof(From), "BitCast needs types of the same size");
+        To to;
+        std::memcpy(&to, &from, sizeof(To));
+        return to;
+    }
+
+    // Leaves a unchanged but hides it from the optimizer. GCC contracts a multiply feeding an
+    // add into an FMA whenever the target has one, so a kernel that must round exactly like its
+    // scalar reference passes the product through here first. Taken by reference so that
+    // AVX registers never cross this non-AVX function by value.
+    template <typename T>
+    inline void NoContract(T& a)
+    {
+#if defined(SMATH_X86) && (defined(__GNUC__) || defined(__clang__))
+        __asm__("" : "+x"(a));
+#else
+        (void)a;
+#endif
+    }
+}
+
+namespace SMath::Simd::Scalar
+{
+    static constexpr int Width = 1;
+
+    template <typename T> inline T Load(const T* p) { return *p; }
+    template <typename T> inline void Store(T* p, T a) { *p = a; }
+
+    template <typename T> inline T Select(bool mask, T a, T b) { return mask ? a : b; }
+    template <typename T> inline T MulAdd(T a, T b, T c) { return a * b + c; }
+    template <typename T> inline T Abs(T a) { return std::fabs(a); }
+    template <typename T> inline T Min(T a, T b) { return a < b ? a : b; }
+    template <typename T> inline T Max(T a, T b) { return a > b ? a : b; }
+    template <typename T> inline T Sqrt(T a) { return std::sqrt(a); }
+    template <typename T> inline T Rcp(T a) { return T(1) / a; }
+    inline bool Any(bool mask) { return mask; }
+
+    inline float Rsqrt(float a)
+    {
+#if defined(SMATH_X86)
+        // 12-bit estimate refined by one Newton-Raphson step
+        float y = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(a)));
+        return y * (1.5f - 0.5f * a * y * y);
+#else
+        return 1.0f / std::sqrt(a);
+#endif
+    }
+
+    inline double Rsqrt(double a) { return 1.0 / std::sqrt(a); }
+
+    // Rounds to nearest in the current rounding mode, like the SIMD conversions
+#if defined(SMATH_X86)
+    inline int32_t RoundToInt(float a) { return _mm_cvtss_si32(_mm_set_ss(a)); }
+    inline int64_t RoundToInt(double a) { return _mm_cvtsd_si64(_mm_set_sd(a)); }
+#else
+    inline int32_t RoundToInt(float a) { return int32_t(std::nearbyint(a)); }
+    inline int64_t RoundToInt(double a) { return int64_t(std::nearbyint(a)); }
+#endif
+    inline float ToFloat(int32_t a) { return float(a); }
+    inline double ToFloat(int64_t a) { return double(a); }
+
+    // Reinterprets the bits, no conversion
+    inline int32_t AsInt(float a) { return BitCast<int32_t>(a); }
+    inline float AsFloat(int32_t a) { return BitCast<float>(a); }
+
+    // 2^n for n in the normal exponent range
+    inline float Pow2(int32_t n) { return BitCast<float>(uint32_t(n + 127) << 23); }
+    inline double Pow2(int64_t n) { return BitCast<double>(uint64_t(n + 1023) << 52); }
+
+    // Splits a normal a into m * 2^e with m in [0.5, 1)
+    inline float SplitExponent(float a, int32_t& e)
+    {
+        uint32_t bits = BitCast<uint32_t>(a);
+        e = int32_t((bits >> 23) & 0xff) - 126;
+        return BitCast<float>((bits & 0x807fffffu) | 0x3f000000u);
+    }
+
+    inline double SplitExponent(double a, int64_t& e)
+    {
+        uint64_t bits = BitCast<uint64_t>(a);
+        e = int64_t((bits >> 52) & 0x7ff) - 1022;
+        return BitCast<double>((bits & 0x800fffffffffffffull) | 0x3fe0000000000000ull);
+    }
+
+    // Largest argument for which exp does not overflow after rounding to 2^n
+    inline float ExpLimit(float) { return 88.0f; }
+    inline double ExpLimit(double) { return 709.0; }
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    static constexpr int Width = 4;
+
+    struct Float
+    {
+        __m128 v;
+        Float() = default;
+        Float(__m128 x) : v(x) {}
+        Float(float s) : v(_mm_set1_ps(s)) {}
+    };
+
+    struct Int
+    {
+        __m128i v;
+        Int() = default;
+        Int(__m128i x) : v(x) {}
+        Int(int32_t s) : v(_mm_set1_epi32(s)) {}
+    };
+
+    struct Mask
+    {
+        __m128 v;
+        Mask(__m128 x) : v(x) {}
+    };
+
+    inline Float Load(const float* p) { return _mm_loadu_ps(p); }
+    inline void Store(float* p, Float a) { _mm_storeu_ps(p, a.v); }
+
+    inline Float operator+(Float a, Float b) { return _mm_add_ps(a.v, b.v); }
+    inline Float operator-(Float a, Float b) { return _mm_sub_ps(a.v, b.v); }
+    inline Float operator*(Float a, Float b) { return _mm_mul_ps(a.v, b.v); }
+    inline Float operator/(Float a, Float b) { return _mm_div_ps(a.v, b.v); }
+    inline Float operator-(Float a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+
+    inline Mask operator<(Float a, Float b) { return _mm_cmplt_ps(a.v, b.v); }
+    inline Mask operator<=(Float a, Float b) { return _mm_cmple_ps(a.v, b.v); }
+    inline Mask operator>(Float a, Float b) { return _mm_cmpgt_ps(a.v, b.v); }
+    inline Mask operator>=(Float a, Float b) { return _mm_cmpge_ps(a.v, b.v); }
+    inline Mask operator==(Float a, Float b) { return _mm_cmpeq_ps(a.v, b.v); }
+
+    inline Int operator+(Int a, Int b) { return _mm_add_epi32(a.v, b.v); }
+    inline Int operator-(Int a, Int b) { return _mm_sub_epi32(a.v, b.v); }
+    inline Int operator&(Int a, Int b) { return _mm_and_si128(a.v, b.v); }
+    inline Int operator^(Int a, Int b) { return _mm_xor_si128(a.v, b.v); }
+    inline Int ShiftRight(Int a, int n) { return _mm_srli_epi32(a.v, n); }
+    inline Int operator|(Int a, Int b) { return _mm_or_si128(a.v, b.v); }
+    inline Int ShiftLeft(Int a, int n) { return _mm_slli_epi32(a.v, n); }
+    inline Int ShiftRightSigned(Int a, int n) { return _mm_srai_epi32(a.v, n); }
+    inline Mask operator==(Int a, Int b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a.v, b.v)); }
+
+    // Low 32 bits of the product; SSE2 only multiplies the even lanes, so do both halves
+    inline Int operator*(Int a, Int b)
+    {
+        __m128i even = _mm_mul_epu32(a.v, b.v);
+        __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a.v, 32), _mm_srli_epi64(b.v, 32));
+        return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+    }
+
+    inline Int LaneIndex() { return _mm_setr_epi32(0, 1, 2, 3); }
+
+    // Lane i reads and writes p[i * stride], for walking arrays of structures
+    inline Float LoadStrided(const float* p, int stride) { return _mm_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride]); }
+
+    inline void StoreStrided(float* p, int stride, Float a)
+    {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, a.v);
+        for (int i = 0; i < 4; ++i)
+            p[i * stride] = lanes[i];
+    }
+
+    // Integer lanes in memory, for packed formats. The 16-bit forms zero-extend on load
+    // and keep the low half of each lane on store.
+    inline Int Load(const int32_t* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    inline void Store(int32_t* p, Int a) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), a.v); }
+    inline Int LoadStrided(const int32_t* p, int stride) { return _mm_setr_epi32(p[0], p[stride], p[2 * stride], p[3 * stride]); }
+
+    inline void StoreStrided(int32_t* p, int stride, Int a)
+    {
+        alignas(16) int32_t lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), a.v);
+        for (int i = 0; i < 4; ++i)
+            p[i * stride] = lanes[i];
+    }
+
+    inline Int LoadWiden(const uint16_t* p)
+    {
+        return _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)), _mm_setzero_si128());
+    }
+
+    inline void StoreNarrow(uint16_t* p, Int a)
+    {
+        __m128i x = _mm_shufflelo_epi16(a.v, _MM_SHUFFLE(3, 3, 2, 0));
+        x = _mm_shufflehi_epi16(x, _MM_SHUFFLE(3, 3, 2, 0));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(p), _mm_shuffle_epi32(x, _MM_SHUFFLE(3, 3, 2, 0)));
+    }
+
+    // Writes Width xyz triples packed, p[3 * i + k] = lane i of component k
+    inline void StoreInterleaved3(float* p, Float x, Float y, Float z)
+    {
+        __m128 xyLo = _mm_unpacklo_ps(x.v, y.v);
+        __m128 xyHi = _mm_unpackhi_ps(x.v, y.v);
+        __m128 zx = _mm_shuffle_ps(z.v, x.v, _MM_SHUFFLE(1, 1, 0, 0));
+        __m128 yz = _mm_shuffle_ps(y.v, z.v, _MM_SHUFFLE(1, 1, 1, 1));
+        __m128 zx2 = _mm_shuffle_ps(z.v, xyHi, _MM_SHUFFLE(2, 2, 2, 2));
+        __m128 yz3 = _mm_shuffle_ps(xyHi, z.v, _MM_SHUFFLE(3, 3, 3, 3));
+        _mm_storeu_ps(p, _mm_shuffle_ps(xyLo, zx, _MM_SHUFFLE(2, 0, 1, 0)));
+        _mm_storeu_ps(p + 4, _mm_shuffle_ps(yz, xyHi, _MM_SHUFFLE(1, 0, 2, 0)));
+        _mm_storeu_ps(p + 8, _mm_shuffle_ps(zx2, yz3, _MM_SHUFFLE(2, 0, 2, 0)));
+    }
+
+    // Writes Width xyzw quadruples packed, a 4x4 transpose per group of four lanes
+    inline void StoreInterleaved4(float* p, Float x, Float y, Float z, Float w)
+    {
+        _MM_TRANSPOSE4_PS(x.v, y.v, z.v, w.v);
+        _mm_storeu_ps(p, x.v);
+        _mm_storeu_ps(p + 4, y.v);
+        _mm_storeu_ps(p + 8, z.v);
+        _mm_storeu_ps(p + 12, w.v);
+    }
+
+    // Inverses of the two above: reads Width packed triples or quadruples into component lanes
+    inline void LoadInterleaved3(const float* p, Float& x, Float& y, Float& z)
+    {
+        __m128 a = _mm_loadu_ps(p), b = _mm_loadu_ps(p + 4), c = _mm_loadu_ps(p + 8);
+        x = _mm_shuffle_ps(a, _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm_shuffle_ps(_mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    inline void LoadInterleaved4(const float* p, Float& x, Float& y, Float& z, Float& w)
+    {
+        __m128 r0 = _mm_loadu_ps(p), r1 = _mm_loadu_ps(p + 4), r2 = _mm_loadu_ps(p + 8), r3 = _mm_loadu_ps(p + 12);
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        x = r0;
+        y = r1;
+        z = r2;
+        w = r3;
+    }
+
+    inline Mask operator&(Mask a, Mask b) { return _mm_and_ps(a.v, b.v); }
+    inline Mask operator|(Mask a, Mask b) { return _mm_or_ps(a.v, b.v); }
+    inline Mask operator~(Mask a) { return _mm_xor_ps(a.v, _mm_castsi128_ps(_mm_set1_epi32(-1))); }
+    inline bool Any(Mask a) { return _mm_movemask_ps(a.v) != 0; }
+    inline int Bits(Mask a) { return _mm_movemask_ps(a.v); }
+
+    inline Float Select(Mask m, Float a, Float b) { return _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)); }
+    inline Float MulAdd(Float a, Float b, Float c) { return _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v); }
+    inline Float Abs(Float a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+    inline Float Min(Float a, Float b) { return _mm_min_ps(a.v, b.v); }
+    inline Float Max(Float a, Float b) { return _mm_max_ps(a.v, b.v); }
+    inline Float Sqrt(Float a) { return _mm_sqrt_ps(a.v); }
+
+    inline Float Rsqrt(Float a)
+    {
+        __m128 y = _mm_rsqrt_ps(a.v);
+        __m128 ayy = _mm_mul_ps(_mm_mul_ps(a.v, y), y);
+        return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_set1_ps(0.5f), ayy)));
+    }
+
+    inline Float Rcp(Float a)
+    {
+        __m128 y = _mm_rcp_ps(a.v);
+        return _mm_mul_ps(y, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(a.v, y)));
+    }
+
+    inline Int RoundToInt(Float a) { return _mm_cvtps_epi32(a.v); }
+    inline Float ToFloat(Int a) { return _mm_cvtepi32_ps(a.v); }
+    inline Int AsInt(Float a) { return _mm_castps_si128(a.v); }
+    inline Float AsFloat(Int a) { return _mm_castsi128_ps(a.v); }
+    inline Float Pow2(Int n) { return _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n.v, _mm_set1_epi32(127)), 23)); }
+
+    inline Float SplitExponent(Float a, Int& e)
+    {
+        __m128i bits = _mm_castps_si128(a.v);
+        e = _mm_sub_epi32(_mm_and_si128(_mm_srli_epi32(bits, 23), _mm_set1_epi32(0xff)), _mm_set1_epi32(126));
+        bits = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(int32_t(0x807fffff))), _mm_set1_epi32(0x3f000000));
+        return _mm_castsi128_ps(bits);
+    }
+
+    inline Float ExpLimit(Float) { return 88.0f; }
+
+    // Double lanes, for kernels that need more than single precision internally.
+    // Only the operations used by Exp and Log are provided.
+    static constexpr int DoubleWidth = 2;
+
+    struct Double
+    {
+        __m128d v;
+        Double() = default;
+        Double(__m128d x) : v(x) {}
+        Double(double s) : v(_mm_set1_pd(s)) {}
+    };
+
+    struct DoubleInt
+    {
+        __m128i v;
+        DoubleInt() = default;
+        DoubleInt(__m128i x) : v(x) {}
+    };
+
+    struct DoubleMask
+    {
+        __m128d v;
+        DoubleMask(__m128d x) : v(x) {}
+    };
+
+    inline void Widen(Float a, Double& lo, Double& hi)
+    {
+        lo = _mm_cvtps_pd(a.v);
+        hi = _mm_cvtps_pd(_mm_movehl_ps(a.v, a.v));
+    }
+
+    inline Float Narrow(Double lo, Double hi) { return _mm_movelh_ps(_mm_cvtpd_ps(lo.v), _mm_cvtpd_ps(hi.v)); }
+
+    inline Double operator+(Double a, Double b) { return _mm_add_pd(a.v, b.v); }
+    inline Double operator-(Double a, Double b) { return _mm_sub_pd(a.v, b.v); }
+    inline Double operator*(Double a, Double b) { return _mm_mul_pd(a.v, b.v); }
+    inline Double operator/(Double a, Double b) { return _mm_div_pd(a.v, b.v); }
+    inline Double operator-(Double a) { return _mm_xor_pd(a.v, _mm_set1_pd(-0.0)); }
+
+    inline DoubleMask operator<(Double a, Double b) { return _mm_cmplt_pd(a.v, b.v); }
+    inline DoubleMask operator>(Double a, Double b) { return _mm_cmpgt_pd(a.v, b.v); }
+    inline DoubleMask operator==(Double a, Double b) { return _mm_cmpeq_pd(a.v, b.v); }
+
+    inline Double Select(DoubleMask m, Double a, Double b) { return _mm_or_pd(_mm_and_pd(m.v, a.v), _mm_andnot_pd(m.v, b.v)); }
+    inline Double MulAdd(Double a, Double b, Double c) { return _mm_add_pd(_mm_mul_pd(a.v, b.v), c.v); }
+    inline Double Min(Double a, Double b) { return _mm_min_pd(a.v, b.v); }
+    inline Double Max(Double a, Double b) { return _mm_max_pd(a.v, b.v); }
+
+    // The two 32-bit results sit in the low half of the register
+    inline DoubleInt RoundToInt(Double a) { return _mm_cvtpd_epi32(a.v); }
+    inline Double ToFloat(DoubleInt a) { return _mm_cvtepi32_pd(a.v); }
+
+    inline Double Pow2(DoubleInt n)
+    {
+        // n + 1023 is positive for the clamped Exp range, so zero-extending is enough
+        __m128i biased = _mm_unpacklo_epi32(_mm_add_epi32(n.v, _mm_set1_epi32(1023)), _mm_setzero_si128());
+        return _mm_castsi128_pd(_mm_slli_epi64(biased, 52));
+    }
+
+    inline Double SplitExponent(Double a, DoubleInt& e)
+    {
+        __m128i bits = _mm_castpd_si128(a.v);
+        __m128i exponent = _mm_and_si128(_mm_srli_epi64(bits, 52), _mm_set1_epi64x(0x7ff));
+        e = _mm_sub_epi32(_mm_shuffle_epi32(exponent, _MM_SHUFFLE(3, 3, 2, 0)), _mm_set1_epi32(1022));
+        bits = _mm_or_si128(_mm_and_si128(bits, _mm_set1_epi64x(int64_t(0x800fffffffffffffull))), _mm_set1_epi64x(0x3fe0000000000000ll));
+        return _mm_castsi128_pd(bits);
+    }
+
+    inline Double ExpLimit(Double) { return 709.0; }
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    static constexpr int Width = 8;
+
+    struct Float
+    {
+        __m256 v;
+        Float() = default;
+        Float(__m256 x) : v(x) {}
+        Float(float s) : v(_mm256_set1_ps(s)) {}
+    };
+
+    struct Int
+    {
+        __m256i v;
+        Int() = default;
+        Int(__m256i x) : v(x) {}
+        Int(int32_t s) : v(_mm256_set1_epi32(s)) {}
+    };
+
+    struct Mask
+    {
+        __m256 v;
+        Mask(__m256 x) : v(x) {}
+    };
+
+    inline Float Load(const float* p) { return _mm256_loadu_ps(p); }
+    inline void Store(float* p, Float a) { _mm256_storeu_ps(p, a.v); }
+
+    inline Float operator+(Float a, Float b) { return _mm256_add_ps(a.v, b.v); }
+    inline Float operator-(Float a, Float b) { return _mm256_sub_ps(a.v, b.v); }
+    inline Float operator*(Float a, Float b) { return _mm256_mul_ps(a.v, b.v); }
+    inline Float operator/(Float a, Float b) { return _mm256_div_ps(a.v, b.v); }
+    inline Float operator-(Float a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+
+    inline Mask operator<(Float a, Float b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+    inline Mask operator<=(Float a, Float b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ); }
+    inline Mask operator>(Float a, Float b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+    inline Mask operator>=(Float a, Float b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ); }
+    inline Mask operator==(Float a, Float b) { return _mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ); }
+
+    inline Int operator+(Int a, Int b) { return _mm256_add_epi32(a.v, b.v); }
+    inline Int operator-(Int a, Int b) { return _mm256_sub_epi32(a.v, b.v); }
+    inline Int operator&(Int a, Int b) { return _mm256_and_si256(a.v, b.v); }
+    inline Int operator^(Int a, Int b) { return _mm256_xor_si256(a.v, b.v); }
+    inline Int operator*(Int a, Int b) { return _mm256_mullo_epi32(a.v, b.v); }
+    inline Int ShiftRight(Int a, int n) { return _mm256_srli_epi32(a.v, n); }
+    inline Int operator|(Int a, Int b) { return _mm256_or_si256(a.v, b.v); }
+    inline Int ShiftLeft(Int a, int n) { return _mm256_slli_epi32(a.v, n); }
+    inline Int ShiftRightSigned(Int a, int n) { return _mm256_srai_epi32(a.v, n); }
+    inline Mask operator==(Int a, Int b) { return _mm256_castsi256_ps(_mm256_cmpeq_epi32(a.v, b.v)); }
+
+    inline Int LaneIndex() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+
+    inline Float LoadStrided(const float* p, int stride)
+    {
+        return _mm256_i32gather_ps(p, _mm256_mullo_epi32(LaneIndex().v, _mm256_set1_epi32(stride)), 4);
+    }
+
+    inline void StoreStrided(float* p, int stride, Float a)
+    {
+        alignas(32) float lanes[8];
+        _mm256_store_ps(lanes, a.v);
+        for (int i = 0; i < 8; ++i)
+            p[i * stride] = lanes[i];
+    }
+
+    inline Int Load(const int32_t* p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+    inline void Store(int32_t* p, Int a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), a.v); }
+
+    inline Int LoadStrided(const int32_t* p, int stride)
+    {
+        return _mm256_i32gather_epi32(p, _mm256_mullo_epi32(LaneIndex().v, _mm256_set1_epi32(stride)), 4);
+    }
+
+    inline void StoreStrided(int32_t* p, int stride, Int a)
+    {
+        alignas(32) int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), a.v);
+        for (int i = 0; i < 8; ++i)
+            p[i * stride] = lanes[i];
+    }
+
+    inline Int LoadWiden(const uint16_t* p) { return _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+
+    inline void StoreNarrow(uint16_t* p, Int a)
+    {
+        // Low halves to the bottom 8 bytes of each 128-bit lane, then the two lanes together
+        const __m256i low = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1,
+                                             0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1);
+        __m256i x = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(a.v, low), _MM_SHUFFLE(3, 1, 2, 0));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm256_castsi256_si128(x));
+    }
+
+    inline void StoreInterleaved3(float* p, Float x, Float y, Float z)
+    {
+        // Each 128-bit half is four whole triples
+        Sse2::StoreInterleaved3(p, _mm256_castps256_ps128(x.v), _mm256_castps256_ps128(y.v), _mm256_castps256_ps128(z.v));
+        Sse2::StoreInterleaved3(p + 12, _mm256_extractf128_ps(x.v, 1), _mm256_extractf128_ps(y.v, 1), _mm256_extractf128_ps(z.v, 1));
+    }
+
+    inline void StoreInterleaved4(float* p, Float x, Float y, Float z, Float w)
+    {
+        // Transposes within each 128-bit half: r0 holds lanes 0 and 4, r1 lanes 1 and 5, ...
+        __m256 xyLo = _mm256_unpacklo_ps(x.v, y.v), xyHi = _mm256_unpackhi_ps(x.v, y.v);
+        __m256 zwLo = _mm256_unpacklo_ps(z.v, w.v), zwHi = _mm256_unpackhi_ps(z.v, w.v);
+        __m256 r0 = _mm256_shuffle_ps(xyLo, zwLo, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 r1 = _mm256_shuffle_ps(xyLo, zwLo, _MM_SHUFFLE(3, 2, 3, 2));
+        __m256 r2 = _mm256_shuffle_ps(xyHi, zwHi, _MM_SHUFFLE(1, 0, 1, 0));
+        __m256 r3 = _mm256_shuffle_ps(xyHi, zwHi, _MM_SHUFFLE(3, 2, 3, 2));
+        _mm256_storeu_ps(p, _mm256_permute2f128_ps(r0, r1, 0x20));
+        _mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(r2, r3, 0x20));
+        _mm256_storeu_ps(p + 16, _mm256_permute2f128_ps(r0, r1, 0x31));
+        _mm256_storeu_ps(p + 24, _mm256_permute2f128_ps(r2, r3, 0x31));
+    }
+
+    // Same shuffles as Sse2, on the two 128-bit halves: the low half reads the first
+    // four elements and the high half the next four
+    inline __m256 LoadHalves(const float* lo, const float* hi)
+    {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1);
+    }
+
+    inline void LoadInterleaved3(const float* p, Float& x, Float& y, Float& z)
+    {
+        __m256 a = LoadHalves(p, p + 12), b = LoadHalves(p + 4, p + 16), c = LoadHalves(p + 8, p + 20);
+        x = _mm256_shuffle_ps(a, _mm256_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm256_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm256_shuffle_ps(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm256_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    inline void LoadInterleaved4(const float* p, Float& x, Float& y, Float& z, Float& w)
+    {
+        __m256 r0 = LoadHalves(p, p + 16), r1 = LoadHalves(p + 4, p + 20), r2 = LoadHalves(p + 8, p + 24), r3 = LoadHalves(p + 12, p + 28);
+        __m256 t0 = _mm256_unpacklo_ps(r0, r1), t1 = _mm256_unpackhi_ps(r0, r1);
+        __m256 t2 = _mm256_unpacklo_ps(r2, r3), t3 = _mm256_unpackhi_ps(r2, r3);
+        x = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        y = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        z = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        w = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    inline Mask operator&(Mask a, Mask b) { return _mm256_and_ps(a.v, b.v); }
+    inline Mask operator|(Mask a, Mask b) { return _mm256_or_ps(a.v, b.v); }
+    inline Mask operator~(Mask a) { return _mm256_xor_ps(a.v, _mm256_castsi256_ps(_mm256_set1_epi32(-1))); }
+    inline bool Any(Mask a) { return _mm256_movemask_ps(a.v) != 0; }
+    inline int Bits(Mask a) { return _mm256_movemask_ps(a.v); }
+
+    inline Float Select(Mask m, Float a, Float b) { return _mm256_blendv_ps(b.v, a.v, m.v); }
+    inline Float MulAdd(Float a, Float b, Float c) { return _mm256_fmadd_ps(a.v, b.v, c.v); }
+    inline Float Abs(Float a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+    inline Float Min(Float a, Float b) { return _mm256_min_ps(a.v, b.v); }
+    inline Float Max(Float a, Float b) { return _mm256_max_ps(a.v, b.v); }
+    inline Float Sqrt(Float a) { return _mm256_sqrt_ps(a.v); }
+
+    inline Float Rsqrt(Float a)
+    {
+        __m256 y = _mm256_rsqrt_ps(a.v);
+        __m256 ayy = _mm256_mul_ps(_mm256_mul_ps(a.v, y), y);
+        return _mm256_mul_ps(y, _mm256_fnmadd_ps(_mm256_set1_ps(0.5f), ayy, _mm256_set1_ps(1.5f)));
+    }
+
+    inline Float Rcp(Float a)
+    {
+        __m256 y = _mm256_rcp_ps(a.v);
+        return _mm256_mul_ps(y, _mm256_fnmadd_ps(a.v, y, _mm256_set1_ps(2.0f)));
+    }
+
+    inline Int RoundToInt(Float a) { return _mm256_cvtps_epi32(a.v); }
+    inline Float ToFloat(Int a) { return _mm256_cvtepi32_ps(a.v); }
+    inline Int AsInt(Float a) { return _mm256_castps_si256(a.v); }
+    inline Float AsFloat(Int a) { return _mm256_castsi256_ps(a.v); }
+    inline Float Pow2(Int n) { return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(n.v, _mm256_set1_epi32(127)), 23)); }
+
+    inline Float SplitExponent(Float a, Int& e)
+    {
+        __m256i bits = _mm256_castps_si256(a.v);
+        e = _mm256_sub_epi32(_mm256_and_si256(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(0xff)), _mm256_set1_epi32(126));
+        bits = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(int32_t(0x807fffff))), _mm256_set1_epi32(0x3f000000));
+        return _mm256_castsi256_ps(bits);
+    }
+
+    inline Float ExpLimit(Float) { return 88.0f; }
+
+    // Double lanes, for kernels that need more than single precision internally.
+    // Only the operations used by Exp and Log are provided.
+    static constexpr int DoubleWidth = 4;
+
+    struct Double
+    {
+        __m256d v;
+        Double() = default;
+        Double(__m256d x) : v(x) {}
+        Double(double s) : v(_mm256_set1_pd(s)) {}
+    };
+
+    struct DoubleInt
+    {
+        __m128i v;
+        DoubleInt() = default;
+        DoubleInt(__m128i x) : v(x) {}
+    };
+
+    struct DoubleMask
+    {
+        __m256d v;
+        DoubleMask(__m256d x) : v(x) {}
+    };
+
+    inline void Widen(Float a, Double& lo, Double& hi)
+    {
+        lo = _mm256_cvtps_pd(_mm256_castps256_ps128(a.v));
+        hi = _mm256_cvtps_pd(_mm256_extractf128_ps(a.v, 1));
+    }
+
+    inline Float Narrow(Double lo, Double hi) { return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lo.v)), _mm256_cvtpd_ps(hi.v), 1); }
+
+    inline Double operator+(Double a, Double b) { return _mm256_add_pd(a.v, b.v); }
+    inline Double operator-(Double a, Double b) { return _mm256_sub_pd(a.v, b.v); }
+    inline Double operator*(Double a, Double b) { return _mm256_mul_pd(a.v, b.v); }
+    inline Double operator/(Double a, Double b) { return _mm256_div_pd(a.v, b.v); }
+    inline Double operator-(Double a) { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)); }
+
+    inline DoubleMask operator<(Double a, Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ); }
+    inline DoubleMask operator>(Double a, Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ); }
+    inline DoubleMask operator==(Double a, Double b) { return _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ); }
+
+    inline Double Select(DoubleMask m, Double a, Double b) { return _mm256_blendv_pd(b.v, a.v, m.v); }
+    inline Double MulAdd(Double a, Double b, Double c) { return _mm256_fmadd_pd(a.v, b.v, c.v); }
+    inline Double Min(Double a, Double b) { return _mm256_min_pd(a.v, b.v); }
+    inline Double Max(Double a, Double b) { return _mm256_max_pd(a.v, b.v); }
+
+    inline DoubleInt RoundToInt(Double a) { return _mm256_cvtpd_epi32(a.v); }
+    inline Double ToFloat(DoubleInt a) { return _mm256_cvtepi32_pd(a.v); }
+
+    inline Double Pow2(DoubleInt n)
+    {
+        __m256i biased = _mm256_cvtepi32_epi64(_mm_add_epi32(n.v, _mm_set1_epi32(1023)));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(biased, 52));
+    }
+
+    inline Double SplitExponent(Double a, DoubleInt& e)
+    {
+        __m256i bits = _mm256_castpd_si256(a.v);
+        __m256i exponent = _mm256_and_si256(_mm256_srli_epi64(bits, 52), _mm256_set1_epi64x(0x7ff));
+        exponent = _mm256_permutevar8x32_epi32(exponent, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+        e = _mm_sub_epi32(_mm256_castsi256_si128(exponent), _mm_set1_epi32(1022));
+        bits = _mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi64x(int64_t(0x800fffffffffffffull))), _mm256_set1_epi64x(0x3fe0000000000000ll));
+        return _mm256_castsi256_pd(bits);
+    }
+
+    inline Double ExpLimit(Double) { return 709.0; }
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    static constexpr int Width = 16;
+
+    struct Float
+    {
+        __m512 v;
+        Float() = default;
+        Float(__m512 x) : v(x) {}
+        Float(float s) : v(_mm512_set1_ps(s)) {}
+    };
+
+    struct Int
+    {
+        __m512i v;
+        Int() = default;
+        Int(__m512i x) : v(x) {}
+        Int(int32_t s) : v(_mm512_set1_epi32(s)) {}
+    };
+
+    struct Mask
+    {
+        __mmask16 v;
+        Mask(__mmask16 x) : v(x) {}
+    };
+
+    inline Float Load(const float* p) { return _mm512_loadu_ps(p); }
+    inline void Store(float* p, Float a) { _mm512_storeu_ps(p, a.v); }
+
+    inline Float operator+(Float a, Float b) { return _mm512_add_ps(a.v, b.v); }
+    inline Float operator-(Float a, Float b) { return _mm512_sub_ps(a.v, b.v); }
+    inline Float operator*(Float a, Float b) { return _mm512_mul_ps(a.v, b.v); }
+    inline Float operator/(Float a, Float b) { return _mm512_div_ps(a.v, b.v); }
+    inline Float operator-(Float a) { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a.v), _mm512_set1_epi32(int32_t(0x80000000)))); }
+
+    inline Mask operator<(Float a, Float b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_LT_OQ); }
+    inline Mask operator<=(Float a, Float b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_LE_OQ); }
+    inline Mask operator>(Float a, Float b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_GT_OQ); }
+    inline Mask operator>=(Float a, Float b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_GE_OQ); }
+    inline Mask operator==(Float a, Float b) { return _mm512_cmp_ps_mask(a.v, b.v, _CMP_EQ_OQ); }
+
+    inline Int operator+(Int a, Int b) { return _mm512_add_epi32(a.v, b.v); }
+    inline Int operator-(Int a, Int b) { return _mm512_sub_epi32(a.v, b.v); }
+    inline Int operator&(Int a, Int b) { return _mm512_and_si512(a.v, b.v); }
+    inline Int operator^(Int a, Int b) { return _mm512_xor_si512(a.v, b.v); }
+    inline Int operator*(Int a, Int b) { return _mm512_mullo_epi32(a.v, b.v); }
+    inline Int ShiftRight(Int a, int n) { return _mm512_srli_epi32(a.v, unsigned(n)); }
+    inline Int operator|(Int a, Int b) { return _mm512_or_si512(a.v, b.v); }
+    inline Int ShiftLeft(Int a, int n) { return _mm512_slli_epi32(a.v, unsigned(n)); }
+    inline Int ShiftRightSigned(Int a, int n) { return _mm512_srai_epi32(a.v, unsigned(n)); }
+    inline Mask operator==(Int a, Int b) { return _mm512_cmpeq_epi32_mask(a.v, b.v); }
+
+    inline Int LaneIndex() { return _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15); }
+
+    inline Float LoadStrided(const float* p, int stride)
+    {
+        return _mm512_i32gather_ps(_mm512_mullo_epi32(LaneIndex().v, _mm512_set1_epi32(stride)), p, 4);
+    }
+
+    inline void StoreStrided(float* p, int stride, Float a)
+    {
+        _mm512_i32scatter_ps(p, _mm512_mullo_epi32(LaneIndex().v, _mm512_set1_epi32(stride)), a.v, 4);
+    }
+
+    inline Int Load(const int32_t* p) { return _mm512_loadu_si512(p); }
+    inline void Store(int32_t* p, Int a) { _mm512_storeu_si512(p, a.v); }
+
+    inline Int LoadStrided(const int32_t* p, int stride)
+    {
+        return _mm512_i32gather_epi32(_mm512_mullo_epi32(LaneIndex().v, _mm512_set1_epi32(stride)), p, 4);
+    }
+
+    inline void StoreStrided(int32_t* p, int stride, Int a)
+    {
+        _mm512_i32scatter_epi32(p, _mm512_mullo_epi32(LaneIndex().v, _mm512_set1_epi32(stride)), a.v, 4);
+    }
+
+    inline Int LoadWiden(const uint16_t* p) { return _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))); }
+    inline void StoreNarrow(uint16_t* p, Int a) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm512_cvtepi32_epi16(a.v)); }
+
+    inline void StoreInterleaved3(float* p, Float x, Float y, Float z)
+    {
+        // Float j of the output is component j % 3 of lane j / 3
+        const __m512i first = _mm512_setr_epi32(0, 0, 0, 1, 1, 1, 2, 2, 2, 3, 3, 3, 4, 4, 4, 5);
+        const __m512i second = _mm512_setr_epi32(5, 5, 6, 6, 6, 7, 7, 7, 8, 8, 8, 9, 9, 9, 10, 10);
+        const __m512i third = _mm512_setr_epi32(10, 11, 11, 11, 12, 12, 12, 13, 13, 13, 14, 14, 14, 15, 15, 15);
+
+        __m512 v = _mm512_mask_permutexvar_ps(_mm512_permutexvar_ps(first, x.v), 0x2492, first, y.v);
+        _mm512_storeu_ps(p, _mm512_mask_permutexvar_ps(v, 0x4924, first, z.v));
+        v = _mm512_mask_permutexvar_ps(_mm512_permutexvar_ps(second, x.v), 0x9249, second, y.v);
+        _mm512_storeu_ps(p + 16, _mm512_mask_permutexvar_ps(v, 0x2492, second, z.v));
+        v = _mm512_mask_permutexvar_ps(_mm512_permutexvar_ps(third, x.v), 0x4924, third, y.v);
+        _mm512_storeu_ps(p + 32, _mm512_mask_permutexvar_ps(v, 0x9249, third, z.v));
+    }
+
+    inline __m256 UpperHalf(Float a) { return _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a.v), 1)); }
+
+    inline void StoreInterleaved4(float* p, Float x, Float y, Float z, Float w)
+    {
+        // Each 256-bit half is eight whole quadruples; extractf32x8 would need AVX-512DQ
+        Avx2::StoreInterleaved4(p, _mm512_castps512_ps256(x.v), _mm512_castps512_ps256(y.v), _mm512_castps512_ps256(z.v), _mm512_castps512_ps256(w.v));
+        Avx2::StoreInterleaved4(p + 32, UpperHalf(x), UpperHalf(y), UpperHalf(z), UpperHalf(w));
+    }
+
+    // Same shuffles as Sse2, on the four 128-bit quarters: quarter k reads p + k * stride
+    inline __m512 LoadQuarters(const float* p, int stride)
+    {
+        __m512 v = _mm512_castps128_ps512(_mm_loadu_ps(p));
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(p + stride), 1);
+        v = _mm512_insertf32x4(v, _mm_loadu_ps(p + 2 * stride), 2);
+        return _mm512_insertf32x4(v, _mm_loadu_ps(p + 3 * stride), 3);
+    }
+
+    inline void LoadInterleaved3(const float* p, Float& x, Float& y, Float& z)
+    {
+        __m512 a = LoadQuarters(p, 12), b = LoadQuarters(p + 4, 12), c = LoadQuarters(p + 8, 12);
+        x = _mm512_shuffle_ps(a, _mm512_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+        y = _mm512_shuffle_ps(_mm512_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1)), _mm512_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+        z = _mm512_shuffle_ps(_mm512_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2)), _mm512_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+    }
+
+    inline void LoadInterleaved4(const float* p, Float& x, Float& y, Float& z, Float& w)
+    {
+        __m512 r0 = LoadQuarters(p, 16), r1 = LoadQuarters(p + 4, 16), r2 = LoadQuarters(p + 8, 16), r3 = LoadQuarters(p + 12, 16);
+        __m512 t0 = _mm512_unpacklo_ps(r0, r1), t1 = _mm512_unpackhi_ps(r0, r1);
+        __m512 t2 = _mm512_unpacklo_ps(r2, r3), t3 = _mm512_unpackhi_ps(r2, r3);
+        x = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        y = _mm512_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        z = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        w = _mm512_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+    }
+
+    inline Mask operator&(Mask a, Mask b) { return __mmask16(a.v & b.v); }
+    inline Mask operator|(Mask a, Mask b) { return __mmask16(a.v | b.v); }
+    inline Mask operator~(Mask a) { return __mmask16(~a.v); }
+    inline bool Any(Mask a) { return a.v != 0; }
+    inline int Bits(Mask a) { return int(a.v); }
+
+    inline Float Select(Mask m, Float a, Float b) { return _mm512_mask_blend_ps(m.v, b.v, a.v); }
+    inline Float MulAdd(Float a, Float b, Float c) { return _mm512_fmadd_ps(a.v, b.v, c.v); }
+    inline Float Abs(Float a) { return _mm512_abs_ps(a.v); }
+    inline Float Min(Float a, Float b) { return _mm512_min_ps(a.v, b.v); }
+    inline Float Max(Float a, Float b) { return _mm512_max_ps(a.v, b.v); }
+    inline Float Sqrt(Float a) { return _mm512_sqrt_ps(a.v); }
+
+    inline Float Rsqrt(Float a)
+    {
+        // 14-bit estimate refined by one Newton-Raphson step
+        __m512 y = _mm512_rsqrt14_ps(a.v);
+        __m512 ayy = _mm512_mul_ps(_mm512_mul_ps(a.v, y), y);
+        return _mm512_mul_ps(y, _mm512_fnmadd_ps(_mm512_set1_ps(0.5f), ayy, _mm512_set1_ps(1.5f)));
+    }
+
+    inline Float Rcp(Float a)
+    {
+        __m512 y = _mm512_rcp14_ps(a.v);
+        return _mm512_mul_ps(y, _mm512_fnmadd_ps(a.v, y, _mm512_set1_ps(2.0f)));
+    }
+
+    inline Int RoundToInt(Float a) { return _mm512_cvtps_epi32(a.v); }
+    inline Float ToFloat(Int a) { return _mm512_cvtepi32_ps(a.v); }
+    inline Int AsInt(Float a) { return _mm512_castps_si512(a.v); }
+    inline Float AsFloat(Int a) { return _mm512_castsi512_ps(a.v); }
+    inline Float Pow2(Int n) { return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_add_epi32(n.v, _mm512_set1_epi32(127)), 23)); }
+
+    inline Float SplitExponent(Float a, Int& e)
+    {
+        __m512i bits = _mm512_castps_si512(a.v);
+        e = _mm512_sub_epi32(_mm512_and_si512(_mm512_srli_epi32(bits, 23), _mm512_set1_epi32(0xff)), _mm512_set1_epi32(126));
+        bits = _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(int32_t(0x807fffff))), _mm512_set1_epi32(0x3f000000));
+        return _mm512_castsi512_ps(bits);
+    }
+
+    inline Float ExpLimit(Float) { return 88.0f; }
+
+    // Double lanes, for kernels that need more than single precision internally.
+    // Only the operations used by Exp and Log are provided.
+    static constexpr int DoubleWidth = 8;
+
+    struct Double
+    {
+        __m512d v;
+        Double() = default;
+        Double(__m512d x) : v(x) {}
+        Double(double s) : v(_mm512_set1_pd(s)) {}
+    };
+
+    struct DoubleInt
+    {
+        __m256i v;
+        DoubleInt() = default;
+        DoubleInt(__m256i x) : v(x) {}
+    };
+
+    struct DoubleMask
+    {
+        __mmask8 v;
+        DoubleMask(__mmask8 x) : v(x) {}
+    };
+
+    inline void Widen(Float a, Double& lo, Double& hi)
+    {
+        lo = _mm512_cvtps_pd(_mm512_castps512_ps256(a.v));
+        hi = _mm512_cvtps_pd(_mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(a.v), 1)));
+    }
+
+    inline Float Narrow(Double lo, Double hi)
+    {
+        __m512d packed = _mm512_insertf64x4(_mm512_castpd256_pd512(_mm256_castps_pd(_mm512_cvtpd_ps(lo.v))), _mm256_castps_pd(_mm512_cvtpd_ps(hi.v)), 1);
+        return _mm512_castpd_ps(packed);
+    }
+
+    inline Double operator+(Double a, Double b) { return _mm512_add_pd(a.v, b.v); }
+    inline Double operator-(Double a, Double b) { return _mm512_sub_pd(a.v, b.v); }
+    inline Double operator*(Double a, Double b) { return _mm512_mul_pd(a.v, b.v); }
+    inline Double operator/(Double a, Double b) { return _mm512_div_pd(a.v, b.v); }
+    inline Double operator-(Double a) { return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a.v), _mm512_set1_epi64(int64_t(0x8000000000000000ull)))); }
+
+    inline DoubleMask operator<(Double a, Double b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ); }
+    inline DoubleMask operator>(Double a, Double b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ); }
+    inline DoubleMask operator==(Double a, Double b) { return _mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ); }
+
+    inline Double Select(DoubleMask m, Double a, Double b) { return _mm512_mask_blend_pd(m.v, b.v, a.v); }
+    inline Double MulAdd(Double a, Double b, Double c) { return _mm512_fmadd_pd(a.v, b.v, c.v); }
+    inline Double Min(Double a, Double b) { return _mm512_min_pd(a.v, b.v); }
+    inline Double Max(Double a, Double b) { return _mm512_max_pd(a.v, b.v); }
+
+    inline DoubleInt RoundToInt(Double a) { return _mm512_cvtpd_epi32(a.v); }
+    inline Double ToFloat(DoubleInt a) { return _mm512_cvtepi32_pd(a.v); }
+
+    inline Double Pow2(DoubleInt n)
+    {
+        __m512i biased = _mm512_cvtepi32_epi64(_mm256_add_epi32(n.v, _mm256_set1_epi32(1023)));
+        return _mm512_castsi512_pd(_mm512_slli_epi64(biased, 52));
+    }
+
+    inline Double SplitExponent(Double a, DoubleInt& e)
+    {
+        __m512i bits = _mm512_castpd_si512(a.v);
+        __m512i exponent = _mm512_and_si512(_mm512_srli_epi64(bits, 52), _mm512_set1_epi64(0x7ff));
+        e = _mm256_sub_epi32(_mm512_cvtepi64_epi32(exponent), _mm256_set1_epi32(1022));
+        bits = _mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi64(int64_t(0x800fffffffffffffull))), _mm512_set1_epi64(0x3fe0000000000000ll));
+        return _mm512_castsi512_pd(bits);
+    }
+
+    inline Double ExpLimit(Double) { return 709.0; }
+}
+SMATH_END_TARGET
+#endif
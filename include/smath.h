@@ -24,4 +24,29 @@
 #include "rect.h"
 #include "box.h"
 #include "random.h"
+#include "decomposition.h"
+#include "fastmath.h"
+#include "batchmath.h"
+#include "batchops.h"
+#include "boxbounds.h"
+#include "frustum.h"
+#include "sphere.h"
+#include "orientedbox.h"
+#include "widebvh.h"
+#include "quantizedbvh.h"
+#include "bvhcache.h"
+#include "kdtree.h"
+#include "spatialhashgrid.h"
+#include "normalencoding.h"
+#include "quaternionencoding.h"
+#include "half.h"
+#include "gpulayout.h"
+#include "batchquaternion.h"
+#include "animationtrack.h"
+#include "curve.h"
+#include "batchcurve.h"
+#include "primitives.h"
+#include "batchintersection.h"
+#include "tilescheduler.h"
+#include "recttree.h"
 
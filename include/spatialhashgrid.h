@@ -0,0 +1,87 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <bit>
+#include <cmath>
+#include <atomic>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include "linalg.h"
+#include "spatialquery.h"
+
+namespace SMath
+{
+    /**
+     * Uniform grid over points with the cells hashed into a table, so the
+     * extent of the points does not matter. Neighbouring cells along x map
+     * to neighbouring buckets, which turns a radius query into a few
+     * contiguous ranges of points. The build is a counting sort:
+     * m_CellStart[h] to m_CellStart[h + 1] is the range of m_Points and
+     * m_Indices whose cell hashes to h. Meant to be rebuilt every frame.
+     *
+     * Within a bucket, points keep their input order when built on one
+     * thread and are in no particular order otherwise.
+     */
+    template<typename T>
+    class SpatialHashGrid
+    {
+    public:
+        SpatialHashGrid() = default;
+        // cellSize around the query radius works best. threadCount <= 0 picks one thread
+        // per Simd::MinParallelChunk points.
+        SpatialHashGrid(std::span<const Point<T, 3>> points, T cellSize, int threadCount = 0);
+        ~SpatialHashGrid() = default;
+
+    public:
+        size_t GetSize() const;
+        T GetCellSize() const;
+        Point<int, 3> GetCell(const Point<T, 3>& point) const;
+        uint32_t GetBucket(const Point<int, 3>& cell) const;
+
+        // Calls func(index, squareDistance) for every point within radius (inclusive)
+        template<typename Func>
+        void ForEachInRadius(const Point<T, 3>& point, T radius, Func&& func) const;
+
+        // Appends the points within radius in no particular order. Returns how many were appended.
+        size_t FindInRadius(const Point<T, 3>& point, T radius, std::vector<uint32_t>& indices) const;
+
+        // Batch queries split across threads. The result of query q is indices[offsets[q]]
+        // to indices[offsets[q + 1]].
+        void FindInRadius(std::span<const Point<T, 3>> points, T radius, std::vector<uint32_t>& indices,
+                          std::vector<size_t>& offsets, int threadCount = 0) const;
+
+    public:
+        T m_CellSize = T(1);
+        T m_InvCellSize = T(1);
+        uint32_t m_BucketMask = 0;
+
+        std::vector<uint32_t> m_CellStart;
+        // Sorted by bucket, m_Indices[i] is the input index of m_Points[i]
+        std::vector<Point<T, 3>> m_Points;
+        std::vector<uint32_t> m_Indices;
+    };
+
+    #include "spatialhashgrid_impl.h"
+}
@@ -0,0 +1,195 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T>
+SpatialHashGrid<T>::SpatialHashGrid(std::span<const Point<T, 3>> points, T cellSize, int threadCount)
+    : m_CellSize(cellSize)
+    , m_InvCellSize(T(1) / cellSize)
+{
+    assert(cellSize > T(0) && points.size() < 0xffffffffu);
+
+    // Twice as many buckets as points keeps collisions between occupied cells rare
+    size_t count = points.size();
+    size_t bucketCount = std::bit_ceil(std::max<size_t>(count, 1)) * 2;
+    m_BucketMask = uint32_t(bucketCount - 1);
+
+    m_CellStart.assign(bucketCount + 1, 0);
+    m_Points.resize(count);
+    m_Indices.resize(count);
+
+    std::vector<uint32_t> buckets(count);
+    int threads = Simd::GetThreadCount(count, threadCount);
+
+    // Counting sort: histogram, exclusive prefix sum, scatter. Threads share the counters.
+    Simd::ParallelSlices(count, threads, [&](size_t begin, size_t end, int) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            uint32_t bucket = GetBucket(GetCell(points[i]));
+            buckets[i] = bucket;
+            if (threads > 1)
+                std::atomic_ref<uint32_t>(m_CellStart[bucket + 1]).fetch_add(1, std::memory_order_relaxed);
+            else
+                ++m_CellStart[bucket + 1];
+        }
+    });
+
+    for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+        m_CellStart[bucket + 1] += m_CellStart[bucket];
+
+    std::vector<uint32_t> cursor(m_CellStart.begin(), m_CellStart.end() - 1);
+    Simd::ParallelSlices(count, threads, [&](size_t begin, size_t end, int) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            uint32_t slot = threads > 1 ? std::atomic_ref<uint32_t>(cursor[buckets[i]]).fetch_add(1, std::memory_order_relaxed)
+                                        : cursor[buckets[i]]++;
+            m_Points[slot] = points[i];
+            m_Indices[slot] = uint32_t(i);
+        }
+    });
+}
+
+template<typename T>
+size_t SpatialHashGrid<T>::GetSize() const
+{
+    return m_Points.size();
+}
+
+template<typename T>
+T SpatialHashGrid<T>::GetCellSize() const
+{
+    return m_CellSize;
+}
+
+template<typename T>
+Point<int, 3> SpatialHashGrid<T>::GetCell(const Point<T, 3>& point) const
+{
+    return Point<int, 3>(int(std::floor(point.x * m_InvCellSize)),
+                         int(std::floor(point.y * m_InvCellSize)),
+                         int(std::floor(point.z * m_InvCellSize)));
+}
+
+template<typename T>
+uint32_t SpatialHashGrid<T>::GetBucket(const Point<int, 3>& cell) const
+{
+    // Rows along x are hashed as a whole (Teschner et al. 2003, plus a final mix) and
+    // cells within a row stay adjacent, so a query reads a row of cells as one range
+    uint32_t row = (uint32_t(cell.y) * 73856093u) ^ (uint32_t(cell.z) * 19349663u);
+    row ^= row >> 16;
+    row *= 0x7feb352du;
+    row ^= row >> 15;
+    return (row + uint32_t(cell.x)) & m_BucketMask;
+}
+
+template<typename T>
+template<typename Func>
+void SpatialHashGrid<T>::ForEachInRadius(const Point<T, 3>& point, T radius, Func&& func) const
+{
+    if (m_Points.empty())
+        return;
+
+    Point<int, 3> lo = GetCell(Point<T, 3>(point.x - radius, point.y - radius, point.z - radius));
+    Point<int, 3> hi = GetCell(Point<T, 3>(point.x + radius, point.y + radius, point.z + radius));
+    size_t rowLength = size_t(hi.x - lo.x + 1);
+    size_t rowCount = size_t(hi.y - lo.y + 1) * size_t(hi.z - lo.z + 1);
+    size_t bucketCount = m_CellStart.size() - 1;
+    T squareRadius = radius * radius;
+
+    auto visit = [&](uint32_t first, uint32_t last) {
+        for (uint32_t i = m_CellStart[first]; i < m_CellStart[last]; ++i)
+        {
+            Vector<T, 3> offset = m_Points[i] - point;
+            T squareDistance = offset.x * offset.x + offset.y * offset.y + offset.z * offset.z;
+            if (squareDistance <= squareRadius)
+                func(m_Indices[i], squareDistance);
+        }
+    };
+
+    // Covering more cells than there are buckets: every bucket is visited anyway
+    if (rowLength * rowCount >= bucketCount)
+    {
+        visit(0, uint32_t(bucketCount));
+        return;
+    }
+
+    // Bucket ranges [first, last) of the rows, split where they wrap around the table
+    struct Range
+    {
+        uint32_t m_First;
+        uint32_t m_Last;
+    };
+
+    Range local[64];
+    std::vector<Range> overflow;
+    Range* ranges = local;
+    if (rowCount * 2 > std::size(local))
+    {
+        overflow.resize(rowCount * 2);
+        ranges = overflow.data();
+    }
+
+    size_t n = 0;
+    for (int z = lo.z; z <= hi.z; ++z)
+    {
+        for (int y = lo.y; y <= hi.y; ++y)
+        {
+            uint32_t first = GetBucket(Point<int, 3>(lo.x, y, z));
+            if (first + rowLength <= bucketCount)
+                ranges[n++] = { first, uint32_t(first + rowLength) };
+            else
+            {
+                ranges[n++] = { first, uint32_t(bucketCount) };
+                ranges[n++] = { 0, uint32_t(first + rowLength - bucketCount) };
+            }
+        }
+    }
+
+    // Distinct rows can share buckets, so merge overlapping ranges to visit each bucket once
+    std::sort(ranges, ranges + n, [](const Range& a, const Range& b) { return a.m_First < b.m_First; });
+    Range current = ranges[0];
+    for (size_t i = 1; i < n; ++i)
+    {
+        if (ranges[i].m_First <= current.m_Last)
+            current.m_Last = std::max(current.m_Last, ranges[i].m_Last);
+        else
+        {
+            visit(current.m_First, current.m_Last);
+            current = ranges[i];
+        }
+    }
+    visit(current.m_First, current.m_Last);
+}
+
+template<typename T>
+size_t SpatialHashGrid<T>::FindInRadius(const Point<T, 3>& point, T radius, std::vector<uint32_t>& indices) const
+{
+    size_t first = indices.size();
+    ForEachInRadius(point, radius, [&](uint32_t index, T) { indices.push_back(index); });
+    return indices.size() - first;
+}
+
+template<typename T>
+void SpatialHashGrid<T>::FindInRadius(std::span<const Point<T, 3>> points, T radius, std::vector<uint32_t>& indices,
+                                      std::vector<size_t>& offsets, int threadCount) const
+{
+    int threads = Simd::GetQueryThreadCount(points.size(), threadCount);
+    Simd::GatherQueries(points.size(), threads, indices, offsets, [&](size_t q, std::vector<uint32_t>& out) {
+        return FindInRadius(points[q], radius, out);
+    });
+}
@@ -0,0 +1,67 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "parallel.h"
+
+/**
+ * Scheduling for batches of spatial queries, shared by KdTree and
+ * SpatialHashGrid: how many threads a batch is worth, and how the
+ * variable-length results of each query are gathered into one array.
+ */
+namespace SMath::Simd
+{
+    // A k-d tree or hash grid query costs roughly what bounding a thousand points does
+    inline constexpr size_t QueryCost = 1024;
+
+    // As GetThreadCount for a batch of queries, so one thread per MinParallelChunk / QueryCost (256) queries
+    inline int GetQueryThreadCount(size_t queryCount, int threadCount)
+    {
+        return GetThreadCount(queryCount * QueryCost, threadCount);
+    }
+
+    // Runs the variable-length queries [0, queryCount) on threadCount slices. query(q, out) appends the
+    // results of query q to out and returns how many; they end up in indices[offsets[q]] to indices[offsets[q + 1]].
+    template <typename Query>
+    inline void GatherQueries(size_t queryCount, int threadCount, std::vector<uint32_t>& indices, std::vector<size_t>& offsets, Query query)
+    {
+        std::vector<std::vector<uint32_t>> sliceIndices(threadCount);
+        offsets.assign(queryCount + 1, 0);
+
+        // Slices cover the queries in order, so concatenating them keeps the query order.
+        // offsets[q + 1] holds the count of query q until the prefix sum.
+        ParallelSlices(queryCount, threadCount, [&](size_t begin, size_t end, int slice) {
+            for (size_t q = begin; q < end; ++q)
+                offsets[q + 1] = query(q, sliceIndices[slice]);
+        });
+
+        for (size_t q = 0; q < queryCount; ++q)
+            offsets[q + 1] += offsets[q];
+
+        indices.clear();
+        indices.reserve(offsets.back());
+        for (const std::vector<uint32_t>& slice : sliceIndices)
+            indices.insert(indices.end(), slice.begin(), slice.end());
+    }
+}
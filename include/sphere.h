@@ -0,0 +1,87 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <cassert>
+#include <limits>
+#include <type_traits>
+#include "linalg.h"
+#include "box.h"
+#include "ray.h"
+#include "spherefit.h"
+
+namespace SMath
+{
+    /**
+     * Bounding sphere. Fit* build a sphere covering a point set in two passes
+     * over the points: one for the extreme points along x, y and z, and one
+     * Ritter growth pass. Float points run both passes on the dispatched SIMD
+     * level.
+     */
+    template<typename T>
+    class Sphere
+    {
+    public:
+        Sphere() = default;
+        Sphere(const Point<T, 3>& center, T radius);
+        ~Sphere() = default;
+
+    public:
+        bool Contains(const Point<T, 3>& point) const;
+        bool Contains(const Sphere& sphere) const;
+        bool Intersects(const Sphere& sphere) const;
+        bool Intersects(const Box<T>& box) const;
+
+        // Nearest hit within [m_TMin, m_TMax]. A ray starting inside hits the far side.
+        bool Intersects(const Ray<T>& ray, T& t) const;
+        // As above with the normal and spherical (u, v) = (phi / 2pi, theta / pi) around z
+        bool Intersect(const Ray<T>& ray, RayHit<T>& hit) const;
+        // Fills the rest of a hit whose m_T is set
+        void CompleteHit(const Ray<T>& ray, RayHit<T>& hit) const;
+
+        // Covers the transformed sphere under the largest axis scale of m
+        Sphere Transformed(const Matrix<T, 4>& m) const;
+
+    public:
+        // Smallest sphere covering both
+        static Sphere Union(const Sphere& a, const Sphere& b);
+
+        // Ritter: starts from the most separated pair of axis extremes. Typically 5-20% larger than optimal.
+        static Sphere FitRitter(std::span<const Point<T, 3>> points);
+
+        // EPOS-6 (Larsson): starts from the minimum sphere of the six axis extremes,
+        // which usually lands within a few percent of optimal for the same cost
+        static Sphere FitEpos6(std::span<const Point<T, 3>> points);
+
+    private:
+        static void FindExtremePoints(std::span<const Point<T, 3>> points, Point<T, 3>* extremes);
+        static void Grow(std::span<const Point<T, 3>> points, Sphere& sphere);
+        static Sphere Circumscribe(const Point<T, 3>& a, const Point<T, 3>& b, const Point<T, 3>& c);
+        static Sphere Circumscribe(const Point<T, 3>& a, const Point<T, 3>& b, const Point<T, 3>& c, const Point<T, 3>& d);
+
+    public:
+        Point<T, 3> m_Center;
+        T m_Radius = T(0);
+    };
+
+    #include "sphere_impl.h"
+}
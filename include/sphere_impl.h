@@ -0,0 +1,313 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T>
+Sphere<T>::Sphere(const Point<T, 3>& center, T radius)
+    : m_Center(center)
+    , m_Radius(radius)
+{
+}
+
+template<typename T>
+bool Sphere<T>::Contains(const Point<T, 3>& point) const
+{
+    Vector<T, 3> offset = point - m_Center;
+    return Vector<T, 3>::Dot(offset, offset) <= m_Radius * m_Radius;
+}
+
+template<typename T>
+bool Sphere<T>::Contains(const Sphere& sphere) const
+{
+    return (sphere.m_Center - m_Center).Magnitude() + sphere.m_Radius <= m_Radius;
+}
+
+template<typename T>
+bool Sphere<T>::Intersects(const Sphere& sphere) const
+{
+    Vector<T, 3> offset = sphere.m_Center - m_Center;
+    T reach = m_Radius + sphere.m_Radius;
+    return Vector<T, 3>::Dot(offset, offset) <= reach * reach;
+}
+
+template<typename T>
+bool Sphere<T>::Intersects(const Box<T>& box) const
+{
+    // Distance from the center to the closest point of the box
+    T squareDistance = T(0);
+    for (int i = 0; i < 3; ++i)
+    {
+        T d = std::max(box.m_Min[i] - m_Center[i], T(0)) + std::max(m_Center[i] - box.m_Max[i], T(0));
+        squareDistance += d * d;
+    }
+
+    return squareDistance <= m_Radius * m_Radius;
+}
+
+template<typename T>
+bool Sphere<T>::Intersects(const Ray<T>& ray, T& t) const
+{
+    Vector<T, 3> oc = ray.m_Origin - m_Center;
+    T a = Vector<T, 3>::Dot(ray.m_Direction, ray.m_Direction);
+    T b = Vector<T, 3>::Dot(oc, ray.m_Direction);
+    T c = Vector<T, 3>::Dot(oc, oc) - m_Radius * m_Radius;
+
+    // b^2 - ac loses every digit once the ray starts far away relative to the radius. The same
+    // value from the offset of the center to the closest point on the line does not
+    // (Haines et al., Ray Tracing Gems ch. 7).
+    Vector<T, 3> closest = oc - ray.m_Direction * (b / a);
+    T discriminant = a * (m_Radius * m_Radius - Vector<T, 3>::Dot(closest, closest));
+    if (discriminant < T(0))
+        return false;
+
+    // q and c / q avoid the cancellation of -b +- sqrt(discriminant) for the smaller root
+    T q = -(b + std::copysign(std::sqrt(discriminant), b));
+    T t0 = q != T(0) ? q / a : T(0);
+    T t1 = q != T(0) ? c / q : T(0);
+    if (t0 > t1)
+        std::swap(t0, t1);
+
+    if (t0 >= ray.m_TMin && t0 <= ray.m_TMax)
+        t = t0;
+    else if (t1 >= ray.m_TMin && t1 <= ray.m_TMax)
+        t = t1;
+    else
+        return false;
+
+    return true;
+}
+
+template<typename T>
+bool Sphere<T>::Intersect(const Ray<T>& ray, RayHit<T>& hit) const
+{
+    T t;
+    if (!Intersects(ray, t))
+        return false;
+
+    hit.m_T = t;
+    CompleteHit(ray, hit);
+    return true;
+}
+
+template<typename T>
+void Sphere<T>::CompleteHit(const Ray<T>& ray, RayHit<T>& hit) const
+{
+    Vector<T, 3> offset = (ray.m_Origin - m_Center) + ray.m_Direction * hit.m_T;
+    hit.m_Normal = offset.Normalized();
+
+    T phi = std::atan2(hit.m_Normal.y, hit.m_Normal.x);
+    hit.m_U = (phi < T(0) ? phi + T(2 * Pi) : phi) * T(0.5 / Pi);
+    hit.m_V = std::acos(std::clamp(hit.m_Normal.z, T(-1), T(1))) * T(1 / Pi);
+}
+
+template<typename T>
+Sphere<T> Sphere<T>::Transformed(const Matrix<T, 4>& m) const
+{
+    Point<T, 3> center;
+    T maxScale = T(0);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        center[i] = m.m_Data2D[i][0] * m_Center.x + m.m_Data2D[i][1] * m_Center.y + m.m_Data2D[i][2] * m_Center.z + m.m_Data2D[i][3];
+
+        T column = m.m_Data2D[0][i] * m.m_Data2D[0][i] + m.m_Data2D[1][i] * m.m_Data2D[1][i] + m.m_Data2D[2][i] * m.m_Data2D[2][i];
+        maxScale = std::max(maxScale, column);
+    }
+
+    return Sphere(center, m_Radius * std::sqrt(maxScale));
+}
+
+template<typename T>
+Sphere<T> Sphere<T>::Union(const Sphere& a, const Sphere& b)
+{
+    Vector<T, 3> offset = b.m_Center - a.m_Center;
+    T distance = offset.Magnitude();
+
+    if (distance + b.m_Radius <= a.m_Radius)
+        return a;
+    if (distance + a.m_Radius <= b.m_Radius)
+        return b;
+
+    T radius = (distance + a.m_Radius + b.m_Radius) * T(0.5);
+    return Sphere(a.m_Center + offset * ((radius - a.m_Radius) / distance), radius);
+}
+
+template<typename T>
+Sphere<T> Sphere<T>::FitRitter(std::span<const Point<T, 3>> points)
+{
+    Point<T, 3> extremes[6];
+    FindExtremePoints(points, extremes);
+
+    int axis = 0;
+    T maxSquareDistance = T(-1);
+    for (int i = 0; i < 3; ++i)
+    {
+        Vector<T, 3> span = extremes[2 * i + 1] - extremes[2 * i];
+        if (Vector<T, 3>::Dot(span, span) > maxSquareDistance)
+        {
+            maxSquareDistance = Vector<T, 3>::Dot(span, span);
+            axis = i;
+        }
+    }
+
+    Vector<T, 3> diameter = extremes[2 * axis + 1] - extremes[2 * axis];
+    Sphere sphere(extremes[2 * axis] + diameter * T(0.5), std::sqrt(maxSquareDistance) * T(0.5));
+    Grow(points, sphere);
+    return sphere;
+}
+
+template<typename T>
+Sphere<T> Sphere<T>::FitEpos6(std::span<const Point<T, 3>> points)
+{
+    Point<T, 3> extremes[6];
+    FindExtremePoints(points, extremes);
+
+    // Minimum sphere of the six extremes by brute force: it is either spanned by two
+    // of them, circumscribes three, or circumscribes four
+    const T tolerance = T(1) + T(64) * std::numeric_limits<T>::epsilon();
+    auto coversExtremes = [&](const Sphere& s)
+    {
+        T limit = s.m_Radius * tolerance;
+        for (const Point<T, 3>& e : extremes)
+        {
+            Vector<T, 3> offset = e - s.m_Center;
+            if (Vector<T, 3>::Dot(offset, offset) > limit * limit)
+                return false;
+        }
+        return true;
+    };
+
+    Sphere best(extremes[0], std::numeric_limits<T>::infinity());
+    auto consider = [&](const Sphere& candidate)
+    {
+        if (candidate.m_Radius < best.m_Radius && coversExtremes(candidate))
+            best = candidate;
+    };
+
+    for (int i = 0; i < 6; ++i)
+    {
+        for (int j = i + 1; j < 6; ++j)
+        {
+            Vector<T, 3> diameter = extremes[j] - extremes[i];
+            consider(Sphere(extremes[i] + diameter * T(0.5), diameter.Magnitude() * T(0.5)));
+
+            for (int k = j + 1; k < 6; ++k)
+            {
+                consider(Circumscribe(extremes[i], extremes[j], extremes[k]));
+
+                for (int l = k + 1; l < 6; ++l)
+                    consider(Circumscribe(extremes[i], extremes[j], extremes[k], extremes[l]));
+            }
+        }
+    }
+
+    // Rounding can leave every candidate marginally short; the growth pass then starts from a point
+    if (best.m_Radius == std::numeric_limits<T>::infinity())
+        best.m_Radius = T(0);
+
+    Grow(points, best);
+    return best;
+}
+
+template<typename T>
+void Sphere<T>::FindExtremePoints(std::span<const Point<T, 3>> points, Point<T, 3>* extremes)
+{
+    assert(!points.empty());
+
+    if constexpr (std::is_same_v<T, float>)
+    {
+        std::array<Point<float, 3>, 6> found = Batch::ExtremePoints(points);
+        for (int e = 0; e < 6; ++e)
+            extremes[e] = found[e];
+    }
+    else
+    {
+        for (int e = 0; e < 6; ++e)
+            extremes[e] = points[0];
+
+        for (const Point<T, 3>& p : points)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if (p[axis] < extremes[2 * axis][axis])
+                    extremes[2 * axis] = p;
+                if (p[axis] > extremes[2 * axis + 1][axis])
+                    extremes[2 * axis + 1] = p;
+            }
+        }
+    }
+}
+
+template<typename T>
+void Sphere<T>::Grow(std::span<const Point<T, 3>> points, Sphere& sphere)
+{
+    if constexpr (std::is_same_v<T, float>)
+    {
+        Batch::GrowSphere(points, sphere.m_Center, sphere.m_Radius);
+    }
+    else
+    {
+        for (const Point<T, 3>& p : points)
+        {
+            Vector<T, 3> offset = p - sphere.m_Center;
+            T squareDistance = Vector<T, 3>::Dot(offset, offset);
+
+            if (squareDistance > sphere.m_Radius * sphere.m_Radius)
+            {
+                T distance = std::sqrt(squareDistance);
+                T grown = (sphere.m_Radius + distance) * T(0.5);
+                sphere.m_Center = sphere.m_Center + offset * ((grown - sphere.m_Radius) / distance);
+                sphere.m_Radius = grown;
+            }
+        }
+    }
+}
+
+template<typename T>
+Sphere<T> Sphere<T>::Circumscribe(const Point<T, 3>& a, const Point<T, 3>& b, const Point<T, 3>& c)
+{
+    Vector<T, 3> ab = b - a;
+    Vector<T, 3> ac = c - a;
+    Vector<T, 3> normal = Vector<T, 3>::Cross(ab, ac);
+
+    T squareNormal = Vector<T, 3>::Dot(normal, normal);
+    if (squareNormal == T(0))
+        return Sphere(a, std::numeric_limits<T>::infinity());
+
+    Vector<T, 3> offset = (Vector<T, 3>::Cross(normal, ab) * Vector<T, 3>::Dot(ac, ac) +
+                           Vector<T, 3>::Cross(ac, normal) * Vector<T, 3>::Dot(ab, ab)) / (T(2) * squareNormal);
+    return Sphere(a + offset, offset.Magnitude());
+}
+
+template<typename T>
+Sphere<T> Sphere<T>::Circumscribe(const Point<T, 3>& a, const Point<T, 3>& b, const Point<T, 3>& c, const Point<T, 3>& d)
+{
+    Vector<T, 3> ab = b - a;
+    Vector<T, 3> ac = c - a;
+    Vector<T, 3> ad = d - a;
+
+    T determinant = Vector<T, 3>::Dot(ab, Vector<T, 3>::Cross(ac, ad));
+    if (determinant == T(0))
+        return Sphere(a, std::numeric_limits<T>::infinity());
+
+    Vector<T, 3> offset = (Vector<T, 3>::Cross(ac, ad) * Vector<T, 3>::Dot(ab, ab) +
+                           Vector<T, 3>::Cross(ad, ab) * Vector<T, 3>::Dot(ac, ac) +
+                           Vector<T, 3>::Cross(ab, ac) * Vector<T, 3>::Dot(ad, ad)) / (T(2) * determinant);
+    return Sphere(a + offset, offset.Magnitude());
+}
@@ -0,0 +1,141 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include "linalg.h"
+#include "dispatch.h"
+
+/**
+ * Dispatched passes over float Point arrays for fitting bounding spheres:
+ * the axis extremes and Ritter growth that Sphere::FitRitter and FitEpos6
+ * are built from. sphere.h includes this; the kernels are kept out of
+ * batchops.h so that only users of Sphere compile them.
+ */
+namespace SMath::Simd
+{
+    static_assert(sizeof(Point<float, 3>) == 3 * sizeof(float), "Sphere kernels walk Point arrays as packed floats");
+
+    struct SphereFitKernels
+    {
+        void (*ExtremePoints)(const Point<float, 3>* points, size_t count, Point<float, 3>* extremes);
+        void (*GrowSphere)(const Point<float, 3>* points, size_t count, Point<float, 3>& center, float& radius);
+    };
+}
+
+namespace SMath::Simd::Scalar
+{
+    // Updates extremes (smallest x, largest x, smallest y, ...) in place; ties keep the earlier point
+    inline void ExtremePointsArray(const Point<float, 3>* points, size_t count, Point<float, 3>* extremes)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if (points[i][axis] < extremes[2 * axis][axis])
+                    extremes[2 * axis] = Point<float, 3>(points[i].x, points[i].y, points[i].z);
+                if (points[i][axis] > extremes[2 * axis + 1][axis])
+                    extremes[2 * axis + 1] = Point<float, 3>(points[i].x, points[i].y, points[i].z);
+            }
+        }
+    }
+
+    // Ritter's growth pass: a point outside the sphere pulls it just far enough to cover it
+    inline void GrowSphereArray(const Point<float, 3>* points, size_t count, Point<float, 3>& center, float& radius)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            float dx = points[i].x - center.x;
+            float dy = points[i].y - center.y;
+            float dz = points[i].z - center.z;
+            float squareDistance = dx * dx + dy * dy + dz * dz;
+
+            if (squareDistance > radius * radius)
+            {
+                float distance = std::sqrt(squareDistance);
+                float grown = (radius + distance) * 0.5f;
+                float shift = (grown - radius) / distance;
+                center.x += dx * shift;
+                center.y += dy * shift;
+                center.z += dz * shift;
+                radius = grown;
+            }
+        }
+    }
+
+    inline constexpr SphereFitKernels SphereFitTable = { ExtremePointsArray, GrowSphereArray };
+}
+
+#if defined(SMATH_X86)
+namespace SMath::Simd::Sse2
+{
+    #include "spherefit_impl.h"
+}
+
+SMATH_BEGIN_TARGET_AVX2
+namespace SMath::Simd::Avx2
+{
+    #include "spherefit_impl.h"
+}
+SMATH_END_TARGET
+
+SMATH_BEGIN_TARGET_AVX512
+namespace SMath::Simd::Avx512
+{
+    #include "spherefit_impl.h"
+}
+SMATH_END_TARGET
+#endif
+
+namespace SMath::Simd
+{
+    inline const SphereFitKernels& GetSphereFitKernels()
+    {
+#if defined(SMATH_X86)
+        return Dispatch(Scalar::SphereFitTable, Sse2::SphereFitTable, Avx2::SphereFitTable, Avx512::SphereFitTable);
+#else
+        return Scalar::SphereFitTable;
+#endif
+    }
+}
+
+namespace SMath::Batch
+{
+    // The points with the smallest and largest x, y and z, in that order. points must not be empty.
+    inline std::array<Point<float, 3>, 6> ExtremePoints(std::span<const Point<float, 3>> points)
+    {
+        assert(!points.empty());
+        std::array<Point<float, 3>, 6> extremes;
+        extremes.fill(points[0]);
+        Simd::GetSphereFitKernels().ExtremePoints(points.data(), points.size(), extremes.data());
+        return extremes;
+    }
+
+    // Grows the sphere (center, radius) in a single Ritter pass until it covers every point
+    inline void GrowSphere(std::span<const Point<float, 3>> points, Point<float, 3>& center, float& radius)
+    {
+        Simd::GetSphereFitKernels().GrowSphere(points.data(), points.size(), center, radius);
+    }
+}
@@ -0,0 +1,124 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * Sphere fitting loops included once per ISA namespace. Points are read
+ * with strided loads, one point per lane.
+ */
+
+inline void ExtremePointsArray(const Point<float, 3>* points, size_t count, Point<float, 3>* extremes)
+{
+    const float* src = reinterpret_cast<const float*>(points);
+
+    // Each lane keeps whole candidate points rather than indices, so the six
+    // winners come out of a single pass. The block a candidate came from orders
+    // ties between lanes; -1 marks the incoming extreme, which precedes every point.
+    Float lanes[6][3];
+    Int blocks[6];
+    for (int e = 0; e < 6; ++e)
+    {
+        for (int c = 0; c < 3; ++c)
+            lanes[e][c] = Float(extremes[e][c]);
+        blocks[e] = Int(-1);
+    }
+
+    size_t i = 0;
+    Int block(0);
+    for (; i + Width <= count; i += Width, block = block + Int(1))
+    {
+        Float p[3] = { LoadStrided(src + 3 * i, 3), LoadStrided(src + 3 * i + 1, 3), LoadStrided(src + 3 * i + 2, 3) };
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            Mask lower = p[axis] < lanes[2 * axis][axis];
+            Mask upper = p[axis] > lanes[2 * axis + 1][axis];
+            for (int c = 0; c < 3; ++c)
+            {
+                lanes[2 * axis][c] = Select(lower, p[c], lanes[2 * axis][c]);
+                lanes[2 * axis + 1][c] = Select(upper, p[c], lanes[2 * axis + 1][c]);
+            }
+            blocks[2 * axis] = AsInt(Select(lower, AsFloat(block), AsFloat(blocks[2 * axis])));
+            blocks[2 * axis + 1] = AsInt(Select(upper, AsFloat(block), AsFloat(blocks[2 * axis + 1])));
+        }
+    }
+
+    float candidates[6][3][Width];
+    int32_t candidateBlocks[6][Width];
+    for (int e = 0; e < 6; ++e)
+    {
+        for (int c = 0; c < 3; ++c)
+            Store(candidates[e][c], lanes[e][c]);
+        Store(candidateBlocks[e], blocks[e]);
+    }
+
+    // Equal candidates go to the earliest point, as in the scalar loop
+    for (int e = 0; e < 6; ++e)
+    {
+        int axis = e / 2;
+        float sign = e % 2 == 0 ? 1.0f : -1.0f;
+        int64_t winner = -1;
+        for (int lane = 0; lane < Width; ++lane)
+        {
+            if (candidateBlocks[e][lane] < 0)
+                continue;
+
+            int64_t index = int64_t(candidateBlocks[e][lane]) * Width + lane;
+            float value = sign * candidates[e][axis][lane];
+            float best = sign * extremes[e][axis];
+            if (value < best || (value == best && index < winner))
+            {
+                extremes[e] = Point<float, 3>(candidates[e][0][lane], candidates[e][1][lane], candidates[e][2][lane]);
+                winner = index;
+            }
+        }
+    }
+
+    Scalar::ExtremePointsArray(points + i, count - i, extremes);
+}
+
+inline void GrowSphereArray(const Point<float, 3>* points, size_t count, Point<float, 3>& center, float& radius)
+{
+    const float* src = reinterpret_cast<const float*>(points);
+
+    // Growing is order dependent, but after the first few blocks almost every point
+    // is already covered: test whole blocks and only replay the rare misses in order
+    Float cx(center.x), cy(center.y), cz(center.z), r2(radius * radius);
+
+    size_t i = 0;
+    for (; i + Width <= count; i += Width)
+    {
+        Float dx = LoadStrided(src + 3 * i, 3) - cx;
+        Float dy = LoadStrided(src + 3 * i + 1, 3) - cy;
+        Float dz = LoadStrided(src + 3 * i + 2, 3) - cz;
+
+        if (Any(MulAdd(dx, dx, MulAdd(dy, dy, dz * dz)) > r2))
+        {
+            Scalar::GrowSphereArray(points + i, Width, center, radius);
+            cx = Float(center.x);
+            cy = Float(center.y);
+            cz = Float(center.z);
+            r2 = Float(radius * radius);
+        }
+    }
+
+    Scalar::GrowSphereArray(points + i, count - i, center, radius);
+}
+
+inline constexpr SphereFitKernels SphereFitTable = { ExtremePointsArray, GrowSphereArray };
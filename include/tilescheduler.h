@@ -0,0 +1,84 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <cstdint>
+#include <algorithm>
+#include "rect.h"
+#include "batchops.h"
+
+namespace SMath
+{
+    enum class TileOrder
+    {
+        RowMajor,
+        // Outwards from the centre tile, so the middle of the image finishes first
+        Spiral,
+        Hilbert,
+        Morton
+    };
+
+    /**
+     * Cuts an area into tiles of a fixed size, clipped at the right and
+     * bottom edges, and runs a callback once per tile across threads.
+     *
+     * Each thread starts with a contiguous run of the ordered tiles. With
+     * Hilbert or Morton order a run is a compact region of the image, so
+     * a thread keeps touching neighbouring memory. A thread that runs out
+     * steals the back half of the largest remaining run.
+     */
+    template<typename T>
+    class TileScheduler
+    {
+    public:
+        TileScheduler() = default;
+        TileScheduler(const Rect<T>& area, T tileWidth, T tileHeight, TileOrder order = TileOrder::Hilbert);
+        ~TileScheduler() = default;
+
+    public:
+        size_t GetTileCount() const;
+        const Rect<T>& GetTile(size_t index) const;
+
+        // Calls func(tile, thread) once for every tile, thread being in [0, threads).
+        // threadCount <= 0 uses every hardware thread.
+        template<typename Func>
+        void Run(Func&& func, int threadCount = 0) const;
+
+    public:
+        static std::vector<Rect<T>> GenerateTiles(const Rect<T>& area, T tileWidth, T tileHeight, TileOrder order);
+
+        // Position of cell (x, y) along the curve filling a size by size grid, size a power of two
+        static uint64_t GetHilbertIndex(uint32_t x, uint32_t y, uint32_t size);
+        static uint64_t GetMortonIndex(uint32_t x, uint32_t y);
+
+    public:
+        Rect<T> m_Area;
+        std::vector<Rect<T>> m_Tiles;
+    };
+
+    #include "tilescheduler_impl.h"
+}
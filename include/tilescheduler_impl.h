@@ -0,0 +1,204 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+template<typename T>
+TileScheduler<T>::TileScheduler(const Rect<T>& area, T tileWidth, T tileHeight, TileOrder order)
+    : m_Area(area)
+    , m_Tiles(GenerateTiles(area, tileWidth, tileHeight, order))
+{
+}
+
+template<typename T>
+size_t TileScheduler<T>::GetTileCount() const
+{
+    return m_Tiles.size();
+}
+
+template<typename T>
+const Rect<T>& TileScheduler<T>::GetTile(size_t index) const
+{
+    return m_Tiles[index];
+}
+
+template<typename T>
+template<typename Func>
+void TileScheduler<T>::Run(Func&& func, int threadCount) const
+{
+    size_t count = m_Tiles.size();
+    if (count == 0)
+        return;
+
+    assert(count < 0xffffffffu);
+    int hardware = int(std::max(1u, std::thread::hardware_concurrency()));
+    int threads = Simd::GetThreadCount(count, threadCount > 0 ? threadCount : hardware);
+
+    // Each queue is a run [begin, end) of tiles, packed as begin << 32 | end, so popping the front
+    // and stealing the back are single compare-exchanges on the same word
+    struct alignas(64) Queue
+    {
+        std::atomic<uint64_t> m_Range;
+    };
+
+    auto pack = [](uint64_t begin, uint64_t end) { return begin << 32 | end; };
+    std::vector<Queue> queues(threads);
+    for (int t = 0; t < threads; ++t)
+        queues[t].m_Range.store(pack(count * t / threads, count * (t + 1) / threads), std::memory_order_relaxed);
+
+    Simd::ParallelSlices(size_t(threads), threads, [&](size_t, size_t, int thread) {
+        std::atomic<uint64_t>& own = queues[thread].m_Range;
+        for (;;)
+        {
+            uint64_t range = own.load(std::memory_order_acquire);
+            uint64_t begin = range >> 32, end = range & 0xffffffffu;
+            if (begin < end)
+            {
+                if (own.compare_exchange_weak(range, pack(begin + 1, end), std::memory_order_acq_rel))
+                    func(m_Tiles[begin], thread);
+                continue;
+            }
+
+            // Own run is empty, so nobody else writes it until it is refilled here
+            int victim = -1;
+            uint64_t most = 0;
+            for (int t = 0; t < threads; ++t)
+            {
+                uint64_t other = queues[t].m_Range.load(std::memory_order_relaxed);
+                uint64_t remaining = (other >> 32) < (other & 0xffffffffu) ? (other & 0xffffffffu) - (other >> 32) : 0;
+                if (remaining > most)
+                {
+                    most = remaining;
+                    victim = t;
+                }
+            }
+
+            // Tiles stolen by others are still taken care of by the thieves
+            if (victim < 0)
+                return;
+
+            uint64_t other = queues[victim].m_Range.load(std::memory_order_acquire);
+            uint64_t otherBegin = other >> 32, otherEnd = other & 0xffffffffu;
+            if (otherBegin >= otherEnd)
+                continue;
+
+            uint64_t split = otherEnd - (otherEnd - otherBegin + 1) / 2;
+            if (queues[victim].m_Range.compare_exchange_strong(other, pack(otherBegin, split), std::memory_order_acq_rel))
+                own.store(pack(split, otherEnd), std::memory_order_release);
+        }
+    });
+}
+
+template<typename T>
+std::vector<Rect<T>> TileScheduler<T>::GenerateTiles(const Rect<T>& area, T tileWidth, T tileHeight, TileOrder order)
+{
+    assert(tileWidth > T(0) && tileHeight > T(0));
+    if (area.IsEmpty())
+        return {};
+
+    uint32_t columns = uint32_t(std::ceil(double(area.w) / double(tileWidth)));
+    uint32_t rows = uint32_t(std::ceil(double(area.h) / double(tileHeight)));
+    size_t count = size_t(columns) * rows;
+
+    std::vector<uint32_t> cells;
+    cells.reserve(count);
+    if (order == TileOrder::Spiral)
+    {
+        // Legs of 1, 1, 2, 2, 3, 3... tiles turning clockwise, skipping cells outside the grid
+        static const int dx[4] = { 1, 0, -1, 0 };
+        static const int dy[4] = { 0, 1, 0, -1 };
+        int64_t x = (columns - 1) / 2, y = (rows - 1) / 2;
+        cells.push_back(uint32_t(y) * columns + uint32_t(x));
+
+        for (uint32_t leg = 0; cells.size() < count; ++leg)
+        {
+            uint32_t length = leg / 2 + 1;
+            for (uint32_t step = 0; step < length; ++step)
+            {
+                x += dx[leg % 4];
+                y += dy[leg % 4];
+                if (x >= 0 && y >= 0 && x < columns && y < rows)
+                    cells.push_back(uint32_t(y) * columns + uint32_t(x));
+            }
+        }
+    }
+    else
+    {
+        for (uint32_t cell = 0; cell < count; ++cell)
+            cells.push_back(cell);
+
+        if (order != TileOrder::RowMajor)
+        {
+            uint32_t size = std::bit_ceil(std::max(columns, rows));
+            std::vector<uint64_t> keys(count);
+            for (uint32_t cell = 0; cell < count; ++cell)
+            {
+                uint32_t x = cell % columns, y = cell / columns;
+                keys[cell] = order == TileOrder::Hilbert ? GetHilbertIndex(x, y, size) : GetMortonIndex(x, y);
+            }
+            std::sort(cells.begin(), cells.end(), [&](uint32_t a, uint32_t b) { return keys[a] < keys[b]; });
+        }
+    }
+
+    std::vector<Rect<T>> tiles;
+    tiles.reserve(count);
+    for (uint32_t cell : cells)
+    {
+        Rect<T> tile(area.x + T(cell % columns) * tileWidth, area.y + T(cell / columns) * tileHeight, tileWidth, tileHeight);
+        tiles.push_back(Rect<T>::Intersection(tile, area));
+    }
+    return tiles;
+}
+
+template<typename T>
+uint64_t TileScheduler<T>::GetHilbertIndex(uint32_t x, uint32_t y, uint32_t size)
+{
+    uint64_t index = 0;
+    for (uint32_t s = size / 2; s > 0; s /= 2)
+    {
+        uint32_t rx = (x & s) ? 1 : 0;
+        uint32_t ry = (y & s) ? 1 : 0;
+        index += uint64_t(s) * s * ((3 * rx) ^ ry);
+
+        // Rotate the quadrant so the curve inside it starts and ends at the right corners
+        if (ry == 0)
+        {
+            if (rx == 1)
+            {
+                x = size - 1 - x;
+                y = size - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+
+template<typename T>
+uint64_t TileScheduler<T>::GetMortonIndex(uint32_t x, uint32_t y)
+{
+    auto spread = [](uint64_t v) {
+        v = (v | (v << 16)) & 0x0000ffff0000ffffull;
+        v = (v | (v << 8)) & 0x00ff00ff00ff00ffull;
+        v = (v | (v << 4)) & 0x0f0f0f0f0f0f0f0full;
+        v = (v | (v << 2)) & 0x3333333333333333ull;
+        v = (v | (v << 1)) & 0x5555555555555555ull;
+        return v;
+    };
+    return spread(x) | (spread(y) << 1);
+}
@@ -27,7 +27,7 @@ namespace SMath
     template<typename T, int N>
     class Vector : public VectorData<T, N>
     {
-        static_assert(std::is_arithmetic_v<T>, "Vector only works with arithmetic types");
+        static_assert(ScalarTraits<T>::IsScalar, "Vector only works with arithmetic types, Half and BFloat16");
 
     public:
         Vector(T v = 0.0);
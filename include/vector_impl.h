@@ -207,10 +207,10 @@ Vector<T, M> Vector<T, N>::Resize() const
 template<typename T, int N>
 T Vector<T, N>::Dot(const Vector& a, const Vector& b)
 {
-    T dot = 0;
+    typename ScalarTraits<T>::ComputeType dot = 0;
     for (int i = 0; i < N; ++i)
         dot += a[i] * b[i];
-    return dot;
+    return T(dot);
 }
 
 template<typename T, int N>
@@ -20,8 +20,19 @@
 
 #pragma once
 
+#include <type_traits>
+
 namespace SMath
 {
+    // Element types Vector and Point accept. Storage types such as Half (half.h)
+    // specialize this and name the arithmetic type their math is carried out in.
+    template <typename T>
+    struct ScalarTraits
+    {
+        static constexpr bool IsScalar = std::is_arithmetic_v<T>;
+        typedef T ComputeType;
+    };
+
     template <typename T, int N>
     class VectorData
     {
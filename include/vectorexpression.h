@@ -0,0 +1,250 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cmath>
+#include <concepts>
+#include <utility>
+#include <type_traits>
+#include "linalg.h"
+
+/**
+ * Opt-in expression templates for element-wise Vector arithmetic.
+ *
+ * An operator builds a lightweight node instead of a temporary Vector only
+ * when one of its operands is already an expression, so every plain Vector
+ * subexpression must be wrapped with Lazy() to avoid its temporary. Here
+ * specular * gloss would otherwise be computed eagerly before joining the
+ * tree. Evaluate() then computes every component in a single loop. A
+ * product feeding an addition or subtraction is contracted into one fused
+ * multiply-add when the target has hardware FMA.
+ *
+ *     Vector3 c = Evaluate(Lazy(albedo) * diffuse + Lazy(specular) * gloss - ambient);
+ *
+ * Terminals built from named vectors hold references, so an expression must
+ * be evaluated before those vectors go out of scope. Temporary Vectors are
+ * copied into their terminal.
+ */
+namespace SMath::Expression
+{
+    template <typename T>
+    inline T MultiplyAdd(T a, T b, T c)
+    {
+        // Without hardware FMA, std::fma is a slow software routine
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+        if constexpr (std::is_floating_point_v<T>)
+            return std::fma(a, b, c);
+        else
+#endif
+        return a * b + c;
+    }
+
+    struct Add      { template <typename T> static T Apply(T a, T b) { return a + b; } };
+    struct Subtract { template <typename T> static T Apply(T a, T b) { return a - b; } };
+    struct Multiply { template <typename T> static T Apply(T a, T b) { return a * b; } };
+    struct Divide   { template <typename T> static T Apply(T a, T b) { return a / b; } };
+
+    template <typename E>
+    concept IsExpression = requires { typename E::IsVectorExpression; };
+
+    // Storage is a reference for named vectors and a copy for temporaries
+    template <typename T, int N, typename Storage = const Vector<T, N>&>
+    class Terminal
+    {
+    public:
+        typedef void IsVectorExpression;
+        typedef T ValueType;
+        static constexpr int Size = N;
+
+    public:
+        Terminal(const Vector<T, N>& v) : m_Vector(v) {}
+        inline T operator[](int i) const { return m_Vector.m_Data[i]; }
+
+    private:
+        Storage m_Vector;
+    };
+
+    template <typename T, int N>
+    class Scalar
+    {
+    public:
+        typedef void IsVectorExpression;
+        typedef T ValueType;
+        static constexpr int Size = N;
+
+    public:
+        Scalar(T v) : m_Value(v) {}
+        inline T operator[](int) const { return m_Value; }
+
+    private:
+        T m_Value;
+    };
+
+    template <typename E>
+    class Negate
+    {
+    public:
+        typedef void IsVectorExpression;
+        typedef typename E::ValueType ValueType;
+        static constexpr int Size = E::Size;
+
+    public:
+        Negate(const E& e) : m_Expression(e) {}
+        inline ValueType operator[](int i) const { return -m_Expression[i]; }
+
+    private:
+        E m_Expression;
+    };
+
+    template <typename Op, typename L, typename R>
+    class Binary
+    {
+        static_assert(L::Size == R::Size, "Operands must have the same dimension");
+
+    public:
+        typedef void IsVectorExpression;
+        typedef typename L::ValueType ValueType;
+        typedef Op Operation;
+        static constexpr int Size = L::Size;
+
+    public:
+        Binary(const L& l, const R& r) : m_Left(l), m_Right(r) {}
+
+        inline ValueType operator[](int i) const
+        {
+            constexpr bool leftIsProduct = IsProduct<L>();
+            constexpr bool rightIsProduct = IsProduct<R>();
+
+            if constexpr (std::same_as<Op, Add> && leftIsProduct)
+                return MultiplyAdd(m_Left.m_Left[i], m_Left.m_Right[i], m_Right[i]);
+            else if constexpr (std::same_as<Op, Add> && rightIsProduct)
+                return MultiplyAdd(m_Right.m_Left[i], m_Right.m_Right[i], m_Left[i]);
+            else if constexpr (std::same_as<Op, Subtract> && leftIsProduct)
+                return MultiplyAdd(m_Left.m_Left[i], m_Left.m_Right[i], -m_Right[i]);
+            else if constexpr (std::same_as<Op, Subtract> && rightIsProduct)
+                return MultiplyAdd(-m_Right.m_Left[i], m_Right.m_Right[i], m_Left[i]);
+            else
+                return Op::Apply(m_Left[i], m_Right[i]);
+        }
+
+    public:
+        L m_Left;
+        R m_Right;
+
+    private:
+        template <typename E>
+        static constexpr bool IsProduct()
+        {
+            if constexpr (requires { typename E::Operation; })
+                return std::same_as<typename E::Operation, Multiply>;
+            else
+                return false;
+        }
+    };
+
+    template <typename T, int N>
+    inline Terminal<T, N> Lazy(const Vector<T, N>& v)
+    {
+        return Terminal<T, N>(v);
+    }
+
+    template <typename T, int N>
+    inline Terminal<T, N, Vector<T, N>> Lazy(Vector<T, N>&& v)
+    {
+        return Terminal<T, N, Vector<T, N>>(v);
+    }
+
+    template <IsExpression E>
+    inline Vector<typename E::ValueType, E::Size> Evaluate(const E& e)
+    {
+        typename E::ValueType data[E::Size];
+        for (int i = 0; i < E::Size; ++i)
+            data[i] = e[i];
+        return Vector<typename E::ValueType, E::Size>(data);
+    }
+
+    template <IsExpression E>
+    inline void Assign(Vector<typename E::ValueType, E::Size>& dst, const E& e)
+    {
+        // Components are computed before any is stored, so dst may appear in e
+        typename E::ValueType data[E::Size];
+        for (int i = 0; i < E::Size; ++i)
+            data[i] = e[i];
+        for (int i = 0; i < E::Size; ++i)
+            dst.m_Data[i] = data[i];
+    }
+
+    /**
+     * Operators. At least one operand must already be an expression, so plain
+     * Vector arithmetic keeps its eager behavior.
+     */
+    template <IsExpression E>
+    inline const E& ToNode(const E& e)
+    {
+        return e;
+    }
+
+    template <typename T, int N>
+    inline Terminal<T, N> ToNode(const Vector<T, N>& v)
+    {
+        return Terminal<T, N>(v);
+    }
+
+    template <typename T, int N>
+    inline Terminal<T, N, Vector<T, N>> ToNode(Vector<T, N>&& v)
+    {
+        return Terminal<T, N, Vector<T, N>>(v);
+    }
+
+    template <typename L, typename R>
+    concept IsExpressionPair = (IsExpression<std::remove_cvref_t<L>> || IsExpression<std::remove_cvref_t<R>>) &&
+        requires (L&& l, R&& r) { ToNode(std::forward<L>(l)); ToNode(std::forward<R>(r)); };
+
+    template <typename Op, typename L, typename R>
+    inline auto MakeBinary(const L& l, const R& r)
+    {
+        return Binary<Op, L, R>(l, r);
+    }
+
+    template <typename L, typename R> requires IsExpressionPair<L, R>
+    inline auto operator+(L&& l, R&& r) { return MakeBinary<Add>(ToNode(std::forward<L>(l)), ToNode(std::forward<R>(r))); }
+
+    template <typename L, typename R> requires IsExpressionPair<L, R>
+    inline auto operator-(L&& l, R&& r) { return MakeBinary<Subtract>(ToNode(std::forward<L>(l)), ToNode(std::forward<R>(r))); }
+
+    template <typename L, typename R> requires IsExpressionPair<L, R>
+    inline auto operator*(L&& l, R&& r) { return MakeBinary<Multiply>(ToNode(std::forward<L>(l)), ToNode(std::forward<R>(r))); }
+
+    template <typename L, typename R> requires IsExpressionPair<L, R>
+    inline auto operator/(L&& l, R&& r) { return MakeBinary<Divide>(ToNode(std::forward<L>(l)), ToNode(std::forward<R>(r))); }
+
+    template <IsExpression E>
+    inline auto operator*(const E& e, typename E::ValueType s) { return MakeBinary<Multiply>(e, Scalar<typename E::ValueType, E::Size>(s)); }
+
+    template <IsExpression E>
+    inline auto operator*(typename E::ValueType s, const E& e) { return MakeBinary<Multiply>(Scalar<typename E::ValueType, E::Size>(s), e); }
+
+    template <IsExpression E>
+    inline auto operator/(const E& e, typename E::ValueType s) { return MakeBinary<Divide>(e, Scalar<typename E::ValueType, E::Size>(s)); }
+
+    template <IsExpression E>
+    inline auto operator-(const E& e) { return Negate<E>(e); }
+}
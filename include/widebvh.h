@@ -0,0 +1,121 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <span>
+#include <algorithm>
+#include <numeric>
+#include <cassert>
+#include <vector>
+#include <cstdint>
+#include "linalg.h"
+#include "box.h"
+#include "ray.h"
+#include "simd.h"
+
+namespace SMath
+{
+    /**
+     * Four-wide bounding volume hierarchy over boxes, built with binned SAH.
+     * Each node stores the bounds of its four children in structure-of-arrays
+     * form so one ray is tested against all of them at once. Leaves are not
+     * nodes: a child slot either holds a node index or a range of m_Primitives.
+     * Nodes deep enough to run out of MaxLevels split at the median instead.
+     */
+    class WideBvh
+    {
+    public:
+        static constexpr int Width = 4;
+        static constexpr int MaxLeafSize = 4;
+        static constexpr uint32_t InvalidChild = 0xffffffffu;
+        static constexpr uint32_t LeafFlag = 0x80000000u;
+        // Entries of the traversal stack, enough for Width - 1 siblings on each of 31 levels
+        static constexpr int StackSize = 96;
+        // Node levels the stack allows, as a node at depth d leaves at most (d + 1) * (Width - 1) + 1 entries
+        static constexpr uint32_t MaxLevels = (StackSize - 1) / (Width - 1);
+
+        struct Node
+        {
+            float m_Min[3][Width];
+            float m_Max[3][Width];
+            uint32_t m_Children[Width];
+        };
+
+        // Ray with the reciprocal direction precomputed for slab tests
+        struct RayData
+        {
+            RayData(const Ray<float>& ray);
+
+            float m_Origin[3];
+            float m_InvDirection[3];
+            float m_TMin;
+        };
+
+    public:
+        WideBvh() = default;
+        WideBvh(std::span<const Box<float>> primitives);
+        ~WideBvh() = default;
+
+    public:
+        // Closest primitive box hit within [m_TMin, m_TMax]. primitives must be the array
+        // the hierarchy was built from. A ray starting inside a box hits it at m_TMin.
+        bool Intersect(const Ray<float>& ray, std::span<const Box<float>> primitives, float& t, uint32_t& primitive) const;
+
+        // Hierarchy accessors, also used to convert into other node formats. The root is node 0.
+        size_t GetNodeCount() const;
+        uint32_t GetChild(size_t node, int slot) const;
+        Box<float> GetChildBounds(size_t node, int slot) const;
+        std::span<const uint32_t> GetPrimitives() const;
+        size_t GetMemoryFootprint() const;
+
+    public:
+        static bool IsLeaf(uint32_t child);
+        static uint32_t MakeLeaf(uint32_t first, uint32_t count);
+        static uint32_t GetLeafFirst(uint32_t child);
+        static uint32_t GetLeafCount(uint32_t child);
+
+        // Slab test of the ray against four boxes given as per-axis min and max lanes.
+        // Returns a bit per hit child and writes each entry distance to tNear.
+        static int IntersectChildren(const float (&min)[3][Width], const float (&max)[3][Width],
+                                     const RayData& ray, float tMax, float (&tNear)[Width]);
+
+        // Closest-hit traversal shared by the node formats. NodeType needs m_Children, and
+        // intersectNode(node, ray, tMax, tNear) behaves like IntersectChildren.
+        template<typename NodeType, typename IntersectNode>
+        static bool Traverse(std::span<const NodeType> nodes, std::span<const uint32_t> indices, const Ray<float>& ray,
+                             std::span<const Box<float>> primitives, IntersectNode&& intersectNode, float& t, uint32_t& primitive);
+
+        // Slab test against one box, t is the entry distance
+        static bool IntersectBox(const Box<float>& box, const RayData& ray, float tMax, float& t);
+
+    private:
+        void Build(uint32_t node, uint32_t depth, uint32_t begin, uint32_t end, std::span<const Box<float>> primitives,
+                   const std::vector<Point<float, 3>>& centroids);
+        uint32_t Split(uint32_t begin, uint32_t end, bool median, std::span<const Box<float>> primitives,
+                       const std::vector<Point<float, 3>>& centroids);
+
+    public:
+        std::vector<Node> m_Nodes;
+        std::vector<uint32_t> m_Primitives;
+    };
+
+    #include "widebvh_impl.h"
+}
@@ -0,0 +1,375 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+inline WideBvh::RayData::RayData(const Ray<float>& ray)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        m_Origin[i] = ray.m_Origin[i];
+        m_InvDirection[i] = 1.0f / ray.m_Direction[i];
+    }
+    m_TMin = ray.m_TMin;
+}
+
+inline WideBvh::WideBvh(std::span<const Box<float>> primitives)
+{
+    assert(primitives.size() < (LeafFlag >> 4));
+
+    uint32_t count = uint32_t(primitives.size());
+    m_Primitives.resize(count);
+    std::iota(m_Primitives.begin(), m_Primitives.end(), 0u);
+
+    std::vector<Point<float, 3>> centroids(count);
+    for (uint32_t i = 0; i < count; ++i)
+        centroids[i] = primitives[i].GetCentroid();
+
+    m_Nodes.reserve(count / 2 + 1);
+    m_Nodes.emplace_back();
+    Build(0, 0, 0, count, primitives, centroids);
+}
+
+inline bool WideBvh::Intersect(const Ray<float>& ray, std::span<const Box<float>> primitives, float& t, uint32_t& primitive) const
+{
+    return Traverse(std::span<const Node>(m_Nodes), std::span<const uint32_t>(m_Primitives), ray, primitives,
+        [](const Node& node, const RayData& data, float tMax, float (&tNear)[Width]) {
+            return IntersectChildren(node.m_Min, node.m_Max, data, tMax, tNear);
+        }, t, primitive);
+}
+
+template<typename NodeType, typename IntersectNode>
+inline bool WideBvh::Traverse(std::span<const NodeType> nodes, std::span<const uint32_t> indices, const Ray<float>& ray,
+                              std::span<const Box<float>> primitives, IntersectNode&& intersectNode, float& t, uint32_t& primitive)
+{
+    struct Entry
+    {
+        uint32_t m_Child;
+        float m_TNear;
+    };
+
+    if (nodes.empty())
+        return false;
+
+    // Each visited node pushes at most Width - 1 more entries than it pops
+    Entry stack[StackSize];
+    int top = 0;
+    stack[top++] = { 0, ray.m_TMin };
+
+    RayData data(ray);
+    float tMax = ray.m_TMax;
+    bool hit = false;
+
+    while (top > 0)
+    {
+        Entry entry = stack[--top];
+        if (entry.m_TNear > tMax)
+            continue;
+
+        if (IsLeaf(entry.m_Child))
+        {
+            uint32_t first = GetLeafFirst(entry.m_Child);
+            for (uint32_t i = first; i < first + GetLeafCount(entry.m_Child); ++i)
+            {
+                float tBox;
+                if (IntersectBox(primitives[indices[i]], data, tMax, tBox))
+                {
+                    tMax = tBox;
+                    primitive = indices[i];
+                    hit = true;
+                }
+            }
+            continue;
+        }
+
+        const NodeType& node = nodes[entry.m_Child];
+        float tNear[Width];
+        int mask = intersectNode(node, data, tMax, tNear);
+
+        // Push far children first so the nearest one is popped next
+        Entry hits[Width];
+        int hitCount = 0;
+        for (int i = 0; i < Width; ++i)
+        {
+            if (!(mask & (1 << i)) || node.m_Children[i] == InvalidChild)
+                continue;
+
+            int j = hitCount++;
+            for (; j > 0 && hits[j - 1].m_TNear < tNear[i]; --j)
+                hits[j] = hits[j - 1];
+            hits[j] = { node.m_Children[i], tNear[i] };
+        }
+
+        assert(top + hitCount <= int(std::size(stack)));
+        for (int i = 0; i < hitCount; ++i)
+            stack[top++] = hits[i];
+    }
+
+    if (hit)
+        t = tMax;
+    return hit;
+}
+
+inline size_t WideBvh::GetNodeCount() const
+{
+    return m_Nodes.size();
+}
+
+inline uint32_t WideBvh::GetChild(size_t node, int slot) const
+{
+    return m_Nodes[node].m_Children[slot];
+}
+
+inline Box<float> WideBvh::GetChildBounds(size_t node, int slot) const
+{
+    const Node& n = m_Nodes[node];
+    return Box<float>(Point<float, 3>(n.m_Min[0][slot], n.m_Min[1][slot], n.m_Min[2][slot]),
+                      Point<float, 3>(n.m_Max[0][slot], n.m_Max[1][slot], n.m_Max[2][slot]));
+}
+
+inline std::span<const uint32_t> WideBvh::GetPrimitives() const
+{
+    return m_Primitives;
+}
+
+inline size_t WideBvh::GetMemoryFootprint() const
+{
+    return m_Nodes.size() * sizeof(Node) + m_Primitives.size() * sizeof(uint32_t);
+}
+
+inline bool WideBvh::IsLeaf(uint32_t child)
+{
+    return (child & LeafFlag) != 0;
+}
+
+inline uint32_t WideBvh::MakeLeaf(uint32_t first, uint32_t count)
+{
+    assert(count >= 1 && count <= 16);
+    return LeafFlag | (first << 4) | (count - 1);
+}
+
+inline uint32_t WideBvh::GetLeafFirst(uint32_t child)
+{
+    return (child & ~LeafFlag) >> 4;
+}
+
+inline uint32_t WideBvh::GetLeafCount(uint32_t child)
+{
+    return (child & 15) + 1;
+}
+
+inline int WideBvh::IntersectChildren(const float (&min)[3][Width], const float (&max)[3][Width],
+                                      const RayData& ray, float tMax, float (&tNear)[Width])
+{
+#if defined(SMATH_X86)
+    using namespace Simd::Sse2;
+
+    // The running interval is the second operand of Min/Max so a NaN from
+    // 0 * inf (ray on a slab plane) leaves it unchanged
+    Float tEnter = ray.m_TMin;
+    Float tExit = tMax;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        Float origin = ray.m_Origin[axis];
+        Float invDirection = ray.m_InvDirection[axis];
+        Float t0 = (Load(min[axis]) - origin) * invDirection;
+        Float t1 = (Load(max[axis]) - origin) * invDirection;
+        tEnter = Max(Min(t0, t1), tEnter);
+        tExit = Min(Max(t0, t1), tExit);
+    }
+
+    Store(tNear, tEnter);
+    return Bits(tEnter <= tExit);
+#else
+    int mask = 0;
+    for (int i = 0; i < Width; ++i)
+    {
+        float tEnter = ray.m_TMin;
+        float tExit = tMax;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            float t0 = (min[axis][i] - ray.m_Origin[axis]) * ray.m_InvDirection[axis];
+            float t1 = (max[axis][i] - ray.m_Origin[axis]) * ray.m_InvDirection[axis];
+            tEnter = Simd::Scalar::Max(Simd::Scalar::Min(t0, t1), tEnter);
+            tExit = Simd::Scalar::Min(Simd::Scalar::Max(t0, t1), tExit);
+        }
+        tNear[i] = tEnter;
+        mask |= int(tEnter <= tExit) << i;
+    }
+    return mask;
+#endif
+}
+
+inline bool WideBvh::IntersectBox(const Box<float>& box, const RayData& ray, float tMax, float& t)
+{
+    float tEnter = ray.m_TMin;
+    float tExit = tMax;
+    for (int axis = 0; axis < 3; ++axis)
+    {
+        float t0 = (box.m_Min[axis] - ray.m_Origin[axis]) * ray.m_InvDirection[axis];
+        float t1 = (box.m_Max[axis] - ray.m_Origin[axis]) * ray.m_InvDirection[axis];
+        tEnter = Simd::Scalar::Max(Simd::Scalar::Min(t0, t1), tEnter);
+        tExit = Simd::Scalar::Min(Simd::Scalar::Max(t0, t1), tExit);
+    }
+
+    t = tEnter;
+    return tEnter <= tExit;
+}
+
+inline void WideBvh::Build(uint32_t node, uint32_t depth, uint32_t begin, uint32_t end, std::span<const Box<float>> primitives,
+                           const std::vector<Point<float, 3>>& centroids)
+{
+    // Median splits quarter the range, so a child subtree holds MaxLeafSize * Width^levels primitives
+    // in the levels left below it. Past that, SAH could build a chain too deep for the traversal stack.
+    uint64_t capacity = MaxLeafSize;
+    for (uint32_t level = depth + 1; level < MaxLevels && capacity < end - begin; ++level)
+        capacity *= Width;
+    bool median = end - begin > capacity;
+
+    // Split the largest range until there are four or every range fits in a leaf
+    uint32_t ranges[Width][2] = { { begin, end } };
+    int rangeCount = 1;
+    while (rangeCount < Width)
+    {
+        int largest = -1;
+        for (int i = 0; i < rangeCount; ++i)
+        {
+            uint32_t size = ranges[i][1] - ranges[i][0];
+            if (size > uint32_t(MaxLeafSize) && (largest < 0 || size > ranges[largest][1] - ranges[largest][0]))
+                largest = i;
+        }
+        if (largest < 0)
+            break;
+
+        uint32_t mid = Split(ranges[largest][0], ranges[largest][1], median, primitives, centroids);
+        ranges[rangeCount][0] = mid;
+        ranges[rangeCount][1] = ranges[largest][1];
+        ranges[largest][1] = mid;
+        ++rangeCount;
+    }
+
+    for (int slot = 0; slot < Width; ++slot)
+    {
+        Box<float> bounds = Box<float>::Empty();
+        uint32_t child = InvalidChild;
+
+        if (slot < rangeCount && ranges[slot][1] > ranges[slot][0])
+        {
+            uint32_t first = ranges[slot][0];
+            uint32_t count = ranges[slot][1] - first;
+            for (uint32_t i = first; i < first + count; ++i)
+                bounds.Expand(primitives[m_Primitives[i]]);
+
+            if (count <= uint32_t(MaxLeafSize))
+                child = MakeLeaf(first, count);
+            else
+            {
+                child = uint32_t(m_Nodes.size());
+                m_Nodes.emplace_back();
+                Build(child, depth + 1, first, first + count, primitives, centroids);
+            }
+        }
+
+        // m_Nodes may have grown during the recursion, so index it again
+        Node& n = m_Nodes[node];
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            n.m_Min[axis][slot] = bounds.m_Min[axis];
+            n.m_Max[axis][slot] = bounds.m_Max[axis];
+        }
+        n.m_Children[slot] = child;
+    }
+}
+
+inline uint32_t WideBvh::Split(uint32_t begin, uint32_t end, bool median, std::span<const Box<float>> primitives,
+                               const std::vector<Point<float, 3>>& centroids)
+{
+    constexpr int BinCount = 16;
+
+    Box<float> centroidBounds = Box<float>::Empty();
+    for (uint32_t i = begin; i < end; ++i)
+        centroidBounds.Expand(centroids[m_Primitives[i]]);
+
+    int axis = centroidBounds.GetMaximumExtent();
+    float lo = centroidBounds.m_Min[axis];
+    float extent = centroidBounds.m_Max[axis] - lo;
+    uint32_t* first = m_Primitives.data() + begin;
+    uint32_t* last = m_Primitives.data() + end;
+
+    if (extent > 0.0f && !median)
+    {
+        float scale = BinCount / extent;
+        auto binOf = [&](uint32_t p) {
+            return std::min(BinCount - 1, int((centroids[p][axis] - lo) * scale));
+        };
+
+        Box<float> bins[BinCount];
+        uint32_t counts[BinCount] = {};
+        for (int b = 0; b < BinCount; ++b)
+            bins[b] = Box<float>::Empty();
+
+        for (uint32_t* p = first; p < last; ++p)
+        {
+            int b = binOf(*p);
+            bins[b].Expand(primitives[*p]);
+            ++counts[b];
+        }
+
+        // Sweep from the right for the suffix costs, then from the left to pick the plane
+        float rightCost[BinCount];
+        Box<float> right = Box<float>::Empty();
+        uint32_t rightCount = 0;
+        for (int b = BinCount - 1; b > 0; --b)
+        {
+            right.Expand(bins[b]);
+            rightCount += counts[b];
+            rightCost[b] = rightCount ? rightCount * right.GetSurfaceArea() : 0.0f;
+        }
+
+        Box<float> left = Box<float>::Empty();
+        uint32_t leftCount = 0;
+        int bestBin = -1;
+        float bestCost = std::numeric_limits<float>::infinity();
+        for (int b = 0; b < BinCount - 1; ++b)
+        {
+            left.Expand(bins[b]);
+            leftCount += counts[b];
+            if (leftCount == 0 || leftCount == end - begin)
+                continue;
+
+            float cost = leftCount * left.GetSurfaceArea() + rightCost[b + 1];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestBin = b;
+            }
+        }
+
+        if (bestBin >= 0)
+        {
+            uint32_t* mid = std::partition(first, last, [&](uint32_t p) { return binOf(p) <= bestBin; });
+            if (mid != first && mid != last)
+                return uint32_t(mid - m_Primitives.data());
+        }
+    }
+
+    // Coincident centroids, no usable plane or too few levels left: split at the median
+    uint32_t* mid = first + (end - begin) / 2;
+    std::nth_element(first, mid, last, [&](uint32_t a, uint32_t b) { return centroids[a][axis] < centroids[b][axis]; });
+    return uint32_t(mid - m_Primitives.data());
+}
@@ -0,0 +1,284 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "animationtrack.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Vector<float, 3> Vector3f;
+    typedef SMath::Quaternion<float> Quaternionf;
+
+    void ExpectNear(const Vector3f& a, const Vector3f& b, float tolerance = 1e-5f)
+    {
+        EXPECT_NEAR(a.x, b.x, tolerance);
+        EXPECT_NEAR(a.y, b.y, tolerance);
+        EXPECT_NEAR(a.z, b.z, tolerance);
+    }
+
+    // Same rotation, either sign
+    void ExpectSameRotation(const Quaternionf& a, const Quaternionf& b, float tolerance = 1e-4f)
+    {
+        EXPECT_NEAR(std::abs(Quaternionf::Dot(a, b)), 1.0f, tolerance);
+    }
+
+    Quaternionf AboutY(float angle)
+    {
+        return Quaternionf::FromAxisAngle(Vector3f(0.0f, 1.0f, 0.0f), angle);
+    }
+}
+
+TEST(AnimationTrackTest, CanSampleLinear)
+{
+    SMath::VectorTrack<float> track({ 0.0f, 1.0f, 3.0f }, { Vector3f(0.0f), Vector3f(2.0f, 0.0f, 0.0f), Vector3f(2.0f, 4.0f, 0.0f) });
+    EXPECT_EQ(track.GetKeyCount(), 3u);
+    EXPECT_EQ(track.GetStartTime(), 0.0f);
+    EXPECT_EQ(track.GetEndTime(), 3.0f);
+
+    ExpectNear(track.Sample(0.0f), Vector3f(0.0f));
+    ExpectNear(track.Sample(0.5f), Vector3f(1.0f, 0.0f, 0.0f));
+    ExpectNear(track.Sample(1.0f), Vector3f(2.0f, 0.0f, 0.0f));
+    ExpectNear(track.Sample(2.5f), Vector3f(2.0f, 3.0f, 0.0f));
+
+    // Held outside the keys
+    ExpectNear(track.Sample(-1.0f), Vector3f(0.0f));
+    ExpectNear(track.Sample(9.0f), Vector3f(2.0f, 4.0f, 0.0f));
+
+    SMath::VectorTrack<float> constant({ 2.0f }, { Vector3f(1.0f, 2.0f, 3.0f) });
+    ExpectNear(constant.Sample(0.0f), Vector3f(1.0f, 2.0f, 3.0f));
+    SMath::TrackCursor cursor;
+    ExpectNear(constant.Sample(5.0f, cursor), Vector3f(1.0f, 2.0f, 3.0f));
+}
+
+TEST(AnimationTrackTest, CursorMatchesBinarySearch)
+{
+    std::vector<float> times;
+    std::vector<Vector3f> values;
+    for (int k = 0; k < 50; ++k)
+    {
+        times.push_back(k * 0.1f + (k % 3) * 0.02f);
+        values.push_back(Vector3f(float(k), float(k * k), 0.0f));
+    }
+    SMath::VectorTrack<float> track(times, values);
+
+    // Forward at several rates, backward, then jumps
+    std::vector<float> playback;
+    for (float step : { 0.01f, 0.13f, 0.37f })
+        for (float t = -0.2f; t < 5.5f; t += step)
+            playback.push_back(t);
+    for (float t = 5.5f; t > -0.5f; t -= 0.07f)
+        playback.push_back(t);
+    for (float t : { 3.0f, 0.0f, 4.9f, 1.05f, 0.1f, 4.92f })
+        playback.push_back(t);
+
+    SMath::TrackCursor cursor;
+    for (float t : playback)
+    {
+        ASSERT_EQ(track.FindKey(t, cursor), track.FindKey(t)) << "time " << t;
+        ASSERT_EQ(track.Sample(t, cursor), track.Sample(t));
+    }
+}
+
+TEST(AnimationTrackTest, CanSampleCubicHermite)
+{
+    // p(t) = t^3 - 2t, p'(t) = 3t^2 - 2: Hermite with exact tangents reproduces the cubic
+    auto p = [](float t) { return Vector3f(t * t * t - 2.0f * t, 1.0f, -t); };
+    auto dp = [](float t) { return Vector3f(3.0f * t * t - 2.0f, 0.0f, -1.0f); };
+
+    std::vector<float> times = { -1.0f, 0.0f, 0.5f, 2.0f };
+    std::vector<Vector3f> values, tangents;
+    for (float t : times)
+    {
+        values.push_back(p(t));
+        tangents.push_back(dp(t));
+    }
+
+    SMath::VectorTrack<float> track(times, values, tangents, tangents);
+    EXPECT_EQ(track.m_Interpolation, SMath::TrackInterpolation::CubicHermite);
+    for (float t = -1.0f; t <= 2.0f; t += 0.05f)
+        ExpectNear(track.Sample(t), p(t), 1e-4f);
+
+    // Catmull-Rom tangents pass through the keys and are smooth across them
+    SMath::VectorTrack<float> spline(times, values, SMath::TrackInterpolation::CubicHermite);
+    for (size_t k = 0; k < times.size(); ++k)
+        ExpectNear(spline.Sample(times[k]), values[k]);
+    ExpectNear(spline.m_InTangents[1], (values[2] - values[0]) * (1.0f / 1.5f));
+
+    float h = 1e-3f;
+    Vector3f left = (spline.Sample(0.5f) - spline.Sample(0.5f - h)) * (1.0f / h);
+    Vector3f right = (spline.Sample(0.5f + h) - spline.Sample(0.5f)) * (1.0f / h);
+    ExpectNear(left, right, 2e-2f);
+}
+
+TEST(AnimationTrackTest, CanSampleRotations)
+{
+    // The last key is stored with the opposite sign and is flipped back on construction
+    std::vector<float> times = { 0.0f, 1.0f, 2.0f, 3.0f };
+    std::vector<Quaternionf> keys = { AboutY(0.0f), AboutY(0.6f), AboutY(1.2f), -AboutY(1.8f) };
+    SMath::RotationTrack<float> linear(times, keys);
+    EXPECT_GT(Quaternionf::Dot(linear.m_Values[2], linear.m_Values[3]), 0.0f);
+
+    for (float t = 0.0f; t <= 3.0f; t += 0.1f)
+    {
+        size_t k = std::min(size_t(t), size_t(2));
+        ExpectSameRotation(linear.Sample(t), Quaternionf::Slerp(keys[k], linear.m_Values[k + 1], t - float(k)));
+        ExpectSameRotation(linear.Sample(t), AboutY(0.6f * t));
+    }
+
+    // Constant angular velocity: squad and Catmull-Rom stay on the same great arc
+    SMath::RotationTrack<float> squad(times, keys, SMath::TrackInterpolation::Squad);
+    SMath::RotationTrack<float> hermite(times, keys, SMath::TrackInterpolation::CubicHermite);
+    SMath::TrackCursor cursor;
+    for (float t = 0.0f; t <= 3.0f; t += 0.1f)
+    {
+        ExpectSameRotation(squad.Sample(t, cursor), AboutY(0.6f * t));
+        EXPECT_NEAR(hermite.Sample(t).Magnitude(), 1.0f, 1e-5f);
+    }
+}
+
+TEST(AnimationTrackTest, SquadIsContinuousForLargeRotations)
+{
+    // Keys far apart put the controls more than 90 degrees from the slerp between the keys
+    std::vector<float> times = { 0.0f, 1.0f, 2.0f, 3.0f, 4.0f };
+    std::vector<Quaternionf> keys = { Quaternionf::Identity(), AboutY(2.6f),
+                                      AboutY(2.6f) * Quaternionf::FromAxisAngle(Vector3f(1.0f, 0.0f, 0.0f), 2.8f),
+                                      Quaternionf::FromAxisAngle(Vector3f(0.0f, 0.0f, 1.0f), 2.9f), AboutY(-2.7f) };
+    SMath::RotationTrack<float> squad(times, keys, SMath::TrackInterpolation::Squad);
+
+    float h = 1e-3f;
+    Quaternionf previous = squad.Sample(0.0f);
+    for (float t = h; t <= 4.0f; t += h)
+    {
+        Quaternionf current = squad.Sample(t);
+        EXPECT_GT(std::abs(Quaternionf::Dot(previous, current)), 0.999f) << "t = " << t;
+        previous = current;
+    }
+}
+
+TEST(AnimationTrackTest, SquadHandlesOppositeControls)
+{
+    // Controls on opposite sides of the hypersphere, where a lerp between them passes through zero
+    SMath::RotationTrack<float> squad({ 0.0f, 1.0f }, { Quaternionf::Identity(), AboutY(0.5f) }, SMath::TrackInterpolation::Squad);
+    const Quaternionf opposites[] = { -Quaternionf::Identity(), -AboutY(0.02f) };
+    for (const Quaternionf& opposite : opposites)
+    {
+        squad.m_Controls = { Quaternionf::Identity(), opposite };
+
+        Quaternionf middle = squad.Sample(0.5f);
+        EXPECT_NEAR(middle.Magnitude(), 1.0f, 1e-4f);
+
+        float h = 1e-3f;
+        Quaternionf previous = squad.Sample(0.0f);
+        for (float t = h; t <= 1.0f; t += h)
+        {
+            Quaternionf current = squad.Sample(t);
+            EXPECT_GT(std::abs(Quaternionf::Dot(previous, current)), 0.999f) << "t = " << t;
+            previous = current;
+        }
+
+        ExpectSameRotation(squad.Sample(0.0f), Quaternionf::Identity());
+        ExpectSameRotation(squad.Sample(1.0f), AboutY(0.5f));
+    }
+}
+
+TEST(AnimationTrackTest, SquadIsSmoothAtKeys)
+{
+    std::vector<float> times = { 0.0f, 1.0f, 2.0f, 3.0f };
+    std::vector<Quaternionf> keys = { Quaternionf::Identity(), AboutY(0.8f),
+                                      AboutY(0.8f) * Quaternionf::FromAxisAngle(Vector3f(1.0f, 0.0f, 0.0f), 0.7f),
+                                      Quaternionf::FromAxisAngle(Vector3f(0.0f, 0.0f, 1.0f), 1.0f) };
+    SMath::RotationTrack<float> squad(times, keys, SMath::TrackInterpolation::Squad);
+
+    for (size_t k = 0; k < keys.size(); ++k)
+        ExpectSameRotation(squad.Sample(times[k]), keys[k]);
+
+    // Angular velocity is continuous across an interior key, unlike piecewise slerp
+    SMath::RotationTrack<float> linear(times, keys);
+    float h = 1e-2f;
+    auto kink = [&](const SMath::RotationTrack<float>& track) {
+        Quaternionf before = track.Sample(1.0f - h).Conjugate() * track.Sample(1.0f);
+        Quaternionf after = track.Sample(1.0f).Conjugate() * track.Sample(1.0f + h);
+        return (after - before).Magnitude() / h;
+    };
+    EXPECT_LT(kink(squad), 0.1f * kink(linear));
+}
+
+TEST(AnimationTrackTest, DoubleRotationsKeepDoublePrecision)
+{
+    typedef SMath::Quaternion<double> Quaterniond;
+    Quaterniond a = Quaterniond::FromAxisAngle(SMath::Vector<double, 3>(0.0, 1.0, 0.0), 0.3);
+    Quaterniond b = Quaterniond::FromAxisAngle(SMath::Vector<double, 3>(1.0, 0.0, 0.0), 2.1);
+    SMath::RotationTrack<double> linear({ 0.0, 1.0 }, { a, b });
+    SMath::RotationTrack<double> squad({ 0.0, 1.0 }, { a, b }, SMath::TrackInterpolation::Squad);
+
+    // With two keys the squad controls are the keys themselves, so both reduce to slerp
+    for (double t = 0.0; t <= 1.0; t += 0.125)
+    {
+        Quaterniond expected = Quaterniond::Slerp(a, b, t);
+        EXPECT_LT((linear.Sample(t) - expected).Magnitude(), 1e-12) << "t = " << t;
+        EXPECT_LT((squad.Sample(t) - expected).Magnitude(), 1e-12) << "t = " << t;
+    }
+}
+
+TEST(AnimationTrackTest, ClipMatchesTrackSampling)
+{
+    std::vector<SMath::VectorTrack<float>> vectorTracks;
+    std::vector<SMath::RotationTrack<float>> rotationTracks;
+    float duration = 0.0f;
+    for (int i = 0; i < 300; ++i)
+    {
+        std::vector<float> times;
+        std::vector<Vector3f> values;
+        std::vector<Quaternionf> rotations;
+        for (int k = 0; k < 10 + i % 7; ++k)
+        {
+            times.push_back(k * (0.25f + i * 0.001f));
+            values.push_back(Vector3f(float(k), float(i), float(k * i % 5)));
+            rotations.push_back(AboutY(0.3f * k + 0.01f * i));
+        }
+        duration = std::max(duration, times.back());
+        auto interpolation = SMath::TrackInterpolation(i % 3);
+        vectorTracks.emplace_back(times, values, interpolation == SMath::TrackInterpolation::Squad
+                                                     ? SMath::TrackInterpolation::Linear : interpolation);
+        rotationTracks.emplace_back(times, rotations, interpolation);
+    }
+
+    SMath::AnimationClip<float> clip(vectorTracks, rotationTracks);
+    EXPECT_EQ(clip.GetTrackCount(), 600u);
+    EXPECT_EQ(clip.GetDuration(), duration);
+
+    for (int threads : { 1, 3 })
+    {
+        std::vector<SMath::TrackCursor> cursors(clip.GetTrackCount());
+        std::vector<Vector3f> vectors(vectorTracks.size());
+        std::vector<Quaternionf> rotations(rotationTracks.size());
+        for (float t = 0.0f; t < 5.0f; t += 0.3f)
+        {
+            clip.Sample(t, cursors, vectors, rotations, threads);
+            for (size_t i = 0; i < vectorTracks.size(); ++i)
+            {
+                ASSERT_EQ(vectors[i], vectorTracks[i].Sample(t));
+                ASSERT_EQ(rotations[i], rotationTracks[i].Sample(t));
+            }
+        }
+    }
+}
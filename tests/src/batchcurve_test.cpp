@@ -0,0 +1,98 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "batchcurve.h"
+#include "batchops.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    std::vector<SMath::CubicBezier<float>> RandomCurves(size_t count, uint32_t seed)
+    {
+        std::vector<float> u = SMath::Test::Uniform(count * 12, seed, -10.0f, 10.0f);
+
+        std::vector<SMath::CubicBezier<float>> curves(count);
+        for (size_t i = 0; i < count; ++i)
+            for (int j = 0; j < 4; ++j)
+                curves[i].m_Points[j] = Point3f(&u[i * 12 + j * 3]);
+        return curves;
+    }
+
+    void ExpectNear(const Point3f& a, const Point3f& b, float tolerance)
+    {
+        EXPECT_NEAR(a.x, b.x, tolerance);
+        EXPECT_NEAR(a.y, b.y, tolerance);
+        EXPECT_NEAR(a.z, b.z, tolerance);
+    }
+}
+
+TEST(BatchCurveTest, CanEvaluateParameters)
+{
+    auto curve = RandomCurves(1, 1)[0];
+    std::vector<float> t = SMath::Test::Uniform(67, 2, 0.0f, 1.0f);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Point3f> out(t.size());
+        SMath::Batch::Evaluate(curve, t, out);
+        for (size_t i = 0; i < t.size(); ++i)
+            ExpectNear(out[i], curve.Evaluate(t[i]), 1e-4f);
+    });
+}
+
+TEST(BatchCurveTest, CanEvaluateCurves)
+{
+    auto curves = RandomCurves(53, 3);
+    std::vector<float> t = SMath::Test::Uniform(curves.size(), 4, 0.0f, 1.0f);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Point3f> out(curves.size());
+        SMath::Batch::Evaluate(curves, t, out);
+        for (size_t i = 0; i < curves.size(); ++i)
+            ExpectNear(out[i], curves[i].Evaluate(t[i]), 1e-5f);
+    });
+}
+
+TEST(BatchCurveTest, CanTessellate)
+{
+    auto curves = RandomCurves(5, 5);
+
+    for (size_t pointCount : { 1, 2, 4, 16, 17, 33, 200 })
+    {
+        SCOPED_TRACE(pointCount);
+        SMath::Test::ForEachLevel([&]() {
+            std::vector<Point3f> out(curves.size() * pointCount);
+            SMath::Batch::Tessellate(curves, pointCount, out);
+            for (size_t c = 0; c < curves.size(); ++c)
+            {
+                for (size_t i = 0; i < pointCount; ++i)
+                {
+                    float t = pointCount > 1 ? float(i) / float(pointCount - 1) : 0.0f;
+                    ExpectNear(out[c * pointCount + i], curves[c].Evaluate(t), 1e-4f);
+                }
+                EXPECT_EQ(out[c * pointCount + pointCount - 1], pointCount > 1 ? curves[c].m_Points[3] : curves[c].m_Points[0]);
+            }
+        });
+    }
+}
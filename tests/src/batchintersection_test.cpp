@@ -0,0 +1,141 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "batchintersection.h"
+#include "batchops.h"
+
+#include <limits>
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    // Rays from around the scene towards its middle
+    std::vector<SMath::Ray<float>> Rays(size_t count, uint32_t seed)
+    {
+        auto u = SMath::Test::Uniform(count * 6, seed, -1.0f, 1.0f);
+        std::vector<SMath::Ray<float>> rays;
+        for (size_t i = 0; i < count; ++i)
+        {
+            Point3f origin(u[i * 6] * 20.0f, u[i * 6 + 1] * 20.0f, -30.0f);
+            Point3f target(u[i * 6 + 3] * 8.0f, u[i * 6 + 4] * 8.0f, u[i * 6 + 5] * 8.0f);
+            rays.emplace_back(origin, target - origin, 0.0f, i % 4 == 0 ? 30.0f : std::numeric_limits<float>::max());
+        }
+        return rays;
+    }
+
+    // Compares the batch closest hit against the scalar loop
+    template<typename Primitive>
+    void ExpectSameClosest(const std::vector<Primitive>& primitives, const std::vector<SMath::Ray<float>>& rays, float tolerance)
+    {
+        int hits = 0;
+        for (const SMath::Ray<float>& ray : rays)
+        {
+            SMath::RayHit<float> expected, actual;
+            uint32_t expectedIndex = 0, actualIndex = 0;
+            bool found = SMath::Simd::Scalar::IntersectClosest(ray, primitives.data(), primitives.size(), 0, expected, expectedIndex);
+            ASSERT_EQ(SMath::Batch::Intersect(ray, std::span<const Primitive>(primitives), actual, actualIndex), found);
+            if (!found)
+                continue;
+
+            ++hits;
+            // Rounding scales with the distances in the scene, about 50
+            EXPECT_NEAR(actual.m_T, expected.m_T, tolerance * (expected.m_T + 50.0f));
+            EXPECT_EQ(actualIndex, expectedIndex);
+            EXPECT_NEAR(actual.m_U, expected.m_U, 1e-4f);
+            EXPECT_NEAR(actual.m_V, expected.m_V, 1e-3f);
+            EXPECT_NEAR((actual.m_Normal - expected.m_Normal).Magnitude(), 0.0f, 1e-4f);
+        }
+        EXPECT_GT(hits, int(rays.size() / 4));
+    }
+}
+
+TEST(BatchIntersectionTest, CanIntersectSpheres)
+{
+    auto u = SMath::Test::Uniform(4 * 45, 1, -8.0f, 8.0f);
+    std::vector<SMath::Sphere<float>> spheres;
+    for (size_t i = 0; i < 45; ++i)
+        spheres.emplace_back(Point3f(&u[i * 4]), 0.5f + std::abs(u[i * 4 + 3]) * 0.2f);
+
+    auto rays = Rays(500, 2);
+    SMath::Test::ForEachLevel([&]() { ExpectSameClosest(spheres, rays, 1e-5f); });
+
+    // An earlier hit bounds the search; nothing closer leaves hit and index alone
+    SMath::RayHit<float> hit;
+    hit.m_T = 1e-3f;
+    uint32_t index = 7;
+    EXPECT_FALSE(SMath::Batch::Intersect(rays[0], std::span<const SMath::Sphere<float>>(spheres), hit, index));
+    EXPECT_EQ(hit.m_T, 1e-3f);
+    EXPECT_EQ(index, 7u);
+}
+
+TEST(BatchIntersectionTest, CanIntersectPlanesAndDisks)
+{
+    auto u = SMath::Test::Uniform(7 * 37, 3, -8.0f, 8.0f);
+    std::vector<SMath::Plane<float>> planes;
+    std::vector<SMath::Disk<float>> disks;
+    for (size_t i = 0; i < 37; ++i)
+    {
+        const float* r = &u[i * 7];
+        planes.emplace_back(Vector3f(r[0], r[1], r[2]), r[3] * 3.0f);
+        disks.emplace_back(Point3f(r[0], r[1], r[2]), Vector3f(r[3], r[4], r[5]), 1.0f + std::abs(r[6]) * 0.3f);
+    }
+
+    auto rays = Rays(500, 4);
+    SMath::Test::ForEachLevel([&]() {
+        ExpectSameClosest(planes, rays, 1e-5f);
+        ExpectSameClosest(disks, rays, 1e-5f);
+    });
+}
+
+TEST(BatchIntersectionTest, ParallelPlanesMissWithInfiniteRange)
+{
+    const float infinity = std::numeric_limits<float>::infinity();
+    std::vector<SMath::Plane<float>> planes(16, SMath::Plane<float>(Vector3f(0.0f, 0.0f, 1.0f), 5.0f));
+    SMath::Ray<float> ray(Point3f(0.0f, 0.0f, 0.0f), Vector3f(1.0f, 0.0f, 0.0f), 1e-4f, infinity);
+
+    SMath::Test::ForEachLevel([&]() {
+        SMath::RayHit<float> hit;
+        hit.m_T = infinity;
+        uint32_t index = 7;
+        EXPECT_FALSE(SMath::Batch::Intersect(ray, std::span<const SMath::Plane<float>>(planes), hit, index));
+        EXPECT_EQ(hit.m_T, infinity);
+        EXPECT_EQ(index, 7u);
+    });
+}
+
+TEST(BatchIntersectionTest, CanIntersectRibbons)
+{
+    auto u = SMath::Test::Uniform(12 * 41, 5, -8.0f, 8.0f);
+    std::vector<SMath::RibbonCurve<float>> ribbons;
+    for (size_t i = 0; i < 41; ++i)
+    {
+        const float* r = &u[i * 12];
+        SMath::CubicBezier<float> curve(Point3f(r), Point3f(r + 3), Point3f(r + 6), Point3f(r + 9));
+        ribbons.emplace_back(curve, 0.4f + 0.1f * float(i % 3), 0.2f);
+    }
+
+    auto rays = Rays(2000, 6);
+    SMath::Test::ForEachLevel([&]() { ExpectSameClosest(ribbons, rays, 1e-4f); });
+}
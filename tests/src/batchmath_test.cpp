@@ -0,0 +1,215 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "batchmath.h"
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    // Error of actual in units in the last place of the correctly rounded result
+    double UlpError(float actual, double expected)
+    {
+        float rounded = float(expected);
+        if (std::isinf(rounded) || rounded == 0.0f)
+            return actual == rounded ? 0.0 : 1e9;
+
+        float ulp = std::nextafter(std::fabs(rounded), INFINITY) - std::fabs(rounded);
+        return std::fabs(double(actual) - expected) / ulp;
+    }
+
+    std::vector<float> Range(float lo, float hi, int count)
+    {
+        std::vector<float> v(count);
+        for (int i = 0; i < count; ++i)
+            v[i] = lo + (hi - lo) * (float(i) / (count - 1));
+        return v;
+    }
+
+    template <typename Func>
+    double MaxUlp(const std::vector<float>& in, Func func, double (*exact)(double))
+    {
+        std::vector<float> out(in.size());
+        func(std::span<const float>(in), std::span<float>(out));
+
+        double maxError = 0.0;
+        for (size_t i = 0; i < in.size(); ++i)
+            maxError = std::max(maxError, UlpError(out[i], exact(double(in[i]))));
+        return maxError;
+    }
+}
+
+TEST(BatchMathTest, SinCosWithinUlpBounds)
+{
+    // Odd count so the scalar tail is exercised as well
+    auto in = Range(-8192.0f, 8192.0f, 200001);
+    SMath::Test::ForEachLevel([&]() {
+        EXPECT_LE(MaxUlp(in, SMath::Batch::Sin, std::sin), 2.5);
+        EXPECT_LE(MaxUlp(in, SMath::Batch::Cos, std::cos), 2.5);
+    });
+}
+
+TEST(BatchMathTest, ExpLogWithinUlpBounds)
+{
+    auto expIn = Range(-87.0f, 88.0f, 200001);
+    auto logIn = Range(1e-30f, 1e30f, 200001);
+    auto logNearOne = Range(0.25f, 4.0f, 200001);
+    SMath::Test::ForEachLevel([&]() {
+        EXPECT_LE(MaxUlp(expIn, SMath::Batch::Exp, std::exp), 1.5);
+        EXPECT_LE(MaxUlp(logIn, SMath::Batch::Log, std::log), 1.0);
+        EXPECT_LE(MaxUlp(logNearOne, SMath::Batch::Log, std::log), 1.0);
+    });
+}
+
+TEST(BatchMathTest, PowWithinUlpBounds)
+{
+    auto x = Range(0.001f, 1000.0f, 100003);
+    auto y = Range(-6.0f, 6.0f, 100003);
+    std::reverse(y.begin(), y.end());
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<float> out(x.size());
+        SMath::Batch::Pow(std::span<const float>(x), std::span<const float>(y), std::span<float>(out));
+
+        double maxError = 0.0;
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            double expected = std::pow(double(x[i]), double(y[i]));
+            if (expected < 1.2e-38 || expected > 3.4e38)
+                continue;
+            maxError = std::max(maxError, UlpError(out[i], expected));
+        }
+        EXPECT_LE(maxError, 1.0);
+    });
+}
+
+TEST(BatchMathTest, PowWithinUlpBoundsForLargeExponents)
+{
+    // |y * ln(x)| up to 88, where exp magnifies any error in the product the most
+    auto x = Range(0.05f, 20.0f, 200003);
+    std::vector<float> y(x.size());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        float scale = (i % 7 + 1) / 7.0f;
+        float logX = std::log(x[i]);
+        y[i] = logX == 0.0f ? 1.0f : (i % 2 == 0 ? 1.0f : -1.0f) * scale * 88.0f / std::fabs(logX);
+    }
+    x.push_back(1.41406f);
+    y.push_back(-220.079f);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<float> out(x.size());
+        SMath::Batch::Pow(std::span<const float>(x), std::span<const float>(y), std::span<float>(out));
+
+        double maxError = 0.0;
+        for (size_t i = 0; i < x.size(); ++i)
+        {
+            double expected = std::pow(double(x[i]), double(y[i]));
+            if (expected < 1.2e-38 || expected > 3.4e38)
+                continue;
+            maxError = std::max(maxError, UlpError(out[i], expected));
+        }
+        EXPECT_LE(maxError, 1.0);
+    });
+}
+
+TEST(BatchMathTest, CanPowWithScalarExponent)
+{
+    auto x = Range(0.0f, 16.0f, 1001);
+    std::vector<float> out(x.size());
+    float gamma = 1.0f / 2.2f;
+
+    SMath::Batch::Pow(std::span<const float>(x), gamma, std::span<float>(out));
+
+    for (size_t i = 0; i < x.size(); ++i)
+        EXPECT_LE(UlpError(out[i], std::pow(double(x[i]), double(gamma))), 1.0);
+}
+
+TEST(BatchMathTest, HandlesSpecialValues)
+{
+    std::vector<float> x = { 0.0f, 1.0f, 0.0f, 2.0f, -1.0f, 1.0f, 4.0f, 0.0f, 3.0f };
+    std::vector<float> y = { 0.0f, INFINITY, 2.0f, 0.0f, 0.5f, 7.0f, 0.5f, -1.0f, 2.0f };
+    std::vector<float> out(x.size());
+
+    SMath::Batch::Pow(std::span<const float>(x), std::span<const float>(y), std::span<float>(out));
+    EXPECT_EQ(out[0], 1.0f);
+    EXPECT_EQ(out[1], 1.0f);
+    EXPECT_EQ(out[2], 0.0f);
+    EXPECT_EQ(out[3], 1.0f);
+    EXPECT_TRUE(std::isnan(out[4]));
+    EXPECT_EQ(out[5], 1.0f);
+    EXPECT_EQ(out[6], 2.0f);
+    EXPECT_TRUE(std::isinf(out[7]));
+    EXPECT_EQ(out[8], 9.0f);
+
+    std::vector<float> in = { 0.0f, -1.0f, INFINITY, 1.0f, -200.0f, 200.0f };
+    SMath::Batch::Log(std::span<const float>(in.data(), 4), std::span<float>(out.data(), 4));
+    EXPECT_TRUE(std::isinf(out[0]) && out[0] < 0);
+    EXPECT_TRUE(std::isnan(out[1]));
+    EXPECT_TRUE(std::isinf(out[2]) && out[2] > 0);
+    EXPECT_EQ(out[3], 0.0f);
+
+    SMath::Batch::Exp(std::span<const float>(in.data() + 4, 2), std::span<float>(out.data(), 2));
+    EXPECT_EQ(out[0], 0.0f);
+    EXPECT_TRUE(std::isinf(out[1]));
+}
+
+TEST(BatchMathTest, CanRunInPlace)
+{
+    auto v = Range(-3.0f, 3.0f, 37);
+    auto expected = v;
+    for (auto& e : expected)
+        e = SMath::FastMath::Exp(e);
+
+    SMath::Batch::Exp(std::span<const float>(v), std::span<float>(v));
+    for (size_t i = 0; i < v.size(); ++i)
+        EXPECT_NEAR(v[i], expected[i], std::fabs(expected[i]) * 3e-7f);
+}
+
+TEST(BatchMathTest, EveryLevelMatchesScalar)
+{
+    auto in = Range(-50.0f, 50.0f, 1003);
+    std::vector<float> scalar(in.size()), simd(in.size());
+    SMath::Simd::Scalar::SinArray(in.data(), scalar.data(), in.size());
+
+#if defined(SMATH_X86)
+    SMath::Simd::Sse2::SinArray(in.data(), simd.data(), in.size());
+    for (size_t i = 0; i < in.size(); ++i)
+        EXPECT_NEAR(simd[i], scalar[i], 3e-7f);
+
+    if (SMath::Simd::GetSupportedLevel() >= SMath::Simd::Level::Avx2)
+    {
+        SMath::Simd::Avx2::SinArray(in.data(), simd.data(), in.size());
+        for (size_t i = 0; i < in.size(); ++i)
+            EXPECT_NEAR(simd[i], scalar[i], 3e-7f);
+    }
+
+    if (SMath::Simd::GetSupportedLevel() >= SMath::Simd::Level::Avx512)
+    {
+        SMath::Simd::Avx512::SinArray(in.data(), simd.data(), in.size());
+        for (size_t i = 0; i < in.size(); ++i)
+            EXPECT_NEAR(simd[i], scalar[i], 3e-7f);
+    }
+#endif
+}
@@ -0,0 +1,181 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "batchops.h"
+#include "transform.h"
+
+#include <vector>
+
+using SMath::Simd::Level;
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    std::vector<Point3f> Points(int count)
+    {
+        std::vector<Point3f> points(count);
+        for (int i = 0; i < count; ++i)
+            points[i] = Point3f(float(i % 7) - 3.0f, float(i % 11) * 0.5f - 2.0f, float(i % 5) - 1.5f);
+        return points;
+    }
+
+    bool GetBit(const std::vector<uint64_t>& mask, size_t i)
+    {
+        return (mask[i / 64] >> (i % 64)) & 1;
+    }
+}
+
+TEST(DispatchTest, CanForceLevel)
+{
+    Level supported = SMath::Simd::GetSupportedLevel();
+
+    EXPECT_EQ(SMath::Simd::SetLevel(Level::Scalar), Level::Scalar);
+    EXPECT_EQ(SMath::Simd::GetLevel(), Level::Scalar);
+
+    // Levels above what the CPU supports are clamped
+    EXPECT_EQ(SMath::Simd::SetLevel(Level::Avx512), supported);
+
+    SMath::Simd::ResetLevel();
+    EXPECT_EQ(SMath::Simd::GetLevel(), supported);
+}
+
+TEST(BatchOpsTest, CanTransformPoints)
+{
+    auto m = SMath::Transform<float>::GetPerspectiveMatrixLH(1.0f, 1.5f, 0.1f, 100.0f) *
+             SMath::Transform<float>::GetTranslationMatrix(Vector3f(0.5f, -1.0f, 20.0f));
+    auto points = Points(103);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Point3f> out(points.size());
+        SMath::Batch::TransformPoints(m, std::span<const Point3f>(points), std::span<Point3f>(out));
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            SMath::Vector<float, 4> h = m * SMath::Vector<float, 4>(points[i].x, points[i].y, points[i].z, 1.0f);
+            for (int j = 0; j < 3; ++j)
+                EXPECT_NEAR(out[i][j], h[j] / h.w, 1e-5f);
+        }
+    });
+}
+
+TEST(BatchOpsTest, CanTransformVectors)
+{
+    auto m = SMath::Transform<float>::GetScaleMatrix(Vector3f(2.0f, 3.0f, 4.0f)) *
+             SMath::Transform<float>::GetTranslationMatrix(Vector3f(5.0f, 6.0f, 7.0f));
+    std::vector<Vector3f> vectors(37, Vector3f(1.0f, -1.0f, 0.5f));
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Vector3f> out(vectors.size());
+        SMath::Batch::TransformVectors(m, std::span<const Vector3f>(vectors), std::span<Vector3f>(out));
+
+        for (const auto& v : out)
+        {
+            EXPECT_FLOAT_EQ(v.x, 2.0f);
+            EXPECT_FLOAT_EQ(v.y, -3.0f);
+            EXPECT_FLOAT_EQ(v.z, 2.0f);
+        }
+    });
+}
+
+TEST(BatchOpsTest, CanNormalizeInPlace)
+{
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Vector3f> vectors(45);
+        for (size_t i = 0; i < vectors.size(); ++i)
+            vectors[i] = Vector3f(float(i) + 1.0f, -2.0f, 0.25f * float(i));
+
+        auto expected = vectors;
+        SMath::Batch::Normalize(std::span<const Vector3f>(vectors), std::span<Vector3f>(vectors));
+
+        for (size_t i = 0; i < vectors.size(); ++i)
+        {
+            Vector3f n = expected[i].Normalized();
+            for (int j = 0; j < 3; ++j)
+                EXPECT_NEAR(vectors[i][j], n[j], 1e-6f);
+        }
+    });
+}
+
+TEST(BatchOpsTest, CanTestPointsAgainstBox)
+{
+    SMath::Box<float> box(Point3f(-1.0f, -1.0f, -1.0f), Point3f(2.0f, 1.0f, 0.5f));
+    auto points = Points(150);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<uint64_t> mask(SMath::Batch::GetMaskSize(points.size()), ~uint64_t(0));
+        SMath::Batch::Contains(box, std::span<const Point3f>(points), std::span<uint64_t>(mask));
+
+        for (size_t i = 0; i < points.size(); ++i)
+            EXPECT_EQ(GetBit(mask, i), box.Contains(points[i])) << "point " << i;
+
+        // Bits past the last element are left clear
+        EXPECT_EQ(mask.back() >> (points.size() % 64), uint64_t(0));
+    });
+}
+
+TEST(BatchOpsTest, CanTestBoxesAgainstBox)
+{
+    SMath::Box<float> box(Point3f(0.0f, 0.0f, 0.0f), Point3f(1.0f, 1.0f, 1.0f));
+    std::vector<SMath::Box<float>> boxes;
+    for (int i = 0; i < 70; ++i)
+    {
+        float offset = float(i % 10) * 0.25f - 1.0f;
+        boxes.emplace_back(Point3f(offset, 0.5f, 0.5f), Point3f(offset + 0.5f, 2.0f, 2.0f));
+    }
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<uint64_t> mask(SMath::Batch::GetMaskSize(boxes.size()));
+        SMath::Batch::Overlaps(box, std::span<const SMath::Box<float>>(boxes), std::span<uint64_t>(mask));
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            bool expected = boxes[i].m_Max.x >= 0.0f && boxes[i].m_Min.x <= 1.0f;
+            EXPECT_EQ(GetBit(mask, i), expected) << "box " << i;
+        }
+    });
+}
+
+TEST(BatchOpsTest, FillUniformIsSameOnEveryLevel)
+{
+    std::vector<float> reference(1001);
+    SMath::Simd::Scalar::FillUniformArray(reference.data(), reference.size(), 42, -2.0f, 3.0f);
+
+    double mean = 0.0;
+    for (float v : reference)
+    {
+        EXPECT_GE(v, -2.0f);
+        EXPECT_LT(v, 3.0f);
+        mean += v;
+    }
+    EXPECT_NEAR(mean / reference.size(), 0.5, 0.15);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<float> out = SMath::Test::Uniform(reference.size(), 42, -2.0f, 3.0f);
+        for (size_t i = 0; i < out.size(); ++i)
+            EXPECT_EQ(out[i], reference[i]);
+    });
+
+    std::vector<float> other = SMath::Test::Uniform(reference.size(), 43, -2.0f, 3.0f);
+    EXPECT_NE(other, reference);
+}
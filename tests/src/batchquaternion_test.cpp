@@ -0,0 +1,153 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "batchquaternion.h"
+#include "batchops.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    typedef SMath::Quaternion<float> Quaternionf;
+    typedef SMath::Quaternion<double> Quaterniond;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    Quaterniond ToDouble(const Quaternionf& q)
+    {
+        return Quaterniond(q.x, q.y, q.z, q.w);
+    }
+
+    // Unit rotations; every third b is close to its a and every fourth is on the far hemisphere
+    void RandomPairs(size_t count, uint32_t seed, std::vector<Quaternionf>& a, std::vector<Quaternionf>& b)
+    {
+        std::vector<float> u = SMath::Test::Uniform(count * 8, seed, -1.0f, 1.0f);
+
+        a.resize(count);
+        b.resize(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float* r = &u[i * 8];
+            a[i] = Quaternionf(r[0], r[1], r[2], r[3]).Normalized();
+            b[i] = Quaternionf(r[4], r[5], r[6], r[7]).Normalized();
+            if (i % 3 == 0)
+                b[i] = (a[i] + b[i] * 1e-4f).Normalized();
+            if (i % 4 == 0)
+                b[i] = -b[i];
+        }
+    }
+
+    template <typename T>
+    void ExpectNear(const Quaterniond& expected, const SMath::Quaternion<T>& actual, double tolerance)
+    {
+        EXPECT_NEAR(expected.x, actual.x, tolerance);
+        EXPECT_NEAR(expected.y, actual.y, tolerance);
+        EXPECT_NEAR(expected.z, actual.z, tolerance);
+        EXPECT_NEAR(expected.w, actual.w, tolerance);
+    }
+}
+
+TEST(BatchQuaternionTest, CanNlerp)
+{
+    Quaterniond a = Quaterniond::FromAxisAngle(SMath::Vector3(0.0, 0.0, 1.0), 0.0);
+    Quaterniond b = Quaterniond::FromAxisAngle(SMath::Vector3(0.0, 0.0, 1.0), SMath::Pi / 2.0);
+
+    // Taking -b rotates the same way, and the shorter path does not depend on the sign
+    ExpectNear(Quaterniond::Nlerp(a, b, 0.5), Quaterniond::Nlerp(a, -b, 0.5), 1e-12);
+    ExpectNear(Quaterniond::Nlerp(a, b, 0.5), Quaterniond::FromAxisAngle(SMath::Vector3(0.0, 0.0, 1.0), SMath::Pi / 4.0), 1e-7);
+    EXPECT_NEAR(Quaterniond::Nlerp(a, b, 0.25).Magnitude(), 1.0, 1e-12);
+}
+
+TEST(BatchQuaternionTest, CanNormalizeAndMultiply)
+{
+    const size_t count = 1003;
+    std::vector<Quaternionf> a, b;
+    RandomPairs(count, 1, a, b);
+    for (size_t i = 0; i < count; ++i)
+        a[i] *= 0.5f + float(i % 7);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Quaternionf> out(count);
+        SMath::Batch::Normalize(a, out);
+        for (size_t i = 0; i < count; ++i)
+            ExpectNear(ToDouble(a[i]).Normalized(), out[i], 1e-6);
+
+        SMath::Batch::Multiply(a, b, out);
+        for (size_t i = 0; i < count; ++i)
+            ExpectNear(ToDouble(a[i]) * ToDouble(b[i]), out[i], 1e-5);
+
+        // In place
+        out = b;
+        SMath::Batch::Multiply(b, out, out);
+        for (size_t i = 0; i < count; ++i)
+            ExpectNear(ToDouble(b[i]) * ToDouble(b[i]), out[i], 1e-6);
+    });
+}
+
+TEST(BatchQuaternionTest, CanRotateVectors)
+{
+    const size_t count = 1001;
+    std::vector<Quaternionf> q, unused;
+    RandomPairs(count, 2, q, unused);
+
+    std::vector<float> u = SMath::Test::Uniform(count * 3, 3, -10.0f, 10.0f);
+    std::vector<Vector3f> v(count);
+    for (size_t i = 0; i < count; ++i)
+        v[i] = Vector3f(u[i * 3], u[i * 3 + 1], u[i * 3 + 2]);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Vector3f> out(count);
+        SMath::Batch::Rotate(q, v, out);
+        for (size_t i = 0; i < count; ++i)
+        {
+            SMath::Vector3 expected = ToDouble(q[i]).Rotate(SMath::Vector3(v[i].x, v[i].y, v[i].z));
+            EXPECT_NEAR(expected.x, out[i].x, 2e-5);
+            EXPECT_NEAR(expected.y, out[i].y, 2e-5);
+            EXPECT_NEAR(expected.z, out[i].z, 2e-5);
+        }
+    });
+}
+
+TEST(BatchQuaternionTest, CanSlerpAndNlerp)
+{
+    const size_t count = 1005;
+    std::vector<Quaternionf> a, b;
+    RandomPairs(count, 4, a, b);
+
+    std::vector<float> t = SMath::Test::Uniform(count, 5, 0.0f, 1.0f);
+    t[0] = 0.0f;
+    t[1] = 1.0f;
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Quaternionf> out(count);
+        SMath::Batch::Slerp(a, b, t, out);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Quaterniond expected = Quaterniond::Slerp(ToDouble(a[i]), ToDouble(b[i]), t[i]);
+            ExpectNear(expected, out[i], 2e-6);
+        }
+
+        SMath::Batch::Nlerp(a, b, t, out);
+        for (size_t i = 0; i < count; ++i)
+            ExpectNear(Quaterniond::Nlerp(ToDouble(a[i]), ToDouble(b[i]), t[i]), out[i], 1e-6);
+    });
+}
@@ -17,7 +17,12 @@
 */
 
 #include "gtest.h"
+#include "testutils.h"
 #include "box.h"
+#include "boxbounds.h"
+#include "batchops.h"
+
+#include <vector>
 
 TEST(BoxTest, CanBeCreated)
 {
@@ -95,3 +100,155 @@ TEST(BoxTest, CanGetUnion)
     EXPECT_EQ(b1b2Union.m_Max, SMath::Point3(5.0, 6.0, 7.0));
 }
 
+TEST(BoxTest, CanCheckOverlap)
+{
+    SMath::Box a(SMath::Point3(0.0), SMath::Point3(1.0));
+
+    EXPECT_TRUE(a.Overlaps(SMath::Box(SMath::Point3(0.5), SMath::Point3(2.0))));
+    EXPECT_TRUE(a.Overlaps(SMath::Box(SMath::Point3(1.0, 0.0, 0.0), SMath::Point3(2.0, 1.0, 1.0))));
+    EXPECT_TRUE(a.Overlaps(SMath::Box(SMath::Point3(-1.0), SMath::Point3(2.0))));
+    EXPECT_FALSE(a.Overlaps(SMath::Box(SMath::Point3(1.1, 0.0, 0.0), SMath::Point3(2.0, 1.0, 1.0))));
+    EXPECT_FALSE(a.Overlaps(SMath::Box(SMath::Point3(0.0, 0.0, -2.0), SMath::Point3(1.0, 1.0, -0.1))));
+    EXPECT_FALSE(a.Overlaps(SMath::Box<double>::Empty()));
+}
+
+TEST(BoxTest, CanGetIntersection)
+{
+    SMath::Box a(SMath::Point3(0.0), SMath::Point3(2.0));
+    SMath::Box b(SMath::Point3(1.0, -1.0, 0.5), SMath::Point3(3.0, 1.0, 1.5));
+
+    SMath::Box i = SMath::Box<double>::Intersection(a, b);
+    EXPECT_EQ(i.m_Min, SMath::Point3(1.0, 0.0, 0.5));
+    EXPECT_EQ(i.m_Max, SMath::Point3(2.0, 1.0, 1.5));
+    EXPECT_FALSE(i.IsEmpty());
+
+    SMath::Box c(SMath::Point3(3.0), SMath::Point3(4.0));
+    EXPECT_TRUE(SMath::Box<double>::Intersection(a, c).IsEmpty());
+}
+
+TEST(BoxTest, CanBeEmpty)
+{
+    SMath::Box empty = SMath::Box<double>::Empty();
+    EXPECT_TRUE(empty.IsEmpty());
+    EXPECT_FALSE(empty.Contains(SMath::Point3(0.0)));
+    EXPECT_FALSE(SMath::Box(SMath::Point3(0.0), SMath::Point3(0.0)).IsEmpty());
+
+    SMath::Box a(SMath::Point3(-1.0), SMath::Point3(1.0));
+    SMath::Box u = SMath::Box<double>::Union(empty, a);
+    EXPECT_EQ(u.m_Min, a.m_Min);
+    EXPECT_EQ(u.m_Max, a.m_Max);
+
+    empty.Expand(SMath::Point3(1.0, 2.0, 3.0));
+    EXPECT_EQ(empty.m_Min, SMath::Point3(1.0, 2.0, 3.0));
+    EXPECT_EQ(empty.m_Max, SMath::Point3(1.0, 2.0, 3.0));
+}
+
+TEST(BoxTest, CanGetCentroid)
+{
+    SMath::Box a(SMath::Point3(-1.0, 0.0, 2.0), SMath::Point3(3.0, 1.0, 2.0));
+    EXPECT_EQ(a.GetCentroid(), SMath::Point3(1.0, 0.5, 2.0));
+}
+
+TEST(BoxTest, CanGetMaximumExtent)
+{
+    EXPECT_EQ(SMath::Box(SMath::Point3(0.0), SMath::Point3(3.0, 1.0, 2.0)).GetMaximumExtent(), 0);
+    EXPECT_EQ(SMath::Box(SMath::Point3(0.0), SMath::Point3(1.0, 3.0, 2.0)).GetMaximumExtent(), 1);
+    EXPECT_EQ(SMath::Box(SMath::Point3(0.0), SMath::Point3(1.0, 2.0, 3.0)).GetMaximumExtent(), 2);
+    EXPECT_EQ(SMath::Box(SMath::Point3(0.0), SMath::Point3(2.0, 2.0, 1.0)).GetMaximumExtent(), 0);
+    EXPECT_EQ(SMath::Box(SMath::Point3(0.0), SMath::Point3(1.0, 2.0, 2.0)).GetMaximumExtent(), 1);
+}
+
+TEST(BoxTest, CanGetOffset)
+{
+    SMath::Box a(SMath::Point3(0.0, 2.0, 1.0), SMath::Point3(4.0, 4.0, 1.0));
+
+    EXPECT_EQ(a.GetOffset(SMath::Point3(0.0, 2.0, 1.0)), SMath::Vector3(0.0, 0.0, 0.0));
+    EXPECT_EQ(a.GetOffset(SMath::Point3(1.0, 3.0, 1.0)), SMath::Vector3(0.25, 0.5, 0.0));
+    EXPECT_EQ(a.GetOffset(SMath::Point3(4.0, 4.0, 1.5)), SMath::Vector3(1.0, 1.0, 0.5));
+}
+
+TEST(BoxTest, CanExpand)
+{
+    SMath::Box a(SMath::Point3(0.0), SMath::Point3(1.0));
+
+    a.Expand(SMath::Point3(2.0, -1.0, 0.5));
+    EXPECT_EQ(a.m_Min, SMath::Point3(0.0, -1.0, 0.0));
+    EXPECT_EQ(a.m_Max, SMath::Point3(2.0, 1.0, 1.0));
+
+    a.Expand(SMath::Box(SMath::Point3(-3.0, 0.0, 0.0), SMath::Point3(0.0, 0.0, 5.0)));
+    EXPECT_EQ(a.m_Min, SMath::Point3(-3.0, -1.0, 0.0));
+    EXPECT_EQ(a.m_Max, SMath::Point3(2.0, 1.0, 5.0));
+}
+
+TEST(BoxTest, CanGetBoundsOfPoints)
+{
+    std::vector<SMath::Point3> points = { SMath::Point3(1, -2, 3), SMath::Point3(-4, 5, 0), SMath::Point3(2, 0, -6) };
+
+    SMath::Box bounds = SMath::Box<double>::FromPoints(points);
+    EXPECT_EQ(bounds.m_Min, SMath::Point3(-4, -2, -6));
+    EXPECT_EQ(bounds.m_Max, SMath::Point3(2, 5, 3));
+
+    SMath::Box empty = SMath::Box<double>::FromPoints({});
+    EXPECT_EQ(SMath::Box<double>::Union(empty, bounds).m_Min, bounds.m_Min);
+    EXPECT_EQ(SMath::Box<double>::Union(empty, bounds).m_Max, bounds.m_Max);
+}
+
+TEST(BoxTest, CanGetUnionOfAll)
+{
+    std::vector<SMath::Box<double>> boxes = {
+        SMath::Box(SMath::Point3(1.0, 2.0, 3.0), SMath::Point3(4.0, 5.0, 6.0)),
+        SMath::Box(SMath::Point3(2.0, 3.0, -4.0), SMath::Point3(5.0, 6.0, 7.0)),
+        SMath::Box(SMath::Point3(-1.0, 3.0, 4.0), SMath::Point3(0.0, 6.0, 5.0))
+    };
+
+    SMath::Box bounds = SMath::Box<double>::UnionAll(boxes);
+    EXPECT_EQ(bounds.m_Min, SMath::Point3(-1.0, 2.0, -4.0));
+    EXPECT_EQ(bounds.m_Max, SMath::Point3(5.0, 6.0, 7.0));
+}
+
+TEST(BoxTest, FloatBoundsMatchOnEveryLevelAndThreadCount)
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    // Odd sizes so slices and SIMD tails are uneven
+    for (size_t count : { size_t(1), size_t(7), size_t(1001), size_t(100003) })
+    {
+        std::vector<Point3f> points(count);
+        SMath::Batch::FillUniform(std::span<float>(&points[0][0], count * 3), uint32_t(count), -50.0f, 50.0f);
+        points[count / 2] = Point3f(NAN, 0.0f, 0.0f);
+
+        std::vector<SMath::Box<float>> boxes(count);
+        for (size_t i = 0; i < count; ++i)
+            boxes[i] = SMath::Box<float>(points[(i * 7) % count], points[(i * 7) % count] + SMath::Vector<float, 3>(0.5f, float(i % 3), 1.0f));
+
+        // NaN coordinates are skipped per component, as std::min and std::max keep their first operand
+        SMath::Box<float> expectedPoints(Point3f(INFINITY), Point3f(-INFINITY));
+        SMath::Box<float> expectedBoxes(Point3f(INFINITY), Point3f(-INFINITY));
+        for (size_t i = 0; i < count; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                expectedPoints.m_Min[c] = std::min(expectedPoints.m_Min[c], points[i][c]);
+                expectedPoints.m_Max[c] = std::max(expectedPoints.m_Max[c], points[i][c]);
+                expectedBoxes.m_Min[c] = std::min(expectedBoxes.m_Min[c], boxes[i].m_Min[c]);
+                expectedBoxes.m_Max[c] = std::max(expectedBoxes.m_Max[c], boxes[i].m_Max[c]);
+            }
+        }
+
+        SMath::Test::ForEachLevel([&]() {
+            for (int threads : { 0, 1, 3, 8 })
+            {
+                SMath::Box<float> fromPoints = SMath::Batch::Bounds(std::span<const Point3f>(points), threads);
+                SMath::Box<float> fromBoxes = SMath::Batch::Bounds(std::span<const SMath::Box<float>>(boxes), threads);
+
+                EXPECT_EQ(fromPoints.m_Min, expectedPoints.m_Min) << count << " points, " << threads << " threads";
+                EXPECT_EQ(fromPoints.m_Max, expectedPoints.m_Max) << count << " points, " << threads << " threads";
+                EXPECT_EQ(fromBoxes.m_Min, expectedBoxes.m_Min) << count << " boxes, " << threads << " threads";
+                EXPECT_EQ(fromBoxes.m_Max, expectedBoxes.m_Max) << count << " boxes, " << threads << " threads";
+            }
+
+            EXPECT_EQ(SMath::Box<float>::FromPoints(points).m_Max, expectedPoints.m_Max);
+            EXPECT_EQ(SMath::Box<float>::UnionAll(boxes).m_Min, expectedBoxes.m_Min);
+        });
+    }
+}
@@ -0,0 +1,283 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "widebvh.h"
+#include "quantizedbvh.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    typedef SMath::Box<float> Boxf;
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    bool BruteForce(const SMath::Ray<float>& ray, const std::vector<Boxf>& boxes, float& t)
+    {
+        SMath::WideBvh::RayData data(ray);
+        float tMax = ray.m_TMax;
+        bool hit = false;
+        for (const Boxf& box : boxes)
+        {
+            float tBox;
+            if (SMath::WideBvh::IntersectBox(box, data, tMax, tBox))
+            {
+                tMax = tBox;
+                hit = true;
+            }
+        }
+        t = tMax;
+        return hit;
+    }
+
+    template <typename Bvh>
+    void ExpectMatchesBruteForce(const Bvh& bvh, const std::vector<Boxf>& boxes, const std::vector<SMath::Ray<float>>& rays)
+    {
+        int hits = 0;
+        for (const auto& ray : rays)
+        {
+            float expected, actual = -1.0f;
+            uint32_t primitive = ~0u;
+            bool expectedHit = BruteForce(ray, boxes, expected);
+            ASSERT_EQ(bvh.Intersect(ray, boxes, actual, primitive), expectedHit);
+            if (!expectedHit)
+                continue;
+
+            // Ties may pick a different box, but never a different distance
+            ++hits;
+            EXPECT_EQ(actual, expected);
+            ASSERT_LT(primitive, boxes.size());
+            float t;
+            EXPECT_TRUE(SMath::WideBvh::IntersectBox(boxes[primitive], SMath::WideBvh::RayData(ray), ray.m_TMax, t));
+            EXPECT_EQ(t, actual);
+        }
+
+        // Enough rays should hit something for the comparison to say much
+        EXPECT_GT(hits, int(rays.size()) / 8);
+    }
+
+    bool Encloses(const Boxf& outer, const Boxf& inner)
+    {
+        for (int i = 0; i < 3; ++i)
+            if (outer.m_Min[i] > inner.m_Min[i] || outer.m_Max[i] < inner.m_Max[i])
+                return false;
+        return true;
+    }
+}
+
+TEST(BvhTest, CanBuildValidHierarchy)
+{
+    auto boxes = SMath::Test::RandomBoxes(5000, 100.0f, 1);
+    SMath::WideBvh bvh(boxes);
+
+    // Every primitive is referenced by exactly one leaf, inside the bounds of its slot
+    std::vector<int> seen(boxes.size(), 0);
+    for (size_t node = 0; node < bvh.GetNodeCount(); ++node)
+    {
+        for (int slot = 0; slot < SMath::WideBvh::Width; ++slot)
+        {
+            uint32_t child = bvh.GetChild(node, slot);
+            if (child == SMath::WideBvh::InvalidChild)
+                continue;
+
+            if (!SMath::WideBvh::IsLeaf(child))
+            {
+                ASSERT_LT(child, bvh.GetNodeCount());
+                for (int i = 0; i < SMath::WideBvh::Width; ++i)
+                    if (bvh.GetChild(child, i) != SMath::WideBvh::InvalidChild)
+                    {
+                        EXPECT_TRUE(Encloses(bvh.GetChildBounds(node, slot), bvh.GetChildBounds(child, i)));
+                    }
+                continue;
+            }
+
+            uint32_t first = SMath::WideBvh::GetLeafFirst(child);
+            EXPECT_LE(SMath::WideBvh::GetLeafCount(child), uint32_t(SMath::WideBvh::MaxLeafSize));
+            for (uint32_t i = first; i < first + SMath::WideBvh::GetLeafCount(child); ++i)
+            {
+                uint32_t primitive = bvh.GetPrimitives()[i];
+                ++seen[primitive];
+                EXPECT_TRUE(Encloses(bvh.GetChildBounds(node, slot), boxes[primitive]));
+            }
+        }
+    }
+
+    for (int count : seen)
+        EXPECT_EQ(count, 1);
+}
+
+TEST(BvhTest, WideBvhMatchesBruteForce)
+{
+    auto boxes = SMath::Test::RandomBoxes(3000, 50.0f, 2);
+    SMath::WideBvh bvh(boxes);
+    ExpectMatchesBruteForce(bvh, boxes, SMath::Test::RandomRays(2000, 50.0f, 3));
+}
+
+TEST(BvhTest, QuantizedBvhMatchesBruteForce)
+{
+    auto boxes = SMath::Test::RandomBoxes(3000, 50.0f, 4);
+    SMath::QuantizedBvh bvh{ SMath::WideBvh(boxes) };
+    ExpectMatchesBruteForce(bvh, boxes, SMath::Test::RandomRays(2000, 50.0f, 5));
+}
+
+TEST(BvhTest, QuantizedBoundsAreConservative)
+{
+    // Offset far from the origin, so origin + q * step rounds
+    Vector3f offset(1000.0f, -20000.0f, 0.5f);
+    auto boxes = SMath::Test::RandomBoxes(4000, 3.0f, 6);
+    for (Boxf& box : boxes)
+        box = Boxf(box.m_Min + offset, box.m_Max + offset);
+
+    SMath::WideBvh wide(boxes);
+    SMath::QuantizedBvh quantized(wide);
+    ASSERT_EQ(quantized.GetNodeCount(), wide.GetNodeCount());
+
+    double wideArea = 0.0, quantizedArea = 0.0;
+    for (size_t node = 0; node < wide.GetNodeCount(); ++node)
+    {
+        for (int slot = 0; slot < SMath::WideBvh::Width; ++slot)
+        {
+            ASSERT_EQ(quantized.GetChild(node, slot), wide.GetChild(node, slot));
+            if (wide.GetChild(node, slot) == SMath::WideBvh::InvalidChild)
+                continue;
+
+            Boxf exact = wide.GetChildBounds(node, slot);
+            Boxf rounded = quantized.GetChildBounds(node, slot);
+            EXPECT_TRUE(Encloses(rounded, exact));
+            wideArea += exact.GetSurfaceArea();
+            quantizedArea += rounded.GetSurfaceArea();
+        }
+    }
+
+    // 8 bits per plane should only loosen the boxes slightly
+    EXPECT_LT(quantizedArea, wideArea * 1.25);
+    ExpectMatchesBruteForce(quantized, boxes, SMath::Test::RandomRays(500, 3.0f, 7, offset));
+}
+
+TEST(BvhTest, CanQuantizeDegenerateBounds)
+{
+    // Flat boxes and coincident boxes give zero extents along some axes
+    std::vector<Boxf> boxes;
+    for (int i = 0; i < 40; ++i)
+        boxes.emplace_back(Point3f(float(i), 0.0f, 2.0f), Point3f(float(i) + 0.5f, 1.0f, 2.0f));
+    for (int i = 0; i < 10; ++i)
+        boxes.emplace_back(Point3f(-5.0f), Point3f(-5.0f));
+
+    SMath::WideBvh wide(boxes);
+    SMath::QuantizedBvh quantized(wide);
+    for (size_t node = 0; node < wide.GetNodeCount(); ++node)
+        for (int slot = 0; slot < SMath::WideBvh::Width; ++slot)
+            if (wide.GetChild(node, slot) != SMath::WideBvh::InvalidChild)
+            {
+                EXPECT_TRUE(Encloses(quantized.GetChildBounds(node, slot), wide.GetChildBounds(node, slot)));
+            }
+
+    SMath::Ray<float> ray(Point3f(10.25f, 0.5f, -3.0f), Vector3f(0.0f, 0.0f, 1.0f));
+    float t;
+    uint32_t primitive;
+    ASSERT_TRUE(quantized.Intersect(ray, boxes, t, primitive));
+    EXPECT_EQ(t, 5.0f);
+    EXPECT_EQ(primitive, 10u);
+}
+
+TEST(BvhTest, CanHandleEmptyAndTinyInputs)
+{
+    std::vector<Boxf> boxes;
+    SMath::WideBvh empty(boxes);
+    SMath::QuantizedBvh quantizedEmpty(empty);
+
+    SMath::Ray<float> ray(Point3f(0.0f, 0.0f, -5.0f), Vector3f(0.0f, 0.0f, 1.0f));
+    float t;
+    uint32_t primitive;
+    EXPECT_FALSE(empty.Intersect(ray, boxes, t, primitive));
+    EXPECT_FALSE(quantizedEmpty.Intersect(ray, boxes, t, primitive));
+    EXPECT_FALSE(SMath::QuantizedBvh().Intersect(ray, boxes, t, primitive));
+
+    boxes.emplace_back(Point3f(-1.0f), Point3f(1.0f));
+    SMath::WideBvh single(boxes);
+    EXPECT_EQ(single.GetNodeCount(), 1u);
+    ASSERT_TRUE(SMath::QuantizedBvh(single).Intersect(ray, boxes, t, primitive));
+    EXPECT_EQ(t, 4.0f);
+    EXPECT_EQ(primitive, 0u);
+
+    // Outside the ray's interval
+    SMath::Ray<float> shortRay(Point3f(0.0f, 0.0f, -5.0f), Vector3f(0.0f, 0.0f, 1.0f), 0.0f, 3.5f);
+    EXPECT_FALSE(single.Intersect(shortRay, boxes, t, primitive));
+}
+
+TEST(BvhTest, DepthStaysWithinTheTraversalStack)
+{
+    // Boxes doubling in distance along 26 directions make the binned SAH splits peel a few
+    // boxes off one arm at a time, which would chain 39 levels deep, past the traversal stack
+    std::vector<Boxf> boxes;
+    std::vector<SMath::Ray<float>> rays;
+    for (int x = -1; x <= 1; ++x)
+    {
+        for (int y = -1; y <= 1; ++y)
+        {
+            for (int z = -1; z <= 1; ++z)
+            {
+                Vector3f direction = Vector3f(float(x), float(y), float(z));
+                if (direction.SquareMagnitude() == 0.0f)
+                    continue;
+
+                for (int i = -120; i <= 120; ++i)
+                {
+                    Point3f center = Point3f(0.0f) + direction * std::ldexp(1.0f, i);
+                    Vector3f half(std::ldexp(1.0f, i - 4));
+                    boxes.emplace_back(center - half, center + half);
+                    if (i % 8 == 0)
+                        rays.emplace_back(Point3f(0.0f) + direction * std::ldexp(1.25f, i), -direction, 0.0f, 1e30f);
+                }
+            }
+        }
+    }
+    SMath::WideBvh bvh(boxes);
+
+    // Children follow their parent, so depths settle in one forward pass
+    std::vector<uint32_t> depth(bvh.GetNodeCount(), 0);
+    for (size_t node = 0; node < bvh.GetNodeCount(); ++node)
+    {
+        ASSERT_LT(depth[node], SMath::WideBvh::MaxLevels);
+        for (int slot = 0; slot < SMath::WideBvh::Width; ++slot)
+        {
+            uint32_t child = bvh.GetChild(node, slot);
+            if (child != SMath::WideBvh::InvalidChild && !SMath::WideBvh::IsLeaf(child))
+                depth[child] = depth[node] + 1;
+        }
+    }
+
+    ExpectMatchesBruteForce(bvh, boxes, rays);
+    ExpectMatchesBruteForce(SMath::QuantizedBvh(bvh), boxes, rays);
+}
+
+TEST(BvhTest, QuantizedNodesAreHalfTheSize)
+{
+    EXPECT_EQ(sizeof(SMath::WideBvh::Node), 112u);
+    EXPECT_EQ(sizeof(SMath::QuantizedBvh::Node), 56u);
+
+    auto boxes = SMath::Test::RandomBoxes(10000, 10.0f, 8);
+    SMath::WideBvh wide(boxes);
+    SMath::QuantizedBvh quantized(wide);
+    EXPECT_LT(quantized.GetMemoryFootprint(), wide.GetMemoryFootprint() * 6 / 10);
+}
@@ -0,0 +1,265 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "bvhcache.h"
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <filesystem>
+
+namespace
+{
+    typedef SMath::Box<float> Boxf;
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+    typedef SMath::BvhCache::Status Status;
+
+    std::string TempPath(const char* name)
+    {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+
+    std::vector<char> ReadFile(const std::string& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+
+    void WriteFile(const std::string& path, const std::vector<char>& bytes)
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(bytes.data(), bytes.size());
+    }
+
+    template <typename Bvh>
+    void ExpectSameHits(const Bvh& bvh, const std::vector<Boxf>& boxes, const SMath::BvhCache& cache)
+    {
+        std::vector<float> u = SMath::Test::Uniform(600, 37, -1.0f, 1.0f);
+        for (int i = 0; i < 100; ++i)
+        {
+            const float* r = &u[i * 6];
+            SMath::Ray<float> ray(Point3f(r[0] * 25, r[1] * 25, r[2] * 25), Vector3f(r[3], r[4], r[5] + 1e-3f), 0.0f, 1e30f);
+
+            float expected = 0.0f, actual = 0.0f;
+            uint32_t expectedPrimitive = 0, actualPrimitive = 0;
+            bool hit = bvh.Intersect(ray, boxes, expected, expectedPrimitive);
+            ASSERT_EQ(cache.Intersect(ray, actual, actualPrimitive), hit);
+            if (hit)
+            {
+                EXPECT_EQ(actual, expected);
+                EXPECT_EQ(actualPrimitive, expectedPrimitive);
+            }
+        }
+    }
+}
+
+TEST(BvhCacheTest, CanRoundTripWideBvh)
+{
+    auto boxes = SMath::Test::RandomBoxes(3000, 20.0f, 31);
+    SMath::WideBvh bvh(boxes);
+    std::string path = TempPath("smath_bvhcache_wide.bin");
+    ASSERT_TRUE(SMath::BvhCache::Write(path.c_str(), bvh, boxes));
+
+    SMath::BvhCache cache;
+    ASSERT_EQ(cache.Open(path.c_str()), Status::Ok);
+    EXPECT_EQ(cache.GetFormat(), SMath::BvhCache::Format::Wide);
+    ASSERT_EQ(cache.GetWideNodes().size(), bvh.GetNodeCount());
+    EXPECT_TRUE(cache.GetQuantizedNodes().empty());
+    EXPECT_EQ(std::memcmp(cache.GetWideNodes().data(), bvh.m_Nodes.data(), cache.GetWideNodes().size_bytes()), 0);
+    EXPECT_TRUE(std::equal(cache.GetPrimitives().begin(), cache.GetPrimitives().end(), bvh.m_Primitives.begin(), bvh.m_Primitives.end()));
+    ASSERT_EQ(cache.GetBoxes().size(), boxes.size());
+
+    // Sections are aligned for in-place use
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cache.GetWideNodes().data()) % SMath::BvhCache::Alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cache.GetPrimitives().data()) % SMath::BvhCache::Alignment, 0u);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(cache.GetBoxes().data()) % SMath::BvhCache::Alignment, 0u);
+
+    ExpectSameHits(bvh, boxes, cache);
+    cache.Close();
+    EXPECT_FALSE(cache.IsOpen());
+    std::filesystem::remove(path);
+}
+
+TEST(BvhCacheTest, CanRoundTripQuantizedBvh)
+{
+    auto boxes = SMath::Test::RandomBoxes(2000, 20.0f, 31);
+    SMath::QuantizedBvh bvh{ SMath::WideBvh(boxes) };
+    std::string path = TempPath("smath_bvhcache_quantized.bin");
+    ASSERT_TRUE(SMath::BvhCache::Write(path.c_str(), bvh, boxes));
+
+    SMath::BvhCache opened;
+    ASSERT_EQ(opened.Open(path.c_str(), false), Status::Ok);
+
+    // Ownership of the mapping moves with the cache
+    SMath::BvhCache cache(std::move(opened));
+    EXPECT_FALSE(opened.IsOpen());
+    ASSERT_TRUE(cache.IsOpen());
+    EXPECT_EQ(cache.GetFormat(), SMath::BvhCache::Format::Quantized);
+    EXPECT_EQ(cache.GetQuantizedNodes().size(), bvh.GetNodeCount());
+    EXPECT_TRUE(cache.GetWideNodes().empty());
+
+    ExpectSameHits(bvh, boxes, cache);
+    std::filesystem::remove(path);
+}
+
+TEST(BvhCacheTest, CanRejectDamagedFiles)
+{
+    auto boxes = SMath::Test::RandomBoxes(500, 20.0f, 31);
+    SMath::WideBvh bvh(boxes);
+    std::string path = TempPath("smath_bvhcache_damaged.bin");
+    ASSERT_TRUE(SMath::BvhCache::Write(path.c_str(), bvh, boxes));
+    const std::vector<char> original = ReadFile(path);
+
+    SMath::BvhCache cache;
+    EXPECT_EQ(cache.Open(TempPath("smath_bvhcache_missing.bin").c_str()), Status::CannotOpen);
+
+    // One flipped bit in the payload
+    std::vector<char> bytes = original;
+    bytes[bytes.size() / 2] ^= 0x10;
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::BadChecksum);
+    EXPECT_FALSE(cache.IsOpen());
+    EXPECT_EQ(cache.Open(path.c_str(), false), Status::Ok);
+
+    bytes = original;
+    bytes.resize(bytes.size() - 7);
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::Truncated);
+
+    bytes.resize(16);
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::Truncated);
+
+    bytes = original;
+    bytes[0] = 'X';
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::BadMagic);
+
+    SMath::BvhCache::Header header;
+    bytes = original;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.m_Version += 1;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::BadVersion);
+
+    // Sections must stay inside the file and aligned
+    bytes = original;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.m_BoxCount += 1;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::BadLayout);
+
+    bytes = original;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.m_IndexOffset += 4;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::BadLayout);
+
+    bytes = original;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    header.m_ByteOrder = 0x04030201u;
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    WriteFile(path, bytes);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::BadLayout);
+
+    WriteFile(path, original);
+    EXPECT_EQ(cache.Open(path.c_str()), Status::Ok);
+    cache.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(BvhCacheTest, CanRejectCorruptTrees)
+{
+    auto boxes = SMath::Test::RandomBoxes(500, 20.0f, 31);
+    SMath::WideBvh bvh(boxes);
+    std::string path = TempPath("smath_bvhcache_corrupt.bin");
+    ASSERT_TRUE(SMath::BvhCache::Write(path.c_str(), bvh, boxes));
+    const std::vector<char> original = ReadFile(path);
+
+    SMath::BvhCache::Header header;
+    std::memcpy(&header, original.data(), sizeof(header));
+    size_t children = header.m_NodeOffset + offsetof(SMath::WideBvh::Node, m_Children);
+
+    // Each damaged file is tried unverified and with a recomputed checksum, as a crafted file would have
+    SMath::BvhCache cache;
+    auto expectRejected = [&](size_t offset, uint32_t value) {
+        std::vector<char> bytes = original;
+        std::memcpy(bytes.data() + offset, &value, sizeof(value));
+        WriteFile(path, bytes);
+        EXPECT_EQ(cache.Open(path.c_str(), false), Status::BadLayout);
+
+        SMath::BvhCache::Header forged = header;
+        forged.m_Checksum = SMath::BvhCache::Checksum(bytes.data() + sizeof(header), bytes.size() - sizeof(header));
+        std::memcpy(bytes.data(), &forged, sizeof(forged));
+        WriteFile(path, bytes);
+        EXPECT_EQ(cache.Open(path.c_str()), Status::BadLayout);
+    };
+
+    expectRejected(children, uint32_t(header.m_NodeCount));
+    expectRejected(children, 0u);
+    expectRejected(children, SMath::WideBvh::MakeLeaf(uint32_t(header.m_IndexCount) - 1, 2));
+    expectRejected(header.m_IndexOffset + 4 * 17, uint32_t(header.m_BoxCount));
+
+    // A chain of nodes is accepted only while the traversal stack can hold it
+    for (uint32_t length : { 31u, 32u })
+    {
+        SMath::WideBvh chain = bvh;
+        chain.m_Nodes.assign(length, bvh.m_Nodes[0]);
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            std::fill(std::begin(chain.m_Nodes[i].m_Children), std::end(chain.m_Nodes[i].m_Children), SMath::WideBvh::InvalidChild);
+            chain.m_Nodes[i].m_Children[0] = i + 1 < length ? i + 1 : SMath::WideBvh::MakeLeaf(0, 1);
+        }
+        ASSERT_TRUE(SMath::BvhCache::Write(path.c_str(), chain, boxes));
+        EXPECT_EQ(cache.Open(path.c_str(), false), length <= 31 ? Status::Ok : Status::BadLayout);
+    }
+
+    WriteFile(path, original);
+    EXPECT_EQ(cache.Open(path.c_str(), false), Status::Ok);
+    cache.Close();
+    std::filesystem::remove(path);
+}
+
+TEST(BvhCacheTest, ChecksumDependsOnEveryByte)
+{
+    std::vector<unsigned char> data(1000);
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = (unsigned char)(i * 7);
+
+    uint64_t reference = SMath::BvhCache::Checksum(data.data(), data.size());
+    EXPECT_EQ(SMath::BvhCache::Checksum(data.data(), data.size()), reference);
+    EXPECT_NE(SMath::BvhCache::Checksum(data.data(), data.size() - 1), reference);
+
+    // Positions in the word lanes and in the byte tail
+    for (size_t i : { size_t(0), size_t(9), size_t(500), size_t(991), size_t(999) })
+    {
+        data[i] ^= 1;
+        EXPECT_NE(SMath::BvhCache::Checksum(data.data(), data.size()), reference);
+        data[i] ^= 1;
+    }
+}
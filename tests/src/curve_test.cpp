@@ -0,0 +1,261 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "curve.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<double, 3> Point3d;
+    typedef SMath::Vector<double, 3> Vector3d;
+
+    void ExpectNear(const Point3d& a, const Point3d& b, double tolerance = 1e-9)
+    {
+        EXPECT_NEAR(a.x, b.x, tolerance);
+        EXPECT_NEAR(a.y, b.y, tolerance);
+        EXPECT_NEAR(a.z, b.z, tolerance);
+    }
+
+    void ExpectNear(const Vector3d& a, const Vector3d& b, double tolerance = 1e-9)
+    {
+        ExpectNear(Point3d(a), Point3d(b), tolerance);
+    }
+
+    const SMath::CubicBezier<double> Curve(Point3d(0.0, 0.0, 0.0), Point3d(1.0, 3.0, -1.0), Point3d(3.0, -2.0, 0.5), Point3d(4.0, 1.0, 2.0));
+
+    // Reference de Casteljau evaluation
+    Point3d DeCasteljau(const SMath::CubicBezier<double>& curve, double t)
+    {
+        Point3d p[4] = { curve.m_Points[0], curve.m_Points[1], curve.m_Points[2], curve.m_Points[3] };
+        for (int level = 3; level > 0; --level)
+            for (int i = 0; i < level; ++i)
+                p[i] = p[i] + (p[i + 1] - p[i]) * t;
+        return p[0];
+    }
+}
+
+TEST(CurveTest, CanEvaluateBezier)
+{
+    ExpectNear(Curve.Evaluate(0.0), Curve.m_Points[0]);
+    ExpectNear(Curve.Evaluate(1.0), Curve.m_Points[3]);
+    for (double t = 0.0; t <= 1.0; t += 0.05)
+        ExpectNear(Curve.Evaluate(t), DeCasteljau(Curve, t));
+
+    // End derivatives are three times the end legs
+    ExpectNear(Curve.Derivative(0.0), (Curve.m_Points[1] - Curve.m_Points[0]) * 3.0);
+    ExpectNear(Curve.Derivative(1.0), (Curve.m_Points[3] - Curve.m_Points[2]) * 3.0);
+
+    double h = 1e-5;
+    for (double t = 0.1; t < 1.0; t += 0.2)
+    {
+        ExpectNear(Curve.Derivative(t), (Curve.Evaluate(t + h) - Curve.Evaluate(t - h)) * (0.5 / h), 1e-6);
+        ExpectNear(Curve.SecondDerivative(t), (Curve.Derivative(t + h) - Curve.Derivative(t - h)) * (0.5 / h), 1e-6);
+    }
+
+    Vector3d c[4];
+    Curve.GetPowerBasis(c);
+    Vector3d power = c[0] + (c[1] + (c[2] + c[3] * 0.3) * 0.3) * 0.3;
+    ExpectNear(Point3d(power), Curve.Evaluate(0.3));
+}
+
+TEST(CurveTest, CanBoundBezier)
+{
+    SMath::Box<double> box = Curve.GetBounds();
+
+    // Dense sampling touches the bounds and stays inside them
+    SMath::Box<double> sampled = SMath::Box<double>::Empty();
+    for (int i = 0; i <= 100000; ++i)
+        sampled.Expand(Curve.Evaluate(i / 100000.0));
+    ExpectNear(box.m_Min, sampled.m_Min, 1e-8);
+    ExpectNear(box.m_Max, sampled.m_Max, 1e-8);
+
+    // Tighter than the control points on y, where the curve turns
+    EXPECT_LT(box.m_Max.y, 3.0);
+    EXPECT_GT(box.m_Min.y, -2.0);
+
+    // A straight segment is bounded by its end points
+    SMath::CubicBezier<double> line(Point3d(0.0), Point3d(1.0), Point3d(2.0), Point3d(3.0));
+    EXPECT_EQ(line.GetBounds().m_Min, Point3d(0.0));
+    EXPECT_EQ(line.GetBounds().m_Max, Point3d(3.0));
+}
+
+TEST(CurveTest, CanSplitBezier)
+{
+    for (double s : { 0.5, 0.2, 0.9 })
+    {
+        SMath::CubicBezier<double> left, right;
+        Curve.Split(s, left, right);
+        ExpectNear(left.m_Points[3], Curve.Evaluate(s));
+        ExpectNear(right.m_Points[0], Curve.Evaluate(s));
+        for (double t = 0.0; t <= 1.0; t += 0.1)
+        {
+            ExpectNear(left.Evaluate(t), Curve.Evaluate(t * s));
+            ExpectNear(right.Evaluate(t), Curve.Evaluate(s + t * (1.0 - s)));
+        }
+    }
+
+    // Output may alias the curve
+    SMath::CubicBezier<double> curve = Curve, other;
+    curve.Split(0.5, curve, other);
+    ExpectNear(curve.Evaluate(1.0), Curve.Evaluate(0.5));
+}
+
+TEST(CurveTest, CanTessellateBezier)
+{
+    for (size_t count : { 1, 2, 3, 17, 1000 })
+    {
+        std::vector<Point3d> points(count);
+        Curve.Tessellate(points);
+        for (size_t i = 0; i < count; ++i)
+            ExpectNear(points[i], Curve.Evaluate(count > 1 ? double(i) / double(count - 1) : 0.0), 1e-9);
+        EXPECT_EQ(points.back(), count > 1 ? Curve.m_Points[3] : Curve.m_Points[0]);
+    }
+}
+
+TEST(CurveTest, CanConvertBases)
+{
+    Point3d p[5] = { Point3d(0.0, 0.0, 0.0), Point3d(1.0, 2.0, 0.0), Point3d(3.0, 2.0, 1.0), Point3d(4.0, 0.0, 1.0), Point3d(6.0, -1.0, 0.0) };
+
+    // Catmull-Rom: through p1 and p2 with tangents (p2 - p0) / 2 and (p3 - p1) / 2
+    auto cr = SMath::CubicBezier<double>::FromCatmullRom(p[0], p[1], p[2], p[3]);
+    ExpectNear(cr.Evaluate(0.0), p[1]);
+    ExpectNear(cr.Evaluate(1.0), p[2]);
+    ExpectNear(cr.Derivative(0.0), (p[2] - p[0]) * 0.5);
+    ExpectNear(cr.Derivative(1.0), (p[3] - p[1]) * 0.5);
+
+    // Uniform B-spline: segment ends are (p0 + 4 p1 + p2) / 6, and consecutive segments meet with C2 continuity
+    auto b0 = SMath::CubicBezier<double>::FromBSpline(p[0], p[1], p[2], p[3]);
+    auto b1 = SMath::CubicBezier<double>::FromBSpline(p[1], p[2], p[3], p[4]);
+    ExpectNear(Vector3d(b0.Evaluate(0.0)), (Vector3d(p[0]) + Vector3d(p[1]) * 4.0 + Vector3d(p[2])) * (1.0 / 6.0));
+    ExpectNear(b0.Evaluate(1.0), b1.Evaluate(0.0));
+    ExpectNear(b0.Derivative(1.0), b1.Derivative(0.0));
+    ExpectNear(b0.SecondDerivative(1.0), b1.SecondDerivative(0.0));
+
+    auto hermite = SMath::CubicBezier<double>::FromHermite(p[0], Vector3d(1.0, 0.0, 0.0), p[1], Vector3d(0.0, 0.0, 2.0));
+    ExpectNear(hermite.Derivative(0.0), Vector3d(1.0, 0.0, 0.0));
+    ExpectNear(hermite.Derivative(1.0), Vector3d(0.0, 0.0, 2.0));
+}
+
+TEST(CurveTest, CanEvaluateSplines)
+{
+    std::vector<Point3d> points;
+    for (int i = 0; i < 7; ++i)
+        points.emplace_back(double(i), double(i % 3), -double(i * i) * 0.1);
+
+    SMath::CubicSpline<double> bezier(points, SMath::CurveBasis::Bezier);
+    SMath::CubicSpline<double> bspline(points, SMath::CurveBasis::BSpline);
+    SMath::CubicSpline<double> catmullRom(points, SMath::CurveBasis::CatmullRom);
+    EXPECT_EQ(bezier.GetSegmentCount(), 2u);
+    EXPECT_EQ(bspline.GetSegmentCount(), 4u);
+    EXPECT_EQ(catmullRom.GetSegmentCount(), 4u);
+
+    ExpectNear(bezier.Evaluate(1.0), points[3]);
+    ExpectNear(bezier.Evaluate(1.5), bezier.GetSegment(1).Evaluate(0.5));
+    for (size_t i = 1; i + 1 < points.size(); ++i)
+        ExpectNear(catmullRom.Evaluate(double(i - 1)), points[i]);
+
+    // Parameters outside the spline clamp to its ends
+    ExpectNear(bspline.Evaluate(-1.0), bspline.GetSegment(0).Evaluate(0.0));
+    ExpectNear(bspline.Evaluate(9.0), bspline.GetSegment(3).Evaluate(1.0));
+
+    double t;
+    EXPECT_EQ(bspline.FindSegment(4.0, t), 3u);
+    EXPECT_EQ(t, 1.0);
+    EXPECT_EQ(bspline.FindSegment(2.25, t), 2u);
+    EXPECT_EQ(t, 0.25);
+
+    SMath::Box<double> box = catmullRom.GetBounds();
+    for (double u = 0.0; u <= 4.0; u += 0.01)
+    {
+        Point3d p = catmullRom.Evaluate(u);
+        EXPECT_TRUE(box.Contains(p));
+    }
+}
+
+TEST(CurveTest, CanBuildArcLengthTable)
+{
+    // A quarter circle approximation of radius 1: length close to pi / 2
+    double k = 0.5522847498;
+    SMath::CubicBezier<double> arc(Point3d(1.0, 0.0, 0.0), Point3d(1.0, k, 0.0), Point3d(k, 1.0, 0.0), Point3d(0.0, 1.0, 0.0));
+    SMath::ArcLengthTable<double> table(arc);
+    EXPECT_NEAR(table.GetLength(), SMath::Pi / 2.0, 1e-3);
+
+    // A straight curve with uneven control points has a non-linear parameterization
+    SMath::CubicBezier<double> line(Point3d(0.0), Point3d(0.1, 0.0, 0.0), Point3d(0.2, 0.0, 0.0), Point3d(3.0, 0.0, 0.0));
+    SMath::ArcLengthTable<double> lineTable(line, 64);
+    EXPECT_NEAR(lineTable.GetLength(), 3.0, 1e-9);
+    for (double s = 0.0; s <= 3.0; s += 0.25)
+    {
+        double t = lineTable.GetParameter(s);
+        EXPECT_NEAR(line.Evaluate(t).x, s, 1e-3);
+        EXPECT_NEAR(lineTable.GetLength(t), s, 1e-9);
+    }
+    EXPECT_EQ(lineTable.GetParameter(-1.0), 0.0);
+    EXPECT_EQ(lineTable.GetParameter(4.0), 1.0);
+
+    // Spline tables cover u from 0 to the segment count
+    std::vector<Point3d> points = { Point3d(0.0), Point3d(1.0, 0.0, 0.0), Point3d(2.0, 0.0, 0.0), Point3d(3.0, 0.0, 0.0),
+                                    Point3d(4.0, 0.0, 0.0), Point3d(5.0, 0.0, 0.0) };
+    SMath::ArcLengthTable<double> splineTable(SMath::CubicSpline<double>(points, SMath::CurveBasis::CatmullRom), 8);
+    EXPECT_NEAR(splineTable.GetLength(), 3.0, 1e-9);
+    EXPECT_NEAR(splineTable.GetParameter(1.5), 1.5, 1e-9);
+}
+
+TEST(CurveTest, CanEvaluatePatch)
+{
+    std::vector<Point3d> points;
+    for (int v = 0; v < 4; ++v)
+        for (int u = 0; u < 4; ++u)
+            points.emplace_back(double(u), double(v), double((u * v) % 3) - 1.0);
+    SMath::BezierPatch<double> patch(points);
+
+    ExpectNear(patch.Evaluate(0.0, 0.0), points[0]);
+    ExpectNear(patch.Evaluate(1.0, 0.0), points[3]);
+    ExpectNear(patch.Evaluate(0.0, 1.0), points[12]);
+    ExpectNear(patch.Evaluate(1.0, 1.0), points[15]);
+
+    // Isocurves, derivatives and normals agree with evaluation
+    double h = 1e-5;
+    for (double u : { 0.1, 0.5, 0.8 })
+    {
+        for (double v : { 0.2, 0.7 })
+        {
+            ExpectNear(patch.GetCurveU(v).Evaluate(u), patch.Evaluate(u, v));
+            Vector3d du = patch.DerivativeU(u, v);
+            Vector3d dv = patch.DerivativeV(u, v);
+            ExpectNear(du, (patch.Evaluate(u + h, v) - patch.Evaluate(u - h, v)) * (0.5 / h), 1e-6);
+            ExpectNear(dv, (patch.Evaluate(u, v + h) - patch.Evaluate(u, v - h)) * (0.5 / h), 1e-6);
+
+            Vector3d n = patch.GetNormal(u, v);
+            EXPECT_NEAR(n.Magnitude(), 1.0, 1e-12);
+            EXPECT_NEAR(Vector3d::Dot(n, du), 0.0, 1e-9);
+            EXPECT_NEAR(Vector3d::Dot(n, dv), 0.0, 1e-9);
+            EXPECT_TRUE(patch.GetBounds().Contains(patch.Evaluate(u, v)));
+        }
+    }
+
+    std::vector<Point3d> grid(9 * 5);
+    patch.Tessellate(9, 5, grid);
+    for (size_t j = 0; j < 5; ++j)
+        for (size_t i = 0; i < 9; ++i)
+            ExpectNear(grid[j * 9 + i], patch.Evaluate(i / 8.0, j / 4.0));
+}
@@ -0,0 +1,239 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "decomposition.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::LUDecomposition<double, 3> LU3;
+    typedef SMath::LUDecomposition<double, 4> LU4;
+    typedef SMath::CholeskyDecomposition<double, 3> Cholesky3;
+    const SMath::Matrix3x3 Spd3(4, 1, 2, 1, 5, 3, 2, 3, 6);
+    const SMath::Matrix4x4 Spd4(10, 1, 2, 3, 1, 9, 1, 2, 2, 1, 8, 1, 3, 2, 1, 7);
+    const SMath::Matrix3x3 General3(0, 2, 1, 1, -3, 4, 5, 6, -1);
+    const SMath::Matrix4x4 General4(0, 1, 2, 3, 4, -5, 6, 7, 8, 9, 10, -11, 1, 2, -3, 1);
+
+    template <int N>
+    SMath::Matrix<double, N> Transpose(const SMath::Matrix<double, N>& m)
+    {
+        return m.Transposed();
+    }
+}
+
+TEST(DecompositionTest, CanSolveWithLU3x3)
+{
+    SMath::LUDecomposition<double, 3> lu(General3);
+    EXPECT_FALSE(lu.IsSingular());
+
+    SMath::Vector3 x(1.5, -2.0, 0.25);
+    EXPECT_EQ(lu.Solve(General3 * x), x);
+}
+
+TEST(DecompositionTest, CanSolveWithLU4x4)
+{
+    SMath::LUDecomposition<double, 4> lu(General4);
+    EXPECT_FALSE(lu.IsSingular());
+
+    SMath::Vector4 x(1.5, -2.0, 0.25, 3.0);
+    EXPECT_EQ(lu.Solve(General4 * x), x);
+}
+
+TEST(DecompositionTest, CanGetDeterminantWithLU)
+{
+    EXPECT_NEAR(LU3(General3).Determinant(), 63.0, 1e-9);
+    EXPECT_NEAR(LU3(SMath::Matrix3x3()).Determinant(), 1.0, 1e-12);
+    EXPECT_NEAR(LU3(Spd3).Determinant(), 70.0, 1e-9);
+}
+
+TEST(DecompositionTest, CanInverseWithLU)
+{
+    SMath::Matrix4x4 inverse = LU4(General4).Inversed();
+    EXPECT_TRUE((General4 * inverse).IsIdentity());
+    EXPECT_EQ(inverse, General4.Inversed());
+}
+
+TEST(DecompositionTest, CanDetectSingularWithLU)
+{
+    SMath::Matrix3x3 singular(1, 2, 3, 2, 4, 6, 1, 0, 1);
+    EXPECT_TRUE(LU3(singular).IsSingular());
+    EXPECT_TRUE(LU3(SMath::Matrix3x3(0.0)).IsSingular());
+}
+
+TEST(DecompositionTest, CanDecomposeWithQR)
+{
+    SMath::QRDecomposition<double, 4> qr(General4);
+
+    EXPECT_EQ(qr.m_Q * qr.m_R, General4);
+    EXPECT_TRUE((qr.m_Q * Transpose(qr.m_Q)).IsIdentity());
+
+    for (int i = 0; i < 4; ++i)
+    {
+        EXPECT_GE(qr.m_R.m_Data2D[i][i], 0.0);
+        for (int j = 0; j < i; ++j)
+            EXPECT_DOUBLE_EQ(qr.m_R.m_Data2D[i][j], 0.0);
+    }
+}
+
+TEST(DecompositionTest, CanSolveWithQR)
+{
+    SMath::QRDecomposition<double, 3> qr(General3);
+    EXPECT_FALSE(qr.IsSingular());
+
+    SMath::Vector3 x(-1.0, 0.5, 7.0);
+    EXPECT_EQ(qr.Solve(General3 * x), x);
+}
+
+TEST(DecompositionTest, CanDecomposeWithCholesky)
+{
+    SMath::CholeskyDecomposition<double, 4> cholesky(Spd4);
+    EXPECT_TRUE(cholesky.IsPositiveDefinite());
+    EXPECT_EQ(cholesky.m_L * Transpose(cholesky.m_L), Spd4);
+
+    SMath::Vector4 x(1.0, 2.0, 3.0, 4.0);
+    EXPECT_EQ(cholesky.Solve(Spd4 * x), x);
+}
+
+TEST(DecompositionTest, CanDetectNonPositiveDefiniteWithCholesky)
+{
+    EXPECT_FALSE(Cholesky3(General3).IsPositiveDefinite());
+    EXPECT_FALSE(Cholesky3(SMath::Matrix3x3(1, 2, 0, 2, 1, 0, 0, 0, 1)).IsPositiveDefinite());
+}
+
+TEST(DecompositionTest, CanGetSymmetricEigen3x3)
+{
+    SMath::SymmetricEigen<double, 3> eigen(Spd3);
+
+    EXPECT_GE(eigen.m_Eigenvalues[0], eigen.m_Eigenvalues[1]);
+    EXPECT_GE(eigen.m_Eigenvalues[1], eigen.m_Eigenvalues[2]);
+    EXPECT_NEAR(eigen.m_Eigenvalues[0] + eigen.m_Eigenvalues[1] + eigen.m_Eigenvalues[2], 15.0, 1e-9);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        SMath::Vector3 v(eigen.m_Eigenvectors.m_Data2D[0][i], eigen.m_Eigenvectors.m_Data2D[1][i], eigen.m_Eigenvectors.m_Data2D[2][i]);
+        EXPECT_NEAR(v.Magnitude(), 1.0, 1e-12);
+        EXPECT_EQ(Spd3 * v, v * SMath::Vector3(eigen.m_Eigenvalues[i]));
+    }
+}
+
+TEST(DecompositionTest, CanGetSymmetricEigen4x4)
+{
+    SMath::SymmetricEigen<double, 4> eigen(Spd4);
+    EXPECT_TRUE((eigen.m_Eigenvectors * Transpose(eigen.m_Eigenvectors)).IsIdentity());
+
+    SMath::Matrix4x4 diagonal(0.0);
+    for (int i = 0; i < 4; ++i)
+        diagonal.m_Data2D[i][i] = eigen.m_Eigenvalues[i];
+
+    EXPECT_EQ(eigen.m_Eigenvectors * diagonal * Transpose(eigen.m_Eigenvectors), Spd4);
+}
+
+TEST(DecompositionTest, CanGetSymmetricEigenOfDiagonal)
+{
+    SMath::SymmetricEigen<double, 3> eigen(SMath::Matrix3x3(1, 0, 0, 0, 3, 0, 0, 0, 2));
+    EXPECT_EQ(eigen.m_Eigenvalues, SMath::Vector3(3, 2, 1));
+    EXPECT_EQ(eigen.m_Eigenvectors, SMath::Matrix3x3(0, 0, 1, 1, 0, 0, 0, 1, 0));
+}
+
+TEST(DecompositionTest, CanBatchSolve)
+{
+    std::vector<SMath::Matrix4x4> m;
+    std::vector<SMath::Vector4> x;
+    std::vector<SMath::Vector4> b;
+
+    // Odd count exercises the partially filled last block
+    for (int i = 0; i < 13; ++i)
+    {
+        SMath::Matrix4x4 mi = i % 2 ? General4 : Spd4;
+        mi.m_Data2D[i % 4][(i + 1) % 4] += i * 0.1;
+        mi.m_Data2D[(i + 1) % 4][i % 4] += i * 0.1;
+        m.push_back(mi);
+        x.push_back(SMath::Vector4(i, -i * 0.5, 1.0, 2.0 - i));
+        b.push_back(mi * x.back());
+    }
+
+    std::vector<SMath::Vector4> result(m.size());
+    SMath::Batch::LUSolve(std::span<const SMath::Matrix4x4>(m), std::span<const SMath::Vector4>(b), std::span<SMath::Vector4>(result));
+
+    for (size_t i = 0; i < m.size(); ++i)
+    {
+        EXPECT_EQ(result[i], x[i]);
+        EXPECT_EQ(result[i], LU4(m[i]).Solve(b[i]));
+    }
+
+    // Cholesky only on the symmetric positive definite ones
+    std::vector<SMath::Matrix4x4> spd;
+    std::vector<SMath::Vector4> spdB;
+    for (size_t i = 0; i < m.size(); i += 2)
+    {
+        spd.push_back(m[i]);
+        spdB.push_back(b[i]);
+    }
+
+    SMath::Batch::CholeskySolve(std::span<const SMath::Matrix4x4>(spd), std::span<const SMath::Vector4>(spdB), std::span<SMath::Vector4>(result));
+    for (size_t i = 0; i < spd.size(); ++i)
+        EXPECT_EQ(result[i], x[i * 2]);
+}
+
+TEST(DecompositionTest, CanBatchDecomposeWithQR)
+{
+    std::vector<SMath::Matrix3x3> m(11, General3);
+    for (int i = 0; i < 11; ++i)
+        m[i].m_Data2D[i % 3][0] += i * 0.1;
+
+    std::vector<SMath::Matrix3x3> q(m.size());
+    std::vector<SMath::Matrix3x3> r(m.size());
+    SMath::Batch::QRDecompose(std::span<const SMath::Matrix3x3>(m), std::span<SMath::Matrix3x3>(q), std::span<SMath::Matrix3x3>(r));
+
+    for (size_t i = 0; i < m.size(); ++i)
+    {
+        SMath::QRDecomposition<double, 3> qr(m[i]);
+        EXPECT_EQ(q[i], qr.m_Q);
+        EXPECT_EQ(r[i], qr.m_R);
+    }
+}
+
+TEST(DecompositionTest, CanBatchGetSymmetricEigen)
+{
+    std::vector<SMath::Matrix3x3> m(9, Spd3);
+    for (int i = 0; i < 9; ++i)
+    {
+        m[i].m_Data2D[0][2] += i;
+        m[i].m_Data2D[2][0] += i;
+    }
+
+    std::vector<SMath::Vector3> values(m.size());
+    std::vector<SMath::Matrix3x3> vectors(m.size());
+    SMath::Batch::SymmetricEigen(std::span<const SMath::Matrix3x3>(m), std::span<SMath::Vector3>(values), std::span<SMath::Matrix3x3>(vectors));
+
+    for (size_t i = 0; i < m.size(); ++i)
+    {
+        SMath::SymmetricEigen<double, 3> eigen(m[i]);
+        EXPECT_EQ(values[i], eigen.m_Eigenvalues);
+
+        SMath::Matrix3x3 diagonal(0.0);
+        for (int j = 0; j < 3; ++j)
+            diagonal.m_Data2D[j][j] = values[i][j];
+
+        EXPECT_EQ(vectors[i] * diagonal * Transpose(vectors[i]), m[i]);
+    }
+}
@@ -0,0 +1,204 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "linalg.h"
+#include "quaternion.h"
+#include "fastmath.h"
+
+#include <cmath>
+#include <functional>
+
+namespace
+{
+    // Returns the largest absolute and relative error of approx against exact over [lo, hi]
+    void Sweep(const std::function<float(float)>& approx, double (*exact)(double), float lo, float hi,
+        double& maxAbs, double& maxRel, int samples = 100000)
+    {
+        maxAbs = 0.0;
+        maxRel = 0.0;
+        for (int i = 0; i <= samples; ++i)
+        {
+            float x = lo + (hi - lo) * (float(i) / samples);
+            double expected = exact(double(x));
+            double error = std::fabs(double(approx(x)) - expected);
+            maxAbs = std::max(maxAbs, error);
+            if (std::fabs(expected) > 1e-30)
+                maxRel = std::max(maxRel, error / std::fabs(expected));
+        }
+    }
+
+    double Rsqrt(double x) { return 1.0 / std::sqrt(x); }
+    double Rcp(double x) { return 1.0 / x; }
+}
+
+TEST(FastMathTest, RsqrtAndRcpWithinBounds)
+{
+    double maxAbs, maxRel;
+    Sweep([](float x) { return SMath::FastMath::Rsqrt(x); }, Rsqrt, 1e-6f, 1e6f, maxAbs, maxRel);
+    EXPECT_LT(maxRel, 3e-7);
+    Sweep([](float x) { return SMath::FastMath::Rcp(x); }, Rcp, 1e-6f, 1e6f, maxAbs, maxRel);
+    EXPECT_LT(maxRel, 3e-7);
+}
+
+TEST(FastMathTest, SinCosWithinBounds)
+{
+    double maxAbs, maxRel;
+    Sweep([](float x) { return SMath::FastMath::Sin(x); }, std::sin, -8192.0f, 8192.0f, maxAbs, maxRel);
+    EXPECT_LT(maxAbs, 1e-7);
+    Sweep([](float x) { return SMath::FastMath::Cos(x); }, std::cos, -8192.0f, 8192.0f, maxAbs, maxRel);
+    EXPECT_LT(maxAbs, 1e-7);
+}
+
+TEST(FastMathTest, SinCosMatchesSinAndCos)
+{
+    for (float x = -20.0f; x < 20.0f; x += 0.37f)
+    {
+        float s, c;
+        SMath::FastMath::SinCos(x, s, c);
+        EXPECT_EQ(s, SMath::FastMath::Sin(x));
+        EXPECT_EQ(c, SMath::FastMath::Cos(x));
+    }
+}
+
+TEST(FastMathTest, InverseTrigWithinBounds)
+{
+    double maxAbs, maxRel;
+    Sweep([](float x) { return SMath::FastMath::Acos(x); }, std::acos, -1.0f, 1.0f, maxAbs, maxRel);
+    EXPECT_LT(maxAbs, 5e-7);
+    Sweep([](float x) { return SMath::FastMath::Atan(x); }, std::atan, -100.0f, 100.0f, maxAbs, maxRel);
+    EXPECT_LT(maxRel, 2e-7);
+
+    double maxError = 0.0;
+    for (int i = 0; i < 3600; ++i)
+    {
+        float angle = float(i) * 0.1f * float(SMath::Pi) / 180.0f;
+        float y = std::sin(angle) * 3.0f;
+        float x = std::cos(angle) * 3.0f;
+        maxError = std::max(maxError, std::fabs(double(SMath::FastMath::Atan2(y, x)) - std::atan2(double(y), double(x))));
+    }
+    EXPECT_LT(maxError, 3e-7);
+
+    EXPECT_FLOAT_EQ(SMath::FastMath::Atan2(1.0f, -0.0f), float(SMath::Pi / 2));
+    EXPECT_FLOAT_EQ(SMath::FastMath::Atan2(-1.0f, -0.0f), float(-SMath::Pi / 2));
+    EXPECT_FLOAT_EQ(SMath::FastMath::Atan2(1.0f, 0.0f), float(SMath::Pi / 2));
+    EXPECT_NEAR(SMath::FastMath::Atan2(2.0, -0.0), SMath::Pi / 2, 3e-7);
+
+    // Signed zeros follow std::atan2 exactly, sign included
+    const float zeros[] = { 0.0f, -0.0f };
+    for (float y : zeros)
+    {
+        for (float x : { 0.0f, -0.0f, 1.0f, -1.0f })
+        {
+            float expected = std::atan2(y, x);
+            float actual = SMath::FastMath::Atan2(y, x);
+            double actualDouble = SMath::FastMath::Atan2(double(y), double(x));
+            EXPECT_NEAR(actual, expected, 3e-7f) << "y = " << y << ", x = " << x;
+            EXPECT_EQ(std::signbit(actual), std::signbit(expected)) << "y = " << y << ", x = " << x;
+            EXPECT_NEAR(actualDouble, double(expected), 3e-7) << "y = " << y << ", x = " << x;
+            EXPECT_EQ(std::signbit(actualDouble), std::signbit(expected)) << "y = " << y << ", x = " << x;
+        }
+    }
+    EXPECT_TRUE(std::isnan(SMath::FastMath::Atan2(0.0f, NAN)));
+}
+
+TEST(FastMathTest, ExpLogWithinBounds)
+{
+    double maxAbs, maxRel;
+    Sweep([](float x) { return SMath::FastMath::Exp(x); }, std::exp, -87.0f, 88.0f, maxAbs, maxRel);
+    EXPECT_LT(maxRel, 2e-7);
+    Sweep([](float x) { return SMath::FastMath::Log(x); }, std::log, 2.0f, 1e30f, maxAbs, maxRel);
+    EXPECT_LT(maxRel, 1e-7);
+    Sweep([](float x) { return SMath::FastMath::Log(x); }, std::log, 0.5f, 2.0f, maxAbs, maxRel);
+    EXPECT_LT(maxAbs, 5e-8);
+
+    EXPECT_EQ(SMath::FastMath::Exp(-200.0f), 0.0f);
+    EXPECT_TRUE(std::isinf(SMath::FastMath::Exp(200.0f)));
+    EXPECT_NEAR(SMath::FastMath::Pow(2.0f, 10.0f), 1024.0f, 1024.0f * 2e-6f);
+}
+
+TEST(FastMathTest, DoubleMatchesLibm)
+{
+    EXPECT_NEAR(SMath::FastMath::Sin(1.0), std::sin(1.0), 1e-7);
+    EXPECT_NEAR(SMath::FastMath::Cos(-2.5), std::cos(-2.5), 1e-7);
+    EXPECT_NEAR(SMath::FastMath::Exp(3.0), std::exp(3.0), std::exp(3.0) * 2e-7);
+    EXPECT_NEAR(SMath::FastMath::Log(7.0), std::log(7.0), 1e-7);
+    EXPECT_NEAR(SMath::FastMath::Acos(0.3), std::acos(0.3), 5e-7);
+    EXPECT_NEAR(SMath::FastMath::Rsqrt(2.0), 1.0 / std::sqrt(2.0), 1e-12);
+}
+
+#if defined(SMATH_X86)
+TEST(FastMathTest, SimdMatchesScalar)
+{
+    alignas(16) float in[4] = { -3.0f, -0.25f, 0.75f, 5.5f };
+    alignas(16) float out[4];
+
+    _mm_store_ps(out, SMath::FastMath::Sin(_mm_load_ps(in)));
+    for (int i = 0; i < 4; ++i)
+        EXPECT_NEAR(out[i], std::sin(in[i]), 1e-7f);
+
+    _mm_store_ps(out, SMath::FastMath::Exp(_mm_load_ps(in)));
+    for (int i = 0; i < 4; ++i)
+        EXPECT_NEAR(out[i], std::exp(in[i]), std::exp(in[i]) * 2e-7f);
+
+    _mm_store_ps(out, SMath::FastMath::Atan(_mm_load_ps(in)));
+    for (int i = 0; i < 4; ++i)
+        EXPECT_NEAR(out[i], std::atan(in[i]), 3e-7f);
+
+    _mm_store_ps(out, SMath::FastMath::Rsqrt(_mm_set_ps(4.0f, 2.0f, 1.0f, 0.5f)));
+    EXPECT_NEAR(out[0], 1.0f / std::sqrt(0.5f), 1e-6f);
+    EXPECT_NEAR(out[3], 0.5f, 1e-6f);
+}
+#endif
+
+TEST(FastMathTest, CanNormalizeFast)
+{
+    SMath::Vector3 v(3, 4, 12);
+    SMath::Vector3 n = SMath::FastMath::Normalized(v);
+    SMath::Vector3 expected = v.Normalized();
+    for (int i = 0; i < 3; ++i)
+        EXPECT_NEAR(n[i], expected[i], 1e-12);
+
+    SMath::Quaternion<double> q(1, 2, 3, 4);
+    EXPECT_NEAR(SMath::FastMath::Normalized(q).Magnitude(), 1.0, 1e-12);
+}
+
+TEST(FastMathTest, CanComputeAngleFast)
+{
+    SMath::Vector3 a(1, 0, 0);
+    SMath::Vector3 b(1, 1, 0);
+    EXPECT_NEAR(SMath::FastMath::Angle(a, b), SMath::Pi / 4, 1e-6);
+    EXPECT_NEAR(SMath::FastMath::Angle(a, -a), SMath::Pi, 1e-6);
+}
+
+TEST(FastMathTest, SlerpFastMatchesSlerp)
+{
+    auto a = SMath::Quaternion<double>::FromAxisAngle(SMath::Vector3(0, 1, 0), 0.3);
+    auto b = SMath::Quaternion<double>::FromAxisAngle(SMath::Vector3(1, 0, 1).Normalized(), 2.1);
+
+    for (int i = 0; i <= 10; ++i)
+    {
+        double t = i / 10.0;
+        auto expected = SMath::Quaternion<double>::Slerp(a, b, t);
+        auto actual = SMath::FastMath::Slerp(a, b, t);
+        for (int j = 0; j < 4; ++j)
+            EXPECT_NEAR(actual[j], expected[j], 1e-6);
+    }
+}
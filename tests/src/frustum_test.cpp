@@ -0,0 +1,132 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "frustum.h"
+#include "transform.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    // 90 degree vertical fov, square aspect, looking down +z from the origin
+    template <typename T>
+    SMath::Frustum<T> MakeFrustum()
+    {
+        return SMath::Frustum<T>(SMath::Transform<T>::GetPerspectiveMatrixLH(T(SMath::Pi / 2), T(1), T(1), T(100)));
+    }
+}
+
+TEST(FrustumTest, CanExtractPlanes)
+{
+    auto frustum = MakeFrustum<double>();
+
+    EXPECT_NEAR(frustum.m_Planes[SMath::Frustum<double>::Near].z, 1.0, 1e-9);
+    EXPECT_NEAR(frustum.m_Planes[SMath::Frustum<double>::Near].w, -1.0, 1e-9);
+    EXPECT_NEAR(frustum.m_Planes[SMath::Frustum<double>::Far].z, -1.0, 1e-9);
+    EXPECT_NEAR(frustum.m_Planes[SMath::Frustum<double>::Far].w, 100.0, 1e-9);
+
+    // Side planes of a 90 degree frustum are at 45 degrees
+    auto left = frustum.m_Planes[SMath::Frustum<double>::Left];
+    EXPECT_NEAR(left.x, std::sqrt(0.5), 1e-9);
+    EXPECT_NEAR(left.z, std::sqrt(0.5), 1e-9);
+    EXPECT_NEAR(left.w, 0.0, 1e-9);
+}
+
+TEST(FrustumTest, CanCheckIfContainsPoint)
+{
+    auto frustum = MakeFrustum<double>();
+
+    EXPECT_TRUE(frustum.Contains(SMath::Point3(0, 0, 10)));
+    EXPECT_TRUE(frustum.Contains(SMath::Point3(9.9, -9.9, 10)));
+    EXPECT_FALSE(frustum.Contains(SMath::Point3(10.1, 0, 10)));
+    EXPECT_FALSE(frustum.Contains(SMath::Point3(0, 0, 0.5)));
+    EXPECT_FALSE(frustum.Contains(SMath::Point3(0, 0, 101)));
+    EXPECT_FALSE(frustum.Contains(SMath::Point3(0, 0, -10)));
+}
+
+TEST(FrustumTest, CanCheckIfIntersectsBox)
+{
+    auto frustum = MakeFrustum<double>();
+
+    EXPECT_TRUE(frustum.Intersects(SMath::Box(SMath::Point3(-1, -1, 5), SMath::Point3(1, 1, 6))));
+    EXPECT_TRUE(frustum.Intersects(SMath::Box(SMath::Point3(9, 0, 10), SMath::Point3(12, 1, 11))));
+    EXPECT_TRUE(frustum.Intersects(SMath::Box(SMath::Point3(-1000, -1000, -1000), SMath::Point3(1000, 1000, 1000))));
+    EXPECT_FALSE(frustum.Intersects(SMath::Box(SMath::Point3(11, 0, 10), SMath::Point3(12, 1, 10.5))));
+    EXPECT_FALSE(frustum.Intersects(SMath::Box(SMath::Point3(-1, -1, -6), SMath::Point3(1, 1, -5))));
+    EXPECT_FALSE(frustum.Intersects(SMath::Box(SMath::Point3(-1, -1, 150), SMath::Point3(1, 1, 160))));
+}
+
+TEST(FrustumTest, CanBeBuiltFromViewProjection)
+{
+    // Camera at z = -10: a box at the origin is 10 units in front of it
+    auto projection = SMath::Transform<double>::GetPerspectiveMatrixLH(SMath::Pi / 2, 1.0, 1.0, 100.0);
+    auto view = SMath::Transform<double>::GetTranslationMatrix(SMath::Vector3(0, 0, 10));
+    SMath::Frustum<double> frustum(projection * view);
+
+    EXPECT_TRUE(frustum.Contains(SMath::Point3(0, 0, 0)));
+    EXPECT_FALSE(frustum.Contains(SMath::Point3(0, 0, -10)));
+    EXPECT_FALSE(frustum.Contains(SMath::Point3(0, 0, 95)));
+}
+
+TEST(FrustumTest, CullMatchesIntersectsOnEveryLevel)
+{
+    auto frustum = MakeFrustum<float>();
+
+    std::vector<SMath::Box<float>> boxes;
+    for (int i = 0; i < 333; ++i)
+    {
+        float x = float(i % 13) * 3.1f - 18.3f;
+        float z = float(i % 17) * 8.1f - 20.3f;
+        boxes.emplace_back(Point3f(x, -1.0f, z), Point3f(x + 2.0f, 1.0f, z + 2.0f));
+    }
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<uint64_t> visible(SMath::Batch::GetMaskSize(boxes.size()));
+        frustum.Cull(std::span<const SMath::Box<float>>(boxes), std::span<uint64_t>(visible));
+
+        int count = 0;
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            bool bit = (visible[i / 64] >> (i % 64)) & 1;
+            EXPECT_EQ(bit, frustum.Intersects(boxes[i])) << "box " << i;
+            count += bit;
+        }
+        EXPECT_GT(count, 0);
+        EXPECT_LT(count, int(boxes.size()));
+    });
+}
+
+TEST(FrustumTest, CanCullDoubleBoxes)
+{
+    auto frustum = MakeFrustum<double>();
+    std::vector<SMath::Box<double>> boxes = {
+        SMath::Box(SMath::Point3(-1, -1, 5), SMath::Point3(1, 1, 6)),
+        SMath::Box(SMath::Point3(-1, -1, -6), SMath::Point3(1, 1, -5)),
+        SMath::Box(SMath::Point3(9, 0, 10), SMath::Point3(12, 1, 11)),
+    };
+
+    std::vector<uint64_t> visible(1, ~uint64_t(0));
+    frustum.Cull(std::span<const SMath::Box<double>>(boxes), std::span<uint64_t>(visible));
+    EXPECT_EQ(visible[0], uint64_t(0b101));
+}
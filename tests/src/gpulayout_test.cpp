@@ -0,0 +1,176 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "gpulayout.h"
+#include "batchops.h"
+#include "transform.h"
+
+#include <vector>
+#include <cstring>
+
+using SMath::GpuMatrixLayout;
+
+namespace
+{
+    typedef SMath::Matrix<float, 4> Matrix4f;
+
+    template <typename T>
+    std::vector<SMath::Matrix<T, 4>> RandomMatrices(size_t count, uint32_t seed)
+    {
+        std::vector<float> u = SMath::Test::Uniform(count * 16, seed, -100.0f, 100.0f);
+
+        std::vector<SMath::Matrix<T, 4>> matrices(count);
+        for (size_t i = 0; i < count; ++i)
+            for (int j = 0; j < 16; ++j)
+                matrices[i][j] = T(u[i * 16 + j]) * T(1.0001);
+        return matrices;
+    }
+
+    template <typename A, typename B>
+    bool SameBytes(const A& a, const B& b)
+    {
+        static_assert(sizeof(A) == sizeof(B));
+        return std::memcmp(&a, &b, sizeof(A)) == 0;
+    }
+}
+
+TEST(GpuLayoutTest, CanPackMatrices)
+{
+    static_assert(alignof(SMath::GpuMatrix4) == 16 && alignof(SMath::GpuMatrix3x4) == 16 && alignof(SMath::GpuVector3) == 16);
+
+    SMath::Matrix4x4 m = SMath::Transform<double>::GetTranslationMatrix(SMath::Vector3(1.0, 2.0, 3.0));
+    m[1] = 5.0;
+
+    // Column-major: the translation is the last column, contiguous
+    SMath::GpuMatrix4 columns = SMath::PackMatrix(m);
+    EXPECT_EQ(columns.m_Data[12], 1.0f);
+    EXPECT_EQ(columns.m_Data[13], 2.0f);
+    EXPECT_EQ(columns.m_Data[14], 3.0f);
+    EXPECT_EQ(columns.m_Data[4], 5.0f);
+
+    SMath::GpuMatrix4 rows = SMath::PackMatrix(m, GpuMatrixLayout::RowMajor);
+    for (int i = 0; i < 16; ++i)
+        EXPECT_EQ(rows.m_Data[i], float(m[i]));
+
+    SMath::GpuMatrix3x4 affine = SMath::PackAffine(m);
+    EXPECT_EQ(affine.m_Data[3], 1.0f);
+    EXPECT_EQ(affine.m_Data[7], 2.0f);
+    EXPECT_EQ(affine.m_Data[11], 3.0f);
+
+    // mat3: each column padded to 16 bytes
+    SMath::Matrix3x3 n(1, 2, 3, 4, 5, 6, 7, 8, 9);
+    SMath::GpuMatrix3x4 mat3 = SMath::PackMatrix(n);
+    const float expected[12] = { 1, 4, 7, 0, 2, 5, 8, 0, 3, 6, 9, 0 };
+    for (int i = 0; i < 12; ++i)
+        EXPECT_EQ(mat3.m_Data[i], expected[i]);
+    EXPECT_EQ(SMath::PackMatrix(n, GpuMatrixLayout::RowMajor).m_Data[4], 4.0f);
+
+    SMath::GpuVector3 v = SMath::PackVector(SMath::Point3(1.0, -2.0, 3.5));
+    EXPECT_EQ(v.x, 1.0f);
+    EXPECT_EQ(v.y, -2.0f);
+    EXPECT_EQ(v.z, 3.5f);
+    EXPECT_EQ(v.m_Pad, 0.0f);
+}
+
+TEST(GpuLayoutTest, BatchMatchesScalar)
+{
+    // Odd count, so the output ends part way through a cache line
+    const size_t count = 1001;
+    auto floats = RandomMatrices<float>(count, 3);
+    auto doubles = RandomMatrices<double>(count, 5);
+
+    std::vector<SMath::Vector<float, 3>> vectors(count);
+    std::vector<SMath::Vector<double, 3>> doubleVectors(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        vectors[i] = SMath::Vector<float, 3>(floats[i][0], floats[i][1], floats[i][2]);
+        doubleVectors[i] = SMath::Vector<double, 3>(doubles[i][0], doubles[i][1], doubles[i][2]);
+    }
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<SMath::GpuMatrix4> matrices(count);
+        std::vector<SMath::GpuMatrix3x4> affine(count);
+        std::vector<SMath::GpuVector3> packed(count, SMath::GpuVector3{ 1, 1, 1, 1 });
+
+        for (GpuMatrixLayout layout : { GpuMatrixLayout::ColumnMajor, GpuMatrixLayout::RowMajor })
+        {
+            SMath::Batch::WriteMatrices(floats, matrices, layout);
+            for (size_t i = 0; i < count; ++i)
+                ASSERT_TRUE(SameBytes(matrices[i], SMath::PackMatrix(floats[i], layout))) << i;
+
+            SMath::Batch::WriteMatrices(doubles, matrices, layout);
+            for (size_t i = 0; i < count; ++i)
+                ASSERT_TRUE(SameBytes(matrices[i], SMath::PackMatrix(doubles[i], layout))) << i;
+        }
+
+        SMath::Batch::WriteAffine(floats, affine);
+        for (size_t i = 0; i < count; ++i)
+            ASSERT_TRUE(SameBytes(affine[i], SMath::PackAffine(floats[i]))) << i;
+        SMath::Batch::WriteAffine(doubles, affine);
+        for (size_t i = 0; i < count; ++i)
+            ASSERT_TRUE(SameBytes(affine[i], SMath::PackAffine(doubles[i]))) << i;
+
+        SMath::Batch::WriteVectors(vectors, packed);
+        for (size_t i = 0; i < count; ++i)
+            ASSERT_TRUE(SameBytes(packed[i], SMath::PackVector(vectors[i]))) << i;
+        SMath::Batch::WriteVectors(doubleVectors, packed);
+        for (size_t i = 0; i < count; ++i)
+            ASSERT_TRUE(SameBytes(packed[i], SMath::PackVector(doubleVectors[i]))) << i;
+    });
+}
+
+TEST(GpuLayoutTest, CanWriteIntoMappedBuffer)
+{
+    // A constant buffer holding a view-projection matrix, then an array of instance transforms
+    struct alignas(16) FrameConstants
+    {
+        SMath::GpuMatrix4 m_ViewProjection;
+        SMath::GpuVector3 m_CameraPosition;
+    };
+    static_assert(sizeof(FrameConstants) == 80);
+
+    const size_t count = 37;
+    std::vector<std::byte> storage(sizeof(FrameConstants) + count * sizeof(SMath::GpuMatrix3x4) + 16);
+    void* mapped = storage.data() + (16 - reinterpret_cast<uintptr_t>(storage.data()) % 16) % 16;
+
+    auto constants = SMath::GpuView<FrameConstants>(mapped, 1);
+    auto instances = SMath::GpuView<SMath::GpuMatrix3x4>(static_cast<std::byte*>(mapped) + sizeof(FrameConstants), count);
+
+    Matrix4f viewProjection = SMath::Transform<float>::GetPerspectiveMatrixLH(1.0f, 1.5f, 0.1f, 100.0f);
+    constants[0].m_ViewProjection = SMath::PackMatrix(viewProjection);
+    constants[0].m_CameraPosition = SMath::PackVector(SMath::Vector<float, 3>(0.0f, 1.0f, -5.0f));
+
+    std::vector<Matrix4f> transforms(count);
+    for (size_t i = 0; i < count; ++i)
+        transforms[i] = SMath::Transform<float>::GetTranslationMatrix(SMath::Vector<float, 3>(float(i), 0.0f, -float(i)));
+    SMath::Batch::WriteAffine(transforms, instances);
+
+    const float* floats = static_cast<const float*>(mapped);
+    EXPECT_EQ(floats[16 + 1], 1.0f);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const float* row = floats + 20 + i * 12;
+        EXPECT_EQ(row[0], 1.0f);
+        EXPECT_EQ(row[3], float(i));
+        EXPECT_EQ(row[11], -float(i));
+    }
+}
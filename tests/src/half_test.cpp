@@ -0,0 +1,235 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "half.h"
+#include "batchops.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using SMath::Half;
+using SMath::BFloat16;
+
+namespace
+{
+    uint32_t Bits(float v)
+    {
+        return SMath::Simd::BitCast<uint32_t>(v);
+    }
+
+    // Every half value, the midpoints between neighbours (ties) and just either side of them,
+    // plus random floats over the whole range
+    std::vector<float> ConversionInputs()
+    {
+        std::vector<float> inputs;
+        for (uint32_t h = 0; h < 0x10000; ++h)
+        {
+            float v = SMath::HalfBitsToFloat(uint16_t(h));
+            float next = SMath::HalfBitsToFloat(uint16_t(h + 1));
+            inputs.push_back(v);
+            if (std::isfinite(v) && std::isfinite(next) && (h & 0x7fff) != 0x7fff)
+            {
+                float mid = v + (next - v) * 0.5f;
+                inputs.push_back(mid);
+                inputs.push_back(std::nextafter(mid, v));
+                inputs.push_back(std::nextafter(mid, next));
+            }
+        }
+
+        std::vector<float> random = SMath::Test::Uniform(1 << 16, 7, -1.0f, 1.0f);
+        for (float r : random)
+            inputs.push_back(std::ldexp(r, int(std::fabs(r) * 1e4f) % 80 - 40));
+
+        inputs.push_back(std::numeric_limits<float>::infinity());
+        inputs.push_back(-std::numeric_limits<float>::max());
+        inputs.push_back(std::numeric_limits<float>::denorm_min());
+        inputs.push_back(std::numeric_limits<float>::quiet_NaN());
+        inputs.push_back(-std::numeric_limits<float>::quiet_NaN());
+        return inputs;
+    }
+}
+
+TEST(HalfTest, CanConvertKnownValues)
+{
+    EXPECT_EQ(Half(0.0f).m_Bits, 0x0000);
+    EXPECT_EQ(Half(-0.0f).m_Bits, 0x8000);
+    EXPECT_EQ(Half(1.0f).m_Bits, 0x3c00);
+    EXPECT_EQ(Half(-2.0f).m_Bits, 0xc000);
+    EXPECT_EQ(Half(65504.0f).m_Bits, 0x7bff);
+    EXPECT_EQ(Half(std::ldexp(1.0f, -14)).m_Bits, 0x0400);
+    EXPECT_EQ(Half(std::ldexp(1.0f, -24)).m_Bits, 0x0001);
+    EXPECT_EQ(Half(std::numeric_limits<float>::infinity()).m_Bits, 0x7c00);
+    EXPECT_EQ(Half(-1e10f).m_Bits, 0xfc00);
+    EXPECT_TRUE(std::isnan(float(Half(std::numeric_limits<float>::quiet_NaN()))));
+
+    EXPECT_EQ(float(Half::FromBits(0x3555)), 0.333251953125f);
+    EXPECT_EQ(float(Half::FromBits(0x0001)), std::ldexp(1.0f, -24));
+    EXPECT_EQ(float(Half::FromBits(0xfc00)), -std::numeric_limits<float>::infinity());
+
+    constexpr Half one = Half::FromBits(0x3c00);
+    EXPECT_EQ(float(one), 1.0f);
+    EXPECT_EQ(Half(1.0f).m_Bits, one.m_Bits);
+}
+
+TEST(HalfTest, RoundsToNearestEven)
+{
+    // Ties between 1 and the next half go to the even mantissa
+    EXPECT_EQ(Half(1.0f + std::ldexp(1.0f, -11)).m_Bits, 0x3c00);
+    EXPECT_EQ(Half(1.0f + 3.0f * std::ldexp(1.0f, -11)).m_Bits, 0x3c02);
+    EXPECT_EQ(Half(std::nextafter(1.0f + std::ldexp(1.0f, -11), 2.0f)).m_Bits, 0x3c01);
+
+    // The same in the subnormal range
+    EXPECT_EQ(Half(std::ldexp(1.0f, -25)).m_Bits, 0x0000);
+    EXPECT_EQ(Half(3.0f * std::ldexp(1.0f, -25)).m_Bits, 0x0002);
+    EXPECT_EQ(Half(std::nextafter(std::ldexp(1.0f, -25), 1.0f)).m_Bits, 0x0001);
+
+    // 65520 is halfway to the next exponent, so rounds up to infinity
+    EXPECT_EQ(Half(65519.0f).m_Bits, 0x7bff);
+    EXPECT_EQ(Half(65520.0f).m_Bits, 0x7c00);
+}
+
+TEST(HalfTest, CanRoundTripEveryHalf)
+{
+    for (uint32_t h = 0; h < 0x10000; ++h)
+    {
+        float v = float(Half::FromBits(uint16_t(h)));
+        if (std::isnan(v))
+        {
+            EXPECT_TRUE(std::isnan(float(Half(v))));
+        }
+        else
+        {
+            ASSERT_EQ(Half(v).m_Bits, h);
+        }
+    }
+}
+
+TEST(HalfTest, CanConvertBFloat16)
+{
+    EXPECT_EQ(BFloat16(1.0f).m_Bits, 0x3f80);
+    EXPECT_EQ(BFloat16(-0.0f).m_Bits, 0x8000);
+    EXPECT_EQ(float(BFloat16::FromBits(0x4049)), 3.140625f);
+    EXPECT_EQ(BFloat16(std::numeric_limits<float>::max()).m_Bits, 0x7f80);
+    EXPECT_TRUE(std::isnan(float(BFloat16(std::numeric_limits<float>::quiet_NaN()))));
+    EXPECT_TRUE(std::isnan(float(BFloat16(SMath::Simd::BitCast<float>(0x7f800001u)))));
+
+    // Ties to even on the 16 dropped bits
+    EXPECT_EQ(BFloat16(SMath::Simd::BitCast<float>(0x3f808000u)).m_Bits, 0x3f80);
+    EXPECT_EQ(BFloat16(SMath::Simd::BitCast<float>(0x3f818000u)).m_Bits, 0x3f82);
+    EXPECT_EQ(BFloat16(SMath::Simd::BitCast<float>(0x3f808001u)).m_Bits, 0x3f81);
+
+    for (uint32_t b = 0; b < 0x10000; ++b)
+    {
+        float v = float(BFloat16::FromBits(uint16_t(b)));
+        if (!std::isnan(v))
+        {
+            ASSERT_EQ(BFloat16(v).m_Bits, b);
+        }
+    }
+}
+
+TEST(HalfTest, BatchMatchesScalar)
+{
+    std::vector<float> inputs = ConversionInputs();
+    // An odd count leaves a tail for the scalar loop on every level
+    inputs.push_back(0.1f);
+
+    std::vector<uint16_t> bits(0x10001);
+    for (uint32_t i = 0; i < bits.size(); ++i)
+        bits[i] = uint16_t(i);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<Half> halves(inputs.size());
+        SMath::Batch::ToHalf(inputs, halves);
+        std::vector<BFloat16> bfloats(inputs.size());
+        SMath::Batch::ToBFloat16(inputs, bfloats);
+
+        for (size_t i = 0; i < inputs.size(); ++i)
+        {
+            if (std::isnan(inputs[i]))
+            {
+                EXPECT_TRUE(std::isnan(float(halves[i])));
+                EXPECT_TRUE(std::isnan(float(bfloats[i])));
+                continue;
+            }
+            ASSERT_EQ(halves[i].m_Bits, Half(inputs[i]).m_Bits) << inputs[i];
+            ASSERT_EQ(bfloats[i].m_Bits, BFloat16(inputs[i]).m_Bits) << inputs[i];
+        }
+
+        std::vector<Half> allHalves(bits.size());
+        std::vector<BFloat16> allBFloats(bits.size());
+        for (size_t i = 0; i < bits.size(); ++i)
+        {
+            allHalves[i] = Half::FromBits(bits[i]);
+            allBFloats[i] = BFloat16::FromBits(bits[i]);
+        }
+
+        std::vector<float> fromHalves(bits.size());
+        std::vector<float> fromBFloats(bits.size());
+        SMath::Batch::ToFloat(allHalves, fromHalves);
+        SMath::Batch::ToFloat(allBFloats, fromBFloats);
+        for (size_t i = 0; i < bits.size(); ++i)
+        {
+            float half = float(allHalves[i]);
+            if (std::isnan(half))
+            {
+                EXPECT_TRUE(std::isnan(fromHalves[i]));
+            }
+            else
+            {
+                ASSERT_EQ(Bits(fromHalves[i]), Bits(half)) << i;
+            }
+            ASSERT_EQ(Bits(fromBFloats[i]), Bits(float(allBFloats[i]))) << i;
+        }
+    });
+}
+
+TEST(HalfTest, CanUseHalfVectors)
+{
+    typedef SMath::Vector<Half, 3> Vector3h;
+    static_assert(sizeof(Vector3h) == 6);
+    static_assert(sizeof(SMath::Point<BFloat16, 4>) == 8);
+
+    Vector3h a(1.0f, 2.0f, 3.0f);
+    Vector3h b(0.5f);
+    EXPECT_EQ(a + b, Vector3h(1.5f, 2.5f, 3.5f));
+    EXPECT_EQ(-a, Vector3h(-1.0f, -2.0f, -3.0f));
+    a += b;
+    a *= Vector3h(2.0f);
+    EXPECT_EQ(a, Vector3h(3.0f, 5.0f, 7.0f));
+    EXPECT_EQ(float(Vector3h::Dot(a, a)), 83.0f);
+    EXPECT_NEAR(float(Vector3h(3.0f, 4.0f, 0.0f).Magnitude()), 5.0f, 1e-3f);
+
+    SMath::Point<Half, 3> p(1.0f, 2.0f, 3.0f);
+    EXPECT_EQ(float(p.z), 3.0f);
+
+    std::vector<SMath::Vector<float, 4>> in = { { 1.0f, -2.0f, 0.1f, 65504.0f }, { 0.0f, 1e-7f, -3.5f, 100000.0f } };
+    std::vector<SMath::Vector<Half, 4>> packed(in.size());
+    std::vector<SMath::Vector<float, 4>> out(in.size());
+    SMath::Batch::ToHalf(std::span<const SMath::Vector<float, 4>>(in), std::span<SMath::Vector<Half, 4>>(packed));
+    SMath::Batch::ToFloat(std::span<const SMath::Vector<Half, 4>>(packed), std::span<SMath::Vector<float, 4>>(out));
+    EXPECT_EQ(packed[0].z.m_Bits, Half(0.1f).m_Bits);
+    EXPECT_EQ(out[0].w, 65504.0f);
+    EXPECT_EQ(out[1].y, float(Half(1e-7f)));
+    EXPECT_TRUE(std::isinf(out[1].w));
+}
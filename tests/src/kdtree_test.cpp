@@ -0,0 +1,246 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "kdtree.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    std::vector<Point3f> Cloud(int count, uint32_t seed)
+    {
+        std::vector<float> u = SMath::Test::Uniform(count * 3, seed, -10.0f, 10.0f);
+
+        std::vector<Point3f> points(count);
+        for (int i = 0; i < count; ++i)
+            points[i] = Point3f(u[i * 3], u[i * 3 + 1] * 0.5f, u[i * 3 + 2] * 0.1f);
+        return points;
+    }
+
+    template <typename T, int N>
+    T SquareDistance(const SMath::Point<T, N>& a, const SMath::Point<T, N>& b)
+    {
+        T sum = T(0);
+        for (int i = 0; i < N; ++i)
+            sum += (a[i] - b[i]) * (a[i] - b[i]);
+        return sum;
+    }
+
+    template <typename T, int N>
+    std::vector<T> BruteForceNearest(const std::vector<SMath::Point<T, N>>& points, const SMath::Point<T, N>& query, size_t k, T maxDistance)
+    {
+        std::vector<T> distances;
+        for (const auto& p : points)
+            if (SquareDistance(p, query) <= maxDistance * maxDistance)
+                distances.push_back(SquareDistance(p, query));
+
+        std::sort(distances.begin(), distances.end());
+        distances.resize(std::min(k, distances.size()));
+        return distances;
+    }
+
+    std::vector<uint32_t> BruteForceRadius(const std::vector<Point3f>& points, const Point3f& query, float radius)
+    {
+        std::vector<uint32_t> indices;
+        for (uint32_t i = 0; i < points.size(); ++i)
+            if (SquareDistance(points[i], query) <= radius * radius)
+                indices.push_back(i);
+        return indices;
+    }
+}
+
+TEST(KdTreeTest, CanFindNearestNeighbours)
+{
+    auto points = Cloud(20000, 1);
+    auto queries = Cloud(300, 2);
+    SMath::KdTree<float> tree(points);
+    EXPECT_EQ(tree.GetSize(), points.size());
+
+    std::vector<uint32_t> indices(50);
+    std::vector<float> distances(50);
+    for (const Point3f& query : queries)
+    {
+        auto expected = BruteForceNearest(points, query, 50, INFINITY);
+        for (size_t k : { size_t(1), size_t(8), size_t(50) })
+        {
+            ASSERT_EQ(tree.FindNearest(query, k, indices, distances), k);
+            for (size_t i = 0; i < k; ++i)
+            {
+                EXPECT_EQ(distances[i], expected[i]);
+                EXPECT_EQ(SquareDistance(points[indices[i]], query), distances[i]);
+            }
+        }
+    }
+}
+
+TEST(KdTreeTest, CanLimitNearestByDistance)
+{
+    auto points = Cloud(5000, 3);
+    SMath::KdTree<float> tree(points);
+
+    std::vector<uint32_t> indices(100);
+    std::vector<float> distances(100);
+    for (const Point3f& query : Cloud(100, 4))
+    {
+        auto expected = BruteForceNearest(points, query, 100, 0.8f);
+        size_t found = tree.FindNearest(query, 100, indices, distances, 0.8f);
+        ASSERT_EQ(found, expected.size());
+        for (size_t i = 0; i < found; ++i)
+            EXPECT_EQ(distances[i], expected[i]);
+    }
+}
+
+TEST(KdTreeTest, CanFindInRadius)
+{
+    auto points = Cloud(20000, 5);
+    SMath::KdTree<float> tree(points);
+
+    std::vector<uint32_t> indices = { 12345u };
+    for (const Point3f& query : Cloud(200, 6))
+    {
+        // Results are appended
+        indices.resize(1);
+        size_t found = tree.FindInRadius(query, 1.5f, indices);
+        ASSERT_EQ(found, indices.size() - 1);
+        EXPECT_EQ(indices[0], 12345u);
+
+        std::vector<uint32_t> actual(indices.begin() + 1, indices.end());
+        std::sort(actual.begin(), actual.end());
+        EXPECT_EQ(actual, BruteForceRadius(points, query, 1.5f));
+    }
+
+    // Inclusive at exactly the radius
+    std::vector<Point3f> grid = { Point3f(0.0f), Point3f(1.0f, 0.0f, 0.0f), Point3f(0.0f, 2.0f, 0.0f) };
+    SMath::KdTree<float> small(grid);
+    indices.clear();
+    EXPECT_EQ(small.FindInRadius(Point3f(0.0f), 1.0f, indices), 2u);
+}
+
+TEST(KdTreeTest, BatchQueriesMatchSingleQueries)
+{
+    auto points = Cloud(30000, 7);
+    auto queries = Cloud(3001, 8);
+    SMath::KdTree<float> tree(points);
+    const size_t k = 6;
+
+    for (int threads : { 1, 4 })
+    {
+        std::vector<uint32_t> indices(queries.size() * k);
+        std::vector<float> distances(queries.size() * k);
+        tree.FindNearest(queries, k, indices, distances, 0.5f, threads);
+
+        std::vector<uint32_t> radiusIndices;
+        std::vector<size_t> offsets;
+        tree.FindInRadius(queries, 0.7f, radiusIndices, offsets, threads);
+        ASSERT_EQ(offsets.size(), queries.size() + 1);
+        EXPECT_EQ(offsets.back(), radiusIndices.size());
+
+        std::vector<uint32_t> singleIndices(k);
+        std::vector<float> singleDistances(k);
+        for (size_t q = 0; q < queries.size(); ++q)
+        {
+            size_t found = tree.FindNearest(queries[q], k, singleIndices, singleDistances, 0.5f);
+            for (size_t i = 0; i < k; ++i)
+            {
+                EXPECT_EQ(indices[q * k + i], i < found ? singleIndices[i] : SMath::KdTree<float>::InvalidIndex);
+                EXPECT_EQ(distances[q * k + i], i < found ? singleDistances[i] : INFINITY);
+            }
+
+            std::vector<uint32_t> single;
+            tree.FindInRadius(queries[q], 0.7f, single);
+            ASSERT_EQ(offsets[q + 1] - offsets[q], single.size());
+            EXPECT_TRUE(std::equal(single.begin(), single.end(), radiusIndices.begin() + offsets[q]));
+        }
+    }
+}
+
+TEST(KdTreeTest, ParallelBuildMatchesSerialBuild)
+{
+    auto points = Cloud(int(SMath::Simd::MinParallelChunk) * 2 + 77, 9);
+    SMath::KdTree<float> serial(points, 1);
+    SMath::KdTree<float> parallel(points, 4);
+
+    ASSERT_EQ(serial.GetSize(), parallel.GetSize());
+    EXPECT_EQ(sizeof(SMath::KdTree<float>::Node), 16u);
+
+    // Every node splits its subtree at its median
+    const auto& nodes = serial.m_Nodes;
+    for (size_t node = 0; node < nodes.size(); ++node)
+    {
+        EXPECT_EQ(nodes[node].m_Index, parallel.m_Nodes[node].m_Index);
+        EXPECT_EQ(nodes[node].m_Axis, parallel.m_Nodes[node].m_Axis);
+
+        int axis = nodes[node].m_Axis;
+        size_t left = 2 * node + 1;
+        size_t right = 2 * node + 2;
+        if (left < nodes.size())
+        {
+            EXPECT_LE(nodes[left].m_Point[axis], nodes[node].m_Point[axis]);
+        }
+        if (right < nodes.size())
+        {
+            EXPECT_GE(nodes[right].m_Point[axis], nodes[node].m_Point[axis]);
+        }
+    }
+}
+
+TEST(KdTreeTest, CanHandleDegenerateInput)
+{
+    SMath::KdTree<float> empty(std::span<const Point3f>{});
+    std::vector<uint32_t> indices(4);
+    std::vector<float> distances(4);
+    EXPECT_EQ(empty.FindNearest(Point3f(0.0f), 4, indices, distances), 0u);
+
+    // Duplicates, and fewer points than k
+    std::vector<Point3f> same(10, Point3f(1.0f, 2.0f, 3.0f));
+    SMath::KdTree<float> duplicates(same);
+    std::vector<uint32_t> many(16);
+    std::vector<float> manyDistances(16);
+    ASSERT_EQ(duplicates.FindNearest(Point3f(0.0f), 16, many, manyDistances), 10u);
+    std::sort(many.begin(), many.begin() + 10);
+    for (uint32_t i = 0; i < 10; ++i)
+        EXPECT_EQ(many[i], i);
+
+    indices.clear();
+    EXPECT_EQ(duplicates.FindInRadius(Point3f(1.0f, 2.0f, 3.0f), 0.0f, indices), 10u);
+}
+
+TEST(KdTreeTest, CanUseOtherDimensions)
+{
+    std::vector<SMath::Point2> points;
+    for (int x = 0; x < 40; ++x)
+        for (int y = 0; y < 25; ++y)
+            points.emplace_back(x * 0.5, y * 0.25 + x * 1e-3);
+
+    SMath::KdTree<double, 2> tree(points);
+    std::vector<uint32_t> indices(5);
+    std::vector<double> distances(5);
+    SMath::Point2 query(7.3, 2.1);
+    ASSERT_EQ(tree.FindNearest(query, 5, indices, distances), 5u);
+
+    auto expected = BruteForceNearest(points, query, 5, double(INFINITY));
+    for (int i = 0; i < 5; ++i)
+        EXPECT_EQ(distances[i], expected[i]);
+}
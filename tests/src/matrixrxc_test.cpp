@@ -0,0 +1,115 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "linalg.h"
+
+TEST(MatrixRxCTest, CanBeInitializedWithValues)
+{
+    SMath::Matrix2x2 m2(0, 1, 2, 3);
+    EXPECT_DOUBLE_EQ(m2.m_11, 0);
+    EXPECT_DOUBLE_EQ(m2.m_12, 1);
+    EXPECT_DOUBLE_EQ(m2.m_21, 2);
+    EXPECT_DOUBLE_EQ(m2.m_22, 3);
+
+    SMath::Matrix3x4 m34(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+    SMath::Matrix4x3 m43(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+
+    for (int i = 0; i < 12; ++i)
+    {
+        EXPECT_DOUBLE_EQ(m34.m_Data[i], i);
+        EXPECT_DOUBLE_EQ(m43.m_Data[i], i);
+    }
+
+    EXPECT_DOUBLE_EQ(m34.m_Data2D[1][3], 7);
+    EXPECT_DOUBLE_EQ(m43.m_Data2D[3][1], 10);
+}
+
+TEST(MatrixRxCTest, HasTightLayout)
+{
+    EXPECT_EQ(sizeof(SMath::Matrix2x2), 4 * sizeof(double));
+    EXPECT_EQ(sizeof(SMath::Matrix3x4), 12 * sizeof(double));
+    EXPECT_EQ(sizeof(SMath::Matrix4x3), 12 * sizeof(double));
+}
+
+TEST(MatrixRxCTest, DefaultsToIdentity)
+{
+    EXPECT_TRUE(SMath::Matrix2x2().IsIdentity());
+    EXPECT_EQ(SMath::Matrix3x4(), SMath::Matrix3x4(1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0));
+    EXPECT_EQ(SMath::Matrix4x3::Identity(), SMath::Matrix4x3(1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0));
+}
+
+TEST(MatrixRxCTest, CanBeTransposed)
+{
+    SMath::Matrix3x4 m(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11);
+    SMath::Matrix4x3 t = m.Transposed();
+
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 4; ++j)
+            EXPECT_DOUBLE_EQ(t.m_Data2D[j][i], m.m_Data2D[i][j]);
+
+    EXPECT_EQ(t.Transposed(), m);
+}
+
+TEST(MatrixRxCTest, CanMultiplyDifferentShapes)
+{
+    SMath::Matrix3x4 a(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+    SMath::Matrix4x3 b(1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0);
+
+    SMath::Matrix3x3 ab = a * b;
+    EXPECT_EQ(ab, SMath::Matrix3x3(10, 10, 5, 26, 22, 17, 42, 34, 29));
+
+    SMath::Matrix4x4 ba = b * a;
+    EXPECT_EQ(ba, SMath::Matrix4x4(19, 22, 25, 28, 5, 6, 7, 8, 12, 16, 20, 24, 10, 12, 14, 16));
+
+    SMath::Matrix<double, 3, 4> aIdentity = a * SMath::Matrix4x4::Identity();
+    EXPECT_EQ(aIdentity, a);
+}
+
+TEST(MatrixRxCTest, CanMultiply2x2)
+{
+    SMath::Matrix2x2 a(1, 2, 3, 4);
+    SMath::Matrix2x2 b(0, 1, 1, 0);
+    EXPECT_EQ(a * b, SMath::Matrix2x2(2, 1, 4, 3));
+    EXPECT_EQ(a * SMath::Vector2(1, -1), SMath::Vector2(-1, -1));
+}
+
+TEST(MatrixRxCTest, CanMultiplyWithVectors)
+{
+    SMath::Matrix3x4 a(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+
+    EXPECT_EQ(a * SMath::Vector4(1, 0, -1, 2), SMath::Vector3(6, 14, 22));
+    EXPECT_EQ(SMath::Vector3(1, 0, -1) * a, SMath::Vector4(-8, -8, -8, -8));
+    EXPECT_EQ(SMath::Vector3(1, 2, 3) * a, a.Transposed() * SMath::Vector3(1, 2, 3));
+}
+
+TEST(MatrixRxCTest, CanTransformAffine)
+{
+    SMath::Matrix3x4 affine(0, -1, 0, 10, 1, 0, 0, 20, 0, 0, 2, 30);
+
+    EXPECT_EQ(affine * SMath::Point3(1, 2, 3), SMath::Point3(8, 21, 36));
+    EXPECT_EQ(affine * SMath::Vector3(1, 2, 3), SMath::Vector3(-2, 1, 6));
+}
+
+TEST(MatrixRxCTest, CanGetUpper3x3)
+{
+    SMath::Matrix3x4 a(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+    EXPECT_EQ(a.Upper3x3(), SMath::Matrix3x3(1, 2, 3, 5, 6, 7, 9, 10, 11));
+}
@@ -0,0 +1,243 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "normalencoding.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    typedef SMath::Normal<double, 3> Normal3;
+    typedef SMath::Normal<float, 3> Normal3f;
+    typedef SMath::Vector<float, 4> Vector4f;
+
+    // Fibonacci lattice, plus the axes and octant diagonals where the maps have seams
+    std::vector<Normal3> SphereSweep(int count)
+    {
+        std::vector<Normal3> normals;
+        const double golden = SMath::Pi * (3.0 - std::sqrt(5.0));
+        for (int i = 0; i < count; ++i)
+        {
+            double z = 1.0 - (i + 0.5) * 2.0 / count;
+            double r = std::sqrt(1.0 - z * z);
+            normals.emplace_back(r * std::cos(golden * i), r * std::sin(golden * i), z);
+        }
+
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            for (double s : { -1.0, 1.0 })
+            {
+                Normal3 n(0.0);
+                n[axis] = s;
+                normals.push_back(n);
+            }
+        }
+
+        const double d = 1.0 / std::sqrt(3.0);
+        for (int octant = 0; octant < 8; ++octant)
+            normals.emplace_back(octant & 1 ? -d : d, octant & 2 ? -d : d, octant & 4 ? -d : d);
+        return normals;
+    }
+
+    // atan2 keeps its precision at the tiny angles acos loses
+    double AngleDegrees(const SMath::Vector<double, 3>& a, const SMath::Vector<double, 3>& b)
+    {
+        SMath::Vector<double, 3> c = SMath::Vector<double, 3>::Cross(a, b);
+        return std::atan2(c.Magnitude(), SMath::Vector<double, 3>::Dot(a, b)) * 180.0 / SMath::Pi;
+    }
+
+    template<typename Encode, typename Decode>
+    double MaxError(const std::vector<Normal3>& normals, Encode encode, Decode decode)
+    {
+        double worst = 0.0;
+        for (const Normal3& n : normals)
+            worst = std::max(worst, AngleDegrees(n, decode(encode(n))));
+        return worst;
+    }
+
+    std::vector<Normal3f> ToFloat(const std::vector<Normal3>& normals)
+    {
+        std::vector<Normal3f> result;
+        for (const Normal3& n : normals)
+            result.emplace_back(float(n.x), float(n.y), float(n.z));
+        return result;
+    }
+
+    double AngleDegrees(const Normal3f& a, const Normal3f& b)
+    {
+        return AngleDegrees(SMath::Vector<double, 3>(a.x, a.y, a.z), SMath::Vector<double, 3>(b.x, b.y, b.z));
+    }
+}
+
+TEST(NormalEncodingTest, CanRoundTripOct16)
+{
+    auto normals = SphereSweep(200000);
+    double error = MaxError(normals, SMath::EncodeOct16<double>, SMath::DecodeOct16<double>);
+    double precise = MaxError(normals, SMath::EncodeOct16Precise<double>, SMath::DecodeOct16<double>);
+    EXPECT_LT(error, 0.0037);
+    EXPECT_LT(precise, 0.0025);
+
+    // Axes land exactly on the grid
+    EXPECT_EQ(SMath::DecodeOct16(SMath::EncodeOct16(Normal3(0.0, 0.0, -1.0))), Normal3(0.0, 0.0, -1.0));
+    EXPECT_EQ(SMath::DecodeOct16(SMath::EncodeOct16(Normal3(0.0, 1.0, 0.0))), Normal3(0.0, 1.0, 0.0));
+    EXPECT_EQ(SMath::EncodeOct16(Normal3(0.0, 0.0, 1.0)), (SMath::Oct16{ 0, 0 }));
+}
+
+TEST(NormalEncodingTest, CanRoundTripOct8)
+{
+    auto normals = SphereSweep(200000);
+    double error = MaxError(normals, SMath::EncodeOct8<double>, SMath::DecodeOct8<double>);
+    double precise = MaxError(normals, SMath::EncodeOct8Precise<double>, SMath::DecodeOct8<double>);
+    EXPECT_LT(error, 0.95);
+    EXPECT_LT(precise, 0.65);
+    EXPECT_EQ(SMath::DecodeOct8(SMath::EncodeOct8(Normal3(-1.0, 0.0, 0.0))), Normal3(-1.0, 0.0, 0.0));
+
+    // Scale does not matter to the octahedral maps
+    EXPECT_EQ(SMath::EncodeOct8(Normal3(0.3, -0.5, 0.2)), SMath::EncodeOct8(Normal3(3.0, -5.0, 2.0)));
+}
+
+TEST(NormalEncodingTest, CanRoundTripSpheremap)
+{
+    auto normals = SphereSweep(200000);
+    std::vector<Normal3> upper, middle, lower;
+    for (const Normal3& n : normals)
+        (n.z >= 0.0 ? upper : n.z >= -0.9 ? middle : lower).push_back(n);
+
+    // Precision drops towards the -z pole
+    EXPECT_LT(MaxError(upper, SMath::EncodeSpheremap<double>, SMath::DecodeSpheremap<double>), 0.0035);
+    EXPECT_LT(MaxError(middle, SMath::EncodeSpheremap<double>, SMath::DecodeSpheremap<double>), 0.011);
+    EXPECT_LT(MaxError(lower, SMath::EncodeSpheremap<double>, SMath::DecodeSpheremap<double>), 0.6);
+
+    EXPECT_EQ(SMath::DecodeSpheremap(SMath::EncodeSpheremap(Normal3(0.0, 0.0, 1.0))), Normal3(0.0, 0.0, 1.0));
+    Normal3 pole = SMath::DecodeSpheremap(SMath::EncodeSpheremap(Normal3(0.0, 0.0, -1.0)));
+    EXPECT_EQ(pole.z, -1.0);
+    EXPECT_NEAR(pole.x, 0.0, 1e-12);
+}
+
+TEST(NormalEncodingTest, CanRoundTripQTangent)
+{
+    auto normals = SphereSweep(50000);
+    double normalError = 0.0, tangentError = 0.0;
+    for (size_t i = 0; i < normals.size(); ++i)
+    {
+        const Normal3& n = normals[i];
+        SMath::Vector<double, 3> helper = std::abs(n.z) < 0.9 ? SMath::Vector<double, 3>(0.0, 0.0, 1.0) : SMath::Vector<double, 3>(1.0, 0.0, 0.0);
+        SMath::Vector<double, 3> t = SMath::Vector<double, 3>::Cross(helper, n).Normalized();
+        double angle = i * 0.37;
+        t = t * std::cos(angle) + SMath::Vector<double, 3>::Cross(n, t) * std::sin(angle);
+        double sign = (i & 1) ? -1.0 : 1.0;
+
+        Normal3 decodedNormal;
+        SMath::Vector<double, 3> decodedTangent;
+        ASSERT_EQ(SMath::DecodeQTangent(SMath::EncodeQTangent(n, t, sign), decodedNormal, decodedTangent), sign);
+        normalError = std::max(normalError, AngleDegrees(n, decodedNormal));
+        tangentError = std::max(tangentError, AngleDegrees(t, decodedTangent));
+    }
+
+    EXPECT_LT(normalError, 0.0035);
+    EXPECT_LT(tangentError, 0.0035);
+}
+
+TEST(NormalEncodingTest, CanEncodeDegenerateTangents)
+{
+    Normal3 n(0.0, 1.0, 0.0);
+    Normal3 decodedNormal;
+    SMath::Vector<double, 3> decodedTangent;
+
+    // Parallel to the normal: any perpendicular tangent will do
+    double sign = SMath::DecodeQTangent(SMath::EncodeQTangent(n, SMath::Vector<double, 3>(0.0, -2.0, 0.0), -1.0), decodedNormal, decodedTangent);
+    EXPECT_EQ(sign, -1.0);
+    EXPECT_LT(AngleDegrees(n, decodedNormal), 0.005);
+    EXPECT_NEAR((SMath::Vector<double, 3>::Dot(n, decodedTangent)), 0.0, 1e-4);
+
+    // Not unit length and not orthogonal
+    SMath::DecodeQTangent(SMath::EncodeQTangent(n, SMath::Vector<double, 3>(3.0, 1.0, 0.0), 1.0), decodedNormal, decodedTangent);
+    EXPECT_LT(AngleDegrees(SMath::Vector<double, 3>(1.0, 0.0, 0.0), decodedTangent), 0.005);
+
+    // Identity frame: w is the only non-zero component and keeps the sign
+    EXPECT_EQ(SMath::EncodeQTangent(Normal3(0.0, 0.0, 1.0), SMath::Vector<double, 3>(1.0, 0.0, 0.0), -1.0), (SMath::QTangent{ 0, 0, 0, -32767 }));
+}
+
+TEST(NormalEncodingTest, BatchMatchesScalar)
+{
+    auto normals = ToFloat(SphereSweep(10007));
+    size_t count = normals.size();
+
+    std::vector<Vector4f> tangents(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const Normal3f& n = normals[i];
+        SMath::Vector<float, 3> t = SMath::Vector<float, 3>::Cross(SMath::Vector<float, 3>(0.3f, -0.8f, 0.5f), n);
+        tangents[i] = Vector4f(t.x, t.y, t.z, (i % 3) ? 1.0f : -1.0f);
+    }
+    tangents[5] = Vector4f(normals[5].x, normals[5].y, normals[5].z, 1.0f);
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<SMath::Oct16> oct16(count);
+        std::vector<SMath::Oct8> oct8(count);
+        std::vector<SMath::Spheremap16> spheremap(count);
+        std::vector<SMath::QTangent> qtangents(count);
+        SMath::Batch::EncodeOct16(normals, oct16);
+        SMath::Batch::EncodeOct8(normals, oct8);
+        SMath::Batch::EncodeSpheremap(normals, spheremap);
+        SMath::Batch::EncodeQTangent(normals, tangents, qtangents);
+
+        std::vector<Normal3f> decoded16(count), decoded8(count), decodedSpheremap(count), decodedNormals(count);
+        std::vector<Vector4f> decodedTangents(count);
+        SMath::Batch::DecodeOct16(oct16, decoded16);
+        SMath::Batch::DecodeOct8(oct8, decoded8);
+        SMath::Batch::DecodeSpheremap(spheremap, decodedSpheremap);
+        SMath::Batch::DecodeQTangent(qtangents, decodedNormals, decodedTangents);
+
+        auto near = [](int a, int b) { return std::abs(a - b) <= 1; };
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Normal3f& n = normals[i];
+            SMath::Oct16 o16 = SMath::EncodeOct16(n);
+            SMath::Oct8 o8 = SMath::EncodeOct8(n);
+            SMath::Spheremap16 s = SMath::EncodeSpheremap(n);
+            SMath::QTangent q = SMath::EncodeQTangent(n, SMath::Vector<float, 3>(tangents[i].x, tangents[i].y, tangents[i].z), tangents[i].w);
+
+            ASSERT_TRUE(near(oct16[i].m_U, o16.m_U) && near(oct16[i].m_V, o16.m_V)) << i;
+            ASSERT_TRUE(near(oct8[i].m_U, o8.m_U) && near(oct8[i].m_V, o8.m_V)) << i;
+            ASSERT_TRUE(near(spheremap[i].m_U, s.m_U) && near(spheremap[i].m_V, s.m_V)) << i;
+            ASSERT_TRUE(near(qtangents[i].m_X, q.m_X) && near(qtangents[i].m_Y, q.m_Y) && near(qtangents[i].m_Z, q.m_Z) && near(qtangents[i].m_W, q.m_W)) << i;
+
+            // Decoding the batch's own codes matches the scalar decoder
+            ASSERT_LT(AngleDegrees(decoded16[i], SMath::DecodeOct16<float>(oct16[i])), 1e-4) << i;
+            ASSERT_LT(AngleDegrees(decoded8[i], SMath::DecodeOct8<float>(oct8[i])), 1e-4) << i;
+            // 1 - r^2 cancels in float near the -z pole
+            ASSERT_LT(AngleDegrees(decodedSpheremap[i], SMath::DecodeSpheremap<float>(spheremap[i])), 1e-3) << i;
+
+            Normal3f normal;
+            SMath::Vector<float, 3> tangent;
+            float sign = SMath::DecodeQTangent<float>(qtangents[i], normal, tangent);
+            ASSERT_LT(AngleDegrees(decodedNormals[i], normal), 1e-4) << i;
+            ASSERT_LT(AngleDegrees(Normal3f(decodedTangents[i].x, decodedTangents[i].y, decodedTangents[i].z), Normal3f(tangent)), 1e-4) << i;
+            ASSERT_EQ(decodedTangents[i].w, sign) << i;
+            ASSERT_EQ(sign, tangents[i].w) << i;
+
+            ASSERT_LT(AngleDegrees(n, decoded16[i]), 0.005) << i;
+        }
+    });
+}
@@ -0,0 +1,219 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "orientedbox.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::OrientedBox<double> OrientedBox;
+    typedef SMath::Point<float, 3> Point3f;
+
+    SMath::Quaternion<double> Rotation(double x, double y, double z, double angle)
+    {
+        return SMath::Quaternion<double>::FromAxisAngle(SMath::Vector3(x, y, z), angle);
+    }
+
+    // Reference separating axis test: projects all corners on every candidate axis
+    bool IntersectsByCorners(const OrientedBox& a, const OrientedBox& b)
+    {
+        auto corners = [](const OrientedBox& box) {
+            std::vector<SMath::Point3> points;
+            for (int i = 0; i < 8; ++i)
+                points.push_back(box.m_Center + box.m_Axes[0] * (i & 1 ? box.m_Extents.x : -box.m_Extents.x)
+                                              + box.m_Axes[1] * (i & 2 ? box.m_Extents.y : -box.m_Extents.y)
+                                              + box.m_Axes[2] * (i & 4 ? box.m_Extents.z : -box.m_Extents.z));
+            return points;
+        };
+
+        std::vector<SMath::Vector3> axes;
+        for (int i = 0; i < 3; ++i)
+        {
+            axes.push_back(a.m_Axes[i]);
+            axes.push_back(b.m_Axes[i]);
+            for (int j = 0; j < 3; ++j)
+                axes.push_back(SMath::Vector3::Cross(a.m_Axes[i], b.m_Axes[j]));
+        }
+
+        auto ca = corners(a), cb = corners(b);
+        for (const auto& axis : axes)
+        {
+            if (axis.SquareMagnitude() < 1e-12)
+                continue;
+
+            double minA = 1e30, maxA = -1e30, minB = 1e30, maxB = -1e30;
+            for (const auto& p : ca)
+            {
+                double d = SMath::Vector3::Dot(p - SMath::Point3(0.0), axis);
+                minA = std::min(minA, d);
+                maxA = std::max(maxA, d);
+            }
+            for (const auto& p : cb)
+            {
+                double d = SMath::Vector3::Dot(p - SMath::Point3(0.0), axis);
+                minB = std::min(minB, d);
+                maxB = std::max(maxB, d);
+            }
+
+            if (maxA < minB || maxB < minA)
+                return false;
+        }
+
+        return true;
+    }
+}
+
+TEST(OrientedBoxTest, CanBeCreated)
+{
+    OrientedBox fromRotation(SMath::Point3(1, 2, 3), Rotation(0, 0, 1, SMath::Pi / 2), SMath::Vector3(1, 2, 3));
+    EXPECT_NEAR(fromRotation.m_Axes[0].y, 1.0, 1e-12);
+    EXPECT_NEAR(fromRotation.m_Axes[1].x, -1.0, 1e-12);
+    EXPECT_NEAR(fromRotation.m_Axes[2].z, 1.0, 1e-12);
+
+    SMath::Matrix3x3 basis = { 0, -1, 0, 1, 0, 0, 0, 0, 1 };
+    OrientedBox fromBasis(SMath::Point3(1, 2, 3), basis, SMath::Vector3(1, 2, 3));
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            EXPECT_NEAR(fromBasis.m_Axes[i][j], fromRotation.m_Axes[i][j], 1e-12);
+
+    OrientedBox fromBox(SMath::Box(SMath::Point3(-1, 0, 2), SMath::Point3(3, 2, 4)));
+    EXPECT_EQ(fromBox.m_Center, SMath::Point3(1, 1, 3));
+    EXPECT_EQ(fromBox.m_Extents, SMath::Vector3(2, 1, 1));
+}
+
+TEST(OrientedBoxTest, CanCheckIfContainsPoint)
+{
+    OrientedBox box(SMath::Point3(0, 0, 0), Rotation(0, 0, 1, SMath::Pi / 4), SMath::Vector3(1, 1, 1));
+
+    EXPECT_TRUE(box.Contains(SMath::Point3(1.4, 0, 0)));
+    EXPECT_TRUE(box.Contains(SMath::Point3(0, -1.4, 0.9)));
+    EXPECT_FALSE(box.Contains(SMath::Point3(1.0, 1.0, 0)));
+    EXPECT_FALSE(box.Contains(SMath::Point3(0, 0, 1.1)));
+}
+
+TEST(OrientedBoxTest, CanIntersectOrientedBox)
+{
+    OrientedBox a(SMath::Point3(0, 0, 0), SMath::Quaternion<double>::Identity(), SMath::Vector3(1, 1, 1));
+
+    EXPECT_TRUE(a.Intersects(OrientedBox(SMath::Point3(1.9, 0, 0), SMath::Quaternion<double>::Identity(), SMath::Vector3(1, 1, 1))));
+    EXPECT_FALSE(a.Intersects(OrientedBox(SMath::Point3(2.1, 0, 0), SMath::Quaternion<double>::Identity(), SMath::Vector3(1, 1, 1))));
+
+    // Rotated 45 degrees, b reaches sqrt(2) towards a
+    EXPECT_TRUE(a.Intersects(OrientedBox(SMath::Point3(2.3, 0, 0), Rotation(0, 0, 1, SMath::Pi / 4), SMath::Vector3(1, 1, 1))));
+    EXPECT_FALSE(a.Intersects(OrientedBox(SMath::Point3(2.5, 0, 0), Rotation(0, 0, 1, SMath::Pi / 4), SMath::Vector3(1, 1, 1))));
+
+    // Their bounds overlap, the boxes do not
+    OrientedBox thin(SMath::Point3(1.6, 1.6, 0), Rotation(0, 0, 1, SMath::Pi / 4), SMath::Vector3(0.1, 2, 1));
+    EXPECT_TRUE(thin.GetBounds().m_Min.x < 1.0 && thin.GetBounds().m_Min.y < 1.0);
+    EXPECT_FALSE(a.Intersects(thin));
+}
+
+TEST(OrientedBoxTest, MatchesReferenceSeparatingAxisTest)
+{
+    std::vector<float> u = SMath::Test::Uniform(4000 * 14, 9, -1.0f, 1.0f);
+
+    int overlaps = 0;
+    for (size_t i = 0; i < u.size(); i += 14)
+    {
+        const float* r = &u[i];
+        OrientedBox a(SMath::Point3(0.0), Rotation(r[0], r[1], r[2] + 2.0, r[3] * 3.0), SMath::Vector3(1.0 + r[4], 0.5, 1.0));
+        OrientedBox b(SMath::Point3(r[5] * 3.0, r[6] * 3.0, r[7] * 3.0), Rotation(r[8], r[9] + 2.0, r[10], r[11] * 3.0),
+                      SMath::Vector3(0.6, 1.0 + r[12], 0.3 + r[13] * 0.2));
+
+        bool expected = IntersectsByCorners(a, b);
+        EXPECT_EQ(a.Intersects(b), expected) << "pair " << i / 14;
+        EXPECT_EQ(b.Intersects(a), expected) << "pair " << i / 14;
+        overlaps += expected;
+    }
+
+    EXPECT_GT(overlaps, 500);
+    EXPECT_LT(overlaps, 3500);
+}
+
+TEST(OrientedBoxTest, CanIntersectRay)
+{
+    OrientedBox box(SMath::Point3(0, 0, 10), Rotation(0, 0, 1, SMath::Pi / 4), SMath::Vector3(1, 1, 1));
+    double t;
+
+    EXPECT_TRUE(box.Intersects(SMath::Ray<double>(SMath::Point3(0, 0, 0), SMath::Vector3(0, 0, 1)), t));
+    EXPECT_NEAR(t, 9.0, 1e-12);
+
+    // Hits the corner edge of the rotated box side-on
+    EXPECT_TRUE(box.Intersects(SMath::Ray<double>(SMath::Point3(-5, 0, 10), SMath::Vector3(1, 0, 0)), t));
+    EXPECT_NEAR(t, 5.0 - std::sqrt(2.0), 1e-12);
+
+    EXPECT_TRUE(box.Intersects(SMath::Ray<double>(SMath::Point3(0, 0, 10), SMath::Vector3(1, 0, 0)), t));
+    EXPECT_NEAR(t, std::sqrt(2.0), 1e-12);
+
+    EXPECT_FALSE(box.Intersects(SMath::Ray<double>(SMath::Point3(1.2, 1.2, 0), SMath::Vector3(0, 0, 1)), t));
+    EXPECT_FALSE(box.Intersects(SMath::Ray<double>(SMath::Point3(0, 0, 0), SMath::Vector3(0, 0, -1)), t));
+}
+
+TEST(OrientedBoxTest, CanGetBounds)
+{
+    OrientedBox box(SMath::Point3(1, 0, 0), Rotation(0, 0, 1, SMath::Pi / 4), SMath::Vector3(1, 1, 2));
+    SMath::Box<double> bounds = box.GetBounds();
+
+    EXPECT_NEAR(bounds.m_Min.x, 1.0 - std::sqrt(2.0), 1e-12);
+    EXPECT_NEAR(bounds.m_Max.y, std::sqrt(2.0), 1e-12);
+    EXPECT_NEAR(bounds.m_Min.z, -2.0, 1e-12);
+    EXPECT_NEAR(bounds.m_Max.z, 2.0, 1e-12);
+}
+
+TEST(OrientedBoxTest, CanFitPointsWithPca)
+{
+    // Points filling a rotated 10 x 4 x 1 box, far from the origin
+    OrientedBox source(SMath::Point3(1000, -500, 250), Rotation(1, 2, 3, 0.7), SMath::Vector3(5, 2, 0.5));
+
+    std::vector<float> u = SMath::Test::Uniform(30011 * 3, 21, -1.0f, 1.0f);
+
+    std::vector<SMath::Point3> points(u.size() / 3);
+    std::vector<Point3f> pointsf(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        points[i] = source.m_Center + source.m_Axes[0] * (u[i * 3] * 5.0) + source.m_Axes[1] * (u[i * 3 + 1] * 2.0) + source.m_Axes[2] * (u[i * 3 + 2] * 0.5);
+        pointsf[i] = Point3f(float(points[i].x), float(points[i].y), float(points[i].z));
+    }
+
+    OrientedBox fit = OrientedBox::FitPca(points);
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_NEAR(std::abs(SMath::Vector3::Dot(fit.m_Axes[i], source.m_Axes[i])), 1.0, 1e-4);
+        // Sampling noise tilts the axes slightly, which the long axis turns into extra extent
+        EXPECT_NEAR(fit.m_Extents[i], source.m_Extents[i], 0.05);
+    }
+
+    OrientedBox padded = fit;
+    padded.m_Extents = padded.m_Extents + SMath::Vector3(1e-9);
+    for (const auto& p : points)
+        ASSERT_TRUE(padded.Contains(p));
+
+    SMath::Test::ForEachLevel([&]() {
+        SMath::OrientedBox<float> fitf = SMath::OrientedBox<float>::FitPca(pointsf);
+        for (int i = 0; i < 3; ++i)
+        {
+            EXPECT_NEAR(std::abs(SMath::Vector<float, 3>::Dot(fitf.m_Axes[i], SMath::Vector<float, 3>(float(fit.m_Axes[i].x), float(fit.m_Axes[i].y), float(fit.m_Axes[i].z)))), 1.0f, 1e-4f);
+            EXPECT_NEAR(fitf.m_Extents[i], float(fit.m_Extents[i]), 1e-3f);
+        }
+    });
+}
@@ -0,0 +1,175 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "primitives.h"
+#include "sphere.h"
+
+#include <cmath>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+    typedef SMath::Vector<float, 3> Vector3f;
+}
+
+TEST(PrimitivesTest, CanIntersectPlane)
+{
+    SMath::Plane<double> plane(SMath::Vector3(0.0, 0.0, 2.0), 4.0);
+    EXPECT_EQ(plane.m_Normal, SMath::Vector3(0.0, 0.0, 1.0));
+    EXPECT_EQ(plane.m_Distance, 2.0);
+    EXPECT_EQ(plane.GetSignedDistance(SMath::Point3(5.0, 1.0, 3.0)), 1.0);
+
+    SMath::RayHit<double> hit;
+    EXPECT_TRUE(plane.Intersect(SMath::Ray<double>(SMath::Point3(1.0, 1.0, 0.0), SMath::Vector3(0.0, 0.6, 0.8)), hit));
+    EXPECT_NEAR(hit.m_T, 2.5, 1e-12);
+    EXPECT_EQ(hit.m_Normal, SMath::Vector3(0.0, 0.0, 1.0));
+
+    // Parallel, behind, and beyond m_TMax
+    EXPECT_FALSE(plane.Intersect(SMath::Ray<double>(SMath::Point3(0.0), SMath::Vector3(1.0, 0.0, 0.0)), hit));
+    EXPECT_FALSE(plane.Intersect(SMath::Ray<double>(SMath::Point3(0.0), SMath::Vector3(0.0, 0.0, -1.0)), hit));
+    EXPECT_FALSE(plane.Intersect(SMath::Ray<double>(SMath::Point3(0.0), SMath::Vector3(0.0, 0.0, 1.0), 0.0, 1.5), hit));
+
+    SMath::Plane<double> through(SMath::Vector3(1.0, 1.0, 0.0), SMath::Point3(1.0, 1.0, 7.0));
+    EXPECT_NEAR(through.GetSignedDistance(SMath::Point3(0.0)), -std::sqrt(2.0), 1e-12);
+}
+
+TEST(PrimitivesTest, CanIntersectDisk)
+{
+    SMath::Disk<double> disk(SMath::Point3(1.0, 2.0, 3.0), SMath::Vector3(0.0, 0.0, -3.0), 2.0);
+    EXPECT_EQ(disk.m_Normal, SMath::Vector3(0.0, 0.0, -1.0));
+
+    SMath::RayHit<double> hit;
+    EXPECT_TRUE(disk.Intersect(SMath::Ray<double>(SMath::Point3(2.0, 2.0, 0.0), SMath::Vector3(0.0, 0.0, 1.0)), hit));
+    EXPECT_NEAR(hit.m_T, 3.0, 1e-12);
+    EXPECT_NEAR(hit.m_U, 0.5, 1e-12);
+    EXPECT_EQ(hit.m_Normal, SMath::Vector3(0.0, 0.0, -1.0));
+
+    // Just outside the radius, and parallel
+    EXPECT_FALSE(disk.Intersect(SMath::Ray<double>(SMath::Point3(3.01, 2.0, 0.0), SMath::Vector3(0.0, 0.0, 1.0)), hit));
+    EXPECT_FALSE(disk.Intersect(SMath::Ray<double>(SMath::Point3(1.0, 2.0, 3.0), SMath::Vector3(1.0, 0.0, 0.0)), hit));
+}
+
+TEST(PrimitivesTest, CanIntersectSphereWithHitRecord)
+{
+    SMath::Sphere<double> sphere(SMath::Point3(0.0, 0.0, 5.0), 2.0);
+    SMath::RayHit<double> hit;
+    EXPECT_TRUE(sphere.Intersect(SMath::Ray<double>(SMath::Point3(0.0), SMath::Vector3(0.0, 0.0, 1.0)), hit));
+    EXPECT_NEAR(hit.m_T, 3.0, 1e-12);
+    EXPECT_NEAR(hit.m_Normal.z, -1.0, 1e-12);
+    EXPECT_NEAR(hit.m_V, 1.0, 1e-12);
+
+    EXPECT_TRUE(sphere.Intersect(SMath::Ray<double>(SMath::Point3(0.0, -10.0, 5.0), SMath::Vector3(0.0, 1.0, 0.0)), hit));
+    EXPECT_NEAR(hit.m_T, 8.0, 1e-12);
+    EXPECT_NEAR(hit.m_U, 0.75, 1e-12);
+    EXPECT_NEAR(hit.m_V, 0.5, 1e-12);
+}
+
+TEST(PrimitivesTest, SphereIsAccurateAtLargeDistances)
+{
+    // The hit record of a unit sphere seen from far away in float, to within float rounding
+    for (double distance : { 1e2, 1e3, 1e4, 1e5 })
+    {
+        for (double offset : { 0.0, 0.5, 0.9 })
+        {
+            SCOPED_TRACE(distance);
+            Vector3f direction = Vector3f(1.0f, 2.0f, 2.0f).Normalized();
+            Vector3f side = Vector3f::Cross(direction, Vector3f(0.0f, 0.0f, 1.0f)).Normalized();
+            Point3f center(3.0f, -4.0f, 1.0f);
+            Point3f origin = center - direction * float(distance) + side * float(offset);
+
+            SMath::Sphere<float> sphere(center, 1.0f);
+            SMath::RayHit<float> hit;
+            ASSERT_TRUE(sphere.Intersect(SMath::Ray<float>(origin, direction), hit));
+
+            double expected = distance - std::sqrt(1.0 - offset * offset);
+            EXPECT_NEAR(hit.m_T, expected, distance * 1e-6);
+            EXPECT_NEAR(Vector3f::Dot(hit.m_Normal, side), offset, 1e-2 + distance * 1e-6);
+        }
+    }
+
+    float t;
+
+    // Planes and disks from far away
+    SMath::Plane<float> plane(Vector3f(0.0f, 0.0f, 1.0f), 0.0f);
+    ASSERT_TRUE(plane.Intersects(SMath::Ray<float>(Point3f(10.0f, 20.0f, 1e5f), Vector3f(0.6f, 0.0f, -0.8f)), t));
+    EXPECT_NEAR(t, 1.25e5, 1.25e5 * 1e-6);
+    SMath::Disk<float> disk(Point3f(0.0f, 0.0f, -1e5f), Vector3f(0.0f, 0.0f, 1.0f), 0.5f);
+    EXPECT_TRUE(disk.Intersects(SMath::Ray<float>(Point3f(0.3f, 0.3f, 0.0f), Vector3f(0.0f, 0.0f, -1.0f)), t));
+    EXPECT_FALSE(disk.Intersects(SMath::Ray<float>(Point3f(0.4f, 0.4f, 0.0f), Vector3f(0.0f, 0.0f, -1.0f)), t));
+}
+
+TEST(PrimitivesTest, CanIntersectStraightRibbon)
+{
+    SMath::CubicBezier<double> line(SMath::Point3(-1.0, 0.0, 5.0), SMath::Point3(-1.0 / 3.0, 0.0, 5.0), SMath::Point3(1.0 / 3.0, 0.0, 5.0),
+                                    SMath::Point3(1.0, 0.0, 5.0));
+    SMath::RibbonCurve<double> ribbon(line, 0.2, 0.2);
+    EXPECT_EQ(ribbon.m_SegmentCount, 1u);
+
+    for (double y : { -0.15, -0.09, 0.0, 0.05, 0.099, 0.11 })
+    {
+        SMath::RayHit<double> hit;
+        bool found = ribbon.Intersect(SMath::Ray<double>(SMath::Point3(0.3, y, 0.0), SMath::Vector3(0.0, 0.0, 1.0)), hit);
+        EXPECT_EQ(found, std::abs(y) <= 0.1);
+        if (!found)
+            continue;
+
+        EXPECT_NEAR(hit.m_T, 5.0, 1e-12);
+        EXPECT_NEAR(hit.m_U, 0.65, 1e-12);
+        EXPECT_NEAR(std::abs(hit.m_V - 0.5), std::abs(y) / 0.2, 1e-12);
+        EXPECT_EQ(hit.m_Normal, SMath::Vector3(0.0, 0.0, -1.0));
+    }
+
+    // Tapering: at u = 0.9 the width is 0.02 + 0.9 * 0.18
+    SMath::RibbonCurve<double> tapered(line, 0.02, 0.2);
+    SMath::RayHit<double> hit;
+    EXPECT_TRUE(tapered.Intersect(SMath::Ray<double>(SMath::Point3(0.8, 0.08, 0.0), SMath::Vector3(0.0, 0.0, 1.0)), hit));
+    EXPECT_FALSE(tapered.Intersect(SMath::Ray<double>(SMath::Point3(-0.8, 0.08, 0.0), SMath::Vector3(0.0, 0.0, 1.0)), hit));
+}
+
+TEST(PrimitivesTest, CanIntersectCurvedRibbon)
+{
+    SMath::CubicBezier<double> curve(SMath::Point3(0.0, 0.0, 0.0), SMath::Point3(1.0, 2.0, 0.5), SMath::Point3(2.0, -2.0, 1.0),
+                                     SMath::Point3(3.0, 0.5, 0.0));
+    SMath::RibbonCurve<double> ribbon(curve, 0.05, 0.02);
+    EXPECT_GT(ribbon.m_SegmentCount, 1u);
+    EXPECT_LE(ribbon.m_SegmentCount, 1u << SMath::RibbonCurve<double>::MaxDepth);
+
+    // Rays aimed at points on the curve from several directions hit near those points
+    SMath::Vector3 directions[] = { SMath::Vector3(0.0, 0.0, 1.0), SMath::Vector3(0.3, -0.2, -1.0), SMath::Vector3(-1.0, 0.1, 0.2) };
+    for (const SMath::Vector3& direction : directions)
+    {
+        for (double u = 0.05; u < 1.0; u += 0.1)
+        {
+            SMath::Point3 target = curve.Evaluate(u);
+            SMath::Ray<double> ray(target - direction.Normalized() * 10.0, direction);
+
+            SMath::RayHit<double> hit;
+            ASSERT_TRUE(ribbon.Intersect(ray, hit)) << u;
+            EXPECT_LT((ray(hit.m_T) - target).Magnitude(), 0.1);
+            EXPECT_GE(hit.m_V, 0.0);
+            EXPECT_LE(hit.m_V, 1.0);
+
+            // Rays passing a full width to the side miss
+            SMath::Vector3 side = SMath::Vector3::Cross(direction, curve.Derivative(u)).Normalized();
+            EXPECT_FALSE(ribbon.Intersect(SMath::Ray<double>(ray.m_Origin + side * 0.2, direction), hit));
+        }
+    }
+}
@@ -0,0 +1,186 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "quaternionencoding.h"
+#include "batchops.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+    typedef SMath::Quaternion<double> Quaternion;
+    typedef SMath::Quaternion<float> Quaternionf;
+
+    // Uniform over rotations: points in the unit 4-ball, projected to the sphere. The
+    // special cases are where the canonical sign and the dropped component are ambiguous.
+    std::vector<Quaternion> Rotations(int count, uint32_t seed)
+    {
+        std::vector<float> u = SMath::Test::Uniform(size_t(count) * 8, seed, -1.0f, 1.0f);
+
+        std::vector<Quaternion> rotations = {
+            Quaternion(0.0, 0.0, 0.0, 1.0), Quaternion(0.0, 0.0, 0.0, -1.0), Quaternion(1.0, 0.0, 0.0, 0.0),
+            Quaternion(0.0, -1.0, 0.0, 0.0), Quaternion(0.5, -0.5, 0.5, -0.5), Quaternion(0.5, 0.5, -0.5, 0.5),
+            Quaternion(SMath::InvSqrt2, 0.0, -SMath::InvSqrt2, 0.0), Quaternion(0.0, 0.0, -SMath::InvSqrt2, -SMath::InvSqrt2)
+        };
+
+        for (size_t i = 0; i + 4 <= u.size() && rotations.size() < size_t(count); i += 4)
+        {
+            Quaternion q(u[i], u[i + 1], u[i + 2], u[i + 3]);
+            double length2 = q.SquareMagnitude();
+            if (length2 > 1e-4 && length2 <= 1.0)
+                rotations.push_back(q / std::sqrt(length2));
+        }
+        return rotations;
+    }
+
+    // Rotation angle between the two, in degrees, whichever sign each has
+    double AngleDegrees(const Quaternion& a, const Quaternion& b)
+    {
+        Quaternion c = b.Normalized();
+        double sign = Quaternion::Dot(a, c) < 0.0 ? -1.0 : 1.0;
+        return 4.0 * std::asin(std::min((a - c * sign).Magnitude() * 0.5, 1.0)) * 180.0 / SMath::Pi;
+    }
+
+    template<typename Encode, typename Decode>
+    double MaxError(const std::vector<Quaternion>& rotations, Encode encode, Decode decode)
+    {
+        double worst = 0.0;
+        for (const Quaternion& q : rotations)
+            worst = std::max(worst, AngleDegrees(q, decode(encode(q))));
+        return worst;
+    }
+
+    template<typename Encode, typename Decode>
+    void ExpectCanonical(const std::vector<Quaternion>& rotations, Encode encode, Decode decode)
+    {
+        for (const Quaternion& q : rotations)
+        {
+            ASSERT_EQ(encode(q), encode(-q));
+            Quaternion decoded = decode(encode(q));
+            ASSERT_GE(Quaternion::Dot(decoded, q) * (Quaternion::Dot(decoded, -q) < 0.0 ? 1.0 : -1.0), 0.0);
+        }
+    }
+}
+
+TEST(QuaternionEncodingTest, CanRoundTripSmallestThree32)
+{
+    auto rotations = Rotations(200000, 1);
+    double error = MaxError(rotations, SMath::EncodeSmallestThree32<double>, SMath::DecodeSmallestThree32<double>);
+    EXPECT_LT(error, 0.25);
+    ExpectCanonical(rotations, SMath::EncodeSmallestThree32<double>, SMath::DecodeSmallestThree32<double>);
+
+    // The dropped component is the largest one, made positive
+    SMath::SmallestThree32 e = SMath::EncodeSmallestThree32(Quaternion(0.1, -0.9, 0.3, 0.2).Normalized());
+    EXPECT_EQ(e.m_Bits >> 30, 1u);
+    EXPECT_GT(SMath::DecodeSmallestThree32(e).y, 0.0);
+    EXPECT_EQ(SMath::DecodeSmallestThree32(SMath::EncodeSmallestThree32(Quaternion(0.0, 0.0, 0.0, -1.0))), Quaternion(0.0, 0.0, 0.0, 1.0));
+}
+
+TEST(QuaternionEncodingTest, CanRoundTripSmallestThree48)
+{
+    auto rotations = Rotations(200000, 2);
+    double error = MaxError(rotations, SMath::EncodeSmallestThree48<double>, SMath::DecodeSmallestThree48<double>);
+    EXPECT_LT(error, 0.0082);
+    ExpectCanonical(rotations, SMath::EncodeSmallestThree48<double>, SMath::DecodeSmallestThree48<double>);
+
+    SMath::SmallestThree48 e = SMath::EncodeSmallestThree48(Quaternion(0.1, 0.3, -0.9, 0.2).Normalized());
+    EXPECT_EQ((e.m_Data[0] >> 15) | (e.m_Data[1] >> 15) << 1, 2);
+    EXPECT_EQ(e.m_Data[2] >> 15, 0);
+}
+
+TEST(QuaternionEncodingTest, CanRoundTripSnorm16)
+{
+    auto rotations = Rotations(200000, 3);
+    double error = MaxError(rotations, SMath::EncodeQuaternionSnorm16<double>, SMath::DecodeQuaternionSnorm16<double>);
+    EXPECT_LT(error, 0.0035);
+    ExpectCanonical(rotations, SMath::EncodeQuaternionSnorm16<double>, SMath::DecodeQuaternionSnorm16<double>);
+
+    // The largest component is made positive, even with w = 0
+    EXPECT_EQ(SMath::EncodeQuaternionSnorm16(Quaternion(0.0, -1.0, 0.0, 0.0)), (SMath::QuaternionSnorm16{ 0, 32767, 0, 0 }));
+    EXPECT_EQ(SMath::EncodeQuaternionSnorm16(Quaternion(0.0, 0.0, 0.0, -1.0)), (SMath::QuaternionSnorm16{ 0, 0, 0, 32767 }));
+}
+
+TEST(QuaternionEncodingTest, BatchMatchesScalar)
+{
+    auto rotations = Rotations(4099, 4);
+    size_t count = rotations.size();
+    std::vector<Quaternionf> rotationsf;
+    for (const Quaternion& q : rotations)
+        rotationsf.emplace_back(float(q.x), float(q.y), float(q.z), float(q.w));
+
+    auto near = [](int a, int b) { return std::abs(a - b) <= 1; };
+    auto nearBits = [&](uint32_t a, uint32_t b) {
+        return (a >> 30) == (b >> 30) && near((a >> 20) & 0x3ff, (b >> 20) & 0x3ff) && near((a >> 10) & 0x3ff, (b >> 10) & 0x3ff) && near(a & 0x3ff, b & 0x3ff);
+    };
+
+    SMath::Test::ForEachLevel([&]() {
+        std::vector<SMath::SmallestThree32> st32(count), st32d(count);
+        std::vector<SMath::SmallestThree48> st48(count), st48d(count);
+        std::vector<SMath::QuaternionSnorm16> sn16(count), sn16d(count);
+        SMath::Batch::EncodeSmallestThree32(rotationsf, st32);
+        SMath::Batch::EncodeSmallestThree48(rotationsf, st48);
+        SMath::Batch::EncodeQuaternionSnorm16(rotationsf, sn16);
+        SMath::Batch::EncodeSmallestThree32(rotations, st32d);
+        SMath::Batch::EncodeSmallestThree48(rotations, st48d);
+        SMath::Batch::EncodeQuaternionSnorm16(rotations, sn16d);
+
+        std::vector<Quaternionf> decoded32(count), decoded48(count), decoded16(count);
+        std::vector<Quaternion> decoded32d(count), decoded48d(count), decoded16d(count);
+        SMath::Batch::DecodeSmallestThree32(st32, decoded32);
+        SMath::Batch::DecodeSmallestThree48(st48, decoded48);
+        SMath::Batch::DecodeQuaternionSnorm16(sn16, decoded16);
+        SMath::Batch::DecodeSmallestThree32(st32, decoded32d);
+        SMath::Batch::DecodeSmallestThree48(st48, decoded48d);
+        SMath::Batch::DecodeQuaternionSnorm16(sn16, decoded16d);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            // Codes are within a step of the scalar double encoder; ties may round either way
+            const Quaternion& q = rotations[i];
+            ASSERT_TRUE(nearBits(st32[i].m_Bits, SMath::EncodeSmallestThree32(q).m_Bits)) << i;
+            ASSERT_EQ(st32[i], st32d[i]) << i;
+            ASSERT_EQ(st48[i], st48d[i]) << i;
+            ASSERT_EQ(sn16[i], sn16d[i]) << i;
+
+            SMath::SmallestThree48 e48 = SMath::EncodeSmallestThree48(q);
+            for (int k = 0; k < 3; ++k)
+                ASSERT_TRUE(near(st48[i].m_Data[k], e48.m_Data[k])) << i;
+            SMath::QuaternionSnorm16 e16 = SMath::EncodeQuaternionSnorm16(q);
+            ASSERT_TRUE(near(sn16[i].m_X, e16.m_X) && near(sn16[i].m_Y, e16.m_Y) && near(sn16[i].m_Z, e16.m_Z) && near(sn16[i].m_W, e16.m_W)) << i;
+
+            // Decoding the batch's own codes matches the scalar decoder
+            Quaternion s32 = SMath::DecodeSmallestThree32(st32[i]);
+            Quaternion s48 = SMath::DecodeSmallestThree48(st48[i]);
+            Quaternion s16 = SMath::DecodeQuaternionSnorm16(sn16[i]);
+            for (int k = 0; k < 4; ++k)
+            {
+                ASSERT_NEAR(decoded32[i][k], s32[k], 1e-6) << i;
+                ASSERT_NEAR(decoded48[i][k], s48[k], 1e-6) << i;
+                ASSERT_NEAR(decoded16[i][k], s16[k], 1e-6) << i;
+                ASSERT_EQ(decoded32d[i][k], double(decoded32[i][k])) << i;
+                ASSERT_EQ(decoded48d[i][k], double(decoded48[i][k])) << i;
+                ASSERT_EQ(decoded16d[i][k], double(decoded16[i][k])) << i;
+            }
+        }
+    });
+}
@@ -39,4 +39,56 @@ TEST(RectTest, CanCheckIfInBounds)
     EXPECT_FALSE(rect.Contains(299, 600));
     EXPECT_FALSE(rect.Contains(300, 599));
     EXPECT_TRUE(rect.Contains(299, 599));
-}
\ No newline at end of file
+}
+
+TEST(RectTest, CanComputeArea)
+{
+    EXPECT_EQ(SMath::Rect(5, 5, 10, 20).GetArea(), 200);
+    EXPECT_EQ(SMath::Rect(5, 5, 0, 20).GetArea(), 0);
+    EXPECT_EQ(SMath::Rect(5, 5, -3, 20).GetArea(), 0);
+    EXPECT_TRUE(SMath::Rect(5, 5, 10, 0).IsEmpty());
+    EXPECT_TRUE(SMath::Rect<int>().IsEmpty());
+    EXPECT_FLOAT_EQ(SMath::Rect(0.0f, 0.0f, 0.5f, 3.0f).GetArea(), 1.5f);
+}
+
+TEST(RectTest, CanIntersectAndUnion)
+{
+    SMath::Rect a(0, 0, 10, 10);
+    SMath::Rect b(5, -5, 10, 10);
+    EXPECT_TRUE(a.Overlaps(b));
+    EXPECT_EQ(SMath::Rect<int>::Intersection(a, b), SMath::Rect(5, 0, 5, 5));
+    EXPECT_EQ(SMath::Rect<int>::Union(a, b), SMath::Rect(0, -5, 15, 15));
+
+    // Touching edges do not overlap, since rectangles are half-open
+    SMath::Rect c(10, 0, 5, 5);
+    EXPECT_FALSE(a.Overlaps(c));
+    EXPECT_TRUE(SMath::Rect<int>::Intersection(a, c).IsEmpty());
+
+    EXPECT_EQ(SMath::Rect<int>::Union(a, SMath::Rect<int>()), a);
+    EXPECT_EQ(SMath::Rect<int>::Union(SMath::Rect(100, 100, 0, 0), a), a);
+    EXPECT_TRUE(a.Contains(SMath::Rect(2, 2, 8, 8)));
+    EXPECT_FALSE(a.Contains(b));
+}
+
+TEST(RectTest, CanSplit)
+{
+    SMath::Rect rect(10, 20, 30, 40);
+    SMath::Rect<int> first, second;
+
+    rect.Split(0, 25, first, second);
+    EXPECT_EQ(first, SMath::Rect(10, 20, 15, 40));
+    EXPECT_EQ(second, SMath::Rect(25, 20, 15, 40));
+    EXPECT_EQ(first.GetArea() + second.GetArea(), rect.GetArea());
+
+    rect.Split(1, 30, first, second);
+    EXPECT_EQ(first, SMath::Rect(10, 20, 30, 10));
+    EXPECT_EQ(second, SMath::Rect(10, 30, 30, 30));
+
+    // Cuts outside the rectangle are clamped, leaving one side empty
+    rect.Split(0, 100, first, second);
+    EXPECT_EQ(first, rect);
+    EXPECT_TRUE(second.IsEmpty());
+    rect.Split(1, -100, first, second);
+    EXPECT_TRUE(first.IsEmpty());
+    EXPECT_EQ(second, rect);
+}
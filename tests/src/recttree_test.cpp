@@ -0,0 +1,274 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "recttree.h"
+#include "batchops.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    // Mostly small rectangles with a few large ones, like widgets over panels
+    template<typename T>
+    std::vector<SMath::Rect<T>> MakeRects(size_t count, uint32_t seed, float extent)
+    {
+        std::vector<float> u = SMath::Test::Uniform(count * 4, seed, 0.0f, 1.0f);
+
+        std::vector<SMath::Rect<T>> rects(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            float size = i % 50 == 0 ? extent * 0.3f : extent * 0.02f;
+            rects[i] = SMath::Rect<T>(T(u[i * 4] * extent), T(u[i * 4 + 1] * extent),
+                                      T(u[i * 4 + 2] * size), T(u[i * 4 + 3] * size));
+        }
+        return rects;
+    }
+
+    template<typename T>
+    std::vector<uint32_t> BruteForce(const std::vector<SMath::Rect<T>>& rects, const std::vector<bool>& alive, const SMath::Rect<T>& query)
+    {
+        std::vector<uint32_t> ids;
+        for (uint32_t i = 0; i < rects.size(); ++i)
+            if (alive[i] && rects[i].Overlaps(query))
+                ids.push_back(i);
+        return ids;
+    }
+
+    template<typename T>
+    std::vector<uint32_t> BruteForce(const std::vector<SMath::Rect<T>>& rects, const std::vector<bool>& alive, T x, T y)
+    {
+        std::vector<uint32_t> ids;
+        for (uint32_t i = 0; i < rects.size(); ++i)
+            if (alive[i] && rects[i].Contains(x, y))
+                ids.push_back(i);
+        return ids;
+    }
+
+    // Queries against a tree holding the live entries of rects, by id
+    template<typename Tree, typename T>
+    void ExpectMatchesBruteForce(const Tree& tree, const std::vector<SMath::Rect<T>>& rects, const std::vector<bool>& alive, float extent)
+    {
+        for (const SMath::Rect<T>& query : MakeRects<T>(200, 99, extent))
+        {
+            std::vector<uint32_t> ids;
+            tree.FindOverlapping(query, ids);
+            ASSERT_EQ(SMath::Test::Sorted(ids), BruteForce(rects, alive, query));
+
+            ids.clear();
+            tree.FindContaining(query.x, query.y, ids);
+            ASSERT_EQ(SMath::Test::Sorted(ids), BruteForce(rects, alive, query.x, query.y));
+        }
+    }
+
+    // Every node's stored bounds cover its children, and all leaves sit at level 0
+    template<typename T>
+    void ExpectValidTree(const SMath::RTree<T>& tree)
+    {
+        size_t items = 0;
+        std::vector<uint32_t> stack = { tree.m_Root };
+        while (!stack.empty())
+        {
+            const auto& node = tree.m_Nodes[stack.back()];
+            uint32_t index = stack.back();
+            stack.pop_back();
+            for (int slot = 0; slot < SMath::RTree<T>::Width; ++slot)
+            {
+                if (slot >= node.m_Count)
+                {
+                    EXPECT_TRUE(node.m_Bounds.Get(slot).IsEmpty());
+                    continue;
+                }
+
+                uint32_t child = node.m_Children[slot];
+                if (node.m_Level == 0)
+                {
+                    ++items;
+                    EXPECT_EQ(tree.m_Leaves[child], index);
+                    EXPECT_TRUE(node.m_Bounds.Get(slot).Contains(tree.GetRect(child)));
+                    continue;
+                }
+
+                const auto& childNode = tree.m_Nodes[child];
+                EXPECT_EQ(childNode.m_Parent, index);
+                EXPECT_EQ(childNode.m_Level + 1, node.m_Level);
+                for (int i = 0; i < childNode.m_Count; ++i)
+                {
+                    EXPECT_LE(node.m_Bounds.m_MinX[slot], childNode.m_Bounds.m_MinX[i]);
+                    EXPECT_GE(node.m_Bounds.m_MaxY[slot], childNode.m_Bounds.m_MaxY[i]);
+                }
+                stack.push_back(child);
+            }
+        }
+        EXPECT_EQ(items, tree.GetSize());
+    }
+}
+
+TEST(RectTreeTest, CanTestLanes)
+{
+    SMath::RectLanes<float, 4> lanes;
+    lanes.Clear();
+    lanes.Set(0, SMath::Rect(0.0f, 0.0f, 10.0f, 10.0f));
+    lanes.Set(1, SMath::Rect(10.0f, 0.0f, 10.0f, 10.0f));
+    lanes.Set(3, SMath::Rect(5.0f, 5.0f, 0.0f, 10.0f));
+
+    EXPECT_EQ(lanes.Containing(10.0f, 5.0f), 0b0010);
+    EXPECT_EQ(lanes.Containing(9.99f, 0.0f), 0b0001);
+    EXPECT_EQ(lanes.Overlapping(SMath::Rect(9.0f, 9.0f, 2.0f, 2.0f)), 0b0011);
+    EXPECT_EQ(lanes.Overlapping(SMath::Rect(-100.0f, -100.0f, 1000.0f, 1000.0f)), 0b0011);
+    EXPECT_EQ(lanes.Overlapping(SMath::Rect(1.0f, 1.0f, 0.0f, 5.0f)), 0);
+    EXPECT_TRUE(lanes.Get(2).IsEmpty());
+    EXPECT_EQ(lanes.Get(1), SMath::Rect(10.0f, 0.0f, 10.0f, 10.0f));
+
+    SMath::RectLanes<int, 8> ints;
+    ints.Clear();
+    ints.Set(5, SMath::Rect(-3, -3, 6, 6));
+    ints.SetUnion(7, ints, 8);
+    EXPECT_EQ(ints.Containing(2, -3), (1 << 5) | (1 << 7));
+    EXPECT_EQ(ints.Containing(3, 0), 0);
+}
+
+TEST(RectTreeTest, CanBulkLoadRTree)
+{
+    for (size_t count : { size_t(0), size_t(1), size_t(7), size_t(8), size_t(9), size_t(5000) })
+    {
+        auto rects = MakeRects<float>(count, 11, 100.0f);
+        SMath::RTree<float> tree(rects);
+        EXPECT_EQ(tree.GetSize(), count);
+        ExpectValidTree(tree);
+        ExpectMatchesBruteForce(tree, rects, std::vector<bool>(count, true), 100.0f);
+    }
+
+    // Sort-Tile-Recursive packs every node but the last of each level full
+    auto rects = MakeRects<float>(4096, 12, 100.0f);
+    SMath::RTree<float> tree(rects);
+    EXPECT_EQ(tree.GetHeight(), 4u);
+    EXPECT_EQ(tree.m_Nodes.size(), 512u + 64u + 8u + 1u);
+}
+
+TEST(RectTreeTest, CanInsertAndRemoveInRTree)
+{
+    auto rects = MakeRects<int>(3000, 13, 10000.0f);
+    std::vector<bool> alive(rects.size(), false);
+
+    // Start from a bulk load of the first half, grow by inserts, then remove every third
+    std::vector<SMath::Rect<int>> first(rects.begin(), rects.begin() + 1500);
+    SMath::RTree<int> tree(first);
+    std::fill(alive.begin(), alive.begin() + 1500, true);
+    for (size_t i = 1500; i < rects.size(); ++i)
+    {
+        EXPECT_EQ(tree.Insert(rects[i]), i);
+        alive[i] = true;
+    }
+    ExpectValidTree(tree);
+    ExpectMatchesBruteForce(tree, rects, alive, 10000.0f);
+
+    for (uint32_t i = 0; i < rects.size(); i += 3)
+    {
+        EXPECT_TRUE(tree.Remove(i));
+        alive[i] = false;
+    }
+    EXPECT_FALSE(tree.Remove(0));
+    EXPECT_FALSE(tree.Remove(100000));
+    EXPECT_EQ(tree.GetSize(), 2000u);
+    ExpectValidTree(tree);
+    ExpectMatchesBruteForce(tree, rects, alive, 10000.0f);
+
+    // Freed ids are handed out again
+    uint32_t id = tree.Insert(SMath::Rect(1, 2, 3, 4));
+    EXPECT_EQ(id % 3, 0u);
+    EXPECT_EQ(tree.GetRect(id), SMath::Rect(1, 2, 3, 4));
+    EXPECT_TRUE(tree.Remove(id));
+
+    for (uint32_t i = 0; i < rects.size(); ++i)
+        if (alive[i])
+            tree.Remove(i);
+    EXPECT_EQ(tree.GetSize(), 0u);
+    EXPECT_EQ(tree.GetHeight(), 1u);
+    EXPECT_TRUE(tree.GetBounds().IsEmpty());
+}
+
+TEST(RectTreeTest, CanGrowRTreeFromEmpty)
+{
+    auto rects = MakeRects<float>(2000, 14, 50.0f);
+    SMath::RTree<float> tree;
+    for (const SMath::Rect<float>& rect : rects)
+        tree.Insert(rect);
+
+    EXPECT_GT(tree.GetHeight(), 2u);
+    ExpectValidTree(tree);
+    ExpectMatchesBruteForce(tree, rects, std::vector<bool>(rects.size(), true), 50.0f);
+}
+
+TEST(RectTreeTest, CanInsertAndRemoveInLooseQuadtree)
+{
+    auto rects = MakeRects<float>(3000, 15, 100.0f);
+    std::vector<bool> alive(rects.size(), true);
+
+    SMath::LooseQuadtree<float> tree(SMath::Rect(0.0f, 0.0f, 100.0f, 100.0f), 6);
+    for (size_t i = 0; i < rects.size(); ++i)
+        EXPECT_EQ(tree.Insert(rects[i]), i);
+    EXPECT_EQ(tree.GetSize(), rects.size());
+    EXPECT_EQ(tree.m_Nodes[0].m_Count, rects.size());
+    ExpectMatchesBruteForce(tree, rects, alive, 100.0f);
+
+    for (uint32_t i = 1; i < rects.size(); i += 2)
+    {
+        EXPECT_TRUE(tree.Remove(i));
+        alive[i] = false;
+    }
+    EXPECT_FALSE(tree.Remove(1));
+    ExpectMatchesBruteForce(tree, rects, alive, 100.0f);
+
+    // Emptying the tree frees every node but the root
+    for (uint32_t i = 0; i < rects.size(); i += 2)
+        EXPECT_TRUE(tree.Remove(i));
+    EXPECT_EQ(tree.GetSize(), 0u);
+    EXPECT_EQ(tree.m_FreeNodes.size(), tree.m_Nodes.size() - 1);
+    EXPECT_EQ(tree.m_Nodes[0].m_Bounds.Overlapping(SMath::Rect(0.0f, 0.0f, 100.0f, 100.0f)), 0);
+}
+
+TEST(RectTreeTest, CanPlaceItemsInLooseQuadtree)
+{
+    SMath::LooseQuadtree<int> tree(SMath::Rect(0, 0, 1024, 1024), 4);
+    EXPECT_EQ(tree.GetLooseBounds(1, 1, 0), SMath::Rect(256, -256, 1024, 1024));
+    EXPECT_EQ(tree.GetLooseBounds(4, 0, 0), SMath::Rect(-32, -32, 128, 128));
+
+    // A small item goes to the deepest level, a large one stays near the root
+    uint32_t small = tree.Insert(SMath::Rect(10, 10, 20, 20));
+    uint32_t large = tree.Insert(SMath::Rect(100, 100, 600, 300));
+    uint32_t outside = tree.Insert(SMath::Rect(5000, -5000, 10, 10));
+    EXPECT_NE(tree.m_ItemNodes[small], 0u);
+    EXPECT_EQ(tree.m_ItemNodes[outside], 0u);
+
+    std::vector<uint32_t> ids;
+    tree.FindContaining(5005, -4995, ids);
+    EXPECT_EQ(ids, std::vector<uint32_t>({ outside }));
+
+    ids.clear();
+    tree.FindOverlapping(SMath::Rect(0, 0, 120, 120), ids);
+    EXPECT_EQ(SMath::Test::Sorted(ids), std::vector<uint32_t>({ small, large }));
+
+    ids.clear();
+    tree.FindContaining(30, 30, ids);
+    EXPECT_TRUE(ids.empty());
+}
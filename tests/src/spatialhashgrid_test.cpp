@@ -0,0 +1,186 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "spatialhashgrid.h"
+
+#include <vector>
+#include <algorithm>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    std::vector<uint32_t> BruteForce(const std::vector<Point3f>& points, const Point3f& query, float radius)
+    {
+        std::vector<uint32_t> indices;
+        for (uint32_t i = 0; i < points.size(); ++i)
+        {
+            SMath::Vector<float, 3> offset = points[i] - query;
+            if (offset.x * offset.x + offset.y * offset.y + offset.z * offset.z <= radius * radius)
+                indices.push_back(i);
+        }
+        return indices;
+    }
+}
+
+TEST(SpatialHashGridTest, CanBuildCompactLayout)
+{
+    auto points = SMath::Test::UniformPoints(10000, 1, -20.0f, 20.0f);
+    SMath::SpatialHashGrid<float> grid(points, 0.5f);
+    EXPECT_EQ(grid.GetSize(), points.size());
+    EXPECT_EQ(grid.m_CellStart.front(), 0u);
+    EXPECT_EQ(grid.m_CellStart.back(), points.size());
+
+    // Every point is stored once, in the bucket of its cell, in input order on one thread
+    std::vector<int> seen(points.size(), 0);
+    for (size_t bucket = 0; bucket + 1 < grid.m_CellStart.size(); ++bucket)
+    {
+        for (uint32_t i = grid.m_CellStart[bucket]; i < grid.m_CellStart[bucket + 1]; ++i)
+        {
+            uint32_t index = grid.m_Indices[i];
+            ++seen[index];
+            EXPECT_EQ(grid.GetBucket(grid.GetCell(points[index])), bucket);
+            EXPECT_EQ(grid.m_Points[i], points[index]);
+            if (i > grid.m_CellStart[bucket])
+            {
+                EXPECT_LT(grid.m_Indices[i - 1], index);
+            }
+        }
+    }
+
+    for (int count : seen)
+        EXPECT_EQ(count, 1);
+}
+
+TEST(SpatialHashGridTest, CanQuantizeToCells)
+{
+    std::vector<Point3f> none;
+    SMath::SpatialHashGrid<float> grid(none, 2.0f);
+    EXPECT_EQ(grid.GetCell(Point3f(0.0f, 1.99f, 2.0f)), (SMath::Point<int, 3>(0, 0, 1)));
+    EXPECT_EQ(grid.GetCell(Point3f(-0.01f, -2.0f, -2.01f)), (SMath::Point<int, 3>(-1, -1, -2)));
+
+    // Cells along x are adjacent buckets
+    EXPECT_EQ((grid.GetBucket(SMath::Point<int, 3>(8, -3, 5)) + 1) & grid.m_BucketMask, grid.GetBucket(SMath::Point<int, 3>(9, -3, 5)));
+
+    std::vector<uint32_t> indices;
+    EXPECT_EQ(grid.FindInRadius(Point3f(0.0f), 10.0f, indices), 0u);
+}
+
+TEST(SpatialHashGridTest, CanFindInRadius)
+{
+    auto points = SMath::Test::UniformPoints(20000, 2, -10.0f, 10.0f);
+    SMath::SpatialHashGrid<float> grid(points, 0.4f);
+
+    for (float radius : { 0.1f, 0.4f, 1.3f })
+    {
+        for (const Point3f& query : SMath::Test::UniformPoints(100, 3, -11.0f, 11.0f))
+        {
+            std::vector<uint32_t> indices;
+            grid.FindInRadius(query, radius, indices);
+            EXPECT_EQ(SMath::Test::Sorted(indices), BruteForce(points, query, radius));
+        }
+    }
+
+    // A small table, where rows of cells wrap around the end of it
+    auto few = SMath::Test::UniformPoints(16, 4, -2.0f, 2.0f);
+    SMath::SpatialHashGrid<float> small(few, 0.5f);
+    for (const Point3f& query : SMath::Test::UniformPoints(200, 5, -2.0f, 2.0f))
+    {
+        std::vector<uint32_t> indices;
+        small.FindInRadius(query, 0.6f, indices);
+        EXPECT_EQ(SMath::Test::Sorted(indices), BruteForce(few, query, 0.6f));
+    }
+
+    // Wider than the table: every bucket is scanned once
+    std::vector<uint32_t> all;
+    grid.FindInRadius(Point3f(0.0f), 100.0f, all);
+    EXPECT_EQ(all.size(), points.size());
+}
+
+TEST(SpatialHashGridTest, CanVisitNeighbours)
+{
+    std::vector<Point3f> points = { Point3f(0.0f), Point3f(0.3f, 0.0f, 0.0f), Point3f(0.0f, -0.5f, 0.0f), Point3f(5.0f) };
+    SMath::SpatialHashGrid<float> grid(points, 0.5f);
+
+    float total = 0.0f;
+    int visited = 0;
+    grid.ForEachInRadius(Point3f(0.0f), 0.5f, [&](uint32_t index, float squareDistance) {
+        EXPECT_NE(index, 3u);
+        total += squareDistance;
+        ++visited;
+    });
+    EXPECT_EQ(visited, 3);
+    EXPECT_FLOAT_EQ(total, 0.09f + 0.25f);
+}
+
+TEST(SpatialHashGridTest, ParallelBuildMatchesSerialBuild)
+{
+    auto points = SMath::Test::UniformPoints(SMath::Simd::MinParallelChunk * 2 + 5, 4, -30.0f, 30.0f);
+    SMath::SpatialHashGrid<float> serial(points, 0.25f, 1);
+    SMath::SpatialHashGrid<float> parallel(points, 0.25f, 4);
+
+    EXPECT_EQ(serial.m_CellStart, parallel.m_CellStart);
+    for (size_t bucket = 0; bucket + 1 < serial.m_CellStart.size(); ++bucket)
+    {
+        auto begin = serial.m_CellStart[bucket];
+        auto end = serial.m_CellStart[bucket + 1];
+        std::vector<uint32_t> a(serial.m_Indices.begin() + begin, serial.m_Indices.begin() + end);
+        std::vector<uint32_t> b(parallel.m_Indices.begin() + begin, parallel.m_Indices.begin() + end);
+        ASSERT_EQ(a, SMath::Test::Sorted(b));
+    }
+}
+
+TEST(SpatialHashGridTest, BatchQueriesMatchSingleQueries)
+{
+    auto points = SMath::Test::UniformPoints(30000, 5, -10.0f, 10.0f);
+    auto queries = SMath::Test::UniformPoints(2049, 6, -10.0f, 10.0f);
+    SMath::SpatialHashGrid<float> grid(points, 0.5f);
+
+    for (int threads : { 1, 3 })
+    {
+        std::vector<uint32_t> indices;
+        std::vector<size_t> offsets;
+        grid.FindInRadius(queries, 0.5f, indices, offsets, threads);
+        ASSERT_EQ(offsets.size(), queries.size() + 1);
+        ASSERT_EQ(offsets.back(), indices.size());
+
+        for (size_t q = 0; q < queries.size(); ++q)
+        {
+            std::vector<uint32_t> single;
+            grid.FindInRadius(queries[q], 0.5f, single);
+            std::vector<uint32_t> batch(indices.begin() + offsets[q], indices.begin() + offsets[q + 1]);
+            ASSERT_EQ(batch, single);
+        }
+    }
+}
+
+TEST(SpatialHashGridTest, CanUseDoublePoints)
+{
+    std::vector<SMath::Point3> points;
+    for (int i = 0; i < 1000; ++i)
+        points.emplace_back(i * 0.01, -i * 0.02, 1e3);
+
+    SMath::SpatialHashGrid<double> grid(points, 0.05);
+    std::vector<uint32_t> indices;
+    grid.FindInRadius(SMath::Point3(5.0, -10.0, 1e3), 0.0225, indices);
+    EXPECT_EQ(SMath::Test::Sorted(indices), std::vector<uint32_t>({ 499, 500, 501 }));
+}
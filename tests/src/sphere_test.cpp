@@ -0,0 +1,249 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "testutils.h"
+#include "sphere.h"
+#include "transform.h"
+
+#include <vector>
+
+namespace
+{
+    typedef SMath::Point<float, 3> Point3f;
+
+    // Points on an ellipsoid shell, plus interior points, in a scrambled order
+    std::vector<Point3f> Cloud(int count)
+    {
+        std::vector<float> u = SMath::Test::Uniform(count * 3, 3, -1.0f, 1.0f);
+
+        std::vector<Point3f> points(count);
+        for (int i = 0; i < count; ++i)
+        {
+            SMath::Vector<float, 3> d(u[i * 3], u[i * 3 + 1], u[i * 3 + 2]);
+            float scale = i % 4 == 0 ? 1.0f / d.Magnitude() : 0.9f;
+            points[i] = Point3f(5.0f + d.x * scale * 3.0f, -2.0f + d.y * scale * 2.0f, 1.0f + d.z * scale);
+        }
+        return points;
+    }
+
+    template <typename T>
+    bool CoversAll(const SMath::Sphere<T>& sphere, const std::vector<SMath::Point<T, 3>>& points)
+    {
+        SMath::Sphere<T> padded(sphere.m_Center, sphere.m_Radius * T(1.00001));
+        for (const auto& p : points)
+            if (!padded.Contains(p))
+                return false;
+        return true;
+    }
+}
+
+TEST(SphereTest, CanBeCreated)
+{
+    SMath::Sphere<double> sphere(SMath::Point3(1, 2, 3), 4);
+    EXPECT_EQ(sphere.m_Center, SMath::Point3(1, 2, 3));
+    EXPECT_EQ(sphere.m_Radius, 4.0);
+}
+
+TEST(SphereTest, CanCheckContainment)
+{
+    SMath::Sphere<double> sphere(SMath::Point3(0, 0, 0), 2);
+
+    EXPECT_TRUE(sphere.Contains(SMath::Point3(0, 2, 0)));
+    EXPECT_TRUE(sphere.Contains(SMath::Point3(1, 1, 1)));
+    EXPECT_FALSE(sphere.Contains(SMath::Point3(1.2, 1.2, 1.2)));
+
+    EXPECT_TRUE(sphere.Contains(SMath::Sphere<double>(SMath::Point3(1, 0, 0), 1)));
+    EXPECT_FALSE(sphere.Contains(SMath::Sphere<double>(SMath::Point3(1, 0, 0), 1.5)));
+}
+
+TEST(SphereTest, CanCheckIntersection)
+{
+    SMath::Sphere<double> sphere(SMath::Point3(0, 0, 0), 1);
+
+    EXPECT_TRUE(sphere.Intersects(SMath::Sphere<double>(SMath::Point3(2, 0, 0), 1)));
+    EXPECT_FALSE(sphere.Intersects(SMath::Sphere<double>(SMath::Point3(2.1, 0, 0), 1)));
+
+    EXPECT_TRUE(sphere.Intersects(SMath::Box(SMath::Point3(0.5, 0.5, -1), SMath::Point3(2, 2, 1))));
+    EXPECT_FALSE(sphere.Intersects(SMath::Box(SMath::Point3(0.8, 0.8, -1), SMath::Point3(2, 2, 1))));
+    EXPECT_TRUE(sphere.Intersects(SMath::Box(SMath::Point3(-5, -5, -5), SMath::Point3(5, 5, 5))));
+}
+
+TEST(SphereTest, CanIntersectRay)
+{
+    SMath::Sphere<double> sphere(SMath::Point3(0, 0, 10), 2);
+    double t;
+
+    EXPECT_TRUE(sphere.Intersects(SMath::Ray<double>(SMath::Point3(0, 0, 0), SMath::Vector3(0, 0, 1)), t));
+    EXPECT_DOUBLE_EQ(t, 8.0);
+
+    EXPECT_TRUE(sphere.Intersects(SMath::Ray<double>(SMath::Point3(0, 1, 0), SMath::Vector3(0, 0, 1)), t));
+    EXPECT_NEAR(t, 10.0 - std::sqrt(3.0), 1e-12);
+
+    // From inside, the far side is hit
+    EXPECT_TRUE(sphere.Intersects(SMath::Ray<double>(SMath::Point3(0, 0, 10), SMath::Vector3(1, 0, 0)), t));
+    EXPECT_DOUBLE_EQ(t, 2.0);
+
+    EXPECT_FALSE(sphere.Intersects(SMath::Ray<double>(SMath::Point3(0, 0, 0), SMath::Vector3(0, 0, -1)), t));
+    EXPECT_FALSE(sphere.Intersects(SMath::Ray<double>(SMath::Point3(3, 0, 0), SMath::Vector3(0, 0, 1)), t));
+    EXPECT_FALSE(sphere.Intersects(SMath::Ray<double>(SMath::Point3(0, 0, 0), SMath::Vector3(0, 0, 1), 0.0, 5.0), t));
+}
+
+TEST(SphereTest, RayIsAccurateAtLargeDistances)
+{
+    typedef SMath::Vector<float, 3> Vector3f;
+
+    // A unit sphere seen from far away in float. b^2 - ac cancels every digit of the
+    // discriminant here; the hit distance must stay within float rounding of the distance.
+    for (double distance : { 1e2, 1e3, 1e4, 1e5 })
+    {
+        for (double offset : { 0.0, 0.5, 0.9 })
+        {
+            SCOPED_TRACE(distance);
+            Vector3f direction = Vector3f(1.0f, 2.0f, 2.0f).Normalized();
+            Vector3f side = Vector3f::Cross(direction, Vector3f(0.0f, 0.0f, 1.0f)).Normalized();
+            Point3f center(3.0f, -4.0f, 1.0f);
+            Point3f origin = center - direction * float(distance) + side * float(offset);
+
+            SMath::Sphere<float> sphere(center, 1.0f);
+            float t;
+            ASSERT_TRUE(sphere.Intersects(SMath::Ray<float>(origin, direction), t));
+            EXPECT_NEAR(t, distance - std::sqrt(1.0 - offset * offset), distance * 1e-6);
+        }
+    }
+
+    // Grazing rays within and outside the radius still resolve at 1e4
+    SMath::Sphere<float> sphere(Point3f(0.0f, 0.0f, 1e4f), 1.0f);
+    float t;
+    EXPECT_TRUE(sphere.Intersects(SMath::Ray<float>(Point3f(0.99f, 0.0f, 0.0f), Vector3f(0.0f, 0.0f, 1.0f)), t));
+    EXPECT_FALSE(sphere.Intersects(SMath::Ray<float>(Point3f(1.01f, 0.0f, 0.0f), Vector3f(0.0f, 0.0f, 1.0f)), t));
+}
+
+TEST(SphereTest, CanBeTransformed)
+{
+    SMath::Sphere<double> sphere(SMath::Point3(1, 0, 0), 1);
+    auto m = SMath::Transform<double>::GetTranslationMatrix(SMath::Vector3(0, 5, 0)) *
+             SMath::Transform<double>::GetRotationMatrix(SMath::Quaternion<double>::FromAxisAngle(SMath::Vector3(0, 0, 1), SMath::Pi / 2)) *
+             SMath::Transform<double>::GetScaleMatrix(SMath::Vector3(1, 3, 2));
+
+    auto transformed = sphere.Transformed(m);
+    EXPECT_NEAR(transformed.m_Center.x, 0.0, 1e-12);
+    EXPECT_NEAR(transformed.m_Center.y, 6.0, 1e-12);
+    EXPECT_NEAR(transformed.m_Center.z, 0.0, 1e-12);
+    EXPECT_NEAR(transformed.m_Radius, 3.0, 1e-12);
+}
+
+TEST(SphereTest, CanUnion)
+{
+    SMath::Sphere<double> a(SMath::Point3(0, 0, 0), 1);
+    SMath::Sphere<double> b(SMath::Point3(4, 0, 0), 1);
+
+    auto u = SMath::Sphere<double>::Union(a, b);
+    EXPECT_EQ(u.m_Center, SMath::Point3(2, 0, 0));
+    EXPECT_EQ(u.m_Radius, 3.0);
+    EXPECT_TRUE(u.Contains(a) && u.Contains(b));
+
+    SMath::Sphere<double> inner(SMath::Point3(0.5, 0, 0), 0.25);
+    EXPECT_EQ(SMath::Sphere<double>::Union(a, inner).m_Radius, 1.0);
+    EXPECT_EQ(SMath::Sphere<double>::Union(inner, a).m_Radius, 1.0);
+}
+
+TEST(SphereTest, CanFitPoints)
+{
+    // Vertices of a cube: the minimum sphere has radius sqrt(3)
+    std::vector<SMath::Point3> cube;
+    for (int i = 0; i < 8; ++i)
+        cube.emplace_back(i & 1 ? 1.0 : -1.0, i & 2 ? 1.0 : -1.0, i & 4 ? 1.0 : -1.0);
+
+    auto ritter = SMath::Sphere<double>::FitRitter(cube);
+    auto epos = SMath::Sphere<double>::FitEpos6(cube);
+    EXPECT_TRUE(CoversAll(ritter, cube));
+    EXPECT_TRUE(CoversAll(epos, cube));
+    EXPECT_LE(ritter.m_Radius, std::sqrt(3.0) * 1.4);
+    EXPECT_LE(epos.m_Radius, std::sqrt(3.0) * 1.2);
+
+    // Octahedron: the six extremes are the vertices, so EPOS-6 is exact
+    std::vector<SMath::Point3> octahedron = {
+        SMath::Point3(3, 0, 0), SMath::Point3(-1, 0, 0), SMath::Point3(1, 2, 0),
+        SMath::Point3(1, -2, 0), SMath::Point3(1, 0, 2), SMath::Point3(1, 0, -2)
+    };
+    epos = SMath::Sphere<double>::FitEpos6(octahedron);
+    EXPECT_NEAR(epos.m_Center.x, 1.0, 1e-12);
+    EXPECT_NEAR(epos.m_Radius, 2.0, 1e-12);
+
+    // A single point
+    auto single = SMath::Sphere<double>::FitEpos6(std::vector<SMath::Point3>{ SMath::Point3(1, 2, 3) });
+    EXPECT_EQ(single.m_Center, SMath::Point3(1, 2, 3));
+    EXPECT_EQ(single.m_Radius, 0.0);
+}
+
+TEST(SphereTest, ExtremePointsTieToTheEarliestPoint)
+{
+    // Repeated extremes land in different lanes and blocks; z tells the points apart
+    std::vector<SMath::Point<float, 3>> points(103);
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        float x = i % 7 == 5 ? -1.0f : (i % 9 == 4 ? 2.0f : 0.0f);
+        float y = i % 11 == 7 ? 5.0f : (i % 13 == 3 ? -4.0f : 0.0f);
+        points[i] = SMath::Point<float, 3>(x, y, float(i));
+    }
+
+    SMath::Test::ForEachLevel([&]() {
+        auto extremes = SMath::Batch::ExtremePoints(points);
+        EXPECT_EQ(extremes[0].z, 5.0f);
+        EXPECT_EQ(extremes[1].z, 4.0f);
+        EXPECT_EQ(extremes[2].z, 3.0f);
+        EXPECT_EQ(extremes[3].z, 7.0f);
+        EXPECT_EQ(extremes[4].z, 0.0f);
+        EXPECT_EQ(extremes[5].z, 102.0f);
+    });
+}
+
+TEST(SphereTest, FitsMatchOnEveryLevel)
+{
+    auto points = Cloud(10007);
+    std::vector<SMath::Point3> pointsd(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+        pointsd[i] = SMath::Point3(points[i].x, points[i].y, points[i].z);
+
+    auto reference = SMath::Sphere<double>::FitEpos6(pointsd);
+    EXPECT_TRUE(CoversAll(reference, pointsd));
+    EXPECT_LE(reference.m_Radius, 3.0 * 1.1);
+
+    SMath::Test::ForEachLevel([&]() {
+        auto extremes = SMath::Batch::ExtremePoints(points);
+        for (const auto& p : points)
+        {
+            EXPECT_GE(p.x, extremes[0].x);
+            EXPECT_LE(p.x, extremes[1].x);
+            EXPECT_GE(p.y, extremes[2].y);
+            EXPECT_LE(p.y, extremes[3].y);
+            EXPECT_GE(p.z, extremes[4].z);
+            EXPECT_LE(p.z, extremes[5].z);
+        }
+
+        auto ritter = SMath::Sphere<float>::FitRitter(points);
+        auto epos = SMath::Sphere<float>::FitEpos6(points);
+        EXPECT_TRUE(CoversAll(ritter, points));
+        EXPECT_TRUE(CoversAll(epos, points));
+        EXPECT_LE(ritter.m_Radius, reference.m_Radius * 1.2);
+        EXPECT_NEAR(epos.m_Radius, reference.m_Radius, reference.m_Radius * 1e-4);
+    });
+}
@@ -0,0 +1,109 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include "gtest.h"
+#include "batchops.h"
+#include "ray.h"
+
+#include <span>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+
+// Fixtures shared by the tests of the batch and spatial code
+namespace SMath::Test
+{
+    // Runs test once per SIMD level the host supports, restoring the detected level after
+    template <typename Func>
+    inline void ForEachLevel(Func test)
+    {
+        const Simd::Level levels[] = { Simd::Level::Scalar, Simd::Level::Sse2, Simd::Level::Avx2, Simd::Level::Avx512 };
+        for (Simd::Level level : levels)
+        {
+            if (level > Simd::GetSupportedLevel())
+                continue;
+
+            SCOPED_TRACE(Simd::GetLevelName(level));
+            Simd::SetLevel(level);
+            test();
+        }
+
+        Simd::ResetLevel();
+    }
+
+    // Uniform floats in [lo, hi), the same for a seed on every level
+    inline std::vector<float> Uniform(size_t count, uint32_t seed, float lo, float hi)
+    {
+        std::vector<float> u(count);
+        Batch::FillUniform(std::span<float>(u), seed, lo, hi);
+        return u;
+    }
+
+    inline std::vector<Point<float, 3>> UniformPoints(size_t count, uint32_t seed, float lo, float hi)
+    {
+        std::vector<float> u = Uniform(count * 3, seed, lo, hi);
+        std::vector<Point<float, 3>> points(count);
+        for (size_t i = 0; i < count; ++i)
+            points[i] = Point<float, 3>(u[i * 3], u[i * 3 + 1], u[i * 3 + 2]);
+        return points;
+    }
+
+    // Small boxes scattered through [-scale, scale]^3, with sizes varying over two orders of magnitude
+    inline std::vector<Box<float>> RandomBoxes(size_t count, float scale, uint32_t seed)
+    {
+        std::vector<float> u = Uniform(count * 6, seed, 0.0f, 1.0f);
+        std::vector<Box<float>> boxes(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float* r = &u[i * 6];
+            Point<float, 3> center((r[0] * 2 - 1) * scale, (r[1] * 2 - 1) * scale, (r[2] * 2 - 1) * scale);
+            Vector<float, 3> half(r[3] * r[3] * scale * 0.05f + scale * 0.0005f, r[4] * scale * 0.02f, r[5] * scale * 0.02f);
+            boxes[i] = Box<float>(center - half, center + half);
+        }
+        return boxes;
+    }
+
+    // Rays from within 1.2 * scale of the offset in random directions, every eighth along x
+    inline std::vector<Ray<float>> RandomRays(size_t count, float scale, uint32_t seed, Vector<float, 3> offset = Vector<float, 3>(0.0f))
+    {
+        std::vector<float> u = Uniform(count * 6, seed, -1.0f, 1.0f);
+        std::vector<Ray<float>> rays;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float* r = &u[i * 6];
+            Vector<float, 3> direction(r[3], r[4], r[5]);
+            if (i % 8 == 0)
+                direction = Vector<float, 3>(r[3], 0.0f, 0.0f);
+            if (direction.SquareMagnitude() == 0.0f)
+                continue;
+
+            rays.emplace_back(Point<float, 3>(r[0] * scale * 1.2f, r[1] * scale * 1.2f, r[2] * scale * 1.2f) + offset, direction, 0.0f, 1e30f);
+        }
+        return rays;
+    }
+
+    inline std::vector<uint32_t> Sorted(std::vector<uint32_t> v)
+    {
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+}
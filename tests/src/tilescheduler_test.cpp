@@ -0,0 +1,149 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "tilescheduler.h"
+
+#include <vector>
+#include <atomic>
+#include <cstdlib>
+
+namespace
+{
+    const SMath::TileOrder Orders[] = { SMath::TileOrder::RowMajor, SMath::TileOrder::Spiral,
+                                        SMath::TileOrder::Hilbert, SMath::TileOrder::Morton };
+
+    // Consecutive tiles of equal size share an edge
+    bool AreAdjacent(const SMath::Rect<int>& a, const SMath::Rect<int>& b)
+    {
+        return (a.y == b.y && std::abs(a.x - b.x) == a.w) || (a.x == b.x && std::abs(a.y - b.y) == a.h);
+    }
+}
+
+TEST(TileSchedulerTest, CanCoverAreaOnce)
+{
+    SMath::Rect area(3, -2, 103, 61);
+    for (SMath::TileOrder order : Orders)
+    {
+        auto tiles = SMath::TileScheduler<int>::GenerateTiles(area, 16, 8, order);
+        ASSERT_EQ(tiles.size(), 7u * 8u);
+
+        std::vector<int> covered(area.GetArea(), 0);
+        for (const SMath::Rect<int>& tile : tiles)
+        {
+            EXPECT_FALSE(tile.IsEmpty());
+            EXPECT_TRUE(area.Contains(tile));
+            for (int y = tile.y; y < tile.y + tile.h; ++y)
+                for (int x = tile.x; x < tile.x + tile.w; ++x)
+                    ++covered[(y - area.y) * area.w + (x - area.x)];
+        }
+
+        for (int count : covered)
+            ASSERT_EQ(count, 1);
+    }
+
+    EXPECT_TRUE(SMath::TileScheduler<int>::GenerateTiles(SMath::Rect(0, 0, 0, 10), 4, 4, SMath::TileOrder::Hilbert).empty());
+}
+
+TEST(TileSchedulerTest, CanOrderTiles)
+{
+    SMath::Rect area(0, 0, 256, 256);
+
+    auto rowMajor = SMath::TileScheduler<int>::GenerateTiles(area, 32, 32, SMath::TileOrder::RowMajor);
+    EXPECT_EQ(rowMajor[1], SMath::Rect(32, 0, 32, 32));
+    EXPECT_EQ(rowMajor[8], SMath::Rect(0, 32, 32, 32));
+
+    auto morton = SMath::TileScheduler<int>::GenerateTiles(area, 32, 32, SMath::TileOrder::Morton);
+    EXPECT_EQ(morton[0], SMath::Rect(0, 0, 32, 32));
+    EXPECT_EQ(morton[1], SMath::Rect(32, 0, 32, 32));
+    EXPECT_EQ(morton[2], SMath::Rect(0, 32, 32, 32));
+    EXPECT_EQ(morton[3], SMath::Rect(32, 32, 32, 32));
+    EXPECT_EQ(morton[4], SMath::Rect(64, 0, 32, 32));
+
+    // The Hilbert curve never jumps on a power of two grid
+    auto hilbert = SMath::TileScheduler<int>::GenerateTiles(area, 32, 32, SMath::TileOrder::Hilbert);
+    EXPECT_EQ(hilbert.front(), SMath::Rect(0, 0, 32, 32));
+    EXPECT_EQ(hilbert.back(), SMath::Rect(224, 0, 32, 32));
+    for (size_t i = 1; i < hilbert.size(); ++i)
+        EXPECT_TRUE(AreAdjacent(hilbert[i - 1], hilbert[i])) << i;
+
+    // Nor does the spiral on an odd square grid
+    auto spiral = SMath::TileScheduler<int>::GenerateTiles(SMath::Rect(0, 0, 50, 50), 10, 10, SMath::TileOrder::Spiral);
+    EXPECT_TRUE(spiral.front().Contains(25, 25));
+    for (size_t i = 1; i < spiral.size(); ++i)
+        EXPECT_TRUE(AreAdjacent(spiral[i - 1], spiral[i])) << i;
+}
+
+TEST(TileSchedulerTest, CanComputeCurveIndices)
+{
+    EXPECT_EQ(SMath::TileScheduler<int>::GetMortonIndex(0, 0), 0u);
+    EXPECT_EQ(SMath::TileScheduler<int>::GetMortonIndex(1, 0), 1u);
+    EXPECT_EQ(SMath::TileScheduler<int>::GetMortonIndex(0, 1), 2u);
+    EXPECT_EQ(SMath::TileScheduler<int>::GetMortonIndex(0xffffffffu, 0xffffffffu), ~0ull);
+
+    std::vector<int> seen(16 * 16, 0);
+    for (uint32_t y = 0; y < 16; ++y)
+        for (uint32_t x = 0; x < 16; ++x)
+            ++seen[SMath::TileScheduler<int>::GetHilbertIndex(x, y, 16)];
+    for (int count : seen)
+        EXPECT_EQ(count, 1);
+}
+
+TEST(TileSchedulerTest, CanRunEveryTileOnce)
+{
+    SMath::Rect area(0, 0, 1000, 700);
+    SMath::TileScheduler<int> scheduler(area, 32, 32);
+    ASSERT_EQ(scheduler.GetTileCount(), 32u * 22u);
+
+    for (int threads : { 1, 3, 8, 1000 })
+    {
+        std::vector<std::atomic<int>> visits(scheduler.GetTileCount());
+        std::atomic<int> badThread = 0;
+        scheduler.Run([&](const SMath::Rect<int>& tile, int thread) {
+            if (thread < 0 || thread >= threads)
+                ++badThread;
+
+            // Uneven work, so threads that finish early have to steal
+            volatile int spin = 0;
+            for (int i = 0; i < (tile.x < 200 ? 20000 : 100); ++i)
+                spin = spin + i;
+            ++visits[(tile.y / 32) * 32 + tile.x / 32];
+        }, threads);
+
+        EXPECT_EQ(badThread.load(), 0);
+        for (const std::atomic<int>& count : visits)
+            ASSERT_EQ(count.load(), 1);
+    }
+
+    SMath::TileScheduler<int> empty;
+    empty.Run([](const SMath::Rect<int>&, int) { FAIL(); });
+}
+
+TEST(TileSchedulerTest, CanUseFloatTiles)
+{
+    SMath::Rect area(-1.0f, -1.0f, 2.0f, 2.0f);
+    SMath::TileScheduler<float> scheduler(area, 0.3f, 0.5f, SMath::TileOrder::Morton);
+    ASSERT_EQ(scheduler.GetTileCount(), 7u * 4u);
+
+    float total = 0.0f;
+    for (size_t i = 0; i < scheduler.GetTileCount(); ++i)
+        total += scheduler.GetTile(i).GetArea();
+    EXPECT_NEAR(total, 4.0f, 1e-5f);
+}
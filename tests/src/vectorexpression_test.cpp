@@ -0,0 +1,115 @@
+/*
+    This file is part of SMath, an open-source math library for graphics
+    applications.
+
+    Copyright (c) 2020-2026 Samuel Huang - All rights reserved.
+
+    Spectre is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "gtest.h"
+#include "linalg.h"
+#include "vectorexpression.h"
+
+using SMath::Expression::Lazy;
+using SMath::Expression::Evaluate;
+
+TEST(VectorExpressionTest, CanEvaluateTerminal)
+{
+    SMath::Vector3 a(1, 2, 3);
+    EXPECT_EQ(Evaluate(Lazy(a)), a);
+}
+
+TEST(VectorExpressionTest, MatchesEagerArithmetic)
+{
+    SMath::Vector3 a(1.5, -2, 3);
+    SMath::Vector3 b(0.5, 4, -1);
+    SMath::Vector3 c(2, 2, 2);
+    SMath::Vector3 d(-3, 1, 0.25);
+    SMath::Vector3 e(7, 8, 9);
+
+    EXPECT_EQ(Evaluate(Lazy(a) + b), a + b);
+    EXPECT_EQ(Evaluate(Lazy(a) - b), a - b);
+    EXPECT_EQ(Evaluate(Lazy(a) * b), a * b);
+    EXPECT_EQ(Evaluate(Lazy(a) / b), a / b);
+    EXPECT_EQ(Evaluate(Lazy(a) * b + Lazy(c) * d - e), a * b + c * d - e);
+    EXPECT_EQ(Evaluate(e - Lazy(a) * b), e - a * b);
+    EXPECT_EQ(Evaluate(c + a * Lazy(b)), c + a * b);
+    EXPECT_EQ(Evaluate((Lazy(a) + b) / (Lazy(c) - d)), (a + b) / (c - d));
+    EXPECT_EQ(Evaluate(-(Lazy(a) * b)), -(a * b));
+}
+
+TEST(VectorExpressionTest, CanMixScalars)
+{
+    SMath::Vector4 a(1, 2, 3, 4);
+    SMath::Vector4 b(4, 3, 2, 1);
+
+    EXPECT_EQ(Evaluate(Lazy(a) * 2.0), a * SMath::Vector4(2.0));
+    EXPECT_EQ(Evaluate(0.5 * Lazy(a) + b), a * SMath::Vector4(0.5) + b);
+    EXPECT_EQ(Evaluate(Lazy(a) / 4.0 - b), a / SMath::Vector4(4.0) - b);
+}
+
+TEST(VectorExpressionTest, CanUseDerivedTypes)
+{
+    SMath::Normal3 n(0, 1, 0);
+    SMath::Vector3 v(1, 2, 3);
+
+    EXPECT_EQ(Evaluate(Lazy(v) * n + n), v * n + n);
+}
+
+TEST(VectorExpressionTest, CanAssignToOperand)
+{
+    SMath::Vector2 a(1, 2);
+    SMath::Vector2 b(3, 4);
+
+    SMath::Expression::Assign(a, Lazy(b) * a + a);
+    EXPECT_EQ(a, SMath::Vector2(4, 10));
+}
+
+TEST(VectorExpressionTest, CopiesTemporaryOperands)
+{
+    SMath::Vector3 a(1, 2, 3);
+    SMath::Vector3 b(4, 5, 6);
+    SMath::Vector3 c(-1, 0.5, 2);
+
+    // a * c is an eager temporary that ends with this statement
+    auto e = Lazy(b) * c + a * c;
+    auto f = Lazy(a + b) * c;
+    EXPECT_EQ(Evaluate(e), b * c + a * c);
+    EXPECT_EQ(Evaluate(f), (a + b) * c);
+
+    EXPECT_TRUE((std::is_same_v<decltype(Lazy(a)), SMath::Expression::Terminal<double, 3>>));
+    EXPECT_TRUE((std::is_same_v<decltype(Lazy(a + b)), SMath::Expression::Terminal<double, 3, SMath::Vector3>>));
+}
+
+TEST(VectorExpressionTest, LeavesEagerArithmeticAlone)
+{
+    SMath::Vector3 a(1, 2, 3);
+    SMath::Vector3 b(4, 5, 6);
+
+    // Without Lazy() the result is still a plain Vector
+    auto eager = a * b + a;
+    EXPECT_TRUE((std::is_same_v<decltype(eager), SMath::Vector3>));
+}
+
+TEST(VectorExpressionTest, WorksWithIntegers)
+{
+    SMath::Vector3i a(1, 2, 3);
+    SMath::Vector3i b(4, 5, 6);
+    SMath::Vector3i c = Evaluate(Lazy(a) * b - a);
+
+    EXPECT_EQ(c[0], 3);
+    EXPECT_EQ(c[1], 8);
+    EXPECT_EQ(c[2], 15);
+}